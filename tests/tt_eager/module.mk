@@ -13,12 +13,15 @@ TT_EAGER_TESTS += \
 		 tests/tt_eager/ops/test_layernorm_op \
 		 tests/tt_eager/ops/test_moreh_matmul_op \
 		 tests/tt_eager/ops/test_moreh_layernorm_op \
+		 tests/tt_eager/ops/test_op_profiler_events \
 		 tests/tt_eager/ops/test_transpose_op \
 		 tests/tt_eager/ops/test_transpose_wh_single_core \
 		 tests/tt_eager/ops/test_transpose_wh_multi_core \
 		 tests/tt_eager/ops/test_reduce_op \
 		 tests/tt_eager/ops/test_bcast_op \
 		 tests/tt_eager/ops/test_bmm_op \
+		 tests/tt_eager/ops/test_matmul_tuner \
+		 tests/tt_eager/ops/test_operation_history \
 		 tests/tt_eager/ops/test_pad_op \
 		 tests/tt_eager/ops/test_tilize_op \
 		 tests/tt_eager/ops/test_tilize_zero_padding \
@@ -27,6 +30,8 @@ TT_EAGER_TESTS += \
 		 tests/tt_eager/ops/test_sfpu \
 		 tests/tt_eager/tensors/test_copy_and_move \
 		 tests/tt_eager/tensors/test_host_device_loopback \
+		 tests/tt_eager/tensors/test_host_ingestion \
+		 tests/tt_eager/tensors/test_host_pad_unpad \
 		 tests/tt_eager/tensors/test_raw_host_memory_pointer \
 		 tests/tt_eager/tensors/test_sharded_loopback \
 		 tests/tt_eager/integration_tests/test_bert \
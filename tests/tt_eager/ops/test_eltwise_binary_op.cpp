@@ -105,6 +105,13 @@ int main() {
     tt::tt_metal::program_cache::enable();
 
     run_binary_ops();
+    // Every op of a run looks up the cache once, each distinct program misses once
+    auto statistics = tt::tt_metal::program_cache::statistics();
+    const auto num_lookups_per_run = statistics.hits + statistics.misses;
+    const auto num_programs = tt::tt_metal::program_cache::num_entries();
+    TT_FATAL(num_programs > 2 and num_programs < num_lookups_per_run, "There are {} entries", num_programs);
+    TT_FATAL(statistics.misses == num_programs, "There are {} misses", statistics.misses);
+
     run_binary_ops();
 
     // Allocate a tensor to show that the addresses aren't cached
@@ -113,10 +120,38 @@ int main() {
 
     run_binary_ops();
 
-    TT_FATAL(tt::tt_metal::program_cache::num_entries() == 4,
+    TT_FATAL(tt::tt_metal::program_cache::num_entries() == num_programs,
         "There are {} entries",
         tt::tt_metal::program_cache::num_entries());
 
+    // Later runs only hit
+    statistics = tt::tt_metal::program_cache::statistics();
+    TT_FATAL(statistics.misses == num_programs, "There are {} misses", statistics.misses);
+    TT_FATAL(statistics.hits == 3 * num_lookups_per_run - num_programs, "There are {} hits", statistics.hits);
+    TT_FATAL(statistics.evictions == 0, "There are {} evictions", statistics.evictions);
+
+    // Bound the cache below the working set so programs get evicted and recompiled
+    tt::tt_metal::program_cache::configure({.max_entries = 2});
+    TT_FATAL(tt::tt_metal::program_cache::num_entries() == 2);
+    const auto previous_statistics = tt::tt_metal::program_cache::statistics();
+    TT_FATAL(previous_statistics.evictions == num_programs - 2, "There are {} evictions", previous_statistics.evictions);
+
+    run_binary_ops();
+
+    // The full cache evicts a program for every miss
+    statistics = tt::tt_metal::program_cache::statistics();
+    const auto num_misses = statistics.misses - previous_statistics.misses;
+    TT_FATAL(tt::tt_metal::program_cache::num_entries() == 2);
+    TT_FATAL(statistics.hits + num_misses == previous_statistics.hits + num_lookups_per_run);
+    TT_FATAL(num_misses > 0, "There are {} misses", num_misses);
+    TT_FATAL(
+        statistics.evictions == previous_statistics.evictions + num_misses,
+        "There are {} evictions",
+        statistics.evictions);
+    TT_FATAL(statistics.reinsertions > 0, "There are {} reinsertions", statistics.reinsertions);
+    TT_FATAL(not tt::tt_metal::program_cache::thrashing_programs().empty());
+
+    tt::tt_metal::program_cache::configure({});
     tt::tt_metal::program_cache::disable_and_clear();
 
     TT_FATAL(tt::tt_metal::program_cache::num_entries() == 0);
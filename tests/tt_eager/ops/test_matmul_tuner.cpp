@@ -0,0 +1,246 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <filesystem>
+#include <variant>
+
+#include "common/constants.hpp"
+#include "tt_dnn/op_library/bmm/matmul_tuner.hpp"
+
+using tt::operations::primary::MatmulMultiCoreReuseMultiCast1DProgramConfig;
+using tt::operations::primary::MatmulMultiCoreReuseMultiCastProgramConfig;
+using tt::operations::primary::MatmulProblem;
+using tt::operations::primary::MatmulProgramConfig;
+using tt::operations::primary::MatmulTuningDatabase;
+using tt::tt_metal::DataType;
+using tt::tt_metal::TensorMemoryLayout;
+
+namespace {
+
+// Grid and unreserved L1 of a Grayskull core
+MatmulProblem create_problem(uint32_t M, uint32_t K, uint32_t N, TensorMemoryLayout output_memory_layout = TensorMemoryLayout::INTERLEAVED) {
+    return MatmulProblem{
+        .M = M,
+        .K = K,
+        .N = N,
+        .in0_dtype = DataType::BFLOAT16,
+        .in1_dtype = DataType::BFLOAT8_B,
+        .output_dtype = DataType::BFLOAT16,
+        .math_fidelity = MathFidelity::LoFi,
+        .fp32_dest_acc_en = false,
+        .packer_l1_acc = false,
+        .compute_with_storage_grid_size = CoreCoord(12, 9),
+        .output_memory_layout = output_memory_layout,
+        .output_buffer_type = output_memory_layout == TensorMemoryLayout::INTERLEAVED ? BufferType::DRAM : BufferType::L1,
+        .l1_size = 1024 * 1024 - 120 * 1024};
+}
+
+// The constraints Matmul::validate and the 1D and 2D programs check
+template <typename ProgramConfigType>
+void check_legal(const MatmulProblem& problem, const ProgramConfigType& config) {
+    const auto& grid = problem.compute_with_storage_grid_size;
+    TT_FATAL(problem.K % config.in0_block_w == 0);
+    TT_FATAL(config.per_core_M % config.out_subblock_h == 0 and config.per_core_N % config.out_subblock_w == 0);
+    TT_FATAL(config.out_subblock_h * config.out_subblock_w <= (problem.fp32_dest_acc_en ? 4 : 8));
+    uint32_t num_blocks_y = (problem.M - 1) / config.per_core_M + 1;
+    uint32_t num_blocks_x = (problem.N - 1) / config.per_core_N + 1;
+    if constexpr (std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig>) {
+        TT_FATAL(num_blocks_y * num_blocks_x <= grid.x * grid.y);
+        TT_FATAL(config.mcast_in0 ? config.per_core_M == problem.M : config.per_core_N == problem.N);
+        if (problem.output_memory_layout == TensorMemoryLayout::WIDTH_SHARDED) {
+            TT_FATAL(config.mcast_in0 and problem.N % config.per_core_N == 0);
+        }
+        if (problem.output_memory_layout == TensorMemoryLayout::HEIGHT_SHARDED) {
+            TT_FATAL(not config.mcast_in0 and problem.M % config.per_core_M == 0);
+        }
+    } else {
+        if (config.transpose_mcast) {
+            std::swap(num_blocks_x, num_blocks_y);
+        }
+        TT_FATAL(num_blocks_y > 1 and num_blocks_y <= grid.y and num_blocks_x > 1 and num_blocks_x <= grid.x);
+        TT_FATAL(problem.output_memory_layout == TensorMemoryLayout::INTERLEAVED or problem.output_memory_layout == TensorMemoryLayout::BLOCK_SHARDED);
+    }
+    if (problem.output_memory_layout != TensorMemoryLayout::INTERLEAVED) {
+        TT_FATAL(config.out_subblock_w == config.per_core_N or config.out_subblock_h == 1);
+    }
+    TT_FATAL(tt::operations::primary::get_matmul_l1_usage(problem, config) <= problem.l1_size);
+}
+
+void check_legal(const MatmulProblem& problem, const MatmulProgramConfig& program_config) {
+    if (auto config = std::get_if<MatmulMultiCoreReuseMultiCast1DProgramConfig>(&program_config)) {
+        check_legal(problem, *config);
+    } else {
+        check_legal(problem, std::get<MatmulMultiCoreReuseMultiCastProgramConfig>(program_config));
+    }
+}
+
+template <typename ProgramConfigType>
+bool is_same_config(const ProgramConfigType& config, const ProgramConfigType& other) {
+    bool is_same = config.compute_with_storage_grid_size == other.compute_with_storage_grid_size and
+                   config.in0_block_w == other.in0_block_w and config.out_subblock_h == other.out_subblock_h and
+                   config.out_subblock_w == other.out_subblock_w and config.per_core_M == other.per_core_M and
+                   config.per_core_N == other.per_core_N;
+    if constexpr (std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig>) {
+        return is_same and config.fuse_batch == other.fuse_batch and config.mcast_in0 == other.mcast_in0;
+    } else {
+        return is_same and config.transpose_mcast == other.transpose_mcast;
+    }
+}
+
+bool is_same_config(const MatmulProgramConfig& program_config, const MatmulProgramConfig& other_program_config) {
+    if (auto config = std::get_if<MatmulMultiCoreReuseMultiCast1DProgramConfig>(&program_config)) {
+        auto other = std::get_if<MatmulMultiCoreReuseMultiCast1DProgramConfig>(&other_program_config);
+        return other != nullptr and is_same_config(*config, *other);
+    }
+    auto other = std::get_if<MatmulMultiCoreReuseMultiCastProgramConfig>(&other_program_config);
+    return other != nullptr and is_same_config(std::get<MatmulMultiCoreReuseMultiCastProgramConfig>(program_config), *other);
+}
+
+void test_enumerate() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    for (const auto& output_memory_layout : {TensorMemoryLayout::INTERLEAVED, TensorMemoryLayout::WIDTH_SHARDED, TensorMemoryLayout::HEIGHT_SHARDED, TensorMemoryLayout::BLOCK_SHARDED}) {
+        for (const auto& [M, K, N] : {std::make_tuple(1, 1, 1), std::make_tuple(2, 32, 256), std::make_tuple(12, 32, 96), std::make_tuple(96, 32, 128), std::make_tuple(17, 13, 29)}) {
+            auto problem = create_problem(M, K, N, output_memory_layout);
+            auto program_configs = tt::operations::primary::enumerate_matmul_program_configs(problem);
+            for (const auto& program_config : program_configs) {
+                check_legal(problem, program_config);
+            }
+            // Small enough to fit in L1, block sharding only runs in 2D, with at least 2 blocks of M and of N
+            if (output_memory_layout != TensorMemoryLayout::BLOCK_SHARDED or (M > 1 and N > 1)) {
+                TT_FATAL(not program_configs.empty(), "No config for {}", tt::operations::primary::get_matmul_problem_key(problem));
+            }
+        }
+    }
+
+    // A whole K of in0 doesn't fit in L1, only smaller blocks of it are enumerated
+    auto problem = create_problem(1, 4096, 1);
+    auto program_configs = tt::operations::primary::enumerate_matmul_program_configs(problem);
+    TT_FATAL(not program_configs.empty());
+    for (const auto& program_config : program_configs) {
+        TT_FATAL(std::get<MatmulMultiCoreReuseMultiCast1DProgramConfig>(program_config).in0_block_w < 4096);
+    }
+}
+
+uint32_t get_num_cores(const MatmulProblem& problem, const MatmulProgramConfig& program_config) {
+    return std::visit(
+        [&](const auto& config) -> uint32_t {
+            using ProgramConfigType = std::decay_t<decltype(config)>;
+            if constexpr (
+                std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig> or
+                std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCastProgramConfig>) {
+                return ((problem.M - 1) / config.per_core_M + 1) * ((problem.N - 1) / config.per_core_N + 1);
+            } else {
+                TT_THROW("Only 1D and 2D multicast matmul program configs are tuned");
+            }
+        },
+        program_config);
+}
+
+void test_tune() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    for (const auto& output_memory_layout : {TensorMemoryLayout::INTERLEAVED, TensorMemoryLayout::WIDTH_SHARDED, TensorMemoryLayout::HEIGHT_SHARDED, TensorMemoryLayout::BLOCK_SHARDED}) {
+        for (const auto& [M, K, N] : {std::make_tuple(1, 144, 144), std::make_tuple(864, 32, 1), std::make_tuple(108, 32, 144), std::make_tuple(17, 13, 29)}) {
+            auto problem = create_problem(M, K, N, output_memory_layout);
+            auto program_configs = tt::operations::primary::enumerate_matmul_program_configs(problem);
+            auto result = tt::operations::primary::tune_matmul(problem);
+            TT_FATAL(result.has_value() == not program_configs.empty());
+            if (not result.has_value()) {
+                continue;
+            }
+
+            // The winner is legal and has the lowest estimate of all legal configs
+            check_legal(problem, result->program_config);
+            TT_FATAL(result->estimated_cycles == tt::operations::primary::estimate_matmul_program_cycles(problem, result->program_config));
+            for (const auto& program_config : program_configs) {
+                TT_FATAL(result->estimated_cycles <= tt::operations::primary::estimate_matmul_program_cycles(problem, program_config));
+            }
+            // Work that can be split is
+            bool can_split = std::any_of(program_configs.begin(), program_configs.end(), [&](const auto& program_config) {
+                return get_num_cores(problem, program_config) > 1;
+            });
+            if (can_split) {
+                TT_FATAL(get_num_cores(problem, result->program_config) > 1, "{} runs on a single core", tt::operations::primary::get_matmul_problem_key(problem));
+            }
+
+            // Higher fidelity is never faster
+            auto hifi4_problem = problem;
+            hifi4_problem.math_fidelity = MathFidelity::HiFi4;
+            TT_FATAL(
+                tt::operations::primary::estimate_matmul_program_cycles(hifi4_problem, result->program_config) >=
+                tt::operations::primary::estimate_matmul_program_cycles(problem, result->program_config));
+        }
+    }
+}
+
+void test_database() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    const auto file_name = (std::filesystem::temp_directory_path() / "test_matmul_tuner.json").string();
+    std::filesystem::remove(file_name);
+
+    std::vector<MatmulProblem> problems = {create_problem(1, 144, 144), create_problem(108, 32, 144), create_problem(864, 32, 1)};
+    std::vector<MatmulProgramConfig> program_configs;
+    {
+        MatmulTuningDatabase database(file_name);
+        TT_FATAL(database.size() == 0);
+        for (const auto& problem : problems) {
+            TT_FATAL(not database.lookup(problem).has_value());
+            program_configs.push_back(database.tune(problem).value().program_config);
+        }
+        TT_FATAL(database.size() == problems.size());
+        // Tuned results are only written by flush
+        TT_FATAL(not std::filesystem::exists(file_name));
+        database.flush();
+        TT_FATAL(std::filesystem::exists(file_name));
+    }
+
+    // Reloaded configs are the tuned ones, other grids and dtypes are different problems
+    MatmulTuningDatabase database(file_name);
+    TT_FATAL(database.size() == problems.size());
+    for (std::size_t i = 0; i < problems.size(); i++) {
+        auto result = database.lookup(problems[i]);
+        TT_FATAL(result.has_value());
+        TT_FATAL(is_same_config(result->program_config, program_configs[i]));
+    }
+    auto other_grid = problems[0];
+    other_grid.compute_with_storage_grid_size = CoreCoord(8, 8);
+    TT_FATAL(not database.lookup(other_grid).has_value());
+    auto other_dtype = problems[0];
+    other_dtype.in1_dtype = DataType::BFLOAT16;
+    TT_FATAL(not database.lookup(other_dtype).has_value());
+    std::filesystem::remove(file_name);
+}
+
+void test_l1_budget() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    MatmulTuningDatabase database;
+    auto problem = create_problem(108, 32, 144);
+    const auto result = database.tune(problem);
+    TT_FATAL(result.has_value());
+    const uint32_t l1_usage = tt::operations::primary::get_matmul_l1_usage(problem, result->program_config);
+
+    // An output in L1 takes its part of the budget
+    auto l1_output = problem;
+    l1_output.output_buffer_type = BufferType::L1;
+    TT_FATAL(tt::operations::primary::get_matmul_l1_usage(l1_output, result->program_config) > l1_usage);
+
+    // With L1 buffers allocated since, the tuned config no longer fits and is left for the heuristics, but it is kept
+    auto occupied = problem;
+    occupied.l1_size = l1_usage - 1;
+    TT_FATAL(not database.tune(occupied).has_value());
+    TT_FATAL(is_same_config(database.lookup(problem).value().program_config, result->program_config));
+    for (const auto& program_config : tt::operations::primary::enumerate_matmul_program_configs(occupied)) {
+        check_legal(occupied, program_config);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    test_enumerate();
+    test_tune();
+    test_database();
+    test_l1_budget();
+    return 0;
+}
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <thread>
+
+#include "tensor/tensor.hpp"
+#include "third_party/json/json.hpp"
+#include "tools/profiler/event_stream.hpp"
+#include "tools/profiler/op_profiler.hpp"
+#include "tt_numpy/functions.hpp"
+
+using tt::tt_metal::DataType;
+using tt::tt_metal::Shape;
+namespace event_stream = tt::tt_metal::op_profiler::event_stream;
+namespace op_profiler = tt::tt_metal::op_profiler;
+
+namespace {
+
+// More events than fit in a buffer, so full buffers are written by the writer thread
+constexpr uint32_t NUM_REPEATED_OPS = event_stream::detail::EVENTS_PER_BUFFER;
+
+nlohmann::json export_chrome_trace(const std::string& events_file_name) {
+    const auto json_file_name = events_file_name + ".json";
+    event_stream::flush();
+    event_stream::export_chrome_trace(events_file_name, json_file_name);
+    std::ifstream json_file(json_file_name);
+    auto trace = nlohmann::json::parse(json_file);
+    std::filesystem::remove(json_file_name);
+    return trace;
+}
+
+// Trace events of each thread in the order they were written, which is the order the ops ended in
+std::map<uint32_t, std::vector<nlohmann::json>> get_thread_trace_events(const nlohmann::json& trace) {
+    std::map<uint32_t, std::vector<nlohmann::json>> thread_trace_events;
+    for (const auto& trace_event : trace["traceEvents"]) {
+        TT_FATAL(trace_event["ph"] == "X");
+        thread_trace_events[trace_event["tid"].get<uint32_t>()].push_back(trace_event);
+    }
+    return thread_trace_events;
+}
+
+void test_nested_ops(const std::string& file_name) {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    auto input_tensor = tt::numpy::zeros(Shape{1, 2, 32, 64}, DataType::BFLOAT16);
+    op_profiler::start_profiling("outer", op_profiler::OpType::tt_dnn_cpu);
+    op_profiler::append_input_data(input_tensor);
+    op_profiler::append_meta_data("first");
+    op_profiler::start_profiling("inner", op_profiler::OpType::custom_zone);
+    op_profiler::stop_profiling("inner");
+    op_profiler::append_meta_data("second");
+    op_profiler::stop_profiling("outer");
+
+    auto thread_trace_events = get_thread_trace_events(export_chrome_trace(file_name));
+    TT_FATAL(thread_trace_events.size() == 1);
+    const auto& trace_events = thread_trace_events.begin()->second;
+    TT_FATAL(trace_events.size() == 2);
+    const auto& inner = trace_events[0];
+    const auto& outer = trace_events[1];
+    TT_FATAL(inner["name"] == "inner" and inner["cat"] == "custom_zone");
+    TT_FATAL(outer["name"] == "outer" and outer["cat"] == "tt_dnn_cpu");
+    TT_FATAL(outer["args"]["Global Call Count"] == 1 and inner["args"]["Global Call Count"] == 2);
+    TT_FATAL(outer["args"]["Call Count"] == 1);
+    // Arguments belong to the innermost op, repeated keys are joined
+    TT_FATAL(outer["args"]["Meta Data"] == "first, second", "Meta Data is {}", outer["args"]["Meta Data"].dump());
+    TT_FATAL(not inner["args"].contains("Meta Data"));
+    const auto inputs = outer["args"]["Inputs"].get<std::string>();
+    TT_FATAL(inputs.rfind("1_2_32_64|", 0) == 0 and inputs.find("BFLOAT16") != std::string::npos, "Inputs are {}", inputs);
+    // The inner op runs within the outer one
+    TT_FATAL(outer["ts"].get<double>() <= inner["ts"].get<double>());
+    TT_FATAL(
+        inner["ts"].get<double>() + inner["dur"].get<double>() <=
+        outer["ts"].get<double>() + outer["dur"].get<double>() + 1e-3);
+}
+
+void record_repeated_ops(const std::string& name) {
+    for (uint32_t index = 0; index < NUM_REPEATED_OPS; index++) {
+        op_profiler::start_profiling(name, op_profiler::OpType::tt_dnn_device);
+        op_profiler::stop_profiling(name);
+    }
+}
+
+void test_threads(const std::string& file_name) {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    record_repeated_ops("main_thread_op");
+    // The buffer of an exited thread is written too
+    std::thread(record_repeated_ops, "worker_thread_op").join();
+    // An op still running when the stream is flushed ends at the last event of its thread
+    op_profiler::start_profiling("running", op_profiler::OpType::tt_dnn_device);
+
+    auto thread_trace_events = get_thread_trace_events(export_chrome_trace(file_name));
+    TT_FATAL(thread_trace_events.size() == 2);
+    // Events written by earlier flushes are kept
+    const auto& main_thread_trace_events = thread_trace_events.at(0);
+    TT_FATAL(main_thread_trace_events.size() == 2 + NUM_REPEATED_OPS + 1, "{} main thread ops", main_thread_trace_events.size());
+    for (uint32_t index = 0; index < NUM_REPEATED_OPS; index++) {
+        const auto& trace_event = main_thread_trace_events[2 + index];
+        TT_FATAL(trace_event["name"] == "main_thread_op" and trace_event["args"]["Call Count"] == index + 1);
+    }
+    TT_FATAL(main_thread_trace_events.back()["name"] == "running");
+    TT_FATAL(main_thread_trace_events.back()["dur"].get<double>() == 0.0);
+
+    const auto& worker_thread_trace_events = thread_trace_events.at(1);
+    TT_FATAL(worker_thread_trace_events.size() == NUM_REPEATED_OPS);
+    // Call counts are per thread, global call counts are across threads
+    TT_FATAL(worker_thread_trace_events.back()["args"]["Call Count"] == NUM_REPEATED_OPS);
+    TT_FATAL(worker_thread_trace_events.back()["args"]["Global Call Count"] == 2 + 2 * NUM_REPEATED_OPS);
+    op_profiler::stop_profiling("running");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto file_name = (std::filesystem::temp_directory_path() / "test_op_profiler_events.bin").string();
+    // Read when the stream is first used
+    setenv("TT_METAL_OP_PROFILER_EVENTS", file_name.c_str(), 1);
+    TT_FATAL(event_stream::enabled());
+
+    test_nested_ops(file_name);
+    test_threads(file_name);
+    std::filesystem::remove(file_name);
+    return 0;
+}
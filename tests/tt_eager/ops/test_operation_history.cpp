@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "common/constants.hpp"
+#include "tensor/tensor.hpp"
+#include "third_party/json/json.hpp"
+#include "tt_dnn/op_library/operation.hpp"
+#include "tt_dnn/op_library/operation_history.hpp"
+#include "tt_dnn/op_library/pad/pad_op.hpp"
+#include "tt_dnn/op_library/run_operation.hpp"
+#include "tt_numpy/functions.hpp"
+
+using tt::tt_metal::DataType;
+using tt::tt_metal::Shape;
+using tt::tt_metal::Tensor;
+using tt::tt_metal::operation::ExternalOperation;
+
+namespace {
+
+constexpr uint32_t CAPACITY = 4;
+
+nlohmann::json decode(const std::string& history_file_name) {
+    const auto json_file_name = history_file_name + ".json";
+    const auto root_dir = std::getenv("TT_METAL_HOME") != nullptr ? std::string(std::getenv("TT_METAL_HOME")) + "/" : "";
+    const auto command =
+        fmt::format("python3 {}tt_eager/decode_operation_history.py {} -o {}", root_dir, history_file_name, json_file_name);
+    TT_FATAL(std::system(command.c_str()) == 0, "Failed to run {}", command);
+    std::ifstream json_file(json_file_name);
+    auto records = nlohmann::json::parse(json_file);
+    std::filesystem::remove(json_file_name);
+    return records;
+}
+
+void append_external_operation(uint32_t value, const std::vector<Tensor>& input_tensors) {
+    tt::tt_metal::operation_history::append(
+        ExternalOperation{"external_operation", {{"value", std::to_string(value)}}}, {}, input_tensors);
+}
+
+void test_append_dump_decode(const std::string& file_name) {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    auto input_tensor = tt::numpy::zeros(Shape{1, 2, 18, 13}, DataType::BFLOAT16);
+
+    // A host operation run through the usual path, and external operations with and without tensors
+    auto padded_shape = Shape{1, 2, tt::constants::TILE_HEIGHT, tt::constants::TILE_WIDTH};
+    tt::tt_metal::operation::run(tt::tt_metal::PadOnHost{padded_shape, {0, 0, 0, 0}, 0}, {input_tensor});
+    append_external_operation(1, {input_tensor, input_tensor});
+    append_external_operation(2, {});
+
+    tt::tt_metal::operation_history::dump(file_name);
+    auto records = decode(file_name);
+    TT_FATAL(records.size() == 3, "Decoded {} records", records.size());
+    for (std::size_t index = 0; index < records.size(); index++) {
+        TT_FATAL(records[index]["index"] == index);
+    }
+    TT_FATAL(records[0]["operation_type"] == "host");
+    TT_FATAL(records[0]["opcode"].get<std::string>().find("PadOnHost") != std::string::npos);
+    TT_FATAL(records[0]["num_input_tensors"] == 1);
+    const auto& tensor = records[0]["input_tensors"][0];
+    TT_FATAL(tensor["storage_type"] == "OWNED" and tensor["data_type"] == "BFLOAT16" and tensor["layout"] == "ROW_MAJOR");
+    TT_FATAL(tensor["shape"] == nlohmann::json::array({1, 2, 18, 13}));
+    TT_FATAL(tensor["memory_layout"].is_null());
+
+    TT_FATAL(records[1]["operation_type"] == "external" and records[1]["opcode"] == "external_operation");
+    TT_FATAL(records[1]["num_input_tensors"] == 2);
+    TT_FATAL(records[1]["attributes"].get<std::string>().find("1") != std::string::npos);
+    TT_FATAL(records[2]["num_input_tensors"] == 0 and records[2]["input_tensors"].empty());
+    TT_FATAL(records[1]["attributes"] != records[2]["attributes"]);
+}
+
+void test_rings_keep_the_last_operations(const std::string& file_name) {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    // The main thread already recorded 3 operations, each thread keeps its last CAPACITY ones
+    for (uint32_t value = 0; value < 2 * CAPACITY; value++) {
+        append_external_operation(value, {});
+    }
+    std::thread([] {
+        for (uint32_t value = 0; value < 2; value++) {
+            append_external_operation(100 + value, {});
+        }
+    }).join();
+
+    tt::tt_metal::operation_history::dump(file_name);
+    auto records = decode(file_name);
+    // The oldest slot of a full ring may have been overwritten while dumping and is skipped
+    std::map<uint32_t, std::vector<uint64_t>> indices_per_thread;
+    for (const auto& record : records) {
+        indices_per_thread[record["thread"].get<uint32_t>()].push_back(record["index"].get<uint64_t>());
+    }
+    TT_FATAL(indices_per_thread.size() == 2);
+    const auto& main_thread_indices = indices_per_thread.at(0);
+    TT_FATAL(main_thread_indices.size() == CAPACITY - 1, "Decoded {} records of the main thread", main_thread_indices.size());
+    TT_FATAL(main_thread_indices.back() == 3 + 2 * CAPACITY - 1);
+    TT_FATAL(std::is_sorted(main_thread_indices.begin(), main_thread_indices.end()));
+    TT_FATAL(indices_per_thread.at(1).size() == 2);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const auto file_name = (std::filesystem::temp_directory_path() / "test_operation_history.bin").string();
+    // Read when the history is first used
+    setenv("OPERATION_HISTORY", file_name.c_str(), 1);
+    setenv("OPERATION_HISTORY_CAPACITY", std::to_string(CAPACITY).c_str(), 1);
+    TT_FATAL(tt::tt_metal::operation_history::enabled());
+
+    test_append_dump_decode(file_name);
+    test_rings_keep_the_last_operations(file_name);
+    std::filesystem::remove(file_name);
+    return 0;
+}
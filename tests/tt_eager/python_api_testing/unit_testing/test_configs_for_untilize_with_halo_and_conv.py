@@ -253,3 +253,43 @@ def test_generate_all_configs_and_references(
             pool_out_golden_pyt_tensor,
             sliding_window_op_sharded_input_top_left_indices,
         )
+
+    # The ops consume the configs generated in C++, which should match the validated python references
+    logger.info("Compare with configs generated in C++")
+    sliding_window_config = ttl.tensor.SlidingWindowConfig(
+        stride_h=stride_h,
+        stride_w=stride_w,
+        pad_h=pad_h,
+        pad_w=pad_w,
+        window_h=filter_h,
+        window_w=filter_w,
+        batch_size=batch_size,
+        input_h=input_h,
+        input_w=input_w,
+        num_cores_nhw=num_cores,
+        input_shard_height=untilize_with_halo_input_shard_height,
+        output_shard_height=conv_output_shard_height,
+    )
+    sliding_window_op_configs = ttl.tensor.get_sliding_window_op_configs(sliding_window_config)
+    assert sliding_window_op_configs.sharded_input_top_left_indices == sliding_window_op_sharded_input_top_left_indices
+    assert sliding_window_op_configs.shard_boundaries == req_conv_input_shard_start_end
+
+    halo_kernel_config = ttl.tensor.get_halo_kernel_config(sliding_window_config)
+    assert halo_kernel_config.local_data == local_data
+    assert halo_kernel_config.local_pad == local_pad
+    assert halo_kernel_config.ll_data == ll_data
+    assert halo_kernel_config.l_data == l_data
+    assert halo_kernel_config.r_data == r_data
+    assert halo_kernel_config.rr_data == rr_data
+    assert halo_kernel_config.local_data_nsegments_per_core == local_data_nsegments_per_core
+    assert halo_kernel_config.local_pad_nsegments_per_core == local_pad_nsegments_per_core
+    assert halo_kernel_config.ll_data_nsegments_per_core == ll_data_nsegments_per_core
+    assert halo_kernel_config.l_data_nsegments_per_core == l_data_nsegments_per_core
+    assert halo_kernel_config.r_data_nsegments_per_core == r_data_nsegments_per_core
+    assert halo_kernel_config.rr_data_nsegments_per_core == rr_data_nsegments_per_core
+    assert halo_kernel_config.ll_data_src_start_offsets_per_core == [idx[0] for idx in src_start_idx]
+    assert halo_kernel_config.l_data_src_start_offsets_per_core == [idx[1] for idx in src_start_idx]
+    assert halo_kernel_config.local_data_src_start_offsets_per_core == [idx[2] for idx in src_start_idx]
+    assert halo_kernel_config.r_data_src_start_offsets_per_core == [idx[3] for idx in src_start_idx]
+    assert halo_kernel_config.rr_data_src_start_offsets_per_core == [idx[4] for idx in src_start_idx]
+    assert halo_kernel_config.max_out_nsticks_per_core == max_out_nsticks_per_core
@@ -5,6 +5,7 @@
 import pytest
 
 import pathlib
+import struct
 
 import torch
 import numpy as np
@@ -115,6 +116,87 @@ def test_tensor_conversion_between_torch_and_np(shape, tt_dtype, device):
     assert passing
 
 
+@pytest.mark.parametrize("shape", [(2, 3, 64, 96)])
+@pytest.mark.parametrize(
+    "tt_dtype",
+    [
+        ttl.tensor.DataType.UINT32,
+        ttl.tensor.DataType.UINT16,
+        ttl.tensor.DataType.FLOAT32,
+        ttl.tensor.DataType.BFLOAT16,
+    ],
+)
+def test_tensor_conversion_through_dlpack(shape, tt_dtype):
+    dtype = tt_dtype_to_torch_dtype[tt_dtype]
+
+    if dtype in {torch.int16, torch.int32}:
+        torch_tensor = torch.randint(torch.iinfo(dtype).min, torch.iinfo(dtype).max, shape, dtype=dtype)
+    else:
+        torch_tensor = torch.rand(shape, dtype=dtype)
+
+    tt_tensor = ttl.tensor.from_dlpack(torch_tensor)
+    assert tt_tensor.storage_type() == ttl.tensor.StorageType.BORROWED
+    assert tt_tensor.dtype() == tt_dtype
+
+    torch_tensor_after_round_trip = torch.from_dlpack(tt_tensor)
+    assert torch_tensor.dtype == torch_tensor_after_round_trip.dtype
+    assert torch_tensor.shape == torch_tensor_after_round_trip.shape
+    assert torch.equal(torch_tensor, torch_tensor_after_round_trip)
+
+    # Neither side copies the data
+    assert torch_tensor_after_round_trip.data_ptr() == torch_tensor.data_ptr()
+    del tt_tensor
+    assert torch.equal(torch_tensor, torch_tensor_after_round_trip)
+
+    # Strided tensors are gathered into an owned tensor
+    transposed_torch_tensor = torch_tensor.transpose(2, 3)
+    tt_tensor = ttl.tensor.from_dlpack(transposed_torch_tensor)
+    assert tt_tensor.storage_type() == ttl.tensor.StorageType.OWNED
+    assert torch.equal(tt_tensor.to_torch(), transposed_torch_tensor)
+
+    # Padding and tilizing while ingesting matches padding and tilizing the contiguous tensor
+    padded_shape = [shape[0], shape[1] + 1, shape[3] + 32, shape[2] + 32]
+    tt_tensor = ttl.tensor.from_dlpack(
+        transposed_torch_tensor, layout=ttl.tensor.Layout.TILE, padded_shape=padded_shape, pad_value=3
+    )
+    expected_tt_tensor = (
+        ttl.tensor.Tensor(transposed_torch_tensor.contiguous(), tt_dtype)
+        .pad(padded_shape, [0, 0, 0, 0], 3)
+        .to(ttl.tensor.Layout.TILE)
+    )
+    assert tt_tensor.layout() == ttl.tensor.Layout.TILE
+    assert torch.equal(
+        tt_tensor.to(ttl.tensor.Layout.ROW_MAJOR).to_torch(),
+        expected_tt_tensor.to(ttl.tensor.Layout.ROW_MAJOR).to_torch(),
+    )
+
+
+@pytest.mark.parametrize("shape", [(2, 3, 50, 40)])
+@pytest.mark.parametrize("torch_dtype", [torch.float32, torch.bfloat16])
+def test_tensor_bfloat8_b_ingestion(shape, torch_dtype):
+    torch.manual_seed(0)
+    torch_tensor = torch.rand(shape, dtype=torch_dtype).transpose(2, 3)
+    padded_shape = [shape[0], shape[1], 64, 64]
+
+    # Converted, padded, tilized and packed in one pass
+    tt_tensor = ttl.tensor.from_dlpack(
+        torch_tensor, ttl.tensor.DataType.BFLOAT8_B, ttl.tensor.Layout.TILE, padded_shape=padded_shape
+    )
+    expected_tt_tensor = (
+        ttl.tensor.Tensor(torch_tensor.float().contiguous(), ttl.tensor.DataType.FLOAT32)
+        .pad(padded_shape, [0, 0, 0, 0], 0)
+        .to(ttl.tensor.Layout.TILE)
+    )
+    expected_tt_tensor = ttl.tensor.Tensor(
+        expected_tt_tensor.to(ttl.tensor.Layout.ROW_MAJOR).to_torch(), ttl.tensor.DataType.BFLOAT8_B
+    ).to(ttl.tensor.Layout.TILE)
+    assert tt_tensor.dtype() == ttl.tensor.DataType.BFLOAT8_B
+    assert torch.equal(
+        tt_tensor.to(ttl.tensor.Layout.ROW_MAJOR).to_torch(),
+        expected_tt_tensor.to(ttl.tensor.Layout.ROW_MAJOR).to_torch(),
+    )
+
+
 @pytest.mark.parametrize("shape", [(2, 3, 64, 96)])
 @pytest.mark.parametrize(
     "tt_dtype",
@@ -153,6 +235,84 @@ def test_serialization(tmp_path, shape, tt_dtype):
     assert passing
 
 
+@pytest.mark.parametrize("shape", [(2, 3, 64, 96)])
+@pytest.mark.parametrize("layout", [ttl.tensor.Layout.ROW_MAJOR, ttl.tensor.Layout.TILE])
+def test_serialization_of_multiple_tensors(tmp_path, shape, layout):
+    torch.manual_seed(0)
+
+    torch_tensors = {}
+    tt_tensors = []
+    for tt_dtype, dtype in tt_dtype_to_torch_dtype.items():
+        if dtype in {torch.int16, torch.int32}:
+            torch_tensor = torch.randint(0, 1024, shape, dtype=dtype)
+        else:
+            torch_tensor = torch.rand(shape, dtype=dtype)
+        name = f"tensor_{tt_dtype}"
+        torch_tensors[name] = torch_tensor
+        tt_tensors.append((name, ttl.tensor.Tensor(torch_tensor, tt_dtype).to(layout)))
+
+    file_name = tmp_path / pathlib.Path("tensors.bin")
+    ttl.tensor.dump_tensors(str(file_name), tt_tensors)
+    tt_tensors_from_file = ttl.tensor.load_tensors(str(file_name))
+
+    assert set(tt_tensors_from_file.keys()) == set(torch_tensors.keys())
+    for name, tt_tensor in tt_tensors:
+        tt_tensor_from_file = tt_tensors_from_file[name]
+        assert tt_tensor_from_file.dtype() == tt_tensor.dtype()
+        assert tt_tensor_from_file.layout() == layout
+        assert tt_tensor_from_file.storage_type() == ttl.tensor.StorageType.BORROWED
+
+        torch_tensor_from_file = tt_tensor_from_file.to(ttl.tensor.Layout.ROW_MAJOR).to_torch()
+        allclose_kwargs = {}
+        if tt_tensor.dtype() == ttl.tensor.DataType.BFLOAT8_B:
+            allclose_kwargs = dict(atol=1e-2)
+        assert torch.allclose(torch_tensors[name], torch_tensor_from_file, **allclose_kwargs)
+
+    # Torch tensors keep the mapping alive after the tt tensors are gone
+    name = f"tensor_{ttl.tensor.DataType.FLOAT32}"
+    torch_tensor_from_file = tt_tensors_from_file[name].to(ttl.tensor.Layout.ROW_MAJOR).to_torch()
+    del tt_tensors_from_file
+    assert torch.allclose(torch_tensors[name], torch_tensor_from_file)
+
+
+@pytest.mark.parametrize(
+    "field_offset, value",
+    [
+        # name_offset that wraps around when the name size is added
+        (0, 2**64 - 1),
+        # payload_size that wraps around when added to the payload offset
+        (24, 2**64 - 4096),
+        # payload smaller than the shape
+        (24, 64),
+    ],
+)
+def test_serialization_rejects_out_of_bounds_entries(tmp_path, field_offset, value):
+    file_name = tmp_path / pathlib.Path("tensors.bin")
+    ttl.tensor.dump_tensors(str(file_name), [("tensor", ttl.tensor.Tensor(torch.rand((1, 1, 32, 32)), ttl.tensor.DataType.FLOAT32))])
+
+    # The first entry follows the 24 B header
+    with open(file_name, "r+b") as file:
+        file.seek(24 + field_offset)
+        file.write(struct.pack("<Q", value))
+
+    with pytest.raises(RuntimeError):
+        ttl.tensor.load_tensors(str(file_name))
+
+
+# Offsets of data_type, layout and pad_value in an entry
+@pytest.mark.parametrize("field_offset", [32, 36, 44])
+def test_serialization_rejects_invalid_enums(tmp_path, field_offset):
+    file_name = tmp_path / pathlib.Path("tensors.bin")
+    ttl.tensor.dump_tensors(str(file_name), [("tensor", ttl.tensor.Tensor(torch.rand((1, 1, 32, 32)), ttl.tensor.DataType.FLOAT32))])
+
+    with open(file_name, "r+b") as file:
+        file.seek(24 + field_offset)
+        file.write(struct.pack("<I", 1000))
+
+    with pytest.raises(RuntimeError):
+        ttl.tensor.load_tensors(str(file_name))
+
+
 @pytest.mark.parametrize("shape", [(1, 2, 3, 4)])
 @pytest.mark.parametrize(
     "tt_dtype",
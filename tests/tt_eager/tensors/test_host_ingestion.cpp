@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <numeric>
+#include <vector>
+
+#include "common/bfloat16.hpp"
+#include "common/bfloat8.hpp"
+#include "common/constants.hpp"
+#include "tensor/host_ingestion.hpp"
+#include "tensor/owned_buffer.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tensor/tensor.hpp"
+
+using tt::tt_metal::DataType;
+using tt::tt_metal::HostTensorSource;
+using tt::tt_metal::Layout;
+using tt::tt_metal::OwnedStorage;
+using tt::tt_metal::Shape;
+using tt::tt_metal::Tensor;
+
+namespace {
+
+constexpr float PAD_VALUE = 7.0f;
+
+uint32_t volume(const std::vector<uint32_t>& shape) {
+    return std::accumulate(shape.begin(), shape.end(), 1u, std::multiplies<uint32_t>());
+}
+
+// Source of shape with its last two dims swapped, a transposed view of dense data of shape [..., W, H]
+template <typename T>
+HostTensorSource transposed_source(const std::vector<T>& data, DataType data_type, const std::vector<uint32_t>& shape) {
+    auto dense_shape = shape;
+    std::swap(dense_shape[shape.size() - 2], dense_shape[shape.size() - 1]);
+    auto strides = tt::tt_metal::compute_row_major_strides(dense_shape);
+    std::swap(strides[shape.size() - 2], strides[shape.size() - 1]);
+    return HostTensorSource{.data = data.data(), .data_type = data_type, .shape = shape, .strides = strides};
+}
+
+// Dense copy of the transposed view, the input of the reference path
+template <typename T>
+std::vector<T> transpose(const std::vector<T>& data, const std::vector<uint32_t>& shape) {
+    const uint32_t height = shape[shape.size() - 2];
+    const uint32_t width = shape[shape.size() - 1];
+    std::vector<T> output(data.size());
+    for (uint32_t block = 0; block < data.size() / (height * width); block++) {
+        for (uint32_t row = 0; row < height; row++) {
+            for (uint32_t col = 0; col < width; col++) {
+                output[block * height * width + row * width + col] = data[block * height * width + col * height + row];
+            }
+        }
+    }
+    return output;
+}
+
+// Reference: dense row major tensor, then pad, then tilize, one pass each
+template <typename T>
+Tensor reference(std::vector<T> data, DataType data_type, const std::vector<uint32_t>& shape, const std::vector<uint32_t>& padded_shape, Layout layout) {
+    auto tensor = Tensor(OwnedStorage{tt::tt_metal::owned_buffer::create<T>(std::move(data))}, shape, data_type, Layout::ROW_MAJOR);
+    if (padded_shape != shape) {
+        tensor = tensor.pad(padded_shape, std::vector<uint32_t>(shape.size(), 0), PAD_VALUE);
+    }
+    return tensor.to(layout);
+}
+
+void check_uint32(const std::vector<uint32_t>& shape, const std::vector<uint32_t>& padded_shape, Layout layout) {
+    std::vector<uint32_t> data(volume(shape));
+    std::iota(data.begin(), data.end(), 0);
+    auto output = tt::tt_metal::ingest_host_tensor(transposed_source(data, DataType::UINT32, shape), DataType::UINT32, layout, Shape(padded_shape), PAD_VALUE);
+    auto expected = reference(transpose(data, shape), DataType::UINT32, shape, padded_shape, layout);
+    TT_FATAL(output.shape() == expected.shape() and output.layout() == layout);
+    TT_FATAL(tt::tt_metal::owned_buffer::get_as<uint32_t>(output) == tt::tt_metal::owned_buffer::get_as<uint32_t>(expected), "Ingested tensor doesn't match the reference");
+}
+
+void test_ingest_strided() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    check_uint32({5, 6}, {5, 6}, Layout::ROW_MAJOR);
+    check_uint32({2, 3, 18, 13}, {3, 5, 32, 32}, Layout::ROW_MAJOR);
+    check_uint32({2, 3, 18, 13}, {2, 3, 32, 32}, Layout::TILE);
+    check_uint32({2, 3, 18, 13}, {3, 4, 64, 96}, Layout::TILE);
+    check_uint32({2, 2, 3, 40, 70}, {2, 2, 3, 64, 96}, Layout::TILE);
+    // Large enough to be split across the executor
+    check_uint32({8, 3, 224, 224}, {8, 3, 224, 256}, Layout::TILE);
+    check_uint32({8, 3, 224, 224}, {8, 4, 224, 224}, Layout::ROW_MAJOR);
+}
+
+void test_ingest_bfloat16() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    std::vector<uint32_t> shape = {2, 3, 50, 40};
+    std::vector<uint32_t> padded_shape = {2, 3, 64, 64};
+    std::vector<float> data(volume(shape));
+    std::iota(data.begin(), data.end(), -1000.5f);
+    std::vector<bfloat16> data_bfloat16(data.begin(), data.end());
+
+    auto source = transposed_source(data, DataType::FLOAT32, shape);
+    auto output = tt::tt_metal::ingest_host_tensor(source, DataType::BFLOAT16, Layout::TILE, Shape(padded_shape), PAD_VALUE);
+    auto expected = reference(transpose(data_bfloat16, shape), DataType::BFLOAT16, shape, padded_shape, Layout::TILE);
+    TT_FATAL(tt::tt_metal::owned_buffer::get_as<bfloat16>(output) == tt::tt_metal::owned_buffer::get_as<bfloat16>(expected), "FLOAT32 to BFLOAT16 doesn't match the reference");
+
+    // Back to FLOAT32 is exact
+    auto bfloat16_source = transposed_source(data_bfloat16, DataType::BFLOAT16, shape);
+    auto output_float = tt::tt_metal::ingest_host_tensor(bfloat16_source, DataType::FLOAT32, Layout::TILE, Shape(padded_shape), PAD_VALUE);
+    auto output_data = tt::tt_metal::owned_buffer::get_as<float>(output_float);
+    auto expected_data = tt::tt_metal::owned_buffer::get_as<bfloat16>(expected);
+    for (auto i = 0; i < output_data.size(); i++) {
+        TT_FATAL(output_data[i] == expected_data[i].to_float(), "Element {} is {}, expected {}", i, output_data[i], expected_data[i].to_float());
+    }
+}
+
+void check_bfloat8_b(const std::vector<uint32_t>& shape, const std::vector<uint32_t>& padded_shape, Layout layout) {
+    std::vector<float> data(volume(shape));
+    for (auto i = 0; i < data.size(); i++) {
+        data[i] = float(i % 977) / 64.0f - 7.0f;
+    }
+    auto output = tt::tt_metal::ingest_host_tensor(transposed_source(data, DataType::FLOAT32, shape), DataType::BFLOAT8_B, layout, Shape(padded_shape), PAD_VALUE);
+    TT_FATAL(output.dtype() == DataType::BFLOAT8_B and output.layout() == layout);
+
+    // Tiles are packed in the order of the tiled (or row major) float data
+    auto expected_floats = reference(transpose(data, shape), DataType::FLOAT32, shape, padded_shape, layout);
+    auto expected_float_data = tt::tt_metal::owned_buffer::get_as<float>(expected_floats);
+    auto expected = pack_fp32_vec_as_bfp8_tiles(std::vector<float>(expected_float_data.begin(), expected_float_data.end()), /*row_major_input=*/false, /*is_exp_a=*/false);
+    auto output_data = tt::tt_metal::owned_buffer::get_as<uint32_t>(output);
+    TT_FATAL(std::vector<uint32_t>(output_data.begin(), output_data.end()) == expected, "BFLOAT8_B doesn't match the reference");
+}
+
+void test_ingest_bfloat8_b() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    check_bfloat8_b({2, 3, 50, 40}, {2, 3, 64, 64}, Layout::TILE);
+    check_bfloat8_b({1, 1, 32, 32}, {1, 1, 32, 32}, Layout::TILE);
+    // Every 1024 elements span several rows
+    check_bfloat8_b({2, 3, 20, 24}, {2, 4, 32, 24}, Layout::ROW_MAJOR);
+    // Large enough to be split across the executor
+    check_bfloat8_b({8, 3, 224, 224}, {8, 3, 224, 256}, Layout::TILE);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    test_ingest_strided();
+    test_ingest_bfloat16();
+    test_ingest_bfloat8_b();
+    return 0;
+}
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <numeric>
+#include <vector>
+
+#include "common/constants.hpp"
+#include "tensor/owned_buffer.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tensor/tensor.hpp"
+
+using tt::tt_metal::DataType;
+using tt::tt_metal::Layout;
+using tt::tt_metal::OwnedStorage;
+using tt::tt_metal::Shape;
+using tt::tt_metal::Tensor;
+
+namespace {
+
+constexpr uint32_t PAD_VALUE = 0xFFFF;
+
+Tensor iota_tensor(const std::vector<uint32_t>& shape) {
+    std::vector<uint32_t> data(std::accumulate(shape.begin(), shape.end(), 1u, std::multiplies<uint32_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    return Tensor(OwnedStorage{tt::tt_metal::owned_buffer::create<uint32_t>(std::move(data))}, shape, DataType::UINT32, Layout::ROW_MAJOR);
+}
+
+// Flat index of the element at index in shape, or -1 when index is outside of [start, start + box)
+int64_t flat_index(const std::vector<uint32_t>& shape, const std::vector<uint32_t>& start, const std::vector<uint32_t>& box, const std::vector<uint32_t>& index) {
+    int64_t flat = 0;
+    for (auto dim = 0; dim < shape.size(); dim++) {
+        if (index[dim] < start[dim] or index[dim] >= start[dim] + box[dim]) {
+            return -1;
+        }
+        flat = flat * shape[dim] + index[dim] - start[dim];
+    }
+    return flat;
+}
+
+// Element by element reference: every element of the output reads the input element it maps to, or the pad value
+void check_pad(const std::vector<uint32_t>& input_shape, const std::vector<uint32_t>& output_shape, const std::vector<uint32_t>& input_start) {
+    auto input = iota_tensor(input_shape);
+    auto output = input.pad(output_shape, input_start, PAD_VALUE);
+    TT_FATAL(output.shape() == Shape(output_shape));
+    auto output_data = tt::tt_metal::owned_buffer::get_as<uint32_t>(output);
+
+    std::vector<uint32_t> index(output_shape.size(), 0);
+    for (auto i = 0; i < output_data.size(); i++) {
+        auto flat = flat_index(input_shape, input_start, input_shape, index);
+        uint32_t expected = flat < 0 ? PAD_VALUE : flat;
+        TT_FATAL(output_data[i] == expected, "Element {} is {}, expected {}", i, output_data[i], expected);
+        for (int dim = index.size() - 1; dim >= 0 and ++index[dim] == output_shape[dim]; dim--) {
+            index[dim] = 0;
+        }
+    }
+
+    // Unpadding the same range has to give back the input
+    std::vector<uint32_t> output_end;
+    for (auto dim = 0; dim < input_shape.size(); dim++) {
+        output_end.push_back(input_start[dim] + input_shape[dim] - 1);
+    }
+    auto unpadded = output.unpad(input_start, output_end);
+    TT_FATAL(unpadded.shape() == input.shape());
+    auto input_data = tt::tt_metal::owned_buffer::get_as<uint32_t>(input);
+    auto unpadded_data = tt::tt_metal::owned_buffer::get_as<uint32_t>(unpadded);
+    TT_FATAL(input_data == unpadded_data, "Unpad didn't restore the input of pad");
+}
+
+void test_pad_unpad_row_major() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    check_pad({7}, {12}, {3});
+    check_pad({5, 6}, {5, 6}, {0, 0});
+    check_pad({5, 6}, {9, 6}, {2, 0});
+    check_pad({1, 1, 18, 13}, {1, 1, 32, 32}, {0, 0, 0, 0});
+    check_pad({2, 3, 18, 13}, {3, 5, 32, 32}, {1, 1, 5, 7});
+    check_pad({2, 3, 4, 5, 6}, {2, 4, 4, 8, 6}, {0, 1, 0, 2, 0});
+    // Large enough to be split across the executor
+    check_pad({8, 3, 224, 224}, {8, 3, 224, 256}, {0, 0, 0, 16});
+    check_pad({8, 3, 224, 224}, {8, 4, 224, 224}, {0, 1, 0, 0});
+}
+
+void test_pad_unpad_tile() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    using tt::constants::TILE_HEIGHT;
+    using tt::constants::TILE_WIDTH;
+
+    auto input = iota_tensor({2, 3, 2 * TILE_HEIGHT, TILE_WIDTH});
+    std::vector<uint32_t> output_shape = {2, 4, 3 * TILE_HEIGHT, 3 * TILE_WIDTH};
+    std::vector<uint32_t> input_start = {0, 1, TILE_HEIGHT, TILE_WIDTH};
+
+    // Padding in tile layout has to match padding in row major layout
+    auto expected = input.pad(output_shape, input_start, PAD_VALUE);
+    auto output = input.to(Layout::TILE).pad(output_shape, input_start, PAD_VALUE);
+    TT_FATAL(output.layout() == Layout::TILE);
+    TT_FATAL(tt::tt_metal::owned_buffer::get_as<uint32_t>(output.to(Layout::ROW_MAJOR)) == tt::tt_metal::owned_buffer::get_as<uint32_t>(expected));
+
+    auto unpadded = output.unpad(input_start, {1, 3, 3 * TILE_HEIGHT - 1, 2 * TILE_WIDTH - 1});
+    TT_FATAL(unpadded.shape() == input.shape());
+    TT_FATAL(tt::tt_metal::owned_buffer::get_as<uint32_t>(unpadded.to(Layout::ROW_MAJOR)) == tt::tt_metal::owned_buffer::get_as<uint32_t>(input));
+}
+
+void test_pad_to_tile_rank_n() {
+    tt::log_info(tt::LogTest, "Running {}", __func__);
+    for (const auto& shape : std::vector<std::vector<uint32_t>>{{18, 13}, {3, 18, 13}, {2, 3, 18, 13}, {2, 2, 3, 40, 70}}) {
+        auto input = iota_tensor(shape);
+        auto padded = input.pad_to_tile(PAD_VALUE);
+        TT_FATAL(padded.shape().rank() == shape.size());
+        TT_FATAL(padded.shape()[-2] % tt::constants::TILE_HEIGHT == 0 and padded.shape()[-1] % tt::constants::TILE_WIDTH == 0);
+        auto unpadded = padded.unpad_from_tile(input.shape());
+        TT_FATAL(tt::tt_metal::owned_buffer::get_as<uint32_t>(unpadded) == tt::tt_metal::owned_buffer::get_as<uint32_t>(input));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    test_pad_unpad_row_major();
+    test_pad_unpad_tile();
+    test_pad_to_tile_rank_n();
+    return 0;
+}
@@ -0,0 +1,259 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tt_metal/common/logger.hpp"
+#include "tt_metal/common/test_common.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+
+constexpr uint32_t DEFAULT_NUM_OPS = 200000;
+constexpr uint32_t DEFAULT_BANK_SIZE_MB = 1024;
+constexpr uint32_t DEFAULT_LIVE_BUFFERS = 4000;
+constexpr uint32_t DEFAULT_REPETITIONS = 3;
+constexpr uint32_t MIN_ALLOCATION_SIZE = 32;
+constexpr uint32_t ALIGNMENT = 32;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Host-only allocator benchmark
+//
+// Replays an allocation trace against FreeList (first and best fit) and IndexedFreeList,
+// reports time per operation and checks that IndexedFreeList places every buffer exactly
+// where best fit FreeList does. The trace is either read from a file (-f) or generated to
+// mimic a model forward pass: many live buffers of mixed sizes with per layer churn.
+//
+// Trace format, one operation per line:
+//   alloc <id> <size> <bottom_up>
+//   alloc_at <id> <address> <size>
+//   free <id>
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+using namespace tt::tt_metal::allocator;
+
+struct TraceOp {
+    enum class Type { ALLOC, ALLOC_AT, FREE };
+    Type type;
+    uint32_t id;
+    uint64_t size = 0;
+    uint64_t address = 0;
+    bool bottom_up = true;
+};
+
+uint32_t num_ops_g = DEFAULT_NUM_OPS;
+uint64_t bank_size_g = uint64_t(DEFAULT_BANK_SIZE_MB) << 20;
+uint32_t live_buffers_g = DEFAULT_LIVE_BUFFERS;
+uint32_t repetitions_g = DEFAULT_REPETITIONS;
+std::string trace_file_g;
+std::string dump_file_g;
+
+void init(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+
+    if (test_args::has_command_option(input_args, "-h") ||
+        test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage:");
+        log_info(LogTest, "  -f: trace file to replay (default: generate a synthetic trace)");
+        log_info(LogTest, "  -n: number of operations in the synthetic trace (default {})", DEFAULT_NUM_OPS);
+        log_info(LogTest, "  -l: target number of live buffers in the synthetic trace (default {})", DEFAULT_LIVE_BUFFERS);
+        log_info(LogTest, "  -s: bank size in MB (default {})", DEFAULT_BANK_SIZE_MB);
+        log_info(LogTest, "  -r: repetitions, best time is reported (default {})", DEFAULT_REPETITIONS);
+        log_info(LogTest, "  -w: write the synthetic trace to this file");
+        exit(0);
+    }
+
+    num_ops_g = test_args::get_command_option_uint32(input_args, "-n", DEFAULT_NUM_OPS);
+    live_buffers_g = test_args::get_command_option_uint32(input_args, "-l", DEFAULT_LIVE_BUFFERS);
+    bank_size_g = uint64_t(test_args::get_command_option_uint32(input_args, "-s", DEFAULT_BANK_SIZE_MB)) << 20;
+    repetitions_g = std::max<uint32_t>(1, test_args::get_command_option_uint32(input_args, "-r", DEFAULT_REPETITIONS));
+    trace_file_g = test_args::get_command_option(input_args, "-f", "");
+    dump_file_g = test_args::get_command_option(input_args, "-w", "");
+}
+
+std::vector<TraceOp> read_trace(const std::string &file_name) {
+    std::ifstream f(file_name);
+    TT_FATAL(f.is_open(), "Failed to open allocation trace {}", file_name);
+    std::vector<TraceOp> trace;
+    std::string line;
+    while (std::getline(f, line)) {
+        std::istringstream record(line);
+        std::string type;
+        record >> type;
+        TraceOp op;
+        if (type == "alloc") {
+            op.type = TraceOp::Type::ALLOC;
+            record >> op.id >> op.size >> op.bottom_up;
+        } else if (type == "alloc_at") {
+            op.type = TraceOp::Type::ALLOC_AT;
+            record >> op.id >> op.address >> op.size;
+        } else if (type == "free") {
+            op.type = TraceOp::Type::FREE;
+            record >> op.id;
+        } else {
+            continue;
+        }
+        TT_FATAL(not record.fail(), "Malformed allocation trace line: {}", line);
+        trace.push_back(op);
+    }
+    return trace;
+}
+
+void write_trace(const std::string &file_name, const std::vector<TraceOp> &trace) {
+    std::ofstream f(file_name);
+    for (const auto &op : trace) {
+        switch (op.type) {
+            case TraceOp::Type::ALLOC: f << "alloc " << op.id << " " << op.size << " " << op.bottom_up << "\n"; break;
+            case TraceOp::Type::ALLOC_AT: f << "alloc_at " << op.id << " " << op.address << " " << op.size << "\n"; break;
+            case TraceOp::Type::FREE: f << "free " << op.id << "\n"; break;
+        }
+    }
+}
+
+// Interleaved buffers come in a handful of tile multiples, sharded activations and circular buffer backing
+// buffers are allocated top down and churn every layer
+std::vector<TraceOp> generate_trace() {
+    std::mt19937 rng(0);
+    std::vector<uint64_t> tile_counts = {1, 2, 4, 8, 16, 32, 64, 128, 256, 1024};
+    std::uniform_int_distribution<size_t> tile_count_dist(0, tile_counts.size() - 1);
+    std::uniform_int_distribution<uint32_t> percent_dist(0, 99);
+
+    std::vector<TraceOp> trace;
+    std::vector<uint32_t> live;
+    uint32_t next_id = 0;
+    uint64_t live_bytes = 0;
+    std::unordered_map<uint32_t, uint64_t> sizes;
+    while (trace.size() < num_ops_g) {
+        bool grow = live.size() < live_buffers_g and live_bytes < bank_size_g / 2;
+        if (live.empty() or (grow and percent_dist(rng) < 70) or (not grow and percent_dist(rng) < 45)) {
+            uint64_t size = tile_counts[tile_count_dist(rng)] * 2048 + (percent_dist(rng) < 20 ? percent_dist(rng) * 32 : 0);
+            trace.push_back({.type = TraceOp::Type::ALLOC, .id = next_id, .size = size, .bottom_up = percent_dist(rng) < 60});
+            sizes[next_id] = size;
+            live_bytes += size;
+            live.push_back(next_id++);
+        } else {
+            // Mostly free recent buffers, as intermediate activations are, sometimes an old one
+            size_t index = percent_dist(rng) < 80 ? live.size() - 1 - std::min<size_t>(live.size() - 1, percent_dist(rng) % 8)
+                                                  : std::uniform_int_distribution<size_t>(0, live.size() - 1)(rng);
+            trace.push_back({.type = TraceOp::Type::FREE, .id = live[index]});
+            live_bytes -= sizes[live[index]];
+            live[index] = live.back();
+            live.pop_back();
+        }
+    }
+    return trace;
+}
+
+struct ReplayResult {
+    double alloc_ns;
+    double free_ns;
+    uint32_t failed_allocations;
+    std::vector<uint64_t> addresses;
+};
+
+ReplayResult replay(Algorithm &algorithm, const std::vector<TraceOp> &trace) {
+    ReplayResult result{.alloc_ns = 0, .free_ns = 0, .failed_allocations = 0};
+    result.addresses.reserve(trace.size());
+    std::unordered_map<uint32_t, uint64_t> id_to_address;
+    uint32_t num_allocs = 0, num_frees = 0;
+    for (const auto &op : trace) {
+        auto start = std::chrono::steady_clock::now();
+        std::optional<uint64_t> address;
+        switch (op.type) {
+            case TraceOp::Type::ALLOC: address = algorithm.allocate(op.size, op.bottom_up); break;
+            case TraceOp::Type::ALLOC_AT: address = algorithm.allocate_at_address(op.address, op.size); break;
+            case TraceOp::Type::FREE: {
+                auto it = id_to_address.find(op.id);
+                if (it != id_to_address.end()) {
+                    algorithm.deallocate(it->second);
+                    id_to_address.erase(it);
+                }
+            } break;
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        if (op.type == TraceOp::Type::FREE) {
+            result.free_ns += ns;
+            num_frees++;
+            continue;
+        }
+        result.alloc_ns += ns;
+        num_allocs++;
+        if (address.has_value()) {
+            id_to_address[op.id] = address.value();
+        } else {
+            result.failed_allocations++;
+        }
+        result.addresses.push_back(address.value_or(std::numeric_limits<uint64_t>::max()));
+    }
+    result.alloc_ns /= std::max<uint32_t>(1, num_allocs);
+    result.free_ns /= std::max<uint32_t>(1, num_frees);
+    return result;
+}
+
+template <class Factory>
+ReplayResult best_of(Factory factory, const std::vector<TraceOp> &trace) {
+    ReplayResult best;
+    for (uint32_t i = 0; i < repetitions_g; i++) {
+        std::unique_ptr<Algorithm> algorithm = factory();
+        auto result = replay(*algorithm, trace);
+        if (i == 0 or result.alloc_ns + result.free_ns < best.alloc_ns + best.free_ns) {
+            best = std::move(result);
+        }
+    }
+    return best;
+}
+
+int main(int argc, char **argv) {
+    init(argc, argv);
+
+    std::vector<TraceOp> trace = trace_file_g.empty() ? generate_trace() : read_trace(trace_file_g);
+    if (not dump_file_g.empty()) {
+        write_trace(dump_file_g, trace);
+    }
+
+    auto free_list_first = best_of([] {
+        return std::make_unique<FreeList>(bank_size_g, 0, MIN_ALLOCATION_SIZE, ALIGNMENT, FreeList::SearchPolicy::FIRST);
+    }, trace);
+    auto free_list_best = best_of([] {
+        return std::make_unique<FreeList>(bank_size_g, 0, MIN_ALLOCATION_SIZE, ALIGNMENT, FreeList::SearchPolicy::BEST);
+    }, trace);
+    auto indexed_free_list = best_of([] {
+        return std::make_unique<IndexedFreeList>(bank_size_g, 0, MIN_ALLOCATION_SIZE, ALIGNMENT);
+    }, trace);
+
+    log_info(LogTest, "Trace: {} operations, bank size {} MB", trace.size(), bank_size_g >> 20);
+    for (const auto &[name, result] : std::vector<std::pair<std::string, const ReplayResult &>>{
+             {"FreeList FIRST", free_list_first}, {"FreeList BEST", free_list_best}, {"IndexedFreeList", indexed_free_list}}) {
+        log_info(
+            LogTest,
+            "{:<16} allocate {:>8.1f}ns, deallocate {:>8.1f}ns, failed allocations {}",
+            name,
+            result.alloc_ns,
+            result.free_ns,
+            result.failed_allocations);
+    }
+
+    bool pass = true;
+    for (size_t i = 0; i < free_list_best.addresses.size(); i++) {
+        if (free_list_best.addresses[i] != indexed_free_list.addresses[i]) {
+            log_error(LogTest, "IndexedFreeList diverged from FreeList BEST at allocation {}", i);
+            pass = false;
+            break;
+        }
+    }
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+        return 0;
+    } else {
+        log_fatal(LogTest, "Test Failed\n");
+        return 1;
+    }
+}
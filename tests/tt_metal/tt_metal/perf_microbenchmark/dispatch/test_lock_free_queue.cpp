@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "tt_metal/common/logger.hpp"
+#include "tt_metal/common/test_common.hpp"
+#include "tt_metal/impl/dispatch/lock_free_queue.hpp"
+#include "tt_metal/impl/dispatch/thread_safe_queue.hpp"
+
+constexpr uint32_t DEFAULT_ITERATIONS = 1000000;
+constexpr uint32_t DEFAULT_CAPACITY = 100;
+constexpr uint32_t DEFAULT_BATCH_SIZE = 32;
+constexpr uint32_t DEFAULT_PRODUCERS = 1;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Host-only microbenchmark of the dispatch queues
+//
+// Compares TSQueue (mutex + condition variables) against LockFreeQueue (SPSC, MPSC and
+// batched SPSC) for enqueue latency and end-to-end producer/consumer throughput
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+using namespace tt::tt_metal;
+
+uint32_t iterations_g = DEFAULT_ITERATIONS;
+uint32_t capacity_g = DEFAULT_CAPACITY;
+uint32_t batch_size_g = DEFAULT_BATCH_SIZE;
+uint32_t producers_g = DEFAULT_PRODUCERS;
+
+void init(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+
+    if (test_args::has_command_option(input_args, "-h") ||
+        test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage:");
+        log_info(LogTest, "  -i: iterations (default {})", DEFAULT_ITERATIONS);
+        log_info(LogTest, "  -c: queue capacity (default {})", DEFAULT_CAPACITY);
+        log_info(LogTest, "  -b: batch size for batched push/pop (default {})", DEFAULT_BATCH_SIZE);
+        log_info(LogTest, "  -p: number of producers for the MPSC run (default {})", DEFAULT_PRODUCERS);
+        exit(0);
+    }
+
+    iterations_g = test_args::get_command_option_uint32(input_args, "-i", DEFAULT_ITERATIONS);
+    capacity_g = test_args::get_command_option_uint32(input_args, "-c", DEFAULT_CAPACITY);
+    batch_size_g = std::max<uint32_t>(1, test_args::get_command_option_uint32(input_args, "-b", DEFAULT_BATCH_SIZE));
+    producers_g = std::max<uint32_t>(1, test_args::get_command_option_uint32(input_args, "-p", DEFAULT_PRODUCERS));
+}
+
+struct QueueResult {
+    double throughput_mops;
+    double mean_push_ns;
+    double p99_push_ns;
+    bool checksum_ok;
+};
+
+void log_result(const std::string &name, const QueueResult &result) {
+    log_info(
+        LogTest,
+        "{:<24} throughput {:>8.2f} Mops/s, push mean {:>8.1f}ns, push p99 {:>8.1f}ns",
+        name,
+        result.throughput_mops,
+        result.mean_push_ns,
+        result.p99_push_ns);
+}
+
+// Every producer pushes iterations / num_producers values, consumer sums them so a lost or duplicated
+// element shows up as a checksum mismatch
+template <class Queue, class PushFn, class PopFn>
+QueueResult run(Queue &q, uint32_t num_producers, PushFn push_fn, PopFn pop_fn) {
+    uint32_t per_producer = iterations_g / num_producers;
+    uint64_t total = uint64_t(per_producer) * num_producers;
+    std::vector<std::vector<uint32_t>> push_ns(num_producers, std::vector<uint32_t>(per_producer));
+
+    uint64_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&] { sum = pop_fn(q, total); });
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < num_producers; p++) {
+        producers.emplace_back([&, p] { push_fn(q, per_producer, push_ns[p]); });
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    consumer.join();
+    auto end = std::chrono::steady_clock::now();
+
+    std::vector<uint32_t> all_push_ns;
+    for (const auto &ns : push_ns) {
+        all_push_ns.insert(all_push_ns.end(), ns.begin(), ns.end());
+    }
+    std::sort(all_push_ns.begin(), all_push_ns.end());
+    double mean_ns = 0;
+    for (uint32_t ns : all_push_ns) {
+        mean_ns += ns;
+    }
+    mean_ns /= std::max<size_t>(1, all_push_ns.size());
+
+    std::chrono::duration<double> elapsed_seconds = end - start;
+    return QueueResult{
+        .throughput_mops = total / elapsed_seconds.count() / 1e6,
+        .mean_push_ns = mean_ns,
+        .p99_push_ns = all_push_ns.empty() ? 0.0 : double(all_push_ns[all_push_ns.size() * 99 / 100]),
+        .checksum_ok = sum == uint64_t(per_producer) * (per_producer - 1) / 2 * num_producers};
+}
+
+template <class Queue>
+void push_each(Queue &q, uint32_t count, std::vector<uint32_t> &push_ns) {
+    for (uint32_t i = 0; i < count; i++) {
+        auto start = std::chrono::steady_clock::now();
+        q.push(i);
+        push_ns[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+template <class Queue>
+uint64_t pop_each(Queue &q, uint64_t count) {
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < count; i++) {
+        sum += q.peek();
+        q.pop();
+    }
+    return sum;
+}
+
+template <class Queue>
+void push_batched(Queue &q, uint32_t count, std::vector<uint32_t> &push_ns) {
+    std::vector<uint32_t> batch;
+    for (uint32_t i = 0; i < count; i += batch_size_g) {
+        batch.clear();
+        for (uint32_t j = i; j < std::min(count, i + batch_size_g); j++) {
+            batch.push_back(j);
+        }
+        auto start = std::chrono::steady_clock::now();
+        q.push_batch(batch.begin(), batch.end());
+        uint32_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        std::fill(push_ns.begin() + i, push_ns.begin() + i + batch.size(), ns / batch.size());
+    }
+}
+
+template <class Queue>
+uint64_t pop_batched(Queue &q, uint64_t count) {
+    uint64_t sum = 0;
+    std::vector<uint32_t> batch;
+    for (uint64_t popped = 0; popped < count;) {
+        batch.clear();
+        popped += q.pop_batch(batch, batch_size_g);
+        for (uint32_t value : batch) {
+            sum += value;
+        }
+    }
+    return sum;
+}
+
+int main(int argc, char **argv) {
+    init(argc, argv);
+
+    bool pass = true;
+    std::vector<std::pair<std::string, QueueResult>> results;
+
+    {
+        TSQueue<uint32_t> q(capacity_g);
+        results.push_back({"TSQueue", run(q, 1, push_each<TSQueue<uint32_t>>, pop_each<TSQueue<uint32_t>>)});
+    }
+    {
+        using Queue = LockFreeQueue<uint32_t>;
+        Queue q(capacity_g);
+        results.push_back({"LockFreeQueue SPSC", run(q, 1, push_each<Queue>, pop_each<Queue>)});
+    }
+    {
+        using Queue = LockFreeQueue<uint32_t>;
+        Queue q(capacity_g);
+        results.push_back({"LockFreeQueue SPSC batch", run(q, 1, push_batched<Queue>, pop_batched<Queue>)});
+    }
+    {
+        TSQueue<uint32_t> q(capacity_g);
+        results.push_back({"TSQueue MP", run(q, producers_g, push_each<TSQueue<uint32_t>>, pop_each<TSQueue<uint32_t>>)});
+    }
+    {
+        using Queue = LockFreeQueue<uint32_t, QueueProducerMode::MULTI>;
+        Queue q(capacity_g);
+        results.push_back({"LockFreeQueue MPSC", run(q, producers_g, push_each<Queue>, pop_each<Queue>)});
+    }
+
+    log_info(LogTest, "Iterations: {}", iterations_g);
+    log_info(LogTest, "Capacity: {}", capacity_g);
+    log_info(LogTest, "Batch size: {}", batch_size_g);
+    log_info(LogTest, "Producers: {}", producers_g);
+    for (const auto &[name, result] : results) {
+        log_result(name, result);
+        if (not result.checksum_ok) {
+            log_error(LogTest, "{} lost or duplicated elements", name);
+            pass = false;
+        }
+    }
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+        return 0;
+    } else {
+        log_fatal(LogTest, "Test Failed\n");
+        return 1;
+    }
+}
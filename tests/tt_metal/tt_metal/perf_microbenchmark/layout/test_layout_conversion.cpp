@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "tt_metal/common/bfloat16.hpp"
+#include "tt_metal/common/layout_conversion.hpp"
+#include "tt_metal/common/logger.hpp"
+#include "tt_metal/common/test_common.hpp"
+#include "tt_metal/common/test_tiles.hpp"
+
+constexpr uint32_t DEFAULT_NUM_BLOCKS = 8;
+constexpr uint32_t DEFAULT_HEIGHT = 1024;
+constexpr uint32_t DEFAULT_WIDTH = 1024;
+constexpr uint32_t DEFAULT_REPETITIONS = 5;
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Host-only layout conversion benchmark
+//
+// Converts a [num_blocks, 1, height, width] tensor between row major and tile layout with
+// the element wise reference (through the swizzled layout), the SIMD engine on one thread
+// and the SIMD engine split across the executor (TT_METAL_THREADCOUNT threads). Reports
+// GB/s of tensor data converted and checks that every method produces the same result.
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+namespace layout_conversion = tt::tt_metal::layout_conversion;
+
+uint32_t num_blocks_g = DEFAULT_NUM_BLOCKS;
+uint32_t height_g = DEFAULT_HEIGHT;
+uint32_t width_g = DEFAULT_WIDTH;
+uint32_t repetitions_g = DEFAULT_REPETITIONS;
+bool skip_reference_g = false;
+
+void init(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+
+    if (test_args::has_command_option(input_args, "-h") ||
+        test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage:");
+        log_info(LogTest, "  -n: number of blocks (default {})", DEFAULT_NUM_BLOCKS);
+        log_info(LogTest, "  -y: block height, multiple of 32 (default {})", DEFAULT_HEIGHT);
+        log_info(LogTest, "  -x: block width, multiple of 32 (default {})", DEFAULT_WIDTH);
+        log_info(LogTest, "  -r: repetitions, best time is reported (default {})", DEFAULT_REPETITIONS);
+        log_info(LogTest, "  --skip-reference: don't run the element wise reference");
+        exit(0);
+    }
+
+    num_blocks_g = test_args::get_command_option_uint32(input_args, "-n", DEFAULT_NUM_BLOCKS);
+    height_g = test_args::get_command_option_uint32(input_args, "-y", DEFAULT_HEIGHT);
+    width_g = test_args::get_command_option_uint32(input_args, "-x", DEFAULT_WIDTH);
+    repetitions_g = std::max<uint32_t>(1, test_args::get_command_option_uint32(input_args, "-r", DEFAULT_REPETITIONS));
+    skip_reference_g = test_args::has_command_option(input_args, "--skip-reference");
+    TT_FATAL(height_g % 32 == 0 and width_g % 32 == 0, "Height and width must be multiples of 32");
+}
+
+// Returns GB/s of the fastest repetition
+double best_bandwidth(size_t num_bytes, const std::function<void()> &fn) {
+    double best_s = std::numeric_limits<double>::max();
+    for (uint32_t i = 0; i < repetitions_g; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        best_s = std::min(best_s, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return num_bytes / best_s / 1e9;
+}
+
+template <typename T>
+bool run(const std::string &type_name) {
+    std::vector<uint32_t> shape = {num_blocks_g, 1, height_g, width_g};
+    size_t num_elements = size_t(num_blocks_g) * height_g * width_g;
+    size_t num_bytes = num_elements * sizeof(T);
+    std::vector<T> row_major(num_elements);
+    for (size_t i = 0; i < num_elements; i++) {
+        row_major[i] = static_cast<T>(uint32_t(i));
+    }
+    std::vector<T> tiled(num_elements), untiled(num_elements);
+    std::vector<T> tiled_single_thread(num_elements), untiled_single_thread(num_elements);
+    std::vector<T> tiled_reference, untiled_reference;
+    bool pass = true;
+
+    auto tilize_single_thread = [&] {
+        layout_conversion::detail::tilize_tile_rows<sizeof(T)>(
+            reinterpret_cast<const std::uint8_t *>(row_major.data()),
+            reinterpret_cast<std::uint8_t *>(tiled_single_thread.data()),
+            width_g,
+            0,
+            num_blocks_g * height_g / 32);
+    };
+    auto untilize_single_thread = [&] {
+        layout_conversion::detail::untilize_tile_rows<sizeof(T)>(
+            reinterpret_cast<const std::uint8_t *>(tiled_single_thread.data()),
+            reinterpret_cast<std::uint8_t *>(untiled_single_thread.data()),
+            width_g,
+            0,
+            num_blocks_g * height_g / 32);
+    };
+    double tilize_single_thread_gbps = best_bandwidth(num_bytes, tilize_single_thread);
+    double untilize_single_thread_gbps = best_bandwidth(num_bytes, untilize_single_thread);
+    double tilize_gbps = best_bandwidth(num_bytes, [&] {
+        layout_conversion::tilize(row_major.data(), tiled.data(), num_blocks_g, height_g, width_g);
+    });
+    double untilize_gbps = best_bandwidth(num_bytes, [&] {
+        layout_conversion::untilize(tiled.data(), untiled.data(), num_blocks_g, height_g, width_g);
+    });
+    pass &= tiled == tiled_single_thread and untiled == untiled_single_thread and untiled == row_major;
+
+    if (not skip_reference_g) {
+        double tilize_reference_gbps = best_bandwidth(num_bytes, [&] {
+            tiled_reference = convert_to_tile_layout<T>(tilize_nchw<T>(row_major, shape));
+        });
+        double untilize_reference_gbps = best_bandwidth(num_bytes, [&] {
+            untiled_reference = untilize_nchw<T>(convert_to_flat_layout<T>(tiled_reference), shape);
+        });
+        pass &= tiled == tiled_reference and untiled == untiled_reference;
+        log_info(
+            LogTest,
+            "{:<8} reference:     tilize {:>7.2f} GB/s, untilize {:>7.2f} GB/s",
+            type_name,
+            tilize_reference_gbps,
+            untilize_reference_gbps);
+    }
+    log_info(
+        LogTest,
+        "{:<8} 1 thread:      tilize {:>7.2f} GB/s, untilize {:>7.2f} GB/s",
+        type_name,
+        tilize_single_thread_gbps,
+        untilize_single_thread_gbps);
+    log_info(
+        LogTest,
+        "{:<8} {:>2} threads:    tilize {:>7.2f} GB/s, untilize {:>7.2f} GB/s",
+        type_name,
+        tt::tt_metal::detail::EXECUTOR_NTHREADS,
+        tilize_gbps,
+        untilize_gbps);
+    if (not pass) {
+        log_error(LogTest, "{} layout conversion results differ", type_name);
+    }
+    return pass;
+}
+
+int main(int argc, char **argv) {
+    init(argc, argv);
+
+    log_info(LogTest, "Shape: [{}, 1, {}, {}]", num_blocks_g, height_g, width_g);
+    bool pass = true;
+    pass &= run<bfloat16>("bfloat16");
+    pass &= run<float>("float32");
+    pass &= run<uint32_t>("uint32");
+
+    if (pass) {
+        log_info(LogTest, "Test Passed");
+        return 0;
+    } else {
+        log_fatal(LogTest, "Test Failed\n");
+        return 1;
+    }
+}
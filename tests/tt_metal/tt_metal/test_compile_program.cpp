@@ -12,6 +12,7 @@
 #include "common/bfloat16.hpp"
 #include "tt_metal/llrt/tt_memory.h"
 #include "tt_metal/detail/kernel_cache.hpp"
+#include "tt_metal/detail/persistent_kernel_cache.hpp"
 #include "tt_metal/detail/tt_metal.hpp"
 #include "tt_metal/detail/program.hpp"
 
@@ -216,6 +217,50 @@ bool test_compile_program_after_clean_kernel_binary_directory(Device *device) {
     return pass;
 }
 
+bool test_compile_program_with_persistent_cache(Device *device) {
+    bool pass = true;
+
+    ClearKernelCache(device->id());
+
+    ProgramAttributes default_attributes;
+    auto program = create_program(device, default_attributes);
+    auto kernel_cache_status = CompileProgramTestWrapper(device, program);
+    assert_kernel_binary_path_exists(program, device->id(), kernel_cache_status);
+    std::unordered_map<std::string, std::string> kernel_name_to_hash = kernel_cache_status.kernel_name_to_hash_str;
+
+    // Only clearing the in-memory lookup mimics a new process, binaries have to come from disk
+    detail::EnablePersistentKernelCache();
+    detail::HashLookup::inst().clear();
+    program.invalidate_compile();
+    auto persistent_cache_status = CompileProgramTestWrapper(device, program);
+    assert_program_cache_hit_status(program, /*hit_expected=*/true, persistent_cache_status);
+    assert_kernel_hash_matches(kernel_name_to_hash, persistent_cache_status);
+
+    // A truncated binary must not be trusted, the kernel is rebuilt in place under the same key
+    auto root_dir = jit_build_get_kernel_compile_outpath(device->id());
+    std::vector<std::pair<std::string, uintmax_t>> binaries;
+    for (const auto &[kernel_name, hash] : kernel_name_to_hash) {
+        for (auto const &dir_entry : std::filesystem::recursive_directory_iterator{root_dir + kernel_name + "/" + hash}) {
+            if (dir_entry.path().extension() == ".elf") {
+                binaries.push_back({dir_entry.path().string(), dir_entry.file_size()});
+            }
+        }
+    }
+    TT_FATAL(not binaries.empty());
+    std::filesystem::resize_file(binaries.front().first, 0);
+
+    detail::HashLookup::inst().clear();
+    program.invalidate_compile();
+    auto rebuilt_cache_status = CompileProgramTestWrapper(device, program);
+    assert_kernel_hash_matches(kernel_name_to_hash, rebuilt_cache_status);
+    for (const auto &[binary, size] : binaries) {
+        TT_FATAL(std::filesystem::file_size(binary) == size, "Expected " + binary + " to be rebuilt");
+    }
+    detail::DisablePersistentKernelCache();
+
+    return pass;
+}
+
 void assert_hash_comparison_for_kernel_type(
     const Program &program,
     const std::unordered_map<std::string, std::string> &prev_kernel_name_to_hash,
@@ -352,6 +397,8 @@ int main(int argc, char **argv) {
 
         pass &= test_compile_program_after_clean_kernel_binary_directory(device);
 
+        pass &= test_compile_program_with_persistent_cache(device);
+
         pass &= test_compile_program_with_modified_program(device);
 
 	pass &= CloseDevice(device);
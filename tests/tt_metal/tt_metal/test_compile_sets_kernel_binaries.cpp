@@ -131,9 +131,13 @@ int main(int argc, char **argv) {
 
         int num_compiles = 3;
         // kernel->binaries() returns 32B aligned binaries
-        std::vector<ll_api::memory> compute_binaries;
-        std::vector<ll_api::memory> brisc_binaries;
-        std::vector<ll_api::memory> ncrisc_binaries;
+        std::vector<std::shared_ptr<const ll_api::memory>> compute_binaries;
+        std::vector<std::shared_ptr<const ll_api::memory>> brisc_binaries;
+        std::vector<std::shared_ptr<const ll_api::memory>> ncrisc_binaries;
+        auto same_binaries = [](const std::vector<std::shared_ptr<const ll_api::memory>> &a,
+                                const std::vector<std::shared_ptr<const ll_api::memory>> &b) {
+            return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const auto &x, const auto &y) { return *x == *y; });
+        };
         for (int i = 0; i < num_compiles; i++) {
             tt_metal::detail::CompileProgram(device, program);
             if (i == 0) {
@@ -144,24 +148,24 @@ int main(int argc, char **argv) {
                 ncrisc_binaries = riscv1_kernel->binaries(device->id());
                 TT_FATAL(ncrisc_binaries.size() == 1, "Expected 1 NCRISC binary!");
             } else {
-                TT_FATAL(compute_kernel->binaries(device->id()) == compute_binaries);
-                TT_FATAL(riscv0_kernel->binaries(device->id()) == brisc_binaries);
-                TT_FATAL(riscv1_kernel->binaries(device->id()) == ncrisc_binaries);
+                TT_FATAL(same_binaries(compute_kernel->binaries(device->id()), compute_binaries));
+                TT_FATAL(same_binaries(riscv0_kernel->binaries(device->id()), brisc_binaries));
+                TT_FATAL(same_binaries(riscv1_kernel->binaries(device->id()), ncrisc_binaries));
             }
             std::string brisc_hex_path = device->build_kernel_target_path(
                 JitBuildProcessorType::DATA_MOVEMENT, 0, get_latest_kernel_binary_path(device->id(), riscv0_kernel));
-            ll_api::memory brisc_binary = llrt::get_risc_binary(brisc_hex_path);
-            TT_FATAL(brisc_binary == brisc_binaries.at(0), "Expected saved BRISC binary to be the same as binary in persistent cache");
+            const ll_api::memory &brisc_binary = *llrt::get_risc_binary(brisc_hex_path);
+            TT_FATAL(brisc_binary == *brisc_binaries.at(0), "Expected saved BRISC binary to be the same as binary in persistent cache");
             std::string ncrisc_hex_path = device->build_kernel_target_path(
                 JitBuildProcessorType::DATA_MOVEMENT, 1, get_latest_kernel_binary_path(device->id(), riscv1_kernel));
-            ll_api::memory ncrisc_binary = llrt::get_risc_binary(ncrisc_hex_path);
-            TT_FATAL(ncrisc_binary == ncrisc_binaries.at(0), "Expected saved NCRISC binary to be the same as binary in persistent cache");
+            const ll_api::memory &ncrisc_binary = *llrt::get_risc_binary(ncrisc_hex_path);
+            TT_FATAL(ncrisc_binary == *ncrisc_binaries.at(0), "Expected saved NCRISC binary to be the same as binary in persistent cache");
             for (int trisc_id = 0; trisc_id <= 2; trisc_id++) {
                 std::string trisc_id_str = std::to_string(trisc_id);
                 std::string trisc_hex_path = device->build_kernel_target_path(
                     JitBuildProcessorType::COMPUTE, trisc_id, get_latest_kernel_binary_path(device->id(), compute_kernel));
-                ll_api::memory trisc_binary = llrt::get_risc_binary(trisc_hex_path);
-                TT_FATAL(trisc_binary == compute_binaries.at(trisc_id), "Expected saved TRISC binary for " + trisc_id_str + " to be the same as binary in persistent cache");
+                const ll_api::memory &trisc_binary = *llrt::get_risc_binary(trisc_hex_path);
+                TT_FATAL(trisc_binary == *compute_binaries.at(trisc_id), "Expected saved TRISC binary for " + trisc_id_str + " to be the same as binary in persistent cache");
             }
         }
         pass &= tt_metal::CloseDevice(device);
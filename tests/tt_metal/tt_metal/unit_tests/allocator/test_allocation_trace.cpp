@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/impl/allocator/allocation_trace.hpp"
+
+using tt::tt_metal::allocator::AllocationTraceBank;
+using tt::tt_metal::allocator::AllocationTraceEvent;
+
+TEST_F(BasicFixture, TestAllocationTraceRoundTrip) {
+    auto file_name = (std::filesystem::temp_directory_path() / "test_allocation_trace" / "device_0_L1.trace").string();
+    AllocationTraceBank bank{
+        .buffer_type = "L1",
+        .num_banks = 64,
+        .bank_size = 1024 * 1024,
+        .offset = 128 * 1024,
+        .interleaved_address_limit = 256 * 1024,
+        .min_allocation_size = 32,
+        .alignment = 32};
+    {
+        tt::tt_metal::allocator::AllocationTraceWriter writer(file_name, bank);
+        writer.allocate(2048, true, 64 * 2048, 2048, std::nullopt, 256 * 1024);
+        writer.allocate(4096, false, 8 * 4096, 4096, 8, 1024 * 1024);
+        writer.allocate_at_address(300 * 1024, 1024);
+        // Never allocated while tracing
+        writer.deallocate(12345);
+        writer.deallocate(256 * 1024);
+        writer.out_of_memory(1024 * 1024, true, 64 * 1024 * 1024, 2048, std::nullopt);
+        writer.deallocate_all();
+    }
+
+    auto trace = tt::tt_metal::allocator::read_allocation_trace(file_name);
+    EXPECT_EQ(trace.bank.buffer_type, "L1");
+    EXPECT_EQ(trace.bank.num_banks, 64);
+    EXPECT_EQ(trace.bank.interleaved_address_limit, 256 * 1024);
+    ASSERT_EQ(trace.events.size(), 7);
+
+    EXPECT_EQ(trace.events[0].type, AllocationTraceEvent::Type::ALLOC);
+    EXPECT_EQ(trace.events[0].size_per_bank, 2048);
+    EXPECT_EQ(trace.events[0].num_shards, 0);
+    EXPECT_EQ(trace.events[0].address, 256 * 1024);
+    EXPECT_EQ(trace.events[1].bottom_up, false);
+    EXPECT_EQ(trace.events[1].num_shards, 8);
+    EXPECT_EQ(trace.events[2].type, AllocationTraceEvent::Type::ALLOC_AT);
+    EXPECT_EQ(trace.events[2].id, 2);
+    EXPECT_EQ(trace.events[2].address, 300 * 1024);
+    EXPECT_EQ(trace.events[3].type, AllocationTraceEvent::Type::FREE);
+    EXPECT_EQ(trace.events[3].id, 0);
+    EXPECT_EQ(trace.events[4].type, AllocationTraceEvent::Type::OUT_OF_MEMORY);
+    EXPECT_EQ(trace.events[4].size, 64 * 1024 * 1024);
+    // The remaining two buffers are freed
+    EXPECT_EQ(trace.events[5].type, AllocationTraceEvent::Type::FREE);
+    EXPECT_EQ(trace.events[6].type, AllocationTraceEvent::Type::FREE);
+    EXPECT_NE(trace.events[5].id, trace.events[6].id);
+
+    std::filesystem::remove_all(std::filesystem::path(file_name).parent_path());
+}
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/impl/allocator/allocator.hpp"
+#include "tt_metal/impl/allocator/buffer_planner.hpp"
+#include "tt_metal/impl/buffers/buffer.hpp"
+
+using tt::tt_metal::Allocator;
+using tt::tt_metal::AllocatorConfig;
+using tt::tt_metal::BufferType;
+using tt::tt_metal::allocator::BankManager;
+using tt::tt_metal::allocator::BufferLifetime;
+using tt::tt_metal::allocator::BufferPlacement;
+using tt::tt_metal::allocator::BufferPlan;
+using tt::tt_metal::allocator::BufferPlanSession;
+
+namespace {
+
+constexpr uint64_t L1_BANK_SIZE = 64 * 1024;
+constexpr uint64_t L1_INTERLEAVED_ADDRESS_LIMIT = 16 * 1024;
+
+BankManager create_l1_bank_manager() {
+    std::unordered_map<uint32_t, int64_t> bank_id_to_bank_offset = {{0, 0}, {1, 0}, {2, 0}, {3, 0}};
+    return BankManager(BufferType::L1, bank_id_to_bank_offset, L1_BANK_SIZE, L1_INTERLEAVED_ADDRESS_LIMIT);
+}
+
+// One DRAM bank and four L1 banks, without a device
+tt::tt_metal::allocator::AllocDescriptor create_alloc_descriptor() {
+    return tt::tt_metal::allocator::AllocDescriptor{
+        .dram = {
+            .init = [](Allocator &allocator, const AllocatorConfig &) {
+                allocator.dram_manager = BankManager(BufferType::DRAM, std::vector<int64_t>{0}, 1024 * 1024);
+                allocator.bank_id_to_dram_channel = {{0, 0}};
+                allocator.dram_channel_to_bank_ids = {{0, {0}}};
+            },
+            .alloc = tt::tt_metal::allocator::base_alloc},
+        .l1 = {
+            .init = [](Allocator &allocator, const AllocatorConfig &) {
+                allocator.l1_manager = create_l1_bank_manager();
+                for (uint32_t bank_id = 0; bank_id < 4; bank_id++) {
+                    allocator.bank_id_to_logical_core[bank_id] = CoreCoord(bank_id, 0);
+                    allocator.logical_core_to_bank_ids[CoreCoord(bank_id, 0)] = {bank_id};
+                }
+            },
+            .alloc = tt::tt_metal::allocator::base_alloc}};
+}
+
+}  // namespace
+
+TEST_F(BasicFixture, TestBufferPlannerReusesFreedSpace) {
+    constexpr uint64_t alignment = 32;
+    // a and b are freed before c is allocated, so c reuses their space
+    std::vector<BufferLifetime> lifetimes = {
+        {.size = 1024, .alloc_step = 0, .free_step = 3},
+        {.size = 512, .alloc_step = 1, .free_step = 4},
+        {.size = 1536, .alloc_step = 5},
+    };
+    BufferPlacement placement = tt::tt_metal::allocator::plan_buffer_placement(lifetimes, alignment);
+    tt::tt_metal::allocator::validate_buffer_placement(lifetimes, placement, alignment);
+    EXPECT_EQ(placement.offsets[2], 0);
+    EXPECT_EQ(placement.arena_size, 1536);
+}
+
+TEST_F(BasicFixture, TestBufferPlannerDirectedSequence) {
+    constexpr uint64_t alignment = 32;
+    // Allocation order of a chain of unary ops: every intermediate lives until the next op consumed it
+    std::vector<BufferLifetime> lifetimes = {
+        {.size = 2048, .alloc_step = 0, .free_step = 2},
+        {.size = 2048, .alloc_step = 1, .free_step = 4},
+        {.size = 100, .alloc_step = 3, .free_step = 6},
+        {.size = 2048, .alloc_step = 5},
+    };
+    BufferPlacement placement = tt::tt_metal::allocator::plan_buffer_placement(lifetimes, alignment);
+    tt::tt_metal::allocator::validate_buffer_placement(lifetimes, placement, alignment);
+    // At most two 2 KB buffers are live at once, the small one may not fit in a gap between them
+    EXPECT_LE(placement.arena_size, 2 * 2048 + 128);
+    for (auto offset : placement.offsets) {
+        EXPECT_EQ(offset % alignment, 0);
+    }
+}
+
+TEST_F(BasicFixture, TestBufferPlannerRejectsOverlap) {
+    constexpr uint64_t alignment = 32;
+    std::vector<BufferLifetime> lifetimes = {
+        {.size = 256, .alloc_step = 0, .free_step = 2},
+        {.size = 256, .alloc_step = 1, .free_step = 3},
+    };
+    BufferPlacement placement{.offsets = {0, 128}, .arena_size = 384};
+    EXPECT_ANY_THROW(tt::tt_metal::allocator::validate_buffer_placement(lifetimes, placement, alignment));
+
+    // Same offsets are fine once the lifetimes don't overlap
+    lifetimes[1].alloc_step = 2;
+    lifetimes[1].free_step = 3;
+    tt::tt_metal::allocator::validate_buffer_placement(lifetimes, placement, alignment);
+}
+
+TEST_F(BasicFixture, TestBufferPlanSessionWithShardedAllocation) {
+    AllocatorConfig config;
+    Allocator allocator(config, create_alloc_descriptor());
+    BufferPlan plan;
+
+    // An interleaved intermediate and output around a sharded buffer, the output outlives the region
+    std::vector<uint64_t> outputs;
+    auto run = [&]() {
+        BufferPlanSession session(plan);
+        allocator.buffer_plan_session = &session;
+        uint64_t intermediate = tt::tt_metal::allocator::allocate_buffer(allocator, 4 * 4096, 4096, BufferType::L1, false);
+        uint64_t sharded = tt::tt_metal::allocator::allocate_buffer(allocator, 2 * 8192, 8192, BufferType::L1, false, 2);
+        uint64_t output = tt::tt_metal::allocator::allocate_buffer(allocator, 4 * 2048, 2048, BufferType::L1, false);
+        EXPECT_GE(intermediate, L1_INTERLEAVED_ADDRESS_LIMIT);
+        EXPECT_GE(output, L1_INTERLEAVED_ADDRESS_LIMIT);
+        EXPECT_TRUE(sharded + 8192 <= intermediate or intermediate + 4096 <= sharded);
+        EXPECT_TRUE(sharded + 8192 <= output or output + 2048 <= sharded);
+        tt::tt_metal::allocator::deallocate_buffer(allocator, intermediate, BufferType::L1);
+        tt::tt_metal::allocator::deallocate_buffer(allocator, sharded, BufferType::L1);
+        allocator.buffer_plan_session = nullptr;
+        bool follows_plan = session.follows_plan();
+        session.finish();
+        outputs.push_back(output);
+        return follows_plan;
+    };
+
+    // The first run records the plan, the sharded buffer doesn't land in the arena of later runs and make them replan
+    EXPECT_FALSE(run());
+    EXPECT_TRUE(plan.is_planned);
+    EXPECT_TRUE(run());
+    EXPECT_TRUE(run());
+    EXPECT_TRUE(plan.is_planned);
+
+    // Outputs of the planned runs are kept in the bank manager once their session ended
+    for (uint64_t output : outputs) {
+        EXPECT_FALSE(allocator.l1_manager.allocate_buffer_at_address(output, 2048).has_value());
+        tt::tt_metal::allocator::deallocate_buffer(allocator, output, BufferType::L1);
+        auto address = allocator.l1_manager.allocate_buffer_at_address(output, 2048);
+        ASSERT_TRUE(address.has_value());
+        allocator.l1_manager.deallocate_buffer(address.value());
+    }
+    EXPECT_EQ(allocator.l1_manager.get_statistics().total_allocated_bytes, 0);
+}
+
+TEST_F(BasicFixture, TestBufferPlanArenaBelowInterleavedLimit) {
+    BankManager bank_manager = create_l1_bank_manager();
+    // Only the space below the interleaved limit is left, interleaved arenas can't go there
+    uint64_t sharded = bank_manager.allocate_buffer(2 * (L1_BANK_SIZE - L1_INTERLEAVED_ADDRESS_LIMIT), L1_BANK_SIZE - L1_INTERLEAVED_ADDRESS_LIMIT, false, 2);
+    EXPECT_EQ(sharded, L1_INTERLEAVED_ADDRESS_LIMIT);
+    EXPECT_FALSE(bank_manager.reserve_range(4096, true).has_value());
+    EXPECT_FALSE(bank_manager.reserve_range(4096, false).has_value());
+    // Nothing leaked, all of it is still free
+    EXPECT_EQ(bank_manager.allocate_buffer(2 * L1_INTERLEAVED_ADDRESS_LIMIT, L1_INTERLEAVED_ADDRESS_LIMIT, true, 2), 0);
+}
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/detail/tt_metal.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+
+using tt::tt_metal::allocator::FreeList;
+using tt::tt_metal::allocator::IndexedFreeList;
+
+TEST_F(BasicFixture, TestIndexedFreeListDirectedSeriesOfAllocDealloc) {
+    constexpr uint32_t max_size_bytes = 1024;
+    constexpr uint32_t min_allocation_size_bytes = 32;
+    constexpr uint32_t alignment = 32;
+
+    IndexedFreeList allocator(max_size_bytes, /*offset*/0, min_allocation_size_bytes, alignment);
+
+    std::optional<uint64_t> addr_0 = allocator.allocate(32, true);
+    ASSERT_TRUE(addr_0.has_value());
+    EXPECT_EQ(addr_0.value(), 0);
+
+    std::optional<uint64_t> addr_1 = allocator.allocate_at_address(64, 32);
+    ASSERT_TRUE(addr_1.has_value());
+    EXPECT_EQ(addr_1.value(), 64);
+
+    // Free blocks are [32, 64) and [96, 1024), a 32 B request takes the smaller one
+    std::optional<uint64_t> addr_2 = allocator.allocate(16, true);
+    ASSERT_TRUE(addr_2.has_value());
+    EXPECT_EQ(addr_2.value(), 32);
+
+    std::optional<uint64_t> addr_3 = allocator.allocate_at_address(512, 128);
+    ASSERT_TRUE(addr_3.has_value());
+    EXPECT_EQ(addr_3.value(), 512);
+
+    // Free blocks are [96, 512) and [640, 1024), best fit picks the 384 B block over the 416 B block
+    std::optional<uint64_t> addr_4 = allocator.allocate(64, true);
+    ASSERT_TRUE(addr_4.has_value());
+    EXPECT_EQ(addr_4.value(), 640);
+
+    // Top down allocation is placed at the end of the best fitting block
+    std::optional<uint64_t> addr_5 = allocator.allocate(64, false);
+    ASSERT_TRUE(addr_5.has_value());
+    EXPECT_EQ(addr_5.value(), 960);
+
+    // Exact fit, [96, 512) is 416 B
+    std::optional<uint64_t> addr_6 = allocator.allocate(416, true);
+    ASSERT_TRUE(addr_6.has_value());
+    EXPECT_EQ(addr_6.value(), 96);
+
+    EXPECT_FALSE(allocator.allocate(512, true).has_value());
+    EXPECT_FALSE(allocator.allocate_at_address(512, 32).has_value());
+
+    // Deallocating coalesces with both neighbours
+    allocator.deallocate(512);
+    allocator.deallocate(96);
+    allocator.deallocate(640);
+    std::optional<uint64_t> addr_7 = allocator.allocate_at_address(96, 800);
+    ASSERT_TRUE(addr_7.has_value());
+    EXPECT_EQ(addr_7.value(), 96);
+
+    EXPECT_EQ(allocator.lowest_occupied_address(), 0);
+    allocator.deallocate(0);
+    EXPECT_EQ(allocator.lowest_occupied_address(), 32);
+
+    allocator.clear();
+    std::optional<uint64_t> addr_8 = allocator.allocate(max_size_bytes, true);
+    ASSERT_TRUE(addr_8.has_value());
+    EXPECT_EQ(addr_8.value(), 0);
+}
+
+TEST_F(BasicFixture, TestAllocationBelowAddressLimitIsRolledBack) {
+    constexpr uint32_t max_size_bytes = 1024;
+    constexpr uint32_t min_allocation_size_bytes = 32;
+    constexpr uint32_t alignment = 32;
+
+    FreeList free_list(max_size_bytes, /*offset*/0, min_allocation_size_bytes, alignment, FreeList::SearchPolicy::FIRST);
+    IndexedFreeList indexed_free_list(max_size_bytes, /*offset*/0, min_allocation_size_bytes, alignment);
+    for (tt::tt_metal::allocator::Algorithm *allocator : std::vector<tt::tt_metal::allocator::Algorithm *>{&free_list, &indexed_free_list}) {
+        ASSERT_TRUE(allocator->allocate_at_address(512, 512).has_value());
+        // The only free block, [0, 512), lies below the limit
+        EXPECT_ANY_THROW(allocator->allocate(64, true, 512));
+        auto stats = allocator->get_statistics();
+        EXPECT_EQ(stats.total_allocated_bytes, 512);
+        EXPECT_EQ(stats.largest_free_block_bytes, 512);
+        EXPECT_EQ(allocator->lowest_occupied_address(), 512);
+        EXPECT_EQ(allocator->allocate(512, true), 0);
+    }
+}
+
+TEST_F(BasicFixture, TestIndexedFreeListMatchesBestFitFreeList) {
+    constexpr uint64_t max_size_bytes = 1024 * 1024;
+    constexpr uint64_t offset_bytes = 64 * 1024;
+    constexpr uint64_t min_allocation_size_bytes = 32;
+    constexpr uint64_t alignment = 32;
+
+    FreeList reference(max_size_bytes, offset_bytes, min_allocation_size_bytes, alignment, FreeList::SearchPolicy::BEST);
+    IndexedFreeList allocator(max_size_bytes, offset_bytes, min_allocation_size_bytes, alignment);
+
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<uint64_t> size_dist(1, 32 * 1024);
+    std::uniform_int_distribution<uint32_t> op_dist(0, 99);
+    std::vector<uint64_t> live_addresses;
+
+    for (uint32_t i = 0; i < 20000; i++) {
+        uint32_t op = op_dist(rng);
+        if (op < 50 or live_addresses.empty()) {
+            uint64_t size = size_dist(rng);
+            bool bottom_up = op % 2;
+            auto expected = reference.allocate(size, bottom_up);
+            auto actual = allocator.allocate(size, bottom_up);
+            ASSERT_EQ(expected, actual) << "allocate " << size << " at step " << i;
+            if (actual.has_value()) {
+                live_addresses.push_back(actual.value());
+            }
+        } else if (op < 60) {
+            uint64_t address = offset_bytes + std::uniform_int_distribution<uint64_t>(0, max_size_bytes / alignment - 1)(rng) * alignment;
+            uint64_t size = size_dist(rng) / 4;
+            auto expected = reference.allocate_at_address(address, size);
+            auto actual = allocator.allocate_at_address(address, size);
+            ASSERT_EQ(expected, actual) << "allocate_at_address " << address << " at step " << i;
+            if (actual.has_value()) {
+                live_addresses.push_back(actual.value());
+            }
+        } else {
+            auto index = std::uniform_int_distribution<size_t>(0, live_addresses.size() - 1)(rng);
+            reference.deallocate(live_addresses[index]);
+            allocator.deallocate(live_addresses[index]);
+            live_addresses[index] = live_addresses.back();
+            live_addresses.pop_back();
+        }
+        ASSERT_EQ(reference.lowest_occupied_address(), allocator.lowest_occupied_address()) << "at step " << i;
+        if (i % 1000 == 0) {
+            auto expected_stats = reference.get_statistics();
+            auto actual_stats = allocator.get_statistics();
+            EXPECT_EQ(expected_stats.total_allocated_bytes, actual_stats.total_allocated_bytes);
+            EXPECT_EQ(expected_stats.largest_free_block_bytes, actual_stats.largest_free_block_bytes);
+            EXPECT_EQ(expected_stats.largest_free_block_addrs, actual_stats.largest_free_block_addrs);
+            EXPECT_EQ(reference.available_addresses(4096), allocator.available_addresses(4096));
+        }
+    }
+}
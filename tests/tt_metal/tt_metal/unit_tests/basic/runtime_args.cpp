@@ -89,7 +89,8 @@ bool verify_result_data_movement(
         auto processor = kernel->processor();
         for (const auto &logical_core : kernel->cores_with_runtime_args()) {
             auto expected_rt_args = core_to_rt_args.at(logical_core);
-            auto rt_args = kernel->runtime_args(logical_core);
+            const auto &rt_args_data = kernel->runtime_args(logical_core);
+            std::vector<uint32_t> rt_args(rt_args_data.begin(), rt_args_data.end());
             EXPECT_TRUE(rt_args == expected_rt_args);
             std::vector<uint32_t> written_args;
             tt_metal::detail::ReadFromDeviceL1(
@@ -179,7 +180,8 @@ bool verify_result_compute(
         auto processor = kernel->processor();
         for (const auto &logical_core : kernel->cores_with_runtime_args()) {
             auto expected_rt_args = core_to_rt_args.at(logical_core);
-            auto rt_args = kernel->runtime_args(logical_core);
+            const auto &rt_args_data = kernel->runtime_args(logical_core);
+            std::vector<uint32_t> rt_args(rt_args_data.begin(), rt_args_data.end());
             EXPECT_TRUE(rt_args == expected_rt_args);
             std::vector<uint32_t> written_args;
             tt_metal::detail::ReadFromDeviceL1(
@@ -254,4 +256,83 @@ TEST_F(DeviceFixture, IllegallyModifyRTArgs) {
     }
 }
 
+TEST_F(DeviceFixture, ModifyRTArgsThroughGetRuntimeArgs) {
+    for (unsigned int id = 0; id < num_devices_; id++) {
+        CoreRange first_core_range = {.start = CoreCoord(0, 0), .end = CoreCoord(1, 1)};
+        CoreRange second_core_range = {.start = CoreCoord(3, 3), .end = CoreCoord(5, 5)};
+        CoreRangeSet core_range_set({first_core_range, second_core_range});
+        auto program =
+            unit_tests::runtime_args::initialize_program_data_movement(this->devices_.at(id), core_range_set);
+        // Cores get different numbers of args so the arena slots are widened after the first cores are added
+        std::vector<uint32_t> short_runtime_args = {101, 202};
+        std::vector<uint32_t> long_runtime_args = {303, 404, 505, 606, 707};
+        SetRuntimeArgs(program, 0, first_core_range, short_runtime_args);
+        SetRuntimeArgs(program, 0, second_core_range, long_runtime_args);
+
+        std::map<CoreCoord, std::vector<uint32_t>> core_to_rt_args;
+        for (const auto &logical_core : detail::GetKernel(program, 0)->logical_cores()) {
+            core_to_rt_args[logical_core] = first_core_range.contains(logical_core) ? short_runtime_args : long_runtime_args;
+            auto &runtime_args = GetRuntimeArgs(program, 0, logical_core);
+            runtime_args[1] = logical_core.x * 16 + logical_core.y;
+            core_to_rt_args[logical_core][1] = runtime_args[1];
+        }
+        detail::WriteRuntimeArgsToDevice(this->devices_.at(id), program);
+        EXPECT_TRUE(
+            unit_tests::runtime_args::verify_result_data_movement(this->devices_.at(id), program, core_to_rt_args));
+    }
+}
+
+TEST_F(DeviceFixture, IllegallyMoveRTArgsAfterGetRuntimeArgs) {
+    for (unsigned int id = 0; id < num_devices_; id++) {
+        CoreRange first_core_range = {.start = CoreCoord(0, 0), .end = CoreCoord(1, 1)};
+        CoreRange second_core_range = {.start = CoreCoord(3, 3), .end = CoreCoord(5, 5)};
+        CoreRangeSet core_range_set({first_core_range, second_core_range});
+        auto program =
+            unit_tests::runtime_args::initialize_program_data_movement(this->devices_.at(id), core_range_set);
+        std::vector<uint32_t> short_runtime_args = {101, 202};
+        SetRuntimeArgs(program, 0, first_core_range, short_runtime_args);
+        auto &runtime_args = GetRuntimeArgs(program, 0, CoreCoord(0, 0));
+        const uint32_t *runtime_args_data = runtime_args.data();
+
+        // Args as wide as the ones already set fit in the arena, the view does not move
+        SetRuntimeArgs(program, 0, CoreCoord(3, 3), std::vector<uint32_t>{303, 404});
+        EXPECT_EQ(runtime_args.data(), runtime_args_data);
+        EXPECT_EQ(runtime_args[1], 202);
+        // Wider args would move it
+        EXPECT_ANY_THROW(SetRuntimeArgs(program, 0, CoreCoord(4, 4), std::vector<uint32_t>{505, 606, 707, 808, 909}));
+
+        SetCommonRuntimeArgs(program, 0, {1, 2});
+        EXPECT_ANY_THROW(SetCommonRuntimeArgs(program, 0, {1, 2, 3}));
+    }
+}
+
+TEST_F(DeviceFixture, SetCommonRTArgsDataMovement) {
+    for (unsigned int id = 0; id < num_devices_; id++) {
+        CoreRange first_core_range = {.start = CoreCoord(0, 0), .end = CoreCoord(1, 1)};
+        CoreRange second_core_range = {.start = CoreCoord(3, 3), .end = CoreCoord(5, 5)};
+        CoreRangeSet core_range_set({first_core_range, second_core_range});
+        auto program =
+            unit_tests::runtime_args::initialize_program_data_movement(this->devices_.at(id), core_range_set);
+        std::vector<uint32_t> runtime_args = {101, 202};
+        std::vector<uint32_t> common_runtime_args = {303, 404, 505};
+        SetRuntimeArgs(program, 0, core_range_set, runtime_args);
+        SetCommonRuntimeArgs(program, 0, common_runtime_args);
+
+        std::map<CoreCoord, std::vector<uint32_t>> core_to_rt_args;
+        Kernel *kernel = detail::GetKernel(program, 0);
+        for (const auto &logical_core : kernel->logical_cores()) {
+            core_to_rt_args[logical_core] = runtime_args;
+        }
+        detail::WriteRuntimeArgsToDevice(this->devices_.at(id), program);
+        EXPECT_TRUE(
+            unit_tests::runtime_args::verify_result_data_movement(this->devices_.at(id), program, core_to_rt_args));
+        for (const auto &logical_core : kernel->logical_cores()) {
+            std::vector<uint32_t> written_args;
+            tt_metal::detail::ReadFromDeviceL1(
+                this->devices_.at(id), logical_core, kernel->common_runtime_args_base(), common_runtime_args.size() * sizeof(uint32_t), written_args);
+            EXPECT_EQ(written_args, common_runtime_args);
+        }
+    }
+}
+
 }  // namespace unit_tests::runtime_args
@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "tt_metal/host_api.hpp"
+#include "tt_metal/detail/tt_metal.hpp"
 #include "tt_metal/hostdevcommon/common_runtime_address_map.h"
 #include "tt_metal/test_utils/env_vars.hpp"
 
@@ -29,8 +30,11 @@ class DeviceFixture : public ::testing::Test {
             GTEST_SKIP();
         }
 
+        std::vector<chip_id_t> device_ids;
         for (unsigned int id = 0; id < num_devices_; id++) {
-            auto* device = tt::tt_metal::CreateDevice(id);
+            device_ids.push_back(id);
+        }
+        for (const auto& [id, device] : tt::tt_metal::detail::CreateDevices(device_ids)) {
             devices_.push_back(device);
         }
         tt::Cluster::instance().set_internal_routing_info_for_ethernet_cores(true);
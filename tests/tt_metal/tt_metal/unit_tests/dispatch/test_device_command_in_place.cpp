@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/impl/buffers/buffer.hpp"
+#include "tt_metal/impl/dispatch/device_command.hpp"
+
+using namespace tt::tt_metal;
+
+// A host vector stands in for the hugepage, commands assembled in place must be read by the device exactly as the
+// zero initialized commands that used to be copied into the issue queue
+namespace unit_tests::device_command_in_place {
+
+constexpr uint32_t STALE_WORD = 0xABABABAB;
+
+void assemble_command(DeviceCommand& command) {
+    command.set_is_program();
+    command.set_page_size(DeviceCommand::PROGRAM_PAGE_SIZE);
+    command.set_num_pages(DeviceCommand::TransferType::RUNTIME_ARGS, 2);
+    command.set_num_pages(2);
+    command.set_data_size(2 * DeviceCommand::PROGRAM_PAGE_SIZE);
+    command.add_buffer_transfer_interleaved_instruction(
+        0x1000, 0x2000, 2, DeviceCommand::PROGRAM_PAGE_SIZE, uint32_t(BufferType::SYSTEM_MEMORY), uint32_t(BufferType::DRAM), 0, 0);
+    command.add_buffer_transfer_sharded_instruction(
+        0x3000, 0x4000, 4, 64, uint32_t(BufferType::SYSTEM_MEMORY), uint32_t(BufferType::L1), 0, 0, {2, 2}, {1, 2}, {1, 1});
+    for (uint32_t val = 1; val <= 16; val++) {
+        command.write_program_entry(val);
+    }
+    command.set_stall();
+}
+
+// Words of the command the device reads: header, entries of every transfer, program entries
+std::vector<uint32_t> parsed_words(
+    const uint32_t* command, const std::vector<uint32_t>& num_transfer_entries, uint32_t num_program_entries) {
+    const uint32_t* entries = command + DeviceCommand::NUM_ENTRIES_IN_COMMAND_HEADER;
+    std::vector<uint32_t> words(command, entries);
+    for (uint32_t i = 0; i < num_transfer_entries.size(); i++) {
+        const uint32_t* transfer = entries + i * DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION;
+        words.insert(words.end(), transfer, transfer + num_transfer_entries[i]);
+    }
+    const uint32_t* program = entries + DeviceCommand::NUM_POSSIBLE_BUFFER_TRANSFERS * DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION;
+    words.insert(words.end(), program, program + num_program_entries);
+    return words;
+}
+
+}  // namespace unit_tests::device_command_in_place
+
+using namespace unit_tests::device_command_in_place;
+
+TEST_F(BasicFixture, TestDeviceCommandAssembledInPlaceMatchesOwnedCommand) {
+    std::vector<uint32_t> issue_queue(DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND, STALE_WORD);
+
+    DeviceCommand in_place_command(issue_queue.data());
+    assemble_command(in_place_command);
+    DeviceCommand owned_command;
+    assemble_command(owned_command);
+
+    ASSERT_EQ(in_place_command.data(), (void*)issue_queue.data());
+    const uint32_t* owned_words = reinterpret_cast<const uint32_t*>(owned_command.data());
+    // Interleaved transfer is only the preamble, sharded transfer is followed by two shards
+    std::vector<uint32_t> num_transfer_entries = {COMMAND_PTR_SHARD_IDX, COMMAND_PTR_SHARD_IDX + 2 * NUM_ENTRIES_PER_SHARD};
+    EXPECT_EQ(parsed_words(issue_queue.data(), num_transfer_entries, 16), parsed_words(owned_words, num_transfer_entries, 16));
+
+    // Only the used parts of the slot were written, the rest still holds stale data
+    EXPECT_EQ(issue_queue.back(), STALE_WORD);
+    EXPECT_EQ(in_place_command.num_written_bytes(), owned_command.num_written_bytes());
+    EXPECT_LT(in_place_command.num_written_bytes(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND / 8);
+
+    // Copies, i.e. trace snapshots, own their storage and drop the stale data
+    DeviceCommand copied_command = in_place_command;
+    EXPECT_NE(copied_command.data(), in_place_command.data());
+    EXPECT_EQ(std::memcmp(copied_command.data(), owned_command.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND), 0);
+}
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <thread>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/impl/dispatch/lock_free_queue.hpp"
+
+using namespace tt::tt_metal;
+
+TEST_F(BasicFixture, TestLockFreeQueueBoundedTryPush) {
+    LockFreeQueue<uint32_t> q(3);
+    EXPECT_TRUE(q.try_push(0));
+    EXPECT_TRUE(q.try_push(1));
+    EXPECT_TRUE(q.try_push(2));
+    // Ring is rounded up to 4 slots but occupancy is bounded by the requested capacity
+    EXPECT_FALSE(q.try_push(3));
+    EXPECT_EQ(q.size(), 3);
+
+    EXPECT_EQ(q.peek(), 0);
+    q.pop();
+    EXPECT_TRUE(q.try_push(3));
+
+    uint32_t value;
+    for (uint32_t expected = 1; expected <= 3; expected++) {
+        ASSERT_TRUE(q.try_pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_FALSE(q.try_pop(value));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST_F(BasicFixture, TestLockFreeQueueSPSCOrdering) {
+    constexpr uint32_t num_elements = 100000;
+    LockFreeQueue<uint32_t> q(16);
+    std::thread producer([&] {
+        std::vector<uint32_t> batch(7);
+        uint32_t i = 0;
+        for (; i + batch.size() <= num_elements / 2; i += batch.size()) {
+            std::iota(batch.begin(), batch.end(), i);
+            q.push_batch(batch.begin(), batch.end());
+        }
+        for (; i < num_elements; i++) {
+            q.push(i);
+        }
+    });
+
+    std::vector<uint32_t> popped;
+    while (popped.size() < num_elements) {
+        if (popped.size() % 2) {
+            q.pop_batch(popped, 5);
+        } else {
+            popped.push_back(q.peek());
+            q.pop();
+        }
+    }
+    producer.join();
+
+    ASSERT_EQ(popped.size(), num_elements);
+    for (uint32_t i = 0; i < num_elements; i++) {
+        ASSERT_EQ(popped[i], i);
+    }
+}
+
+TEST_F(BasicFixture, TestLockFreeQueueMPSCNoLoss) {
+    constexpr uint32_t num_producers = 4;
+    constexpr uint32_t num_elements_per_producer = 25000;
+    LockFreeQueue<uint32_t, QueueProducerMode::MULTI> q(32);
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < num_producers; p++) {
+        producers.emplace_back([&q, p] {
+            for (uint32_t i = 0; i < num_elements_per_producer; i++) {
+                q.push(p * num_elements_per_producer + i);
+            }
+        });
+    }
+
+    std::vector<uint32_t> last_seen(num_producers, 0);
+    std::vector<uint32_t> count(num_producers, 0);
+    for (uint32_t i = 0; i < num_producers * num_elements_per_producer; i++) {
+        uint32_t value = q.peek();
+        q.pop();
+        uint32_t producer = value / num_elements_per_producer;
+        uint32_t index = value % num_elements_per_producer;
+        // Elements from one producer must stay in order
+        if (count[producer] != 0) {
+            ASSERT_GT(index, last_seen[producer]);
+        }
+        last_seen[producer] = index;
+        count[producer]++;
+    }
+    for (auto &producer : producers) {
+        producer.join();
+    }
+    for (uint32_t p = 0; p < num_producers; p++) {
+        EXPECT_EQ(count[p], num_elements_per_producer);
+    }
+    EXPECT_TRUE(q.empty());
+}
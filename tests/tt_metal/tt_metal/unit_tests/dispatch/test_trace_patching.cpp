@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+
+#include "basic_fixture.hpp"
+#include "tt_metal/host_api.hpp"
+#include "tt_metal/impl/dispatch/command_queue.hpp"
+
+using namespace tt::tt_metal;
+
+// Host only traces, a patched trace must assemble to the same issue queue image as a trace freshly recorded with
+// the patched values
+namespace unit_tests::trace_patching {
+
+constexpr uint32_t BASE_ADDRESS = 0x1000;
+
+struct TraceTestProgram {
+    Program program;
+    KernelHandle reader_kernel;
+    KernelHandle writer_kernel;
+};
+
+TraceTestProgram create_program(const CoreRange& cores) {
+    Program program = CreateProgram();
+    auto reader_kernel = CreateKernel(
+        program,
+        "tt_metal/kernels/dataflow/reader_unary.cpp",
+        cores,
+        DataMovementConfig{.processor = DataMovementProcessor::RISCV_1, .noc = NOC::RISCV_1_default});
+    auto writer_kernel = CreateKernel(
+        program,
+        "tt_metal/kernels/dataflow/writer_unary.cpp",
+        cores,
+        DataMovementConfig{.processor = DataMovementProcessor::RISCV_0, .noc = NOC::RISCV_0_default});
+    return {.program = std::move(program), .reader_kernel = reader_kernel, .writer_kernel = writer_kernel};
+}
+
+void set_buffer_addresses(TraceTestProgram& test_program, const CoreRange& cores, uint32_t input_address, uint32_t output_address) {
+    for (auto x = cores.start.x; x <= cores.end.x; x++) {
+        CoreCoord core = {x, cores.start.y};
+        SetRuntimeArgs(test_program.program, test_program.reader_kernel, core, {input_address, 1, 1, 8});
+        SetRuntimeArgs(test_program.program, test_program.writer_kernel, core, {output_address, 1, 1, 8});
+    }
+}
+
+DeviceCommand create_program_command(bool stall) {
+    constexpr uint32_t num_host_data_pages = 1;
+    DeviceCommand command;
+    command.set_is_program();
+    command.set_page_size(DeviceCommand::PROGRAM_PAGE_SIZE);
+    command.set_num_pages(DeviceCommand::TransferType::RUNTIME_ARGS, num_host_data_pages);
+    command.set_num_pages(num_host_data_pages);
+    command.set_data_size(DeviceCommand::PROGRAM_PAGE_SIZE * num_host_data_pages);
+    command.add_buffer_transfer_interleaved_instruction(
+        0, 0, num_host_data_pages, DeviceCommand::PROGRAM_PAGE_SIZE, uint32_t(BufferType::SYSTEM_MEMORY), 0, 0, 0);
+    if (stall) {
+        command.set_stall();
+    }
+    return command;
+}
+
+}  // namespace unit_tests::trace_patching
+
+using namespace unit_tests::trace_patching;
+
+TEST_F(BasicFixture, TestPatchedTraceMatchesFreshlyAssembledTrace) {
+    CoreRange cores({0, 0}, {1, 0});
+    TraceTestProgram test_program = create_program(cores);
+
+    // Decode loop with the same program recorded twice, the second iteration reads and writes other buffers
+    set_buffer_addresses(test_program, cores, 0x100000, 0x200000);
+    Trace trace;
+    trace.record_program(test_program.program, create_program_command(/*stall=*/false));
+    trace.record_program(test_program.program, create_program_command(/*stall=*/false));
+    ASSERT_EQ(trace.num_commands(), 2);
+
+    std::vector<uint32_t> input_patch_points, output_patch_points;
+    for (auto x = cores.start.x; x <= cores.end.x; x++) {
+        CoreCoord core = {x, cores.start.y};
+        input_patch_points.push_back(trace.declare_patch_point(trace.runtime_arg_patch_point(1, test_program.reader_kernel, core, 0)));
+        output_patch_points.push_back(trace.declare_patch_point(trace.runtime_arg_patch_point(1, test_program.writer_kernel, core, 0)));
+    }
+    uint32_t stall_patch_point = trace.declare_patch_point(
+        {.command_index = 0, .stream = TracePatchPoint::Stream::COMMAND, .word_offset = offsetof(CommandHeader, stall) / sizeof(uint32_t)});
+
+    for (auto patch_point : input_patch_points) {
+        trace.set_patch_value(patch_point, 0x300000);
+    }
+    for (auto patch_point : output_patch_points) {
+        trace.set_patch_value(patch_point, 0x400000);
+    }
+    trace.set_patch_value(stall_patch_point, 1);
+
+    Trace fresh_trace;
+    fresh_trace.record_program(test_program.program, create_program_command(/*stall=*/true));
+    set_buffer_addresses(test_program, cores, 0x300000, 0x400000);
+    fresh_trace.record_program(test_program.program, create_program_command(/*stall=*/false));
+
+    EXPECT_EQ(trace.assemble(BASE_ADDRESS), fresh_trace.assemble(BASE_ADDRESS));
+
+    // Host data source of every command points right after the command in the issue queue
+    auto stream = trace.assemble(BASE_ADDRESS);
+    uint32_t second_command = DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND + DeviceCommand::PROGRAM_PAGE_SIZE / sizeof(uint32_t);
+    EXPECT_EQ(stream[DeviceCommand::NUM_ENTRIES_IN_COMMAND_HEADER], BASE_ADDRESS + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND);
+    EXPECT_EQ(
+        stream[second_command + DeviceCommand::NUM_ENTRIES_IN_COMMAND_HEADER],
+        BASE_ADDRESS + 2 * DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + DeviceCommand::PROGRAM_PAGE_SIZE);
+}
+
+TEST_F(BasicFixture, TestTraceDumpAndLoad) {
+    CoreRange cores({0, 0}, {3, 0});
+    TraceTestProgram test_program = create_program(cores);
+    set_buffer_addresses(test_program, cores, 0x100000, 0x200000);
+
+    Trace trace;
+    trace.record_program(test_program.program, create_program_command(/*stall=*/false));
+    uint32_t patch_point = trace.declare_patch_point(trace.runtime_arg_patch_point(0, test_program.writer_kernel, {2, 0}, 0));
+
+    auto file_name = std::filesystem::temp_directory_path() / "test_trace_dump_and_load.bin";
+    DumpTrace(trace, file_name);
+    // Unused command entries and data padding are not stored
+    EXPECT_LT(std::filesystem::file_size(file_name), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND / 4);
+
+    Trace loaded_trace = LoadTrace(file_name);
+    std::filesystem::remove(file_name);
+    EXPECT_EQ(loaded_trace.num_commands(), trace.num_commands());
+    EXPECT_EQ(loaded_trace.assemble(BASE_ADDRESS), trace.assemble(BASE_ADDRESS));
+
+    // Patch points and runtime args locations survive the round trip
+    trace.set_patch_value(patch_point, 0x500000);
+    loaded_trace.set_patch_value(patch_point, 0x500000);
+    EXPECT_EQ(loaded_trace.assemble(BASE_ADDRESS), trace.assemble(BASE_ADDRESS));
+    EXPECT_EQ(
+        loaded_trace.runtime_arg_patch_point(0, test_program.reader_kernel, {3, 0}, 3).word_offset,
+        trace.runtime_arg_patch_point(0, test_program.reader_kernel, {3, 0}, 3).word_offset);
+    EXPECT_ANY_THROW(loaded_trace.runtime_arg_patch_point(0, test_program.reader_kernel, {3, 0}, 4));
+}
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+
+#include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/common/bfloat8.hpp"
+#include "tt_metal/common/test_tiles.hpp"
+
+namespace {
+
+// Element at a time packing of tiled data with the scalar conversion helpers
+template <bool truncate_bfp_mantissa>
+std::vector<uint32_t> reference_pack(const std::vector<float> &tiled, bool is_exp_a) {
+    std::vector<uint32_t> packed(tiled.size() / FLOATS_IN_TILE * BFP8_WORDS_IN_TILE);
+    for (uint32_t tile = 0; tile < tiled.size() / FLOATS_IN_TILE; tile++) {
+        auto exponents = reinterpret_cast<uint8_t *>(&packed[tile * BFP8_WORDS_IN_TILE]);
+        auto data = exponents + BFP8_EXPONENT_BYTES_IN_TILE;
+        for (uint32_t face_row = 0; face_row < BFP8_FACE_ROWS_IN_TILE; face_row++) {
+            std::vector<uint32_t> row(16);
+            std::memcpy(row.data(), &tiled[tile * FLOATS_IN_TILE + face_row * 16], 16 * sizeof(float));
+            exponents[face_row] = get_max_exp(row, is_exp_a);
+            for (uint32_t i = 0; i < 16; i++) {
+                data[face_row * 16 + i] = convert_u32_to_bfp8<truncate_bfp_mantissa>(row[i], exponents[face_row], is_exp_a);
+            }
+        }
+    }
+    return packed;
+}
+
+// Inverse conversion for a single datum, one left shift at a time until the leading one becomes the hidden bit
+uint32_t reference_unpack(uint8_t datum, uint32_t shared_exp, bool is_exp_a) {
+    uint32_t sign = datum >> 7;
+    uint32_t mantissa = datum & 0x7f;
+    if (mantissa == 0) {
+        return sign << 31;
+    }
+    uint32_t shift_cnt = 0;
+    while ((mantissa & 0x40) == 0) {
+        mantissa <<= 1;
+        shift_cnt++;
+    }
+    mantissa = (mantissa << 1) & 0x7f;
+    uint32_t exp = shared_exp + (is_exp_a ? 112 : 0) - shift_cnt;
+    return (sign << 31) | (exp << 23) | (mantissa << 16);
+}
+
+std::vector<float> random_floats(size_t size, std::mt19937 &rng) {
+    // Mix of ordinary values, +/- 0, denormals, infinities and values with very different exponents
+    std::vector<float> data(size);
+    std::normal_distribution<float> normal(0.0f, 1.0f);
+    for (auto &datum : data) {
+        uint32_t bits;
+        switch (rng() % 8) {
+            case 0: bits = 0; break;
+            case 1: bits = 0x80000000; break;
+            case 2: bits = rng() & 0x807fffff; break;
+            case 3: bits = (rng() & 0x80000000) | 0x7f800000; break;
+            case 4: bits = rng(); break;
+            default: {
+                float value = normal(rng) * std::pow(10.0f, int(rng() % 13) - 6);
+                std::memcpy(&bits, &value, sizeof(bits));
+            }
+        }
+        std::memcpy(&datum, &bits, sizeof(bits));
+    }
+    return data;
+}
+
+template <bool truncate_bfp_mantissa>
+void pack_matches_reference_helper(bool is_exp_a) {
+    std::mt19937 rng(0);
+    std::vector<float> tiled = random_floats(8 * FLOATS_IN_TILE, rng);
+    uint32_t num_tiles = tiled.size() / FLOATS_IN_TILE;
+    auto expected = reference_pack<truncate_bfp_mantissa>(tiled, is_exp_a);
+
+    EXPECT_EQ(expected, pack_fp32_vec_as_bfp8_tiles<truncate_bfp_mantissa>(tiled, /*row_major_input=*/false, is_exp_a));
+    // Runtime dispatch picks AVX-512 when available, check the AVX2 kernels explicitly
+    std::vector<uint32_t> avx2_packed(expected.size());
+    Bfp8TileAddressing addressing{.row_major = false, .rows = 32, .cols = 32};
+    pack_bfp8_tiles_avx2<truncate_bfp_mantissa>(tiled.data(), addressing, 0, num_tiles, is_exp_a, avx2_packed.data());
+    EXPECT_EQ(expected, avx2_packed);
+
+    // Unpack arbitrary bytes, not just values produced by packing
+    std::vector<uint32_t> packed(expected.size());
+    std::generate(packed.begin(), packed.end(), rng);
+    std::vector<uint32_t> expected_unpacked;
+    for (uint32_t tile = 0; tile < num_tiles; tile++) {
+        auto exponents = reinterpret_cast<const uint8_t *>(&packed[tile * BFP8_WORDS_IN_TILE]);
+        auto data = exponents + BFP8_EXPONENT_BYTES_IN_TILE;
+        for (uint32_t i = 0; i < FLOATS_IN_TILE; i++) {
+            expected_unpacked.push_back(reference_unpack(data[i], exponents[i / 16], is_exp_a));
+        }
+    }
+    auto unpacked = unpack_bfp8_tiles_into_float_vec(packed, /*row_major_output=*/false, is_exp_a);
+    std::vector<float> avx2_unpacked(unpacked.size());
+    unpack_bfp8_tiles_avx2(packed.data(), addressing, 0, num_tiles, is_exp_a, avx2_unpacked.data());
+    ASSERT_EQ(unpacked.size(), expected_unpacked.size());
+    EXPECT_EQ(0, std::memcmp(unpacked.data(), expected_unpacked.data(), unpacked.size() * sizeof(float)));
+    EXPECT_EQ(0, std::memcmp(avx2_unpacked.data(), expected_unpacked.data(), unpacked.size() * sizeof(float)));
+}
+
+}  // namespace
+
+TEST_F(BasicFixture, TestBfp8PackUnpackMatchesReference) {
+    pack_matches_reference_helper<false>(/*is_exp_a=*/false);
+    pack_matches_reference_helper<false>(/*is_exp_a=*/true);
+    pack_matches_reference_helper<true>(/*is_exp_a=*/false);
+    pack_matches_reference_helper<true>(/*is_exp_a=*/true);
+}
+
+TEST_F(BasicFixture, TestBfp8PackUnpackRowMajor) {
+    std::mt19937 rng(0);
+    std::vector<uint32_t> shape = {2, 3, 256, 320};
+    std::vector<float> row_major = random_floats(shape[0] * shape[1] * shape[2] * shape[3], rng);
+    std::vector<float> tiled = convert_layout<float>(row_major, shape, TensorLayout::LIN_ROW_MAJOR, TensorLayout::TILED32_4FACES);
+
+    // Fused tilize + pack is the same as packing tilized data, large enough to be split across executor threads
+    auto packed = pack_fp32_vec_as_bfp8_tiles(tiled, /*row_major_input=*/false, /*is_exp_a=*/false);
+    EXPECT_EQ(packed, pack_row_major_fp32_as_bfp8_tiles(row_major.data(), shape[0] * shape[1], shape[2], shape[3], /*is_exp_a=*/false));
+
+    auto unpacked = unpack_bfp8_tiles_into_float_vec(packed, /*row_major_output=*/false, /*is_exp_a=*/false);
+    auto expected = convert_layout<float>(unpacked, shape, TensorLayout::TILED32_4FACES, TensorLayout::LIN_ROW_MAJOR);
+    auto unpacked_row_major = unpack_bfp8_tiles_into_row_major_float_vec(packed, shape[0] * shape[1], shape[2], shape[3], /*is_exp_a=*/false);
+    ASSERT_EQ(expected.size(), unpacked_row_major.size());
+    EXPECT_EQ(0, std::memcmp(expected.data(), unpacked_row_major.data(), expected.size() * sizeof(float)));
+
+    // Within a tile row major input matches tilized input
+    std::vector<float> tile_row_major(row_major.begin(), row_major.begin() + FLOATS_IN_TILE);
+    std::vector<float> tile = convert_layout<float>(tile_row_major, {1, 1, 32, 32}, TensorLayout::LIN_ROW_MAJOR, TensorLayout::TILED32_4FACES);
+    EXPECT_EQ(
+        pack_fp32_vec_as_bfp8_tiles(tile_row_major, /*row_major_input=*/true, /*is_exp_a=*/false),
+        pack_fp32_vec_as_bfp8_tiles(tile, /*row_major_input=*/false, /*is_exp_a=*/false));
+}
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 #include "tests/tt_metal/tt_metal/unit_tests/common/basic_fixture.hpp"
+#include "tt_metal/common/test_tiles.hpp"
 #include "tt_metal/common/tilize_untilize.hpp"
 
 template <bool tilize_first, typename T>
@@ -44,8 +45,16 @@ TEST_F(BasicFixture, TestTilizeAndThenUntilizeBfloat16) {
     tilize_untilize_helper<true, bfloat16>(max_num_batches, max_num_row_tiles, max_num_col_tiles, TILE_HEIGHT, TILE_WIDTH);
 }
 
-TEST_F(BasicFixture, TestTilizeThrowErrorForNonBfloat16DataType) {
-    vector<float> vec(1024, 0);
+TEST_F(BasicFixture, TestTilizeAndThenUntilizeFloat32) {
+    tilize_untilize_helper<true, float>(4, 4, 4, 32, 32);
+}
+
+TEST_F(BasicFixture, TestTilizeAndThenUntilizeUint32) {
+    tilize_untilize_helper<true, uint32_t>(4, 4, 4, 32, 32);
+}
+
+TEST_F(BasicFixture, TestTilizeThrowErrorForUnsupportedDataType) {
+    vector<double> vec(1024, 0);
     EXPECT_ANY_THROW(tilize(vec, 32, 32));
 }
 
@@ -65,8 +74,8 @@ TEST_F(BasicFixture, TestTilizeThrowErrorForInvalidVectorShape) {
     EXPECT_ANY_THROW(tilize(vec, 32, 32)); // m and n not divisible by 32
 }
 
-TEST_F(BasicFixture, TestUntilizeThrowErrorForNonBfloat16DataType) {
-    vector<float> vec(1024, 0);
+TEST_F(BasicFixture, TestUntilizeThrowErrorForUnsupportedDataType) {
+    vector<double> vec(1024, 0);
     EXPECT_ANY_THROW(untilize(vec, 32, 32));
 }
 
@@ -95,3 +104,27 @@ TEST_F(BasicFixture, TestUntilizeAndThenTilizeBfloat16) {
 
     tilize_untilize_helper<false, bfloat16>(max_num_batches, max_num_row_tiles, max_num_col_tiles, TILE_HEIGHT, TILE_WIDTH);
 }
+
+template <typename T>
+void convert_layout_matches_reference_helper(const vector<uint32_t>& shape) {
+    vector<T> row_major(shape[0] * shape[1] * shape[2] * shape[3]);
+    for (uint32_t i = 0; i < row_major.size(); i++) {
+        row_major[i] = static_cast<T>(i % 65536);
+    }
+
+    // Reference goes through the swizzled layout one element at a time
+    vector<T> tiled = convert_layout<T>(row_major, shape, TensorLayout::LIN_ROW_MAJOR, TensorLayout::TILED32_4FACES);
+    ASSERT_TRUE(tiled == convert_to_tile_layout<T>(tilize_nchw<T>(row_major, shape)));
+
+    vector<T> untiled = convert_layout<T>(tiled, shape, TensorLayout::TILED32_4FACES, TensorLayout::LIN_ROW_MAJOR);
+    ASSERT_TRUE(untiled == untilize_nchw<T>(convert_to_flat_layout<T>(tiled), shape));
+    ASSERT_TRUE(untiled == row_major);
+}
+
+TEST_F(BasicFixture, TestConvertLayoutMatchesReference) {
+    convert_layout_matches_reference_helper<bfloat16>({1, 1, 32, 32});
+    convert_layout_matches_reference_helper<uint32_t>({2, 3, 64, 96});
+    // Large enough to be split across executor threads
+    convert_layout_matches_reference_helper<bfloat16>({2, 3, 256, 320});
+    convert_layout_matches_reference_helper<float>({1, 4, 512, 256});
+}
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "device_fixture.hpp"
+#include "tt_metal/common/utils.hpp"
+#include "tt_metal/llrt/rtoptions.hpp"
+#include "tt_metal/llrt/tt_memory.h"
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Image of an elf the way the JIT build loaded it before reading segments, objcopy -O verilog regrouped by
+// hex8tohex32.py into 32 bit words and parsed back
+ll_api::memory load_through_hex(const fs::path& elf, const fs::path& out_dir) {
+    const std::string& root = tt::llrt::OptionsG.get_root_dir();
+    const fs::path hex8 = out_dir / (elf.stem().string() + ".hex.tmp");
+    const fs::path hex32 = out_dir / (elf.stem().string() + ".hex");
+    const std::string log_file = (out_dir / "build.log").string();
+    std::string cmd = root + "tt_metal/third_party/sfpi/compiler/bin/riscv32-unknown-elf-objcopy -O verilog " +
+                      elf.string() + " " + hex8.string();
+    EXPECT_TRUE(tt::utils::run_command(cmd, log_file, false)) << cmd;
+    cmd = "python3 " + root + "tt_metal/hw/toolchain/hex8tohex32.py " + hex8.string() + " " + hex32.string();
+    EXPECT_TRUE(tt::utils::run_command(cmd, log_file, false)) << cmd;
+    std::ifstream hex(hex32);
+    return ll_api::memory(hex);
+}
+
+}  // namespace
+
+TEST_F(DeviceFixture, ElfSegmentsMatchHexImage) {
+    const fs::path out_dir = fs::temp_directory_path() / ("test_elf_loading_" + std::to_string(getpid()));
+    fs::create_directories(out_dir);
+    for (auto device : this->devices_) {
+        // Opening the device built its firmware
+        size_t num_elfs = 0;
+        for (const auto& entry : fs::recursive_directory_iterator(device->build_env().get_out_firmware_root_path())) {
+            if (entry.path().extension() != ".elf") {
+                continue;
+            }
+            ll_api::memory from_elf;
+            from_elf.fill_from_elf(entry.path().string());
+            ll_api::memory from_hex = load_through_hex(entry.path(), out_dir);
+            EXPECT_GT(from_elf.num_spans(), 0) << entry.path();
+            EXPECT_EQ(from_elf.num_spans(), from_hex.num_spans()) << entry.path();
+            EXPECT_EQ(from_elf.size(), from_hex.size()) << entry.path();
+            EXPECT_TRUE(from_elf == from_hex) << entry.path();
+            num_elfs++;
+        }
+        EXPECT_GT(num_elfs, 0);
+    }
+    fs::remove_all(out_dir);
+}
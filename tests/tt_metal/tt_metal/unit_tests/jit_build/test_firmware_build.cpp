@@ -0,0 +1,135 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "tt_metal/common/tt_backend_api_types.hpp"
+#include "tt_metal/jit_build/build.hpp"
+#include "tt_metal/jit_build/genfiles.hpp"
+#include "tt_metal/test_utils/env_vars.hpp"
+
+namespace fs = std::filesystem;
+
+using tt::tt_metal::JitBuildEnv;
+using tt::tt_metal::JitBuildStateSet;
+
+namespace {
+
+// Builds the brisc firmware of made up device headers the way Device::initialize_build and build_firmware do, no
+// device is opened
+class FirmwareBuild : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        this->dir_ = fs::temp_directory_path() / ("test_firmware_build_" + std::to_string(getpid()) + "_" + test_info->name());
+        fs::remove_all(this->dir_);
+        this->arch_ = tt::get_arch_from_string(tt::test_utils::get_env_arch_name());
+    }
+    void TearDown() override {
+        for (const auto& root : this->firmware_roots_) {
+            fs::remove_all(root);
+        }
+        fs::remove_all(this->dir_);
+    }
+
+    // Headers of a device with one DRAM and one L1 bank, l1_bank_offset tells devices apart
+    std::string generate_headers(const std::string& name, int32_t l1_bank_offset) const {
+        const std::string path = (this->dir_ / name).string() + "/";
+        CoreCoord grid_size(13, 12);
+        std::vector<CoreCoord> dram_bank_map = {CoreCoord(1, 0)};
+        std::vector<int32_t> dram_bank_offset_map = {0};
+        std::vector<CoreCoord> l1_bank_map = {CoreCoord(1, 1)};
+        std::vector<int32_t> l1_bank_offset_map = {l1_bank_offset};
+        tt::tt_metal::jit_build_genfiles_bank_to_noc_coord_descriptor(
+            path, grid_size, dram_bank_map, dram_bank_offset_map, l1_bank_map, l1_bank_offset_map);
+        tt::tt_metal::jit_build_genfiles_noc_addr_ranges_header(
+            path, 0, 1 << 30, 0, 1 << 30, {CoreCoord(0, 3)}, {CoreCoord(1, 0)}, {}, grid_size, {}, CoreCoord(1, 11));
+        return path;
+    }
+
+    struct Build {
+        std::unique_ptr<JitBuildEnv> env;
+        JitBuildStateSet states;
+    };
+    Build create_build(const std::string& headers_path) {
+        Build build{.env = std::make_unique<JitBuildEnv>()};
+        build.env->init(0, this->arch_);
+        build.env->init_firmware_root(headers_path);
+        build.states.push_back(std::make_shared<tt::tt_metal::JitBuildDataMovement>(*build.env, 0, true));
+        this->firmware_roots_.push_back(build.env->get_out_firmware_root_path());
+        return build;
+    }
+    static fs::file_time_type elf_time(const Build& build) {
+        return fs::last_write_time(build.states[0]->get_target_out_path(""));
+    }
+
+    fs::path dir_;
+    tt::ARCH arch_;
+    std::vector<std::string> firmware_roots_;
+};
+
+}  // namespace
+
+TEST_F(FirmwareBuild, StampedBuildIsReused) {
+    auto headers = this->generate_headers("device", 0);
+    auto first = this->create_build(headers);
+    fs::remove_all(first.env->get_out_firmware_root_path());
+    tt::tt_metal::jit_build_firmware(*first.env, first.states);
+    const auto built_time = elf_time(first);
+
+    // Another open of a device with the same headers, regenerated in between, finds the build and keeps it
+    headers = this->generate_headers("device", 0);
+    auto second = this->create_build(headers);
+    EXPECT_EQ(second.env->get_out_firmware_root_path(), first.env->get_out_firmware_root_path());
+    tt::tt_metal::jit_build_firmware(*second.env, second.states);
+    EXPECT_EQ(elf_time(second), built_time);
+}
+
+TEST_F(FirmwareBuild, ChangedHeaderInvalidatesStamp) {
+    auto build = this->create_build(this->generate_headers("device", 0));
+    fs::remove_all(build.env->get_out_firmware_root_path());
+    tt::tt_metal::jit_build_firmware(*build.env, build.states);
+
+    // Other generated defines are another firmware
+    auto other = this->create_build(this->generate_headers("other_device", 1024));
+    EXPECT_NE(other.env->get_out_firmware_root_path(), build.env->get_out_firmware_root_path());
+
+    // A header the build read changes after the stamp was written
+    const auto built_time = elf_time(build);
+    const std::string header = build.env->get_out_firmware_root_path() + "brisc/generated_bank_to_noc_coord_mapping.h";
+    ASSERT_TRUE(fs::exists(header));
+    std::ofstream(header, std::ios::app) << "\n";
+    tt::tt_metal::jit_build_firmware(*build.env, build.states);
+    EXPECT_NE(elf_time(build), built_time);
+}
+
+TEST_F(FirmwareBuild, ConcurrentBuildsShareOne) {
+    auto headers = this->generate_headers("device", 0);
+    std::vector<Build> builds;
+    builds.push_back(this->create_build(headers));
+    builds.push_back(this->create_build(headers));
+    ASSERT_EQ(builds[0].env->get_out_firmware_root_path(), builds[1].env->get_out_firmware_root_path());
+    fs::remove_all(builds[0].env->get_out_firmware_root_path());
+
+    // Separate envs lock the root through separate opens, like two devices or processes do, the build that waits
+    // reuses the one that went first instead of building again
+    std::vector<fs::file_time_type> built_times(builds.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < builds.size(); i++) {
+        threads.emplace_back([&, i] {
+            tt::tt_metal::jit_build_firmware(*builds[i].env, builds[i].states);
+            built_times[i] = elf_time(builds[i]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(built_times[0], built_times[1]);
+    EXPECT_TRUE(fs::exists(builds[0].env->get_out_firmware_root_path() + "firmware.stamp"));
+}
@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "tt_metal/jit_build/build.hpp"
+#include "tt_metal/jit_build/digest.hpp"
+#include "tt_metal/jit_build/kernel_binary_cache.hpp"
+
+namespace fs = std::filesystem;
+
+using tt::tt_metal::Digest;
+using tt::tt_metal::JitObjectCache;
+
+namespace {
+
+class ObjectCacheDir : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        const auto* test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+        this->dir_ = fs::temp_directory_path() / ("test_object_cache_" + std::to_string(getpid()) + "_" + test_info->name());
+        fs::remove_all(this->dir_);
+        fs::create_directories(this->dir_ / "build");
+        this->root_ = (this->dir_ / "objects").string() + "/";
+    }
+    void TearDown() override { fs::remove_all(this->dir_); }
+
+    std::string write(const std::string& name, const std::string& contents) const {
+        auto path = (this->dir_ / name).string();
+        std::ofstream(path, std::ios::trunc) << contents;
+        return path;
+    }
+    static std::string read(const std::string& path) {
+        std::ifstream f(path);
+        std::stringstream contents;
+        contents << f.rdbuf();
+        return contents.str();
+    }
+    // Pretends the entry was last used long enough ago to be evicted
+    void age(const std::string& name) const {
+        fs::last_write_time(this->root_ + name, fs::file_time_type::clock::now() - std::chrono::hours(1));
+    }
+
+    fs::path dir_;
+    std::string root_;
+};
+
+// Key of an object built with flags from the preprocessed source at path, the way JitBuildState::compile_one forms it
+std::string object_key(const std::string& flags, const std::string& path) {
+    Digest digest;
+    digest.update_field("object");
+    digest.update_field(flags);
+    digest.update_file(path);
+    return digest.hex();
+}
+
+}  // namespace
+
+TEST(JitBuildDigest, MatchesSha256) {
+    EXPECT_EQ(Digest().hex(), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    EXPECT_EQ(Digest().update("abc").hex(), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    // Split updates hash like one
+    std::string data(1000, 'x');
+    Digest split;
+    for (size_t i = 0; i < data.size(); i += 7) {
+        split.update(data.data() + i, std::min<size_t>(7, data.size() - i));
+    }
+    EXPECT_EQ(split.hex(), Digest().update(data).hex());
+    // Fields are delimited
+    EXPECT_NE(Digest().update_field("ab").update_field("c").hex(), Digest().update_field("a").update_field("bc").hex());
+}
+
+TEST_F(ObjectCacheDir, MissThenHit) {
+    JitObjectCache cache(this->root_, 0);
+    auto source = this->write("kernel.ii", "int f() { return 1; }");
+    auto key = object_key("-O2", source) + ".o";
+
+    auto obj = (this->dir_ / "build" / "kernel.o").string();
+    EXPECT_FALSE(cache.fetch(key, obj));
+    EXPECT_FALSE(fs::exists(obj));
+
+    auto built = this->write("built.o", "object of f");
+    cache.publish(built, key);
+    this->age(key);
+    EXPECT_TRUE(cache.fetch(key, obj));
+    EXPECT_EQ(read(obj), "object of f");
+    // A hit refreshes the LRU stamp
+    EXPECT_GT(fs::last_write_time(this->root_ + key), fs::file_time_type::clock::now() - std::chrono::minutes(1));
+    // Publishing only leaves the entry behind
+    EXPECT_EQ(std::distance(fs::directory_iterator(this->root_), fs::directory_iterator()), 1);
+}
+
+TEST_F(ObjectCacheDir, ChangedInputsMiss) {
+    JitObjectCache cache(this->root_, 0);
+    auto source = this->write("kernel.ii", "int f() { return 1; }");
+    auto key = object_key("-O2", source) + ".o";
+    cache.publish(this->write("built.o", "object of f"), key);
+
+    auto obj = (this->dir_ / "build" / "kernel.o").string();
+    EXPECT_TRUE(cache.fetch(object_key("-O2", source) + ".o", obj));
+    EXPECT_FALSE(cache.fetch(object_key("-O3", source) + ".o", obj));
+    this->write("kernel.ii", "int f() { return 2; }");
+    EXPECT_FALSE(cache.fetch(object_key("-O2", source) + ".o", obj));
+}
+
+TEST_F(ObjectCacheDir, EvictsLeastRecentlyUsed) {
+    constexpr uint64_t MAX_BYTES = 1000;
+    JitObjectCache cache(this->root_, MAX_BYTES);
+    auto entry = this->write("entry.o", std::string(300, 'x'));
+    for (const auto& name : {"a.o", "b.o", "c.o"}) {
+        cache.publish(entry, name);
+        this->age(name);
+    }
+    // b is used again, a is the least recently used
+    auto obj = (this->dir_ / "build" / "b.o").string();
+    EXPECT_TRUE(cache.fetch("b.o", obj));
+    fs::last_write_time(this->root_ + "a.o", fs::file_time_type::clock::now() - std::chrono::hours(2));
+
+    // Over the cap, evicted down to 90% of it
+    cache.publish(entry, "d.o");
+    EXPECT_FALSE(fs::exists(this->root_ + "a.o"));
+    EXPECT_TRUE(fs::exists(this->root_ + "b.o"));
+    EXPECT_TRUE(fs::exists(this->root_ + "d.o"));
+
+    // Entries used within the grace period are never evicted, even over the cap
+    cache.publish(entry, "e.o");
+    cache.publish(entry, "f.o");
+    EXPECT_TRUE(fs::exists(this->root_ + "b.o"));
+    EXPECT_TRUE(fs::exists(this->root_ + "f.o"));
+}
+
+TEST_F(ObjectCacheDir, LinkerScriptIncludes) {
+    fs::create_directories(this->dir_ / "toolchain");
+    auto memory = this->write("toolchain/memory.ld", "MEMORY { CODE : ORIGIN = 0, LENGTH = 4K }");
+    auto address = this->write("toolchain/address.ld", "__address = 0;");
+    auto sections = this->write("sections.ld", "SECTIONS { .text : { *(.text) } }\nINCLUDE address.ld");
+    auto script = this->write("toolchain/app.ld", "INCLUDE \"memory.ld\"\n/* main */\nINCLUDE sections.ld\n");
+
+    std::string lflags = "-Os -L" + this->dir_.string() + " -L" + (this->dir_ / "toolchain").string() + " -T" + script + " ";
+    auto scripts = tt::tt_metal::jit_build_get_linker_scripts(lflags);
+    std::sort(scripts.begin(), scripts.end());
+    std::vector<std::string> expected = {address, memory, script, sections};
+    for (auto& path : expected) {
+        path = fs::weakly_canonical(path).string();
+    }
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(scripts, expected);
+
+    // A missing script is left for the link to report
+    EXPECT_TRUE(tt::tt_metal::jit_build_get_linker_scripts("-T" + (this->dir_ / "missing.ld").string()).empty());
+}
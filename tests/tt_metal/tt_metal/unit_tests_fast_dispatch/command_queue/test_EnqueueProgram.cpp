@@ -559,6 +559,62 @@ TEST_F(CommandQueueFixture, DISABLED_TestDramCacheMatch) {}
 
 TEST_F(CommandQueueFixture, DISABLED_TestProgramVectorSizeMatch) {}
 
+TEST_F(CommandQueueFixture, TestCachedProgramPicksUpNewRuntimeArgCores) {
+    CoreRange cr = {.start = {0, 0}, .end = {1, 0}};
+    CoreRangeSet cr_set({cr});
+    CoreCoord first_core = {0, 0};
+    CoreCoord second_core = {1, 0};
+
+    Program program;
+    auto kernel = CreateKernel(
+        program, "tt_metal/kernels/dataflow/blank.cpp", cr_set,
+        DataMovementConfig{.processor = DataMovementProcessor::RISCV_0, .noc = NOC::RISCV_0_default});
+
+    CommandQueue& cq = tt::tt_metal::detail::GetCommandQueue(this->device_);
+    vector<uint32_t> first_core_args = {1, 2, 3};
+    SetRuntimeArgs(program, kernel, first_core, first_core_args);
+    EnqueueProgram(cq, program, false);
+    Finish(cq);
+
+    // Second enqueue reuses the cached binaries, new values and a new core with wider args must still land
+    first_core_args = {4, 5, 6};
+    vector<uint32_t> second_core_args = {7, 8, 9, 10, 11, 12};
+    SetRuntimeArgs(program, kernel, first_core, first_core_args);
+    SetRuntimeArgs(program, kernel, second_core, second_core_args);
+    EnqueueProgram(cq, program, false);
+    Finish(cq);
+
+    vector<uint32_t> readback;
+    tt::tt_metal::detail::ReadFromDeviceL1(
+        this->device_, first_core, BRISC_L1_ARG_BASE, first_core_args.size() * sizeof(uint32_t), readback);
+    EXPECT_EQ(readback, first_core_args);
+    tt::tt_metal::detail::ReadFromDeviceL1(
+        this->device_, second_core, BRISC_L1_ARG_BASE, second_core_args.size() * sizeof(uint32_t), readback);
+    EXPECT_EQ(readback, second_core_args);
+}
+
+TEST_F(CommandQueueFixture, TestCachedProgramPicksUpNewSemaphores) {
+    CoreRange cr = {.start = {0, 0}, .end = {0, 0}};
+    CoreRangeSet cr_set({cr});
+
+    Program program;
+    local_test_functions::initialize_dummy_kernels(program, cr_set);
+
+    CommandQueue& cq = tt::tt_metal::detail::GetCommandQueue(this->device_);
+    EnqueueProgram(cq, program, false);
+    Finish(cq);
+
+    // Adding a semaphore rebuilds the program pages of the cached program
+    uint32_t initial_value = 0xabcd;
+    uint32_t semaphore_address = CreateSemaphore(program, cr, initial_value);
+    EnqueueProgram(cq, program, false);
+    Finish(cq);
+
+    vector<uint32_t> readback;
+    tt::tt_metal::detail::ReadFromDeviceL1(this->device_, cr.start, semaphore_address, sizeof(uint32_t), readback);
+    EXPECT_EQ(readback.at(0), initial_value);
+}
+
 }  // end namespace dram_cache_tests
 }  // end namespace basic_tests
 
@@ -411,6 +411,50 @@ TEST_F(CommandQueueFixture, TestWrapCompletionQOnInsufficientSpace2) {
     EXPECT_EQ(src_2, result_2);
 }
 
+// Test that non-blocking reads can be in flight together, across completion queue wraps, and complete in order
+TEST_F(CommandQueueFixture, TestNonBlockingReadsInFlight) {
+    uint32_t page_size = 2048;
+    uint32_t num_pages = 64;
+    uint32_t num_buffers = 32;  // 4 MB of reads, more than the completion region holds
+
+    vector<std::unique_ptr<Buffer>> buffers;
+    vector<vector<uint32_t>> srcs;
+    vector<vector<uint32_t>> results(num_buffers);
+    vector<std::shared_future<void>> reads;
+    for (uint32_t i = 0; i < num_buffers; i++) {
+        buffers.push_back(std::make_unique<Buffer>(this->device_, num_pages * page_size, page_size, BufferType::DRAM));
+        srcs.push_back(local_test_functions::generate_arange_vector(buffers.back()->size()));
+        for (uint32_t& val : srcs.back()) {
+            val += i << 24;
+        }
+        EnqueueWriteBuffer(tt::tt_metal::detail::GetCommandQueue(device_), *buffers.back(), srcs.back(), false);
+    }
+    for (uint32_t i = 0; i < num_buffers; i++) {
+        reads.push_back(EnqueueReadBuffer(tt::tt_metal::detail::GetCommandQueue(device_), *buffers[i], results[i], false));
+    }
+    // The last read completing implies all earlier reads completed
+    reads.back().wait();
+    for (uint32_t i = 0; i < num_buffers; i++) {
+        EXPECT_EQ(reads[i].wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        EXPECT_EQ(srcs[i], results[i]);
+    }
+}
+
+// Test that reads send the commands held back by lazy mode, a blocking read would otherwise never complete
+TEST_F(CommandQueueFixture, TestBlockingReadInLazyMode) {
+    uint32_t page_size = 2048;
+    uint32_t num_pages = 16;
+    Buffer buffer(this->device_, num_pages * page_size, page_size, BufferType::DRAM);
+    vector<uint32_t> src = local_test_functions::generate_arange_vector(buffer.size());
+    vector<uint32_t> result;
+    tt::tt_metal::detail::SetLazyCommandQueueMode(true);
+    EnqueueWriteBuffer(tt::tt_metal::detail::GetCommandQueue(device_), buffer, src, false);
+    auto read = EnqueueReadBuffer(tt::tt_metal::detail::GetCommandQueue(device_), buffer, result, true);
+    tt::tt_metal::detail::SetLazyCommandQueueMode(false);
+    EXPECT_EQ(read.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(src, result);
+}
+
 
 }  // end namespace dram_tests
 
@@ -490,6 +534,26 @@ TEST_F(CommandQueueFixture, ShardedBufferReadWrites) {
         local_test_functions::stress_test_EnqueueWriteBuffer_and_EnqueueReadBuffer_sharded(this->device_, tt::tt_metal::detail::GetCommandQueue(this->device_), config));
 }
 
+TEST_F(CommandQueueFixture, WidthShardedBufferReadWrites) {
+    BufferStressTestConfigSharded config({2,2}, {4,2});
+    config.seed = 0;
+    config.num_iterations = 20;
+    config.mem_config = TensorMemoryLayout::WIDTH_SHARDED;
+
+    EXPECT_TRUE(
+        local_test_functions::stress_test_EnqueueWriteBuffer_and_EnqueueReadBuffer_sharded(this->device_, tt::tt_metal::detail::GetCommandQueue(this->device_), config));
+}
+
+TEST_F(CommandQueueFixture, BlockShardedBufferReadWrites) {
+    BufferStressTestConfigSharded config({2,2}, {4,2});
+    config.seed = 0;
+    config.num_iterations = 20;
+    config.mem_config = TensorMemoryLayout::BLOCK_SHARDED;
+
+    EXPECT_TRUE(
+        local_test_functions::stress_test_EnqueueWriteBuffer_and_EnqueueReadBuffer_sharded(this->device_, tt::tt_metal::detail::GetCommandQueue(this->device_), config));
+}
+
 TEST_F(CommandQueueFixture, StressWrapTest) {
     const char* arch = getenv("ARCH_NAME");
     if ( strcasecmp(arch,"wormhole_b0") == 0 ) {
@@ -4,6 +4,7 @@
 
 #include "gtest/gtest.h"
 #include "tt_metal/host_api.hpp"
+#include "tt_metal/detail/tt_metal.hpp"
 #include "tt_metal/test_utils/env_vars.hpp"
 #include "tt_metal/impl/dispatch/command_queue.hpp"
 #include "tt_metal/llrt/rtoptions.hpp"
@@ -47,8 +48,11 @@ class CommandQueueMultiDeviceFixture : public ::testing::Test {
 
         num_devices_ = tt::tt_metal::GetNumAvailableDevices();
 
+        std::vector<chip_id_t> device_ids;
         for (unsigned int id = 0; id < num_devices_; id++) {
-            auto* device = tt::tt_metal::CreateDevice(id);
+            device_ids.push_back(id);
+        }
+        for (const auto& [id, device] : tt::tt_metal::detail::CreateDevices(device_ids)) {
             devices_.push_back(device);
         }
         tt::Cluster::instance().set_internal_routing_info_for_ethernet_cores(true);
@@ -0,0 +1,208 @@
+# SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+
+# SPDX-License-Identifier: Apache-2.0
+
+"""Decodes the binary operation history written when OPERATION_HISTORY is set into CSV or JSON.
+
+The layout mirrors tt_eager/tt_dnn/op_library/operation_history.hpp and operation_history.cpp.
+"""
+
+import argparse
+import csv
+import json
+import struct
+import sys
+
+MAGIC = b"TTOPHIST"
+VERSION = 1
+
+FILE_HEADER = struct.Struct("<8sIIII")
+SECTION_HEADER = struct.Struct("<IIQ")
+RING_HEADER = struct.Struct("<IIQ")
+RECORD_HEADER = struct.Struct("<QQIIIBB2x")
+
+SECTION_ENUM_NAMES = 0
+SECTION_STRINGS = 1
+SECTION_RING = 2
+
+OPERATION_TYPES = {0: "host", 1: "device", 2: "external"}
+ENUMS = ["storage_type", "data_type", "layout", "memory_layout", "buffer_type"]
+NO_MEMORY_CONFIG = 0xFF
+
+
+def parse_enum_names(payload):
+    names = {enum: {} for enum in ENUMS}
+    offset = 0
+    while offset < len(payload):
+        enum_id, value, length = struct.unpack_from("<BBH", payload, offset)
+        offset += 4
+        names[ENUMS[enum_id]][value] = payload[offset : offset + length].decode()
+        offset += length
+    return names
+
+
+def parse_strings(payload, strings):
+    offset = 0
+    while offset < len(payload):
+        (length,) = struct.unpack_from("<I", payload, offset)
+        offset += 4
+        strings.append(payload[offset : offset + length].decode(errors="replace"))
+        offset += length
+
+
+def parse_tensor(data, offset, max_num_dimensions, enum_names):
+    storage_type, data_type, layout, rank, memory_layout, buffer_type = struct.unpack_from("<BBBBBB2x", data, offset)
+    shape = struct.unpack_from(f"<{max_num_dimensions}I", data, offset + 8)[:rank]
+    tensor = {
+        "storage_type": enum_names["storage_type"].get(storage_type, storage_type),
+        "shape": list(shape),
+        "data_type": enum_names["data_type"].get(data_type, data_type),
+        "layout": enum_names["layout"].get(layout, layout),
+        "memory_layout": None,
+        "buffer_type": None,
+    }
+    if memory_layout != NO_MEMORY_CONFIG:
+        tensor["memory_layout"] = enum_names["memory_layout"].get(memory_layout, memory_layout)
+        tensor["buffer_type"] = enum_names["buffer_type"].get(buffer_type, buffer_type)
+    return tensor
+
+
+def parse_ring(payload, header, strings, enum_names):
+    _, record_size, max_input_tensors, max_num_dimensions = header
+    tensor_size = 8 + 4 * max_num_dimensions
+    thread_index, capacity, num_records = RING_HEADER.unpack_from(payload, 0)
+
+    # A full ring is written oldest slot first starting at num_records % capacity. That slot may be the one its thread
+    # was overwriting during the dump, so it is skipped.
+    num_slots = min(num_records, capacity)
+    first_slot = num_records % capacity if num_records >= capacity else 0
+    slots = [(first_slot + i) % num_slots for i in range(num_slots)]
+    if num_records >= capacity:
+        slots = slots[1:]
+
+    records = []
+    for slot in slots:
+        offset = RING_HEADER.size + slot * record_size
+        index, timestamp_ns, opcode, attributes, composite_parent_names, operation_type, num_input_tensors = (
+            RECORD_HEADER.unpack_from(payload, offset)
+        )
+        input_tensors = [
+            parse_tensor(payload, offset + RECORD_HEADER.size + i * tensor_size, max_num_dimensions, enum_names)
+            for i in range(min(num_input_tensors, max_input_tensors))
+        ]
+        records.append(
+            {
+                "index": index,
+                "thread": thread_index,
+                "timestamp_ns": timestamp_ns,
+                "operation_type": OPERATION_TYPES.get(operation_type, operation_type),
+                "opcode": strings[opcode],
+                "composite_parent_names": strings[composite_parent_names],
+                "attributes": strings[attributes],
+                "num_input_tensors": num_input_tensors,
+                "input_tensors": input_tensors,
+            }
+        )
+    return records
+
+
+def decode(file_name):
+    with open(file_name, "rb") as file:
+        data = file.read()
+
+    magic, version, *header = FILE_HEADER.unpack_from(data, 0)
+    assert magic == MAGIC, f"{file_name} is not an operation history"
+    assert version == VERSION, f"{file_name} has version {version}, expected {VERSION}"
+
+    enum_names = {enum: {} for enum in ENUMS}
+    strings = []
+    rings = []
+    offset = FILE_HEADER.size
+    while offset + SECTION_HEADER.size <= len(data):
+        section_type, _, size = SECTION_HEADER.unpack_from(data, offset)
+        offset += SECTION_HEADER.size
+        payload = data[offset : offset + size]
+        offset += size
+        if section_type == SECTION_ENUM_NAMES:
+            enum_names = parse_enum_names(payload)
+        elif section_type == SECTION_STRINGS:
+            parse_strings(payload, strings)
+        elif section_type == SECTION_RING:
+            rings.append(payload)
+
+    records = []
+    for payload in rings:
+        records.extend(parse_ring(payload, [version, *header], strings, enum_names))
+    return sorted(records, key=lambda record: record["index"])
+
+
+def write_csv(records, output_file):
+    max_input_tensors = max((len(record["input_tensors"]) for record in records), default=0)
+    columns = [
+        "Index",
+        "Thread",
+        "Timestamp [ns]",
+        "Operation Type",
+        "Opcode",
+        "Composite Parent Names",
+        "Attributes",
+        "Num Input Tensors",
+    ]
+    for index in range(max_input_tensors):
+        columns += [
+            f"Input Tensor {index} {name}"
+            for name in ["Storage Type", "Shape", "Data Type", "Layout", "Memory Layout", "Buffer Type"]
+        ]
+
+    writer = csv.writer(output_file)
+    writer.writerow(columns)
+    for record in records:
+        row = [
+            record["index"],
+            record["thread"],
+            record["timestamp_ns"],
+            record["operation_type"],
+            record["opcode"],
+            record["composite_parent_names"],
+            record["attributes"],
+            record["num_input_tensors"],
+        ]
+        for tensor in record["input_tensors"]:
+            row += [
+                tensor["storage_type"],
+                "x".join(str(dim) for dim in tensor["shape"]),
+                tensor["data_type"],
+                tensor["layout"],
+                tensor["memory_layout"] or "",
+                tensor["buffer_type"] or "",
+            ]
+        row += [""] * (len(columns) - len(row))
+        writer.writerow(row)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("history", help="File written by the operation history")
+    parser.add_argument("-o", "--output", help="Output file, .json for JSON and CSV otherwise (stdout by default)")
+    parser.add_argument("-n", "--last", type=int, help="Only decode the last N operations")
+    parser.add_argument("--json", action="store_true", help="Write JSON to stdout")
+    args = parser.parse_args()
+
+    records = decode(args.history)
+    if args.last is not None:
+        records = records[-args.last :]
+
+    as_json = args.json or (args.output is not None and args.output.endswith(".json"))
+    output_file = open(args.output, "w", newline="") if args.output is not None else sys.stdout
+    try:
+        if as_json:
+            json.dump(records, output_file, indent=2)
+        else:
+            write_csv(records, output_file)
+    finally:
+        if args.output is not None:
+            output_file.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,307 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tensor/host_ingestion.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include "common/bfloat16.hpp"
+#include "common/bfloat8.hpp"
+#include "common/constants.hpp"
+#include "common/executor.hpp"
+#include "common/layout_conversion.hpp"
+#include "tensor/owned_buffer_functions.hpp"
+#include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace {
+
+using tt::constants::TILE_HEIGHT;
+using tt::constants::TILE_HW;
+using tt::constants::TILE_WIDTH;
+
+using tt::tt_metal::detail::PARALLEL_FOR_MIN_BYTES_PER_TASK;
+
+template <typename Dst, typename Src>
+inline Dst convert_element(Src value) {
+    if constexpr (std::is_same_v<Src, Dst>) {
+        return value;
+    } else if constexpr (std::is_same_v<Src, bfloat16>) {
+        return value.to_float();
+    } else {
+        return bfloat16(value);
+    }
+}
+
+// Reads the rows of the output, [..., rows, width] flattened to 2D, from the source. Output rows and columns that are
+// outside of the source are padding
+template <typename Src, typename Dst>
+class RowReader {
+   public:
+    RowReader(const HostTensorSource& source, const std::vector<uint32_t>& output_shape, Dst pad_value) :
+        data_(static_cast<const Src*>(source.data)),
+        source_shape_(source.shape),
+        output_shape_(output_shape),
+        strides_(source.strides),
+        pad_value_(pad_value) {}
+
+    // Offset of the first element of an output row in the source, nullopt if the whole row is padding
+    std::optional<int64_t> row_offset(uint64_t row) const {
+        int64_t offset = 0;
+        for (int dim = static_cast<int>(this->output_shape_.size()) - 2; dim >= 0; dim--) {
+            uint32_t index = row % this->output_shape_[dim];
+            row /= this->output_shape_[dim];
+            if (index >= this->source_shape_[dim]) {
+                return std::nullopt;
+            }
+            offset += int64_t(index) * this->strides_[dim];
+        }
+        return offset;
+    }
+
+    // Writes count elements of the output row at row_offset, starting from column col
+    void read(std::optional<int64_t> row_offset, uint32_t col, uint32_t count, Dst* dst) const {
+        const uint32_t width = this->source_shape_.back();
+        uint32_t num_valid = 0;
+        if (row_offset.has_value() and col < width) {
+            num_valid = std::min(count, width - col);
+            const int64_t col_stride = this->strides_.back();
+            const Src* src = this->data_ + row_offset.value() + int64_t(col) * col_stride;
+            if constexpr (std::is_same_v<Src, Dst>) {
+                if (col_stride == 1) {
+                    // Lowered to a memmove
+                    std::copy_n(src, num_valid, dst);
+                    std::fill(dst + num_valid, dst + count, this->pad_value_);
+                    return;
+                }
+            }
+            for (uint32_t index = 0; index < num_valid; index++) {
+                dst[index] = convert_element<Dst>(src[index * col_stride]);
+            }
+        }
+        std::fill(dst + num_valid, dst + count, this->pad_value_);
+    }
+
+   private:
+    const Src* data_;
+    std::vector<uint32_t> source_shape_;
+    std::vector<uint32_t> output_shape_;
+    std::vector<int64_t> strides_;
+    Dst pad_value_;
+};
+
+// Reads the tile into row major order, which stays in L1, and tilizes it into the output
+template <typename Src, typename Dst>
+void gather_tile(
+    const RowReader<Src, Dst>& reader,
+    const std::array<std::optional<int64_t>, TILE_HEIGHT>& row_offsets,
+    uint32_t col_tile,
+    Dst* tile) {
+    alignas(64) std::array<Dst, TILE_HW> rows;
+    for (uint32_t row = 0; row < TILE_HEIGHT; row++) {
+        reader.read(row_offsets[row], col_tile * TILE_WIDTH, TILE_WIDTH, rows.data() + row * TILE_WIDTH);
+    }
+    layout_conversion::tilize_tile(rows.data(), TILE_WIDTH, tile);
+}
+
+// Calls fn(tile_index, row_offsets, col_tile) for every tile, tile rows are split across the executor
+template <typename Src, typename Dst, typename Fn>
+void for_each_tile(const RowReader<Src, Dst>& reader, uint32_t num_rows, uint32_t width, size_t tile_bytes, const Fn& fn) {
+    const uint32_t num_tile_rows = num_rows / TILE_HEIGHT;
+    const uint32_t num_col_tiles = width / TILE_WIDTH;
+    const size_t num_bytes = size_t(num_tile_rows) * num_col_tiles * tile_bytes;
+    tt_metal::detail::parallel_for(num_tile_rows, num_bytes / PARALLEL_FOR_MIN_BYTES_PER_TASK, [&](uint32_t begin, uint32_t end) {
+        std::array<std::optional<int64_t>, TILE_HEIGHT> row_offsets;
+        for (uint32_t tile_row = begin; tile_row < end; tile_row++) {
+            for (uint32_t row = 0; row < TILE_HEIGHT; row++) {
+                row_offsets[row] = reader.row_offset(uint64_t(tile_row) * TILE_HEIGHT + row);
+            }
+            for (uint32_t col_tile = 0; col_tile < num_col_tiles; col_tile++) {
+                fn(size_t(tile_row) * num_col_tiles + col_tile, row_offsets, col_tile);
+            }
+        }
+    });
+}
+
+inline void pack_bfp8_tile(const float* tile, bool use_avx512, uint32_t* dst) {
+    const auto addressing = Bfp8TileAddressing{.row_major = false, .rows = TILE_HEIGHT, .cols = TILE_WIDTH};
+    if (use_avx512) {
+        pack_bfp8_tiles_avx512<false>(tile, addressing, 0, 1, /*is_exp_a=*/false, dst);
+    } else {
+        pack_bfp8_tiles_avx2<false>(tile, addressing, 0, 1, /*is_exp_a=*/false, dst);
+    }
+}
+
+template <typename Src, typename Dst>
+std::vector<Dst> ingest(const RowReader<Src, Dst>& reader, uint32_t num_rows, uint32_t width, Layout layout) {
+    std::vector<Dst> output(size_t(num_rows) * width);
+    Dst* dst = output.data();
+    if (layout == Layout::TILE) {
+        for_each_tile(reader, num_rows, width, TILE_HW * sizeof(Dst), [&](size_t tile_index, const auto& row_offsets, uint32_t col_tile) {
+            gather_tile(reader, row_offsets, col_tile, dst + tile_index * TILE_HW);
+        });
+    } else {
+        const size_t num_bytes = output.size() * sizeof(Dst);
+        tt_metal::detail::parallel_for(num_rows, num_bytes / PARALLEL_FOR_MIN_BYTES_PER_TASK, [&](uint32_t begin, uint32_t end) {
+            for (uint32_t row = begin; row < end; row++) {
+                reader.read(reader.row_offset(row), 0, width, dst + size_t(row) * width);
+            }
+        });
+    }
+    return output;
+}
+
+template <typename Src>
+std::vector<uint32_t> ingest_bfloat8_b(const RowReader<Src, float>& reader, uint32_t num_rows, uint32_t width, Layout layout) {
+    const size_t volume = size_t(num_rows) * width;
+    const size_t num_tiles = volume / TILE_HW;
+    std::vector<uint32_t> output(num_tiles * BFP8_WORDS_IN_TILE);
+    uint32_t* dst = output.data();
+    const bool use_avx512 = bfp8_cpu_supports_avx512();
+    if (layout == Layout::TILE) {
+        for_each_tile(reader, num_rows, width, TILE_HW * sizeof(float), [&](size_t tile_index, const auto& row_offsets, uint32_t col_tile) {
+            alignas(64) std::array<float, TILE_HW> tile;
+            gather_tile(reader, row_offsets, col_tile, tile.data());
+            pack_bfp8_tile(tile.data(), use_avx512, dst + tile_index * BFP8_WORDS_IN_TILE);
+        });
+    } else {
+        // Row major BFLOAT8_B packs every 1024 consecutive elements as a tile, which may span several rows
+        TT_FATAL(num_tiles <= std::numeric_limits<uint32_t>::max(), "Ingestion of {} tiles is not supported", num_tiles);
+        const size_t num_bytes = volume * sizeof(float);
+        tt_metal::detail::parallel_for(num_tiles, num_bytes / PARALLEL_FOR_MIN_BYTES_PER_TASK, [&](uint32_t begin, uint32_t end) {
+            alignas(64) std::array<float, TILE_HW> tile;
+            for (uint32_t tile_index = begin; tile_index < end; tile_index++) {
+                size_t element = size_t(tile_index) * TILE_HW;
+                uint32_t filled = 0;
+                while (filled < TILE_HW) {
+                    const uint32_t row = element / width;
+                    const uint32_t col = element % width;
+                    const uint32_t count = std::min(width - col, TILE_HW - filled);
+                    reader.read(reader.row_offset(row), col, count, tile.data() + filled);
+                    filled += count;
+                    element += count;
+                }
+                pack_bfp8_tile(tile.data(), use_avx512, dst + size_t(tile_index) * BFP8_WORDS_IN_TILE);
+            }
+        });
+    }
+    return output;
+}
+
+// Number of rows of the output flattened to [rows, width]
+inline uint32_t compute_num_rows(const std::vector<uint32_t>& output_shape) {
+    uint64_t num_rows = 1;
+    for (size_t index = 0; index + 1 < output_shape.size(); index++) {
+        num_rows *= output_shape[index];
+    }
+    TT_FATAL(num_rows <= std::numeric_limits<uint32_t>::max(), "Ingestion of {} rows is not supported", num_rows);
+    return num_rows;
+}
+
+template <typename Src, typename Dst>
+Tensor create_tensor(
+    const HostTensorSource& source,
+    const std::vector<uint32_t>& output_shape,
+    const Shape& shape,
+    DataType data_type,
+    Layout layout,
+    float pad_value) {
+    RowReader<Src, Dst> reader(source, output_shape, static_cast<Dst>(pad_value));
+    auto output = ingest(reader, compute_num_rows(output_shape), output_shape.back(), layout);
+    return Tensor(OwnedStorage{owned_buffer::create<Dst>(std::move(output))}, shape, data_type, layout);
+}
+
+}  // namespace
+
+std::vector<int64_t> compute_row_major_strides(const std::vector<uint32_t>& shape) {
+    std::vector<int64_t> strides(shape.size(), 1);
+    for (int dim = static_cast<int>(shape.size()) - 2; dim >= 0; dim--) {
+        strides[dim] = strides[dim + 1] * shape[dim + 1];
+    }
+    return strides;
+}
+
+Tensor ingest_host_tensor(
+    const HostTensorSource& source, DataType data_type, Layout layout, const std::optional<Shape>& padded_shape, float pad_value) {
+    ZoneScoped;
+    const auto rank = source.shape.size();
+    TT_FATAL(rank > 0, "Ingestion of a scalar is not supported");
+    TT_FATAL(source.strides.size() == rank, "Source has {} strides for {} dims", source.strides.size(), rank);
+    TT_FATAL(layout == Layout::ROW_MAJOR or layout == Layout::TILE, "Ingestion only supports ROW_MAJOR and TILE layouts");
+
+    auto output_shape = source.shape;
+    auto dimensions_pads = std::vector<Padding::PadDimension>();
+    if (padded_shape.has_value()) {
+        TT_FATAL(padded_shape->rank() == rank, "Padded shape must have the rank of the source, {}", rank);
+        for (size_t index = 0; index < rank; index++) {
+            output_shape[index] = padded_shape.value()[index];
+            TT_FATAL(
+                output_shape[index] >= source.shape[index],
+                "Padded shape is smaller than the source in dim {}, {} < {}",
+                index,
+                output_shape[index],
+                source.shape[index]);
+            dimensions_pads.push_back(Padding::PadDimension{.front = 0, .back = output_shape[index] - source.shape[index]});
+        }
+    }
+    const auto shape =
+        padded_shape.has_value() ? Shape(output_shape, Padding(dimensions_pads, Padding::PadValue::Any)) : Shape(output_shape);
+
+    if (layout == Layout::TILE) {
+        TT_FATAL(
+            rank >= 2 and output_shape[rank - 2] % TILE_HEIGHT == 0 and output_shape[rank - 1] % TILE_WIDTH == 0,
+            "TILE layout requires the last two dims to be multiples of {}x{}",
+            TILE_HEIGHT,
+            TILE_WIDTH);
+    }
+
+    switch (data_type) {
+        case DataType::BFLOAT8_B: {
+            const uint32_t num_rows = compute_num_rows(output_shape);
+            const uint32_t width = output_shape.back();
+            TT_FATAL(
+                layout == Layout::TILE or (uint64_t(num_rows) * width) % TILE_HW == 0,
+                "ROW_MAJOR BFLOAT8_B requires a volume that is a multiple of {}",
+                TILE_HW);
+            std::vector<uint32_t> output;
+            if (source.data_type == DataType::FLOAT32) {
+                output = ingest_bfloat8_b(RowReader<float, float>(source, output_shape, pad_value), num_rows, width, layout);
+            } else if (source.data_type == DataType::BFLOAT16) {
+                output = ingest_bfloat8_b(RowReader<bfloat16, float>(source, output_shape, pad_value), num_rows, width, layout);
+            } else {
+                TT_THROW("BFLOAT8_B can only be created from FLOAT32 or BFLOAT16");
+            }
+            return Tensor(OwnedStorage{owned_buffer::create<uint32_t>(std::move(output))}, shape, data_type, layout);
+        }
+        case DataType::FLOAT32:
+            if (source.data_type == DataType::BFLOAT16) {
+                return create_tensor<bfloat16, float>(source, output_shape, shape, data_type, layout, pad_value);
+            }
+            TT_FATAL(source.data_type == DataType::FLOAT32, "FLOAT32 can only be created from FLOAT32 or BFLOAT16");
+            return create_tensor<float, float>(source, output_shape, shape, data_type, layout, pad_value);
+        case DataType::BFLOAT16:
+            if (source.data_type == DataType::FLOAT32) {
+                return create_tensor<float, bfloat16>(source, output_shape, shape, data_type, layout, pad_value);
+            }
+            TT_FATAL(source.data_type == DataType::BFLOAT16, "BFLOAT16 can only be created from FLOAT32 or BFLOAT16");
+            return create_tensor<bfloat16, bfloat16>(source, output_shape, shape, data_type, layout, pad_value);
+        case DataType::UINT32:
+            TT_FATAL(source.data_type == DataType::UINT32, "UINT32 can only be created from UINT32");
+            return create_tensor<uint32_t, uint32_t>(source, output_shape, shape, data_type, layout, pad_value);
+        case DataType::UINT16:
+            TT_FATAL(source.data_type == DataType::UINT16, "UINT16 can only be created from UINT16");
+            return create_tensor<uint16_t, uint16_t>(source, output_shape, shape, data_type, layout, pad_value);
+        default: TT_THROW("Unsupported DataType");
+    }
+}
+
+}  // namespace tt_metal
+
+}  // namespace tt
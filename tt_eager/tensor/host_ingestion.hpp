@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Creation of host tensors in their final format straight from framework memory (torch, numpy, DLPack).
+// The source is read once with its own strides and every output tile is gathered, converted, padded and, for
+// BFLOAT8_B, packed while it is still in cache, instead of copying, tilizing and packing the whole tensor in turns.
+// Tile rows are split across the executor.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "tensor/tensor.hpp"
+#include "tensor/types.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+// Host memory to create a tensor from, a dense row major array or any strided view of one
+struct HostTensorSource {
+    const void* data;
+    // FLOAT32, BFLOAT16, UINT32 or UINT16
+    DataType data_type;
+    std::vector<uint32_t> shape;
+    // In elements, may be negative or 0 (broadcast views)
+    std::vector<int64_t> strides;
+};
+
+// Row major strides of a dense array of shape
+std::vector<int64_t> compute_row_major_strides(const std::vector<uint32_t>& shape);
+
+/**
+ * Creates an owned host tensor of data_type in layout from source in one pass over the output.
+ * If padded_shape is set the source is placed at its origin and the rest is filled with pad_value, like pad.
+ * Besides keeping the element type, FLOAT32 and BFLOAT16 sources can be converted to each other and to BFLOAT8_B.
+ * TILE layout requires the last two dims of the output to be multiples of 32, a ROW_MAJOR BFLOAT8_B output
+ * requires its volume to be a multiple of a tile.
+ */
+Tensor ingest_host_tensor(
+    const HostTensorSource& source,
+    DataType data_type,
+    Layout layout,
+    const std::optional<Shape>& padded_shape = std::nullopt,
+    float pad_value = 0.0f);
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -5,10 +5,21 @@
 #include "tensor/serialization.hpp"
 #include "tensor/borrowed_buffer_functions.hpp"
 #include "tensor/owned_buffer_functions.hpp"
+#include "common/bfloat8.hpp"
+#include "common/constants.hpp"
+#include "third_party/magic_enum/magic_enum.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <string>
+#include <unordered_set>
 
 namespace tt {
 
@@ -16,30 +27,235 @@ namespace tt_metal {
 
 namespace detail {
 
-void dump_owned_storage(ofstream& output_stream, const OwnedStorage& storage) {
-    std::visit(
-        [&output_stream]<typename T>(const owned_buffer::Buffer<T>& generic_buffer) {
-            const auto buffer = owned_buffer::get_as<T>(generic_buffer);
-            auto size = buffer.size();
-            output_stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
-            output_stream.write(reinterpret_cast<const char*>(buffer.begin()), sizeof(T) * size);
-        },
-        storage.buffer
-    );
+// Tensor file layout, all offsets are from the start of the file:
+//   TensorFileHeader
+//   TensorFileEntry[num_tensors]
+//   names of the tensors, back to back
+//   payloads, each aligned to TENSOR_FILE_PAYLOAD_ALIGNMENT
+// Payloads are the host buffers as they are, so tiled and BFLOAT8_B packed tensors need no conversion when loaded
+constexpr char TENSOR_FILE_MAGIC[8] = {'T', 'T', 'T', 'E', 'N', 'S', 'O', 'R'};
+constexpr uint32_t TENSOR_FILE_VERSION = 1;
+// Page aligned so that payloads can be mapped, pinned or DMAed without copying
+constexpr uint64_t TENSOR_FILE_PAYLOAD_ALIGNMENT = 4096;
+
+struct TensorFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_tensors;
+    uint64_t file_size;
+};
+
+struct TensorFileEntry {
+    uint64_t name_offset;
+    uint64_t name_size;
+    uint64_t payload_offset;
+    uint64_t payload_size;
+    uint32_t data_type;
+    uint32_t layout;
+    uint32_t rank;
+    uint32_t pad_value;
+    uint32_t dimensions[MAX_NUM_DIMENSIONS];
+    uint32_t padding_front[MAX_NUM_DIMENSIONS];
+    uint32_t padding_back[MAX_NUM_DIMENSIONS];
+};
+
+static_assert(sizeof(TensorFileHeader) == 24);
+static_assert(sizeof(TensorFileEntry) == 48 + 12 * MAX_NUM_DIMENSIONS);
+
+inline uint64_t align_payload_offset(uint64_t offset) {
+    return (offset + TENSOR_FILE_PAYLOAD_ALIGNMENT - 1) / TENSOR_FILE_PAYLOAD_ALIGNMENT * TENSOR_FILE_PAYLOAD_ALIGNMENT;
+}
+
+TensorFileEntry create_tensor_file_entry(const Shape& shape, DataType data_type, Layout layout) {
+    TensorFileEntry entry{};
+    entry.data_type = static_cast<uint32_t>(data_type);
+    entry.layout = static_cast<uint32_t>(layout);
+    entry.rank = shape.rank();
+    entry.pad_value = static_cast<uint32_t>(shape.padding().pad_value());
+    for (auto index = 0; index < shape.rank(); index++) {
+        entry.dimensions[index] = shape[index];
+        entry.padding_front[index] = shape.padding()[index].front;
+        entry.padding_back[index] = shape.padding()[index].back;
+    }
+    return entry;
+}
+
+// Compared without adding, so offsets and sizes near the top of the range can't wrap around
+inline bool is_in_bounds(uint64_t offset, uint64_t size, uint64_t file_size) {
+    return offset <= file_size and size <= file_size - offset;
+}
+
+// Enums are stored as their underlying values, any other value is a corrupt file
+template <typename EnumType>
+EnumType get_enum(uint32_t value) {
+    auto result = magic_enum::enum_cast<EnumType>(static_cast<std::underlying_type_t<EnumType>>(value));
+    if (not result.has_value()) {
+        TT_THROW("Invalid {} {} in tensor file", magic_enum::enum_type_name<EnumType>(), value);
+    }
+    return result.value();
+}
+
+// Bytes the shape needs, BFLOAT8_B packs every 1024 elements with their exponents
+uint64_t get_min_payload_size(const TensorFileEntry& entry, DataType data_type) {
+    uint64_t volume = 1;
+    for (uint32_t index = 0; index < entry.rank; index++) {
+        TT_FATAL(
+            entry.dimensions[index] == 0 or volume <= std::numeric_limits<uint64_t>::max() / 4 / entry.dimensions[index],
+            "Tensor file shape is too large");
+        volume *= entry.dimensions[index];
+    }
+    switch (data_type) {
+        case DataType::BFLOAT8_B: return (volume + constants::TILE_HW - 1) / constants::TILE_HW * BFP8_WORDS_IN_TILE * sizeof(uint32_t);
+        case DataType::UINT32:
+        case DataType::FLOAT32: return volume * sizeof(uint32_t);
+        case DataType::UINT16:
+        case DataType::BFLOAT16: return volume * sizeof(uint16_t);
+        default: TT_THROW("Unsupported DataType {} in tensor file", entry.data_type);
+    }
+}
+
+Shape get_shape(const TensorFileEntry& entry) {
+    TT_FATAL(entry.rank > 0 and entry.rank <= MAX_NUM_DIMENSIONS, "Invalid tensor rank {} in tensor file", entry.rank);
+    std::vector<uint32_t> dimensions(entry.dimensions, entry.dimensions + entry.rank);
+    std::vector<Padding::PadDimension> pad_dimensions;
+    for (auto index = 0; index < entry.rank; index++) {
+        pad_dimensions.push_back({.front = entry.padding_front[index], .back = entry.padding_back[index]});
+    }
+    return Shape(dimensions, Padding(pad_dimensions, get_enum<Padding::PadValue>(entry.pad_value)));
 }
 
-void dump_borrowed_storage(ofstream& output_stream, const BorrowedStorage& storage) {
-    std::visit(
-        [&output_stream]<typename T>(const borrowed_buffer::Buffer<T>& generic_buffer) {
-            const auto buffer = borrowed_buffer::get_as<T>(generic_buffer);
-            auto size = buffer.size();
-            output_stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
-            output_stream.write(reinterpret_cast<const char*>(buffer.begin()), sizeof(T) * size);
+// Returns the host buffer of a tensor as bytes
+std::pair<const char*, uint64_t> get_host_buffer_bytes(const Tensor& tensor) {
+    return std::visit(
+        [] (const auto& storage) -> std::pair<const char*, uint64_t> {
+            using StorageType = std::decay_t<decltype(storage)>;
+            if constexpr (std::is_same_v<StorageType, OwnedStorage> or std::is_same_v<StorageType, BorrowedStorage>) {
+                return std::visit(
+                    [] (const auto& buffer) -> std::pair<const char*, uint64_t> {
+                        using T = std::decay_t<decltype(*buffer.begin())>;
+                        return {reinterpret_cast<const char*>(buffer.begin()), sizeof(T) * buffer.size()};
+                    },
+                    storage.buffer
+                );
+            }
+            else if constexpr (std::is_same_v<StorageType, DeviceStorage>) {
+                TT_THROW("Device storage isn't supported");
+            }
+            else {
+                raise_unsupported_storage<StorageType>();
+            }
         },
-        storage.buffer
+        tensor.storage()
     );
 }
 
+// Copy on write mapping of a tensor file, shared by all the tensors loaded from it
+// The BorrowedStorage callbacks of every tensor hold a reference, so the file is unmapped with the last tensor
+class MappedTensorFile {
+   public:
+    explicit MappedTensorFile(const std::string& file_name) {
+        int fd = open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error(fmt::format("Cannot open \"{}\"", file_name));
+        }
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0) {
+            close(fd);
+            throw std::runtime_error(fmt::format("Cannot stat \"{}\"", file_name));
+        }
+        this->size_ = file_stat.st_size;
+        // Writable private mapping as borrowed buffers aren't const, writes never reach the file
+        if (this->size_ > 0) {
+            this->data_ = mmap(nullptr, this->size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        }
+        close(fd);
+        if (this->data_ == MAP_FAILED) {
+            this->data_ = nullptr;
+            throw std::runtime_error(fmt::format("Cannot map \"{}\": {}", file_name, std::strerror(errno)));
+        }
+    }
+
+    ~MappedTensorFile() {
+        if (this->data_ != nullptr) {
+            munmap(this->data_, this->size_);
+        }
+    }
+
+    MappedTensorFile(const MappedTensorFile&) = delete;
+    MappedTensorFile& operator=(const MappedTensorFile&) = delete;
+
+    char* data() const { return static_cast<char*>(this->data_); }
+    uint64_t size() const { return this->size_; }
+
+   private:
+    void* data_ = nullptr;
+    uint64_t size_ = 0;
+};
+
+template <typename T>
+BorrowedBuffer create_borrowed_buffer(char* payload, uint64_t payload_size) {
+    TT_FATAL(payload_size % sizeof(T) == 0, "Tensor file payload of {} B doesn't hold a whole number of elements", payload_size);
+    return borrowed_buffer::Buffer<T>(reinterpret_cast<T*>(payload), payload_size / sizeof(T));
+}
+
+BorrowedBuffer create_borrowed_buffer(char* payload, uint64_t payload_size, DataType data_type) {
+    if (data_type == DataType::UINT32 or data_type == DataType::BFLOAT8_B) {
+        return create_borrowed_buffer<std::uint32_t>(payload, payload_size);
+    } else if (data_type == DataType::UINT16) {
+        return create_borrowed_buffer<std::uint16_t>(payload, payload_size);
+    } else if (data_type == DataType::FLOAT32) {
+        return create_borrowed_buffer<float>(payload, payload_size);
+    } else if (data_type == DataType::BFLOAT16) {
+        return create_borrowed_buffer<bfloat16>(payload, payload_size);
+    } else {
+        TT_THROW("Unsupported DataType");
+    }
+}
+
+bool is_tensor_file(const std::string& file_name) {
+    ifstream input_stream(file_name, ios::in | ios::binary);
+    char magic[sizeof(TENSOR_FILE_MAGIC)] = {};
+    input_stream.read(magic, sizeof(magic));
+    return input_stream and std::memcmp(magic, TENSOR_FILE_MAGIC, sizeof(magic)) == 0;
+}
+
+std::vector<std::pair<std::string, Tensor>> map_tensor_file(const std::string& file_name) {
+    auto mapping = std::make_shared<MappedTensorFile>(file_name);
+    const char* data = mapping->data();
+
+    TensorFileHeader header;
+    TT_FATAL(mapping->size() >= sizeof(header), "\"{}\" is not a tensor file", file_name);
+    std::memcpy(&header, data, sizeof(header));
+    TT_FATAL(std::memcmp(header.magic, TENSOR_FILE_MAGIC, sizeof(header.magic)) == 0, "\"{}\" is not a tensor file", file_name);
+    TT_FATAL(header.version == TENSOR_FILE_VERSION, "Unsupported tensor file version {} in \"{}\"", header.version, file_name);
+    TT_FATAL(header.file_size == mapping->size(), "Tensor file \"{}\" is truncated", file_name);
+    TT_FATAL(sizeof(header) + uint64_t(header.num_tensors) * sizeof(TensorFileEntry) <= mapping->size(), "Tensor file \"{}\" is truncated", file_name);
+
+    std::vector<std::pair<std::string, Tensor>> tensors;
+    tensors.reserve(header.num_tensors);
+    for (uint32_t index = 0; index < header.num_tensors; index++) {
+        TensorFileEntry entry;
+        std::memcpy(&entry, data + sizeof(header) + index * sizeof(TensorFileEntry), sizeof(entry));
+        TT_FATAL(
+            is_in_bounds(entry.name_offset, entry.name_size, mapping->size()) and
+                is_in_bounds(entry.payload_offset, entry.payload_size, mapping->size()) and
+                entry.payload_offset % TENSOR_FILE_PAYLOAD_ALIGNMENT == 0,
+            "Tensor {} of \"{}\" is out of bounds", index, file_name);
+
+        auto data_type = get_enum<DataType>(entry.data_type);
+        auto shape = get_shape(entry);
+        TT_FATAL(
+            entry.payload_size >= get_min_payload_size(entry, data_type),
+            "Tensor {} of \"{}\" has a payload of {} B, too small for its shape", index, file_name, entry.payload_size);
+        auto buffer = create_borrowed_buffer(mapping->data() + entry.payload_offset, entry.payload_size, data_type);
+        auto storage = BorrowedStorage(buffer, [mapping] {}, [mapping] {});
+        tensors.emplace_back(
+            std::string(data + entry.name_offset, entry.name_size),
+            Tensor(std::move(storage), shape, data_type, get_enum<Layout>(entry.layout)));
+    }
+    return tensors;
+}
+
 template<typename T>
 OwnedStorage load_owned_storage(ifstream& input_stream) {
     std::size_t size = 0;
@@ -68,44 +284,8 @@ OwnedStorage load_owned_storage(ifstream& input_stream, DataType data_type) {
     }
 }
 
-}
-
-void dump_tensor(const std::string& file_name, const Tensor& tensor) {
-    ofstream output_stream(file_name, ios::out | ios::binary);
-    if (not output_stream) {
-        throw std::runtime_error(fmt::format("Cannot open \"{}\"", file_name));
-    }
-
-    auto shape = tensor.shape();
-    auto data_type = tensor.dtype();
-    auto layout = tensor.layout();
-
-    output_stream.write(reinterpret_cast<const char*>(&shape), sizeof(Shape));
-    output_stream.write(reinterpret_cast<const char*>(&data_type), sizeof(DataType));
-    output_stream.write(reinterpret_cast<const char*>(&layout), sizeof(Layout));
-
-    std::visit(
-        [&output_stream] (const auto& storage) {
-
-            using StorageType = std::decay_t<decltype(storage)>;
-            if constexpr (std::is_same_v<StorageType, OwnedStorage>) {
-                detail::dump_owned_storage(output_stream, storage);
-            }
-            else if constexpr (std::is_same_v<StorageType, BorrowedStorage>) {
-                detail::dump_borrowed_storage(output_stream, storage);
-            }
-            else if constexpr (std::is_same_v<StorageType, DeviceStorage>) {
-                TT_THROW("Device storage isn't supported");
-            }
-            else {
-                raise_unsupported_storage<StorageType>();
-            }
-        },
-        tensor.storage()
-    );
-}
-
-Tensor load_tensor(const std::string& file_name) {
+// Files written before the tensor file format: raw Shape, DataType and Layout followed by the element count and data
+Tensor load_legacy_tensor(const std::string& file_name) {
     ifstream input_stream(file_name, ios::in | ios::binary);
     if (not input_stream) {
         throw std::runtime_error(fmt::format("Cannot open \"{}\"", file_name));
@@ -122,6 +302,76 @@ Tensor load_tensor(const std::string& file_name) {
     return Tensor(std::move(storage), shape, data_type, layout);
 }
 
+}
+
+void dump_tensors(const std::string& file_name, const std::vector<std::pair<std::string, Tensor>>& named_tensors) {
+    ofstream output_stream(file_name, ios::out | ios::binary);
+    if (not output_stream) {
+        throw std::runtime_error(fmt::format("Cannot open \"{}\"", file_name));
+    }
+
+    std::unordered_set<std::string> names;
+    detail::TensorFileHeader header{};
+    std::memcpy(header.magic, detail::TENSOR_FILE_MAGIC, sizeof(header.magic));
+    header.version = detail::TENSOR_FILE_VERSION;
+    header.num_tensors = named_tensors.size();
+
+    std::vector<detail::TensorFileEntry> entries;
+    std::vector<std::pair<const char*, uint64_t>> payloads;
+    uint64_t offset = sizeof(header) + named_tensors.size() * sizeof(detail::TensorFileEntry);
+    for (const auto& [name, tensor] : named_tensors) {
+        TT_FATAL(names.insert(name).second, "Tensor name \"{}\" is used more than once", name);
+        auto entry = detail::create_tensor_file_entry(tensor.shape(), tensor.dtype(), tensor.layout());
+        entry.name_offset = offset;
+        entry.name_size = name.size();
+        offset += name.size();
+        entries.push_back(entry);
+        payloads.push_back(detail::get_host_buffer_bytes(tensor));
+    }
+    for (auto index = 0; index < entries.size(); index++) {
+        offset = detail::align_payload_offset(offset);
+        entries[index].payload_offset = offset;
+        entries[index].payload_size = payloads[index].second;
+        offset += payloads[index].second;
+    }
+    header.file_size = offset;
+
+    output_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output_stream.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(detail::TensorFileEntry));
+    for (const auto& [name, tensor] : named_tensors) {
+        output_stream.write(name.data(), name.size());
+    }
+    static const std::vector<char> zeros(detail::TENSOR_FILE_PAYLOAD_ALIGNMENT, 0);
+    for (auto index = 0; index < entries.size(); index++) {
+        output_stream.write(zeros.data(), entries[index].payload_offset - output_stream.tellp());
+        output_stream.write(payloads[index].first, payloads[index].second);
+    }
+    if (not output_stream) {
+        throw std::runtime_error(fmt::format("Failed to write \"{}\"", file_name));
+    }
+}
+
+std::map<std::string, Tensor> load_tensors(const std::string& file_name) {
+    std::map<std::string, Tensor> tensors;
+    for (auto& [name, tensor] : detail::map_tensor_file(file_name)) {
+        tensors.emplace(name, std::move(tensor));
+    }
+    return tensors;
+}
+
+void dump_tensor(const std::string& file_name, const Tensor& tensor) {
+    dump_tensors(file_name, {{"", tensor}});
+}
+
+Tensor load_tensor(const std::string& file_name) {
+    if (not detail::is_tensor_file(file_name)) {
+        return detail::load_legacy_tensor(file_name);
+    }
+    auto tensors = detail::map_tensor_file(file_name);
+    TT_FATAL(tensors.size() == 1, "\"{}\" holds {} tensors, use load_tensors", file_name, tensors.size());
+    return tensors[0].second;
+}
+
 
 }  // namespace tt_metal
 
@@ -6,15 +6,25 @@
 
 #include "tensor/tensor.hpp"
 
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace tt {
 
 namespace tt_metal {
 
 void dump_tensor(const std::string& file_name, const Tensor& tensor);
+// Files written by dump_tensor are memory mapped, the returned tensor borrows the mapping instead of reading the file
+// Files written by older versions of dump_tensor are still read into owned storage
 Tensor load_tensor(const std::string& file_name);
 
+// Writes host tensors under unique names into one file, payloads are page aligned and stored in their current layout
+void dump_tensors(const std::string& file_name, const std::vector<std::pair<std::string, Tensor>>& named_tensors);
+// Memory maps a file written by dump_tensors, all the returned tensors borrow the same mapping
+std::map<std::string, Tensor> load_tensors(const std::string& file_name);
+
 
 }  // namespace tt_metalls
 
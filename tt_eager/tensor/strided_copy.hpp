@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Host copy of an N-d box between two dense row major arrays, used by pad and unpad.
+// Inner dimensions the box fully covers in both arrays are collapsed into one contiguous run, so the copy is a
+// sequence of memcpys. When padding, the gaps between runs are filled in the same single pass over the output.
+// Large copies are split by runs across the executor.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "common/assert.hpp"
+#include "common/executor.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace strided_copy {
+
+namespace detail {
+
+inline std::vector<size_t> compute_strides(const std::vector<uint32_t>& shape) {
+    std::vector<size_t> strides(shape.size(), 1);
+    for (int dim = static_cast<int>(shape.size()) - 2; dim >= 0; dim--) {
+        strides[dim] = strides[dim + 1] * shape[dim + 1];
+    }
+    return strides;
+}
+
+// Offsets of the first element of a run in the source and destination, advanced run by run like an odometer over the
+// outer dimensions of the box
+class RunIterator {
+   public:
+    RunIterator(
+        const std::vector<uint32_t>& box_shape,
+        uint32_t num_outer_dims,
+        const std::vector<size_t>& src_strides,
+        const std::vector<uint32_t>& src_start,
+        const std::vector<size_t>& dst_strides,
+        const std::vector<uint32_t>& dst_start,
+        uint64_t first_run) :
+        box_shape_(box_shape), num_outer_dims_(num_outer_dims), src_strides_(src_strides), dst_strides_(dst_strides), index_(num_outer_dims, 0) {
+        const uint32_t rank = box_shape.size();
+        for (uint32_t dim = num_outer_dims; dim < rank; dim++) {
+            this->src_offset_ += src_start[dim] * src_strides[dim];
+            this->dst_offset_ += dst_start[dim] * dst_strides[dim];
+        }
+        for (int dim = static_cast<int>(num_outer_dims) - 1; dim >= 0; dim--) {
+            this->index_[dim] = first_run % box_shape[dim];
+            first_run /= box_shape[dim];
+            this->src_offset_ += (src_start[dim] + this->index_[dim]) * src_strides[dim];
+            this->dst_offset_ += (dst_start[dim] + this->index_[dim]) * dst_strides[dim];
+        }
+    }
+
+    size_t src_offset() const { return this->src_offset_; }
+    size_t dst_offset() const { return this->dst_offset_; }
+
+    void next() {
+        for (int dim = static_cast<int>(this->num_outer_dims_) - 1; dim >= 0; dim--) {
+            this->src_offset_ += this->src_strides_[dim];
+            this->dst_offset_ += this->dst_strides_[dim];
+            if (++this->index_[dim] < this->box_shape_[dim]) {
+                return;
+            }
+            this->index_[dim] = 0;
+            this->src_offset_ -= this->box_shape_[dim] * this->src_strides_[dim];
+            this->dst_offset_ -= this->box_shape_[dim] * this->dst_strides_[dim];
+        }
+    }
+
+   private:
+    const std::vector<uint32_t>& box_shape_;
+    const uint32_t num_outer_dims_;
+    const std::vector<size_t>& src_strides_;
+    const std::vector<size_t>& dst_strides_;
+    std::vector<uint32_t> index_;
+    size_t src_offset_ = 0;
+    size_t dst_offset_ = 0;
+};
+
+}  // namespace detail
+
+// Copies the box of box_shape elements starting at src_start in src to dst_start in dst. If pad_value is set, every
+// element of dst outside of the box is set to it. All shapes must have the same rank.
+template <typename T>
+void copy_box(
+    const T* src,
+    const std::vector<uint32_t>& src_shape,
+    const std::vector<uint32_t>& src_start,
+    T* dst,
+    const std::vector<uint32_t>& dst_shape,
+    const std::vector<uint32_t>& dst_start,
+    const std::vector<uint32_t>& box_shape,
+    std::optional<T> pad_value = std::nullopt) {
+    const uint32_t rank = box_shape.size();
+    TT_FATAL(src_shape.size() == rank and src_start.size() == rank and dst_shape.size() == rank and dst_start.size() == rank,
+        "Shapes of a strided copy must all have rank {}", rank);
+    size_t dst_volume = 1;
+    uint64_t box_volume = 1;
+    for (uint32_t dim = 0; dim < rank; dim++) {
+        TT_FATAL(src_start[dim] + box_shape[dim] <= src_shape[dim], "Box of size {} at {} doesn't fit in source dim {} of size {}", box_shape[dim], src_start[dim], dim, src_shape[dim]);
+        TT_FATAL(dst_start[dim] + box_shape[dim] <= dst_shape[dim], "Box of size {} at {} doesn't fit in destination dim {} of size {}", box_shape[dim], dst_start[dim], dim, dst_shape[dim]);
+        dst_volume *= dst_shape[dim];
+        box_volume *= box_shape[dim];
+    }
+    if (rank == 0) {
+        *dst = *src;
+        return;
+    }
+    if (box_volume == 0) {
+        if (pad_value.has_value()) {
+            std::fill(dst, dst + dst_volume, pad_value.value());
+        }
+        return;
+    }
+
+    // Collapse the inner dims fully covered in both arrays into the run, the remaining outer dims are iterated
+    uint32_t run_dim = rank - 1;
+    size_t run_size = box_shape[run_dim];
+    while (run_dim > 0 and box_shape[run_dim] == src_shape[run_dim] and box_shape[run_dim] == dst_shape[run_dim]) {
+        run_dim--;
+        run_size *= box_shape[run_dim];
+    }
+    const uint32_t num_outer_dims = run_dim;
+    uint64_t num_runs = 1;
+    for (uint32_t dim = 0; dim < num_outer_dims; dim++) {
+        num_runs *= box_shape[dim];
+    }
+    const auto src_strides = detail::compute_strides(src_shape);
+    const auto dst_strides = detail::compute_strides(dst_shape);
+
+    // Runs are visited in increasing dst order, so each task fills the gap in front of each of its runs and the last
+    // task also fills the tail
+    auto copy_runs = [&](uint32_t begin, uint32_t end) {
+        detail::RunIterator run(box_shape, num_outer_dims, src_strides, src_start, dst_strides, dst_start, begin);
+        size_t dst_filled = 0;
+        if (pad_value.has_value() and begin > 0) {
+            detail::RunIterator previous_run(box_shape, num_outer_dims, src_strides, src_start, dst_strides, dst_start, begin - 1);
+            dst_filled = previous_run.dst_offset() + run_size;
+        }
+        for (uint32_t run_index = begin; run_index < end; run_index++) {
+            if (pad_value.has_value()) {
+                std::fill(dst + dst_filled, dst + run.dst_offset(), pad_value.value());
+                dst_filled = run.dst_offset() + run_size;
+            }
+            std::memcpy(dst + run.dst_offset(), src + run.src_offset(), run_size * sizeof(T));
+            run.next();
+        }
+        if (pad_value.has_value() and end == num_runs) {
+            std::fill(dst + dst_filled, dst + dst_volume, pad_value.value());
+        }
+    };
+
+    TT_FATAL(num_runs <= std::numeric_limits<uint32_t>::max(), "Strided copy of {} runs is not supported", num_runs);
+    const size_t num_bytes = (pad_value.has_value() ? dst_volume : box_volume) * sizeof(T);
+    tt_metal::detail::parallel_for(num_runs, num_bytes / tt_metal::detail::PARALLEL_FOR_MIN_BYTES_PER_TASK, copy_runs);
+}
+
+}  // namespace strided_copy
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -136,7 +136,9 @@ Tensor Tensor::pad(const Shape& output_tensor_shape, const Shape& input_tensor_s
     TT_ASSERT(
         this->storage_type() == StorageType::OWNED or
         this->storage_type() == StorageType::BORROWED && "Tensor must be on host for padding");
-    TT_ASSERT(this->layout() == Layout::ROW_MAJOR && "Tensor layout must be ROW_MAJOR for padding");
+    TT_ASSERT(
+        this->layout() == Layout::ROW_MAJOR or this->layout() == Layout::TILE &&
+        "Tensor layout must be ROW_MAJOR or TILE for padding");
 
     auto input_shape = this->shape();
     auto dimensions_pads = std::vector<Padding::PadDimension>();
@@ -153,33 +155,49 @@ Tensor Tensor::pad(const Shape& output_tensor_shape, const Shape& input_tensor_s
 
 Tensor Tensor::unpad(const Shape &output_tensor_start, const Shape &output_tensor_end) const {
     ZoneScoped;
-    TT_ASSERT(this->layout() == Layout::ROW_MAJOR && "Tensor layout must be ROW_MAJOR for unpadding");
+    TT_ASSERT(
+        this->layout() == Layout::ROW_MAJOR or this->layout() == Layout::TILE &&
+        "Tensor layout must be ROW_MAJOR or TILE for unpadding");
     return tensor_impl::unpad_wrapper(*this, output_tensor_start, output_tensor_end);
 }
 
 Tensor Tensor::pad_to_tile(float pad_value) const {
     ZoneScoped;
-    uint32_t h = this->shape()[2];
-    uint32_t w = this->shape()[3];
+    const auto rank = this->shape().rank();
+    TT_ASSERT(rank >= 2, "Tensor must have a rank of at least 2 to be padded to tiles");
+    uint32_t h = this->shape()[-2];
+    uint32_t w = this->shape()[-1];
     uint32_t padded_h = round_up(h, TILE_HEIGHT);
     uint32_t padded_w = round_up(w, TILE_WIDTH);
 
-    auto padding = Padding({{0, 0}, {0, 0}, {0, padded_h - h}, {0, padded_w - w}}, Padding::PadValue::Any);
+    std::vector<uint32_t> output_dims(this->shape().begin(), this->shape().end());
+    output_dims[rank - 2] = padded_h;
+    output_dims[rank - 1] = padded_w;
+    std::vector<Padding::PadDimension> dimensions_pads(rank, Padding::PadDimension{.front = 0, .back = 0});
+    dimensions_pads[rank - 2].back = padded_h - h;
+    dimensions_pads[rank - 1].back = padded_w - w;
+    auto padding = Padding(dimensions_pads, Padding::PadValue::Any);
 
-    Shape output_tensor_shape = Shape({this->shape()[0], this->shape()[1], padded_h, padded_w}, padding);
-    Shape input_tensor_start = {0, 0, 0, 0};
+    Shape output_tensor_shape = Shape(output_dims, padding);
+    Shape input_tensor_start = std::vector<uint32_t>(rank, 0);
 
     return this->pad(output_tensor_shape, input_tensor_start, pad_value);
 }
 
 Tensor Tensor::unpad_from_tile(const Shape &output_tensor_shape) const {
     ZoneScoped;
-
-    TT_ASSERT(this->shape()[0] == output_tensor_shape[0] && this->shape()[1] == output_tensor_shape[1], "Input shape must match output shape apart from last 2 dims");
-    TT_ASSERT(this->shape()[2] % TILE_HEIGHT == 0 && this->shape()[3] % TILE_WIDTH==0, "Last 2 dims of input shape must be multiples of 32");
-    TT_ASSERT(this->shape()[2] - TILE_HEIGHT < output_tensor_shape[2] && this->shape()[3] - TILE_WIDTH < output_tensor_shape[3], "Last 2 dims of output must be within range to have been padded to input");
-    Shape output_tensor_start = {0, 0, 0, 0};
-    Shape output_tensor_end = {output_tensor_shape[0] - 1, output_tensor_shape[1] - 1, output_tensor_shape[2] - 1, output_tensor_shape[3] - 1};
+    const auto rank = this->shape().rank();
+    TT_ASSERT(output_tensor_shape.rank() == rank, "Output shape must have the same rank as the input shape");
+    for (auto index = 0; index < rank - 2; index++) {
+        TT_ASSERT(this->shape()[index] == output_tensor_shape[index], "Input shape must match output shape apart from last 2 dims");
+    }
+    TT_ASSERT(this->shape()[-2] % TILE_HEIGHT == 0 && this->shape()[-1] % TILE_WIDTH==0, "Last 2 dims of input shape must be multiples of 32");
+    TT_ASSERT(this->shape()[-2] - TILE_HEIGHT < output_tensor_shape[-2] && this->shape()[-1] - TILE_WIDTH < output_tensor_shape[-1], "Last 2 dims of output must be within range to have been padded to input");
+    Shape output_tensor_start = std::vector<uint32_t>(rank, 0);
+    std::vector<uint32_t> output_tensor_end;
+    for (auto index = 0; index < rank; index++) {
+        output_tensor_end.push_back(output_tensor_shape[index] - 1);
+    }
     return this->unpad(output_tensor_start, output_tensor_end);
 }
 
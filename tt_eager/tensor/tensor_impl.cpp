@@ -182,6 +182,23 @@ void validate_on_device_dtype_and_layout(Device *device, DataType dtype, Layout
     supported_layout();
 }
 
+// BFLOAT8_B tensors are packed into uint32_t words, either owned or borrowed (i.e. loaded from a tensor file)
+std::vector<uint32_t> get_bfloat8_b_packed_data(const Tensor &tensor) {
+    return std::visit(
+        [](const auto &storage) -> std::vector<uint32_t> {
+            using StorageType = std::decay_t<decltype(storage)>;
+            if constexpr (std::is_same_v<StorageType, OwnedStorage>) {
+                return owned_buffer::get_as<uint32_t>(storage.buffer).get();
+            } else if constexpr (std::is_same_v<StorageType, BorrowedStorage>) {
+                auto buffer = borrowed_buffer::get_as<uint32_t>(storage.buffer);
+                return std::vector<uint32_t>(buffer.begin(), buffer.end());
+            } else {
+                TT_THROW("BFLOAT8_B host conversion requires a tensor on host");
+            }
+        },
+        tensor.storage());
+}
+
 Tensor to_layout_bfloat8_b(const Tensor &tensor, Layout target_layout) {
     // TODO(arakhmati): do not convert to FLOAT32
 
@@ -189,8 +206,26 @@ Tensor to_layout_bfloat8_b(const Tensor &tensor, Layout target_layout) {
         return tensor;
     }
 
+    auto input_packed_data = get_bfloat8_b_packed_data(tensor);
+
+    // A ROW_MAJOR bfloat8_b tensor is row major data packed as if it were tiles, so a tile aligned tensor only needs
+    // one unpack and one pack with the layout conversion fused into either
+    auto shape_vec = detail::to_4D_shape(tensor.shape());
+    if (shape_vec[2] % tt::constants::TILE_HEIGHT == 0 and shape_vec[3] % tt::constants::TILE_WIDTH == 0) {
+        uint32_t num_blocks = shape_vec[0] * shape_vec[1];
+        std::vector<uint32_t> output_packed_data;
+        if (target_layout == Layout::TILE) {
+            auto float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+            output_packed_data = pack_row_major_fp32_as_bfp8_tiles(float_data.data(), num_blocks, shape_vec[2], shape_vec[3], /*is_exp_a=*/false);
+        } else {
+            auto float_data = unpack_bfp8_tiles_into_row_major_float_vec(input_packed_data, num_blocks, shape_vec[2], shape_vec[3], /*is_exp_a=*/false);
+            output_packed_data = pack_fp32_vec_as_bfp8_tiles(float_data, /*row_major_input=*/false, /*is_exp_a=*/false);
+        }
+        auto output_uint32_buffer = owned_buffer::create<uint32_t>(std::move(output_packed_data));
+        return Tensor(std::move(OwnedStorage{std::move(output_uint32_buffer)}), tensor.shape(), DataType::BFLOAT8_B, target_layout);
+    }
+
     // Convert to FLOAT32 tensor and change layout
-    auto input_packed_data = owned_buffer::get_as<uint32_t>(tensor).get();
     auto input_float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
     auto input_float_buffer = owned_buffer::create<float>(std::move(input_float_data));
     auto float_tensor = Tensor(OwnedStorage{input_float_buffer}, tensor.shape(), DataType::FLOAT32, tensor.layout()).to(target_layout);
@@ -207,7 +242,7 @@ Tensor pad_bfloat8_b(const Tensor &tensor, const Shape& output_tensor_shape, con
     // TODO(arakhmati): do not convert to FLOAT32
 
     // Convert to FLOAT32 tensor and pad
-    auto input_packed_data = owned_buffer::get_as<uint32_t>(tensor).get();
+    auto input_packed_data = get_bfloat8_b_packed_data(tensor);
     auto input_float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
     auto input_float_buffer = owned_buffer::create<float>(std::move(input_float_data));
     auto float_tensor = Tensor(OwnedStorage{input_float_buffer}, tensor.shape(), DataType::FLOAT32, tensor.layout()).pad(output_tensor_shape, input_tensor_start, pad_value);
@@ -223,7 +258,7 @@ Tensor unpad_bfloat8_b(const Tensor &tensor, const Shape& output_tensor_start, c
     // TODO(arakhmati): do not convert to FLOAT32
 
     // Convert to FLOAT32 tensor and unpad
-    auto input_packed_data = owned_buffer::get_as<uint32_t>(tensor).get();
+    auto input_packed_data = get_bfloat8_b_packed_data(tensor);
     auto input_float_data = unpack_bfp8_tiles_into_float_vec(input_packed_data, /*row_major_output=*/false, /*is_exp_a=*/false);
     auto input_float_buffer = owned_buffer::create<float>(std::move(input_float_data));
     auto float_tensor = Tensor(OwnedStorage{input_float_buffer}, tensor.shape(), DataType::FLOAT32, tensor.layout()).unpad(output_tensor_start, output_tensor_end);
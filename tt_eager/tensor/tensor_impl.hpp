@@ -6,6 +6,7 @@
 
 #include "tensor/borrowed_buffer_functions.hpp"
 #include "tensor/owned_buffer_functions.hpp"
+#include "tensor/strided_copy.hpp"
 #include "tensor/tensor.hpp"
 #include "tensor/tensor_utils.hpp"
 #include "tensor/types.hpp"
@@ -635,78 +636,58 @@ inline Tensor to_layout(const Tensor &tensor, Layout target_layout) {
     return Tensor(OwnedStorage{output_buffer}, tensor.shape(), tensor.dtype(), target_layout);
 }
 
+std::vector<uint32_t> get_bfloat8_b_packed_data(const Tensor &tensor);
+
 Tensor to_layout_bfloat8_b(const Tensor &tensor, Layout target_layout);
 
 // ======================================================================================
 //                                  .pad() and .unpad()
 // ======================================================================================
+namespace detail {
+
+// Tile layout data is a row major array of tiles, so tile aligned pads and unpads are copies of boxes of whole tiles.
+// Maps the dims of a shape, or of a start index if is_start is set, to the array of tiles.
+inline std::vector<uint32_t> get_strided_copy_dims(const std::vector<uint32_t>& dims, Layout layout, bool is_start = false) {
+    if (layout != Layout::TILE) {
+        return dims;
+    }
+    TT_FATAL(dims.size() >= 2, "Tile layout requires a rank of at least 2");
+    TT_FATAL(
+        dims[dims.size() - 2] % tt::constants::TILE_HEIGHT == 0 and dims[dims.size() - 1] % tt::constants::TILE_WIDTH == 0,
+        "Pad and unpad of a tile layout tensor must be aligned to tiles");
+    auto tiled_dims = dims;
+    tiled_dims[dims.size() - 2] /= tt::constants::TILE_HEIGHT;
+    tiled_dims[dims.size() - 1] /= tt::constants::TILE_WIDTH;
+    tiled_dims.push_back(is_start ? 0 : tt::constants::TILE_HW);
+    return tiled_dims;
+}
+
+}  // namespace detail
+
 template <typename T>
 inline Tensor pad(const Tensor &tensor, const Shape& output_tensor_shape, const Shape& input_tensor_start, float pad_value) {
+    ZoneScoped;
     auto pad_value_ = static_cast<T>(pad_value);
-    const auto input_tensor_shape = tensor.shape();
-    const auto input_tensor_strides = tensor.strides();
-    const auto input_tensor_data_type = tensor.dtype();
-
-    auto pad =
-        [&input_tensor_shape, &input_tensor_strides, &input_tensor_data_type, &output_tensor_shape, &input_tensor_start, &pad_value_]
-        (const auto& input_buffer) {
-        // Check if input tensor fits in output tensor given the input tensor start indices
-        TT_ASSERT(input_tensor_shape[0] + input_tensor_start[0] <= output_tensor_shape[0]);
-        TT_ASSERT(input_tensor_shape[1] + input_tensor_start[1] <= output_tensor_shape[1]);
-        TT_ASSERT(input_tensor_shape[2] + input_tensor_start[2] <= output_tensor_shape[2]);
-        TT_ASSERT(input_tensor_shape[3] + input_tensor_start[3] <= output_tensor_shape[3]);
-
-        // Figure out pad size on each dim
-        uint32_t pad_size[4][2] = {
-            {input_tensor_start[0], output_tensor_shape[0] - input_tensor_shape[0] - input_tensor_start[0]},
-            {input_tensor_start[1], output_tensor_shape[1] - input_tensor_shape[1] - input_tensor_start[1]},
-            {input_tensor_start[2], output_tensor_shape[2] - input_tensor_shape[2] - input_tensor_start[2]},
-            {input_tensor_start[3], output_tensor_shape[3] - input_tensor_shape[3] - input_tensor_start[3]}
-        };
-
-        const std::array<uint32_t, 4> output_tensor_strides = {
-            output_tensor_shape[1] * output_tensor_shape[2] * output_tensor_shape[3],
-            output_tensor_shape[2] * output_tensor_shape[3],
-            output_tensor_shape[3],
-            1
-        };
-
-        auto output_buffer = owned_buffer::create<T>(compute_volume(output_tensor_shape));
-        auto output_index = 0;
-        for(auto i = 0; i < pad_size[0][0] * output_tensor_strides[0]; i++) {
-            output_buffer[output_index++] = pad_value_;
-        }
-        for(auto dim0 = 0; dim0 < input_tensor_shape[0]; dim0++) {
-            for(auto i = 0; i < pad_size[1][0] * output_tensor_strides[1]; i++) {
-                output_buffer[output_index++] = pad_value_;
-            }
-            for(auto dim1 = 0; dim1 < input_tensor_shape[1]; dim1++) {
-                for(auto i = 0; i < pad_size[2][0] * output_tensor_strides[2]; i++) {
-                    output_buffer[output_index++] = pad_value_;
-                }
-                for(auto dim2 = 0; dim2 < input_tensor_shape[2]; dim2++) {
-                    for(auto i = 0; i < pad_size[3][0] * output_tensor_strides[3]; i++) {
-                        output_buffer[output_index++] = pad_value_;
-                    }
-                    for(auto dim3 = 0; dim3 < input_tensor_shape[3]; dim3++) {
-                        auto input_index = dim3 + input_tensor_strides[2] * dim2 + input_tensor_strides[1] * dim1 + input_tensor_strides[0] * dim0;
-                        output_buffer[output_index++] = input_buffer[input_index];
-                    }
-                    for(auto i = 0; i < pad_size[3][1] * output_tensor_strides[3]; i++) {
-                        output_buffer[output_index++] = pad_value_;
-                    }
-                }
-                for(auto i = 0; i < pad_size[2][1] * output_tensor_strides[2]; i++) {
-                    output_buffer[output_index++] = pad_value_;
-                }
-            }
-            for(auto i = 0; i < pad_size[1][1] * output_tensor_strides[1]; i++) {
-                output_buffer[output_index++] = pad_value_;
-            }
-        }
-        for(auto i = 0; i < pad_size[0][1] * output_tensor_strides[0]; i++) {
-            output_buffer[output_index++] = pad_value_;
-        }
+    const auto layout = tensor.layout();
+    const auto input_tensor_shape = std::vector<uint32_t>(tensor.shape().begin(), tensor.shape().end());
+    const auto output_shape = std::vector<uint32_t>(output_tensor_shape.begin(), output_tensor_shape.end());
+    const auto input_start = std::vector<uint32_t>(input_tensor_start.begin(), input_tensor_start.end());
+    TT_FATAL(
+        output_shape.size() == input_tensor_shape.size() and input_start.size() == input_tensor_shape.size(),
+        "Padded shape and input start must have the same rank as the input tensor");
+
+    auto pad = [&input_tensor_shape, &output_shape, &input_start, &layout, &pad_value_](const auto& input_buffer) {
+        const auto src_shape = detail::get_strided_copy_dims(input_tensor_shape, layout);
+        auto output_buffer = owned_buffer::create<T>(compute_volume(output_shape));
+        strided_copy::copy_box<T>(
+            input_buffer.begin(),
+            src_shape,
+            std::vector<uint32_t>(src_shape.size(), 0),
+            output_buffer.begin(),
+            detail::get_strided_copy_dims(output_shape, layout),
+            detail::get_strided_copy_dims(input_start, layout, /*is_start=*/true),
+            src_shape,
+            pad_value_);
         return output_buffer;
     };
 
@@ -737,52 +718,38 @@ Tensor pad_bfloat8_b(const Tensor &tensor, const Shape& output_tensor_shape, con
 
 template <typename T>
 inline Tensor unpad(const Tensor &tensor, const Shape& output_tensor_start, const Shape& output_tensor_end) {
-    const auto input_tensor_shape = tensor.shape();
-    const auto input_tensor_strides = tensor.strides();
-
-    // Check if tensor start and end indices are within input tensor shape
-    TT_ASSERT(output_tensor_start[0] < input_tensor_shape[0]);
-    TT_ASSERT(output_tensor_end[0] < input_tensor_shape[0]);
-    TT_ASSERT(output_tensor_start[1] < input_tensor_shape[1]);
-    TT_ASSERT(output_tensor_end[1] < input_tensor_shape[1]);
-    TT_ASSERT(output_tensor_start[2] < input_tensor_shape[2]);
-    TT_ASSERT(output_tensor_end[2] < input_tensor_shape[2]);
-    TT_ASSERT(output_tensor_start[3] < input_tensor_shape[3]);
-    TT_ASSERT(output_tensor_end[3] < input_tensor_shape[3]);
-
-    // Check if start shape is <= end shape
-    TT_ASSERT(output_tensor_start[0] <= output_tensor_end[0]);
-    TT_ASSERT(output_tensor_start[1] <= output_tensor_end[1]);
-    TT_ASSERT(output_tensor_start[2] <= output_tensor_end[2]);
-    TT_ASSERT(output_tensor_start[3] <= output_tensor_end[3]);
+    ZoneScoped;
+    const auto layout = tensor.layout();
+    const auto input_tensor_shape = std::vector<uint32_t>(tensor.shape().begin(), tensor.shape().end());
+    const auto output_start = std::vector<uint32_t>(output_tensor_start.begin(), output_tensor_start.end());
+    TT_FATAL(
+        output_tensor_start.rank() == input_tensor_shape.size() and output_tensor_end.rank() == input_tensor_shape.size(),
+        "Unpad start and end must have the same rank as the input tensor");
 
     // Figure out output tensor shape
-    const Shape output_tensor_shape = {
-        output_tensor_end[0] - output_tensor_start[0] + 1,
-        output_tensor_end[1] - output_tensor_start[1] + 1,
-        output_tensor_end[2] - output_tensor_start[2] + 1,
-        output_tensor_end[3] - output_tensor_start[3] + 1,
+    std::vector<uint32_t> output_shape;
+    for (auto index = 0; index < input_tensor_shape.size(); index++) {
+        // Check if tensor start and end indices are within input tensor shape and start is <= end
+        TT_FATAL(output_tensor_start[index] <= output_tensor_end[index] and output_tensor_end[index] < input_tensor_shape[index],
+            "Unpad range [{}, {}] of dim {} is outside of [0, {})", output_tensor_start[index], output_tensor_end[index], index, input_tensor_shape[index]);
+        output_shape.push_back(output_tensor_end[index] - output_tensor_start[index] + 1);
+    }
+    const Shape output_tensor_shape = output_shape;
+
+    auto unpad = [&input_tensor_shape, &output_shape, &output_start, &layout](const auto& input_buffer) {
+        const auto dst_shape = detail::get_strided_copy_dims(output_shape, layout);
+        auto output_buffer = owned_buffer::create<T>(compute_volume(output_shape));
+        strided_copy::copy_box<T>(
+            input_buffer.begin(),
+            detail::get_strided_copy_dims(input_tensor_shape, layout),
+            detail::get_strided_copy_dims(output_start, layout, /*is_start=*/true),
+            output_buffer.begin(),
+            dst_shape,
+            std::vector<uint32_t>(dst_shape.size(), 0),
+            dst_shape);
+        return output_buffer;
     };
 
-    auto unpad =
-        [&input_tensor_shape, &input_tensor_strides, &output_tensor_shape, &output_tensor_start, &output_tensor_end](
-            const auto& input_buffer) {
-            auto output_buffer = owned_buffer::create<T>(compute_volume(output_tensor_shape));
-            auto output_index = 0;
-            for (auto dim0 = output_tensor_start[0]; dim0 <= output_tensor_end[0]; dim0++) {
-                for (auto dim1 = output_tensor_start[1]; dim1 <= output_tensor_end[1]; dim1++) {
-                    for (auto dim2 = output_tensor_start[2]; dim2 <= output_tensor_end[2]; dim2++) {
-                        for (auto dim3 = output_tensor_start[3]; dim3 <= output_tensor_end[3]; dim3++) {
-                            auto input_index = dim3 + input_tensor_strides[2] * dim2 + input_tensor_strides[1] * dim1 +
-                                               input_tensor_strides[0] * dim0;
-                            output_buffer[output_index++] = input_buffer[input_index];
-                        }
-                    }
-                }
-            }
-            return output_buffer;
-        };
-
     auto output_buffer = std::visit(
         [&unpad](auto&& storage) -> owned_buffer::Buffer<T> {
             using StorageType = std::decay_t<decltype(storage)>;
@@ -802,7 +769,6 @@ inline Tensor unpad(const Tensor &tensor, const Shape& output_tensor_start, cons
     return Tensor(OwnedStorage{output_buffer}, output_tensor_shape, tensor.dtype(), tensor.layout());
 }
 
-
 Tensor unpad_bfloat8_b(const Tensor &tensor, const Shape& output_tensor_start, const Shape& output_tensor_end);
 
 // ======================================================================================
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "tensor/tensor_utils.hpp"
+#include "tensor/borrowed_buffer_functions.hpp"
 #include "tensor/owned_buffer.hpp"
 #include "tensor/owned_buffer_functions.hpp"
 
@@ -11,10 +12,29 @@ namespace tt {
 namespace tt_metal {
 
 
+    // Data of a host tensor, which is owned by the tensor or borrowed from a loaded file
+    template <typename T>
+    const T* get_host_data(const Tensor& tensor) {
+        return std::visit(
+            [](auto&& storage) -> const T* {
+                using StorageType = std::decay_t<decltype(storage)>;
+                if constexpr (std::is_same_v<StorageType, OwnedStorage>) {
+                    return owned_buffer::get_as<T>(storage.buffer).begin();
+                } else if constexpr (std::is_same_v<StorageType, BorrowedStorage>) {
+                    return borrowed_buffer::get_as<T>(storage.buffer).begin();
+                } else if constexpr (std::is_same_v<StorageType, DeviceStorage>) {
+                    TT_THROW("Convolution weights must be on host");
+                } else {
+                    raise_unsupported_storage<StorageType>();
+                }
+            },
+            tensor.storage());
+    }
+
     template <typename T>
     Tensor to_weight_special_padding_tile_layout(const Tensor& conv_weight_tensor, uint32_t in1_block_h, uint32_t in1_block_w, DataType output_dtype) {
         auto w_shape = conv_weight_tensor.shape();
-        auto input_buffer = owned_buffer::get_as<T>(conv_weight_tensor);
+        auto input_buffer = get_host_data<T>(conv_weight_tensor);
         uint32_t in1_block_h_datums = in1_block_h * constants::TILE_HEIGHT;
         uint32_t in1_block_w_datums = in1_block_w * constants::TILE_WIDTH;
         auto weight_matrix_cols = w_shape[0];
@@ -58,7 +78,7 @@ namespace tt_metal {
     template <typename T>
     Tensor to_weight_tile_layout(const Tensor& conv_weight_tensor, uint32_t in1_block_h, uint32_t in1_block_w, DataType output_dtype) {
         auto w_shape = conv_weight_tensor.shape();
-        auto input_buffer = owned_buffer::get_as<T>(conv_weight_tensor);
+        auto input_buffer = get_host_data<T>(conv_weight_tensor);
         auto weight_matrix_cols = w_shape[0];
         // width padding
         uint32_t in1_block_w_datums = in1_block_w * constants::TILE_WIDTH;
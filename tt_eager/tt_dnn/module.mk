@@ -43,6 +43,7 @@ TT_DNN_SRCS = \
 	tt_eager/tt_dnn/op_library/bcast/multi_core_w/bcast_op_multi_core_w.cpp \
 	tt_eager/tt_dnn/op_library/bcast/multi_core_hw/bcast_op_multi_core_hw.cpp \
 	tt_eager/tt_dnn/op_library/bmm/bmm_op.cpp \
+	tt_eager/tt_dnn/op_library/bmm/matmul_tuner.cpp \
 	tt_eager/tt_dnn/op_library/bmm/single_core/bmm_op_single_core_tilize_untilize.cpp \
 	tt_eager/tt_dnn/op_library/bmm/single_core/bmm_op_single_core.cpp \
 	tt_eager/tt_dnn/op_library/bmm/multi_core/bmm_op_multi_core.cpp \
@@ -65,6 +66,7 @@ TT_DNN_SRCS = \
 	tt_eager/tt_dnn/op_library/untilize/untilize_op.cpp \
 	tt_eager/tt_dnn/op_library/untilize/untilize_with_halo_op.cpp \
 	tt_eager/tt_dnn/op_library/untilize/untilize_with_halo_op_v2.cpp \
+	tt_eager/tt_dnn/op_library/sliding_window_op_infra/sliding_window.cpp \
 	tt_eager/tt_dnn/op_library/softmax/multi_core/softmax_op_multi_core.cpp \
 	tt_eager/tt_dnn/op_library/softmax/softmax_op.cpp \
 	tt_eager/tt_dnn/op_library/moreh_helper_functions.cpp \
@@ -3,11 +3,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "tt_dnn/op_library/bmm/bmm_op.hpp"
+#include "tt_dnn/op_library/bmm/matmul_tuner.hpp"
 #include "tt_dnn/op_library/work_split.hpp"
 #include "tt_metal/tools/profiler/op_profiler.hpp"
 
 #include "tt_metal/host_api.hpp"
 #include "tt_metal/common/constants.hpp"
+#include "tt_metal/detail/util.hpp"
 
 #include "third_party/magic_enum/magic_enum.hpp"
 
@@ -278,6 +280,63 @@ tt::operations::primary::MatmulMultiCoreReuseMultiCast1DProgramConfig get_mcast_
     };
 }
 
+uint32_t MatmulMultiCastCBSizes::get_l1_usage(bool output_is_sharded, bool has_bias) const {
+    uint32_t l1_usage = this->in1_CB_size;
+    if (not this->in0_CB_in_place) {
+        l1_usage += this->in0_CB_size;
+    }
+    if (not output_is_sharded) {
+        l1_usage += this->out_CB_size;
+    }
+    if (this->interm0_data_format != this->output_data_format) {
+        l1_usage += this->interm0_CB_size;
+    }
+    if (has_bias) {
+        l1_usage += this->in3_CB_size;
+    }
+    return l1_usage;
+}
+
+MatmulMultiCastCBSizes get_mcast_matmul_cb_sizes(
+    uint32_t B, uint32_t num_blocks, uint32_t in0_block_w, uint32_t per_core_M, uint32_t per_core_N,
+    tt::DataFormat in0_data_format, tt::DataFormat in1_data_format, tt::DataFormat bias_data_format, tt::DataFormat output_data_format,
+    bool packer_l1_acc, bool in0_CB_in_place) {
+    tt::DataFormat interm0_data_format = packer_l1_acc ? tt::DataFormat::Float16_b : output_data_format;
+
+    uint32_t in0_single_tile_size = tt_metal::detail::TileSize(in0_data_format);
+    uint32_t in1_single_tile_size = tt_metal::detail::TileSize(in1_data_format);
+    uint32_t bias_single_tile_size = tt_metal::detail::TileSize(bias_data_format);
+    uint32_t output_single_tile_size = tt_metal::detail::TileSize(output_data_format);
+    uint32_t interm0_single_tile_size = tt_metal::detail::TileSize(interm0_data_format);
+
+    uint32_t in0_block_tiles = per_core_M * in0_block_w;
+    uint32_t in0_CB_tiles = in0_block_tiles;
+    if (in0_CB_in_place) {
+        in0_CB_tiles = num_blocks * in0_CB_tiles * B;
+    } else if (B * num_blocks > 1) {
+        in0_CB_tiles = in0_CB_tiles * 2; // double buffer
+    }
+    uint32_t in1_block_tiles = per_core_N * in0_block_w;
+    uint32_t in1_CB_tiles = in1_block_tiles;
+    if (B * num_blocks > 1) {
+        in1_CB_tiles = in1_CB_tiles * 2; // double buffer
+    }
+    uint32_t out_CB_tiles = per_core_M * per_core_N; // No double buffer
+    uint32_t in2_CB_tiles = per_core_M * in0_block_w;
+    uint32_t in3_CB_tiles = per_core_N; // No double buffer
+
+    return MatmulMultiCastCBSizes{
+        .output_data_format = output_data_format,
+        .interm0_data_format = interm0_data_format,
+        .in0_CB_size = in0_CB_tiles * in0_single_tile_size,
+        .in1_CB_size = in1_CB_tiles * in1_single_tile_size,
+        .in2_CB_size = in2_CB_tiles * in0_single_tile_size,
+        .in3_CB_size = in3_CB_tiles * bias_single_tile_size,
+        .out_CB_size = out_CB_tiles * output_single_tile_size,
+        .interm0_CB_size = out_CB_tiles * interm0_single_tile_size,
+        .in0_CB_in_place = in0_CB_in_place};
+}
+
 }
 
 namespace tt {
@@ -986,6 +1045,14 @@ MatmulParallelizationStrategy Matmul::get_parallelization_strategy(const std::ve
     );
 }
 
+MatmulProgramConfig get_matmul_program_config(const Tensor &input_tensor_a, const Tensor &input_tensor_b, const MatmulProgramConfig& program_config, const MemoryConfig& mem_config, const DataType output_dtype, const MathFidelity math_fidelity, const bool fp32_dest_acc_en, const bool packer_l1_acc) {
+    if (not std::holds_alternative<MatmulDefaultProgramConfig>(program_config)) {
+        return program_config;
+    }
+    auto tuned_program_config = get_tuned_matmul_program_config(input_tensor_a, input_tensor_b, mem_config, output_dtype, math_fidelity, fp32_dest_acc_en, packer_l1_acc);
+    return tuned_program_config.value_or(program_config);
+}
+
 Tensor matmul_1d(const Tensor &input_tensor_a, const Tensor &input_tensor_b, std::optional<const Tensor> bias, std::optional<MatmulMultiCoreReuseMultiCast1DProgramConfig> program_config, const MemoryConfig& mem_config, std::optional<const DataType> output_dtype, const MathFidelity math_fidelity, const bool fp32_dest_acc_en, const bool math_approx_mode, const bool packer_l1_acc) {
     if (!program_config.has_value()) {
         program_config = bmm_op_utils::get_mcast_1d_config(input_tensor_a, input_tensor_b);
@@ -310,6 +310,9 @@ struct Matmul {
     }
 };
 
+// program_config, unless it is the default one and TT_METAL_MATMUL_TUNING_DB has a tuned config for the matmul.
+// Resolved before the op runs, so that validation, the output tensors, the program hash and the program see the same config
+MatmulProgramConfig get_matmul_program_config(const Tensor &input_tensor_a, const Tensor &input_tensor_b, const MatmulProgramConfig& program_config, const MemoryConfig& mem_config, const DataType output_dtype, const MathFidelity math_fidelity, const bool fp32_dest_acc_en, const bool packer_l1_acc);
 
 inline Tensor matmul(
     const Tensor &input_tensor_a,
@@ -322,7 +325,9 @@ inline Tensor matmul(
     const bool math_approx_mode = true,
     const bool packer_l1_acc = false
 ) {
-    return operation::run(Matmul{program_config, mem_config, output_dtype.value_or(input_tensor_a.dtype()), math_fidelity, fp32_dest_acc_en, math_approx_mode, packer_l1_acc}, {input_tensor_a, input_tensor_b}, {std::nullopt}).at(0);
+    const DataType dtype = output_dtype.value_or(input_tensor_a.dtype());
+    auto matmul_program_config = get_matmul_program_config(input_tensor_a, input_tensor_b, program_config, mem_config, dtype, math_fidelity, fp32_dest_acc_en, packer_l1_acc);
+    return operation::run(Matmul{matmul_program_config, mem_config, dtype, math_fidelity, fp32_dest_acc_en, math_approx_mode, packer_l1_acc}, {input_tensor_a, input_tensor_b}, {std::nullopt}).at(0);
 }
 
 inline Tensor matmul(
@@ -336,7 +341,9 @@ inline Tensor matmul(
     const bool math_approx_mode = true,
     const bool packer_l1_acc = false
 ) {
-    return operation::run(Matmul{program_config, mem_config, output_dtype.value_or(input_tensor_a.dtype()), math_fidelity, fp32_dest_acc_en, math_approx_mode, packer_l1_acc}, {input_tensor_a, input_tensor_b}, {bias}).at(0);
+    const DataType dtype = output_dtype.value_or(input_tensor_a.dtype());
+    auto matmul_program_config = get_matmul_program_config(input_tensor_a, input_tensor_b, program_config, mem_config, dtype, math_fidelity, fp32_dest_acc_en, packer_l1_acc);
+    return operation::run(Matmul{matmul_program_config, mem_config, dtype, math_fidelity, fp32_dest_acc_en, math_approx_mode, packer_l1_acc}, {input_tensor_a, input_tensor_b}, {bias}).at(0);
 }
 
 Tensor matmul_1d(const Tensor &input_tensor_a, const Tensor &input_tensor_b, std::optional<const Tensor> bias, std::optional<MatmulMultiCoreReuseMultiCast1DProgramConfig> program_config = std::nullopt, const MemoryConfig& mem_config = operation::DEFAULT_OUTPUT_MEMORY_CONFIG, std::optional<const DataType> output_dtype=std::nullopt, const MathFidelity math_fidelity = MathFidelity::LoFi, const bool fp32_dest_acc_en = false, const bool math_approx_mode = true, const bool packer_l1_acc = false);
@@ -366,4 +373,29 @@ tuple<uint32_t, uint32_t, uint32_t, uint32_t> get_large_matmul_params(uint32_t M
 CoreCoord get_core_range(uint32_t num_blocks_rows, uint32_t num_blocks_cols, uint32_t max_num_rows, uint32_t max_num_cols);
 
 tt::operations::primary::MatmulMultiCoreReuseMultiCast1DProgramConfig get_mcast_1d_config(const Tensor &input_tensor_a, const Tensor &input_tensor_b, bool fuse_batch = false, std::optional<UnaryWithParam> fused_activation = std::nullopt, bool mcast_in0 = true, bool out_sharded = false);
+
+// Circular buffers of a core of the 1D and 2D multicast programs, also used by the matmul tuner to only pick configs
+// that fit in L1
+struct MatmulMultiCastCBSizes {
+    tt::DataFormat output_data_format;
+    tt::DataFormat interm0_data_format;
+    uint32_t in0_CB_size;
+    uint32_t in1_CB_size;
+    // Over a sharded in0, in place
+    uint32_t in2_CB_size;
+    uint32_t in3_CB_size;
+    uint32_t out_CB_size;
+    uint32_t interm0_CB_size;
+    // The in1 multicast program reads a sharded in0 straight from its in0 CB
+    bool in0_CB_in_place;
+
+    // Bytes of L1 allocated on a core, CBs over sharded tensors are in place and partials share the output CB unless
+    // they are kept in another format
+    uint32_t get_l1_usage(bool output_is_sharded, bool has_bias) const;
+};
+
+MatmulMultiCastCBSizes get_mcast_matmul_cb_sizes(
+    uint32_t B, uint32_t num_blocks, uint32_t in0_block_w, uint32_t per_core_M, uint32_t per_core_N,
+    tt::DataFormat in0_data_format, tt::DataFormat in1_data_format, tt::DataFormat bias_data_format, tt::DataFormat output_data_format,
+    bool packer_l1_acc, bool in0_CB_in_place);
 }  // namespace bmm_op_utils
@@ -0,0 +1,614 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_dnn/op_library/bmm/matmul_tuner.hpp"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+#include "third_party/json/json.hpp"
+#include "third_party/magic_enum/magic_enum.hpp"
+#include "tt_metal/common/constants.hpp"
+#include "tt_metal/detail/util.hpp"
+#include "tt_metal/host_api.hpp"
+
+using namespace tt::constants;
+
+namespace tt {
+
+namespace operations {
+
+namespace primary {
+
+namespace {
+
+// Rough per core costs, only their ratios matter to rank configs
+// 32x32x32 tile multiplication on the FPU, per fidelity phase
+constexpr double MATMUL_TILE_CYCLES = 64.0;
+constexpr double UNPACK_TILE_CYCLES = 16.0;
+constexpr double PACK_TILE_CYCLES = 32.0;
+// Acquiring and releasing dst and the circular buffer handshakes of a subblock
+constexpr double SUBBLOCK_CYCLES = 64.0;
+// Semaphore round trip between a multicast sender and its receivers, once per block of K
+constexpr double MCAST_BLOCK_CYCLES = 256.0;
+// Of a single reader or writer core on the NoC
+constexpr double NOC_BYTES_PER_CYCLE = 32.0;
+// Of the whole chip
+constexpr double DRAM_BYTES_PER_CYCLE = 96.0;
+
+constexpr uint32_t DATABASE_VERSION = 2;
+
+uint32_t get_tile_size(DataType dtype) {
+    return tt_metal::detail::TileSize(datatype_to_dataformat_converter(dtype));
+}
+
+uint32_t get_fidelity_phases(MathFidelity math_fidelity) {
+    switch (math_fidelity) {
+        case MathFidelity::HiFi2: return 2;
+        case MathFidelity::HiFi3: return 3;
+        case MathFidelity::HiFi4: return 4;
+        default: return 1;
+    }
+}
+
+// Blocking of a config common to the 1D and 2D programs
+struct MatmulBlocking {
+    uint32_t in0_block_w;
+    uint32_t out_subblock_h;
+    uint32_t out_subblock_w;
+    uint32_t per_core_M;
+    uint32_t per_core_N;
+};
+
+template <typename ProgramConfigType>
+MatmulBlocking get_blocking(const ProgramConfigType &program_config) {
+    return MatmulBlocking{
+        .in0_block_w = static_cast<uint32_t>(program_config.in0_block_w),
+        .out_subblock_h = static_cast<uint32_t>(program_config.out_subblock_h),
+        .out_subblock_w = static_cast<uint32_t>(program_config.out_subblock_w),
+        .per_core_M = static_cast<uint32_t>(program_config.per_core_M),
+        .per_core_N = static_cast<uint32_t>(program_config.per_core_N)};
+}
+
+MatmulBlocking get_blocking(const MatmulProgramConfig &program_config) {
+    return std::visit(
+        [](const auto &program_config) -> MatmulBlocking {
+            using ProgramConfigType = std::decay_t<decltype(program_config)>;
+            if constexpr (
+                std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig> or
+                std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCastProgramConfig>) {
+                return get_blocking(program_config);
+            } else {
+                TT_THROW("Only 1D and 2D multicast matmul program configs are tuned");
+            }
+        },
+        program_config);
+}
+
+// Subblocks of a per_core_M x per_core_N block that fit in dst, largest first
+std::vector<std::pair<uint32_t, uint32_t>> get_subblocks(const MatmulProblem &problem, uint32_t per_core_M, uint32_t per_core_N) {
+    const uint32_t max_subblock_tiles = problem.fp32_dest_acc_en ? 4 : 8;
+    const bool output_sharded = problem.output_memory_layout != TensorMemoryLayout::INTERLEAVED;
+    std::vector<std::pair<uint32_t, uint32_t>> subblocks;
+    for (const auto &[out_subblock_h, out_subblock_w] : bmm_op_utils::SUBBLOCK_HW_CHOICES) {
+        if (out_subblock_h * out_subblock_w > max_subblock_tiles) {
+            continue;
+        }
+        if (per_core_M % out_subblock_h != 0 or per_core_N % out_subblock_w != 0) {
+            continue;
+        }
+        // Sharded outputs are written a row of subblocks at a time
+        if (output_sharded and out_subblock_w != per_core_N and out_subblock_h != 1) {
+            continue;
+        }
+        subblocks.emplace_back(out_subblock_h, out_subblock_w);
+    }
+    return subblocks;
+}
+
+// Distinct block sizes splitting size tiles in at most max_num_blocks blocks, with their number of blocks
+std::vector<std::pair<uint32_t, uint32_t>> get_block_sizes(uint32_t size, uint32_t max_num_blocks) {
+    std::vector<std::pair<uint32_t, uint32_t>> block_sizes;
+    for (uint32_t num_blocks = 1; num_blocks <= std::min(size, max_num_blocks); num_blocks++) {
+        const uint32_t block_size = div_up(size, num_blocks);
+        // Several block counts round to the same size, keep the one that really results from it
+        if (div_up(size, block_size) == num_blocks) {
+            block_sizes.emplace_back(block_size, num_blocks);
+        }
+    }
+    return block_sizes;
+}
+
+nlohmann::json to_json(const MatmulTuningResult &result) {
+    nlohmann::json json = std::visit(
+        [](const auto &program_config) -> nlohmann::json {
+            using ProgramConfigType = std::decay_t<decltype(program_config)>;
+            if constexpr (
+                std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig> or
+                std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCastProgramConfig>) {
+                const auto &grid = program_config.compute_with_storage_grid_size;
+                nlohmann::json json = {
+                    {"compute_with_storage_grid_size", {grid.x, grid.y}},
+                    {"in0_block_w", program_config.in0_block_w},
+                    {"out_subblock_h", program_config.out_subblock_h},
+                    {"out_subblock_w", program_config.out_subblock_w},
+                    {"per_core_M", program_config.per_core_M},
+                    {"per_core_N", program_config.per_core_N},
+                };
+                if constexpr (std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig>) {
+                    json["type"] = "1d";
+                    json["fuse_batch"] = program_config.fuse_batch;
+                    json["mcast_in0"] = program_config.mcast_in0;
+                } else {
+                    json["type"] = "2d";
+                    json["transpose_mcast"] = program_config.transpose_mcast;
+                }
+                return json;
+            } else {
+                TT_THROW("Only 1D and 2D multicast matmul program configs are tuned");
+            }
+        },
+        result.program_config);
+    json["estimated_cycles"] = result.estimated_cycles;
+    return json;
+}
+
+MatmulTuningResult from_json(const nlohmann::json &json) {
+    const auto &grid = json.at("compute_with_storage_grid_size");
+    const CoreCoord compute_with_storage_grid_size(grid.at(0).get<std::size_t>(), grid.at(1).get<std::size_t>());
+    const auto type = json.at("type").get<std::string>();
+    MatmulProgramConfig program_config;
+    if (type == "1d") {
+        program_config = MatmulMultiCoreReuseMultiCast1DProgramConfig{
+            .compute_with_storage_grid_size = compute_with_storage_grid_size,
+            .in0_block_w = json.at("in0_block_w").get<std::size_t>(),
+            .out_subblock_h = json.at("out_subblock_h").get<std::size_t>(),
+            .out_subblock_w = json.at("out_subblock_w").get<std::size_t>(),
+            .per_core_M = json.at("per_core_M").get<std::size_t>(),
+            .per_core_N = json.at("per_core_N").get<std::size_t>(),
+            .fuse_batch = json.at("fuse_batch").get<bool>(),
+            .fused_activation = std::nullopt,
+            .mcast_in0 = json.at("mcast_in0").get<bool>()};
+    } else if (type == "2d") {
+        program_config = MatmulMultiCoreReuseMultiCastProgramConfig{
+            .compute_with_storage_grid_size = compute_with_storage_grid_size,
+            .in0_block_w = json.at("in0_block_w").get<std::size_t>(),
+            .out_subblock_h = json.at("out_subblock_h").get<std::size_t>(),
+            .out_subblock_w = json.at("out_subblock_w").get<std::size_t>(),
+            .per_core_M = json.at("per_core_M").get<std::size_t>(),
+            .per_core_N = json.at("per_core_N").get<std::size_t>(),
+            .transpose_mcast = json.at("transpose_mcast").get<bool>(),
+            .fused_activation = std::nullopt};
+    } else {
+        TT_THROW("Unknown matmul program config type {}", type);
+    }
+    return MatmulTuningResult{.program_config = program_config, .estimated_cycles = json.at("estimated_cycles").get<double>()};
+}
+
+// Cycles of a core and of the DRAM traffic of all cores
+std::pair<double, double> estimate_core_and_dram_cycles(const MatmulProblem &problem, const MatmulProgramConfig &program_config) {
+    const auto blocking = get_blocking(program_config);
+    const double per_core_M = blocking.per_core_M;
+    const double per_core_N = blocking.per_core_N;
+    const double K = problem.K;
+    const double num_blocks = problem.K / blocking.in0_block_w;
+    const double num_subblocks = (per_core_M / blocking.out_subblock_h) * (per_core_N / blocking.out_subblock_w);
+    const double out_block_tiles = per_core_M * per_core_N;
+
+    // Compute of one core, every core runs a full block even when it only covers padding
+    double compute_cycles = out_block_tiles * K * get_fidelity_phases(problem.math_fidelity) * MATMUL_TILE_CYCLES;
+    // Each subblock unpacks its row of in0 and column of in1 for every tile of K
+    compute_cycles += num_subblocks * K * (blocking.out_subblock_h + blocking.out_subblock_w) * UNPACK_TILE_CYCLES;
+    compute_cycles += num_subblocks * num_blocks * SUBBLOCK_CYCLES;
+    // Partials are packed after every block of K and, unless the packer accumulates in L1, unpacked again
+    compute_cycles += out_block_tiles * num_blocks * PACK_TILE_CYCLES;
+    if (not problem.packer_l1_acc) {
+        compute_cycles += out_block_tiles * (num_blocks - 1) * UNPACK_TILE_CYCLES;
+    }
+
+    const double in0_tile_size = get_tile_size(problem.in0_dtype);
+    const double in1_tile_size = get_tile_size(problem.in1_dtype);
+    const double output_tile_size = get_tile_size(problem.output_dtype);
+    const double in0_block_bytes = per_core_M * K * in0_tile_size;
+    const double in1_block_bytes = per_core_N * K * in1_tile_size;
+    const double num_blocks_M = std::ceil(problem.M / per_core_M);
+    const double num_blocks_N = std::ceil(problem.N / per_core_N);
+
+    // Multicast senders read their block and write it again to the receivers, other cores read their own block
+    const bool mcast_in0 = std::visit(
+        [](const auto &program_config) {
+            using ProgramConfigType = std::decay_t<decltype(program_config)>;
+            if constexpr (std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig>) {
+                return program_config.mcast_in0;
+            } else {
+                return true;
+            }
+        },
+        program_config);
+    const bool mcast_in1 = std::visit(
+        [](const auto &program_config) {
+            using ProgramConfigType = std::decay_t<decltype(program_config)>;
+            if constexpr (std::is_same_v<ProgramConfigType, MatmulMultiCoreReuseMultiCast1DProgramConfig>) {
+                return not program_config.mcast_in0;
+            } else {
+                return true;
+            }
+        },
+        program_config);
+    double in0_cycles = in0_block_bytes * (mcast_in0 ? 2 : 1) / NOC_BYTES_PER_CYCLE;
+    // The writer shares its core with the in1 reader
+    double in1_cycles = in1_block_bytes * (mcast_in1 ? 2 : 1) / NOC_BYTES_PER_CYCLE;
+    if (problem.output_memory_layout == TensorMemoryLayout::INTERLEAVED) {
+        in1_cycles += out_block_tiles * output_tile_size / NOC_BYTES_PER_CYCLE;
+    }
+    const double data_movement_cycles = std::max(in0_cycles, in1_cycles);
+    const double mcast_cycles = num_blocks * MCAST_BLOCK_CYCLES;
+
+    // Every block of in0 is read once per block of N it isn't multicast to, the same for in1
+    double dram_bytes = in0_block_bytes * num_blocks_M * (mcast_in0 ? 1 : num_blocks_N);
+    dram_bytes += in1_block_bytes * num_blocks_N * (mcast_in1 ? 1 : num_blocks_M);
+    if (problem.output_memory_layout == TensorMemoryLayout::INTERLEAVED) {
+        dram_bytes += double(problem.M) * problem.N * output_tile_size;
+    }
+    const double dram_cycles = dram_bytes / DRAM_BYTES_PER_CYCLE;
+
+    // With a single block of K the block is read, computed and written in turns
+    if (num_blocks == 1) {
+        return {compute_cycles + data_movement_cycles + mcast_cycles, dram_cycles};
+    }
+    return {std::max(compute_cycles, data_movement_cycles) + mcast_cycles, dram_cycles};
+}
+
+}  // namespace
+
+std::optional<MatmulProblem> create_matmul_problem(
+    const Tensor &input_tensor_a,
+    const Tensor &input_tensor_b,
+    const MemoryConfig &output_mem_config,
+    DataType output_dtype,
+    MathFidelity math_fidelity,
+    bool fp32_dest_acc_en,
+    bool packer_l1_acc) {
+    // Host inputs are left to Matmul::validate to report
+    if (input_tensor_a.storage_type() != StorageType::DEVICE or input_tensor_b.storage_type() != StorageType::DEVICE) {
+        return std::nullopt;
+    }
+    const auto &ashape = input_tensor_a.shape();
+    const auto &bshape = input_tensor_b.shape();
+    // Sharded inputs constrain the blocking to their shard specs, batched in1 can't be fused into M
+    if (input_tensor_a.memory_config().is_sharded() or input_tensor_b.memory_config().is_sharded() or
+        bshape[0] * bshape[1] != 1) {
+        return std::nullopt;
+    }
+    auto device = input_tensor_a.device();
+    // Circular buffers have to end below every L1 buffer, the output is allocated below those before the program
+    const uint64_t l1_end = device->lowest_occupied_compute_l1_address().value_or(device->l1_size_per_core());
+    return MatmulProblem{
+        .M = input_tensor_a.volume() / ashape[-1] / TILE_HEIGHT,
+        .K = ashape[-1] / TILE_WIDTH,
+        .N = bshape[-1] / TILE_WIDTH,
+        .in0_dtype = input_tensor_a.dtype(),
+        .in1_dtype = input_tensor_b.dtype(),
+        .output_dtype = output_dtype,
+        .math_fidelity = math_fidelity,
+        .fp32_dest_acc_en = fp32_dest_acc_en,
+        .packer_l1_acc = packer_l1_acc,
+        .compute_with_storage_grid_size = device->compute_with_storage_grid_size(),
+        .output_memory_layout = output_mem_config.memory_layout,
+        .output_buffer_type = output_mem_config.buffer_type,
+        .l1_size = static_cast<uint32_t>(l1_end > L1_UNRESERVED_BASE ? l1_end - L1_UNRESERVED_BASE : 0)};
+}
+
+std::string get_matmul_problem_key(const MatmulProblem &problem) {
+    return fmt::format(
+        "{}x{}x{} {} {} {} {} fp32_dest_acc_en={} packer_l1_acc={} grid={}x{} {} {}",
+        problem.M,
+        problem.K,
+        problem.N,
+        magic_enum::enum_name(problem.in0_dtype),
+        magic_enum::enum_name(problem.in1_dtype),
+        magic_enum::enum_name(problem.output_dtype),
+        magic_enum::enum_name(problem.math_fidelity),
+        problem.fp32_dest_acc_en,
+        problem.packer_l1_acc,
+        problem.compute_with_storage_grid_size.x,
+        problem.compute_with_storage_grid_size.y,
+        magic_enum::enum_name(problem.output_memory_layout),
+        magic_enum::enum_name(problem.output_buffer_type));
+}
+
+std::vector<MatmulProgramConfig> enumerate_matmul_program_configs(const MatmulProblem &problem) {
+    const auto &grid = problem.compute_with_storage_grid_size;
+    const uint32_t num_cores = grid.x * grid.y;
+    const auto output_memory_layout = problem.output_memory_layout;
+
+    std::vector<MatmulProgramConfig> program_configs;
+    auto add_fitting = [&](const MatmulProgramConfig &program_config) {
+        if (get_matmul_l1_usage(problem, program_config) <= problem.l1_size) {
+            program_configs.push_back(program_config);
+        }
+    };
+
+    for (uint32_t in0_block_w = 1; in0_block_w <= problem.K; in0_block_w++) {
+        if (problem.K % in0_block_w != 0) {
+            continue;
+        }
+
+        // 1D mcast in0: all of M on every core, N split across the grid
+        if (output_memory_layout == TensorMemoryLayout::INTERLEAVED or output_memory_layout == TensorMemoryLayout::WIDTH_SHARDED) {
+            for (const auto &[per_core_N, num_blocks] : get_block_sizes(problem.N, num_cores)) {
+                if (output_memory_layout == TensorMemoryLayout::WIDTH_SHARDED and problem.N % per_core_N != 0) {
+                    continue;
+                }
+                for (const auto &[out_subblock_h, out_subblock_w] : get_subblocks(problem, problem.M, per_core_N)) {
+                    add_fitting(MatmulMultiCoreReuseMultiCast1DProgramConfig{
+                        .compute_with_storage_grid_size = grid,
+                        .in0_block_w = in0_block_w,
+                        .out_subblock_h = out_subblock_h,
+                        .out_subblock_w = out_subblock_w,
+                        .per_core_M = problem.M,
+                        .per_core_N = per_core_N,
+                        .fuse_batch = true,
+                        .fused_activation = std::nullopt,
+                        .mcast_in0 = true});
+                }
+            }
+        }
+
+        // 1D mcast in1: all of N on every core, M split across the grid
+        if (output_memory_layout == TensorMemoryLayout::INTERLEAVED or output_memory_layout == TensorMemoryLayout::HEIGHT_SHARDED) {
+            for (const auto &[per_core_M, num_blocks] : get_block_sizes(problem.M, num_cores)) {
+                if (output_memory_layout == TensorMemoryLayout::HEIGHT_SHARDED and problem.M % per_core_M != 0) {
+                    continue;
+                }
+                for (const auto &[out_subblock_h, out_subblock_w] : get_subblocks(problem, per_core_M, problem.N)) {
+                    add_fitting(MatmulMultiCoreReuseMultiCast1DProgramConfig{
+                        .compute_with_storage_grid_size = grid,
+                        .in0_block_w = in0_block_w,
+                        .out_subblock_h = out_subblock_h,
+                        .out_subblock_w = out_subblock_w,
+                        .per_core_M = per_core_M,
+                        .per_core_N = problem.N,
+                        .fuse_batch = true,
+                        .fused_activation = std::nullopt,
+                        .mcast_in0 = false});
+                }
+            }
+        }
+
+        // 2D: blocks of M along the grid rows and of N along its columns, the other way around when transposed.
+        // The program only multicasts both inputs, so both dims need at least 2 blocks
+        if (output_memory_layout == TensorMemoryLayout::INTERLEAVED or output_memory_layout == TensorMemoryLayout::BLOCK_SHARDED) {
+            for (bool transpose_mcast : {false, true}) {
+                const uint32_t max_num_blocks_M = transpose_mcast ? grid.x : grid.y;
+                const uint32_t max_num_blocks_N = transpose_mcast ? grid.y : grid.x;
+                for (const auto &[per_core_M, num_blocks_M] : get_block_sizes(problem.M, max_num_blocks_M)) {
+                    for (const auto &[per_core_N, num_blocks_N] : get_block_sizes(problem.N, max_num_blocks_N)) {
+                        if (num_blocks_M < 2 or num_blocks_N < 2) {
+                            continue;
+                        }
+                        for (const auto &[out_subblock_h, out_subblock_w] : get_subblocks(problem, per_core_M, per_core_N)) {
+                            add_fitting(MatmulMultiCoreReuseMultiCastProgramConfig{
+                                .compute_with_storage_grid_size = grid,
+                                .in0_block_w = in0_block_w,
+                                .out_subblock_h = out_subblock_h,
+                                .out_subblock_w = out_subblock_w,
+                                .per_core_M = per_core_M,
+                                .per_core_N = per_core_N,
+                                .transpose_mcast = transpose_mcast,
+                                .fused_activation = std::nullopt});
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return program_configs;
+}
+
+uint32_t get_matmul_l1_usage(const MatmulProblem &problem, const MatmulProgramConfig &program_config) {
+    // Same circular buffers as the 1D and 2D programs, with interleaved inputs and the batch fused into M
+    const auto blocking = get_blocking(program_config);
+    const auto in1_data_format = datatype_to_dataformat_converter(problem.in1_dtype);
+    const auto cb_sizes = bmm_op_utils::get_mcast_matmul_cb_sizes(
+        1,
+        problem.K / blocking.in0_block_w,
+        blocking.in0_block_w,
+        blocking.per_core_M,
+        blocking.per_core_N,
+        datatype_to_dataformat_converter(problem.in0_dtype),
+        in1_data_format,
+        in1_data_format,
+        datatype_to_dataformat_converter(problem.output_dtype),
+        problem.packer_l1_acc,
+        false);
+    // Room for a bias is always kept, so that tuned configs don't depend on it
+    uint32_t l1_usage = cb_sizes.get_l1_usage(problem.output_memory_layout != TensorMemoryLayout::INTERLEAVED, true);
+    if (problem.output_buffer_type == BufferType::L1) {
+        // A sharded output holds a block per core, an interleaved one spreads its tiles over at least as many banks
+        // as there are cores
+        const auto &grid = problem.compute_with_storage_grid_size;
+        const uint32_t output_tiles = problem.output_memory_layout == TensorMemoryLayout::INTERLEAVED
+                                          ? div_up(problem.M * problem.N, grid.x * grid.y)
+                                          : blocking.per_core_M * blocking.per_core_N;
+        l1_usage += output_tiles * get_tile_size(problem.output_dtype);
+    }
+    return l1_usage;
+}
+
+double estimate_matmul_program_cycles(const MatmulProblem &problem, const MatmulProgramConfig &program_config) {
+    const auto [core_cycles, dram_cycles] = estimate_core_and_dram_cycles(problem, program_config);
+    return std::max(core_cycles, dram_cycles);
+}
+
+std::optional<MatmulTuningResult> tune_matmul(const MatmulProblem &problem) {
+    std::optional<MatmulTuningResult> best_result;
+    double best_core_cycles = 0;
+    for (const auto &program_config : enumerate_matmul_program_configs(problem)) {
+        const auto [core_cycles, dram_cycles] = estimate_core_and_dram_cycles(problem, program_config);
+        const double estimated_cycles = std::max(core_cycles, dram_cycles);
+        // Configs bound by the DRAM bandwidth tie, the one with the least work per core is kept
+        if (not best_result.has_value() or estimated_cycles < best_result->estimated_cycles or
+            (estimated_cycles == best_result->estimated_cycles and core_cycles < best_core_cycles)) {
+            best_result = MatmulTuningResult{.program_config = program_config, .estimated_cycles = estimated_cycles};
+            best_core_cycles = core_cycles;
+        }
+    }
+    return best_result;
+}
+
+MatmulTuningDatabase::MatmulTuningDatabase(const std::string &file_name) : file_name_(file_name) {
+    if (std::filesystem::exists(file_name)) {
+        this->load(file_name);
+    }
+}
+
+std::optional<MatmulTuningResult> MatmulTuningDatabase::lookup(const MatmulProblem &problem) const {
+    std::unique_lock lock(this->mutex_);
+    auto result = this->results_.find(get_matmul_problem_key(problem));
+    if (result == this->results_.end()) {
+        return std::nullopt;
+    }
+    return result->second;
+}
+
+void MatmulTuningDatabase::insert(const MatmulProblem &problem, const MatmulTuningResult &result) {
+    std::unique_lock lock(this->mutex_);
+    this->results_.insert_or_assign(get_matmul_problem_key(problem), result);
+}
+
+std::optional<MatmulTuningResult> MatmulTuningDatabase::tune(const MatmulProblem &problem) {
+    if (auto result = this->lookup(problem); result.has_value()) {
+        // Tuned while more L1 was free, the default heuristics run instead
+        if (get_matmul_l1_usage(problem, result->program_config) > problem.l1_size) {
+            log_debug(
+                tt::LogOp,
+                "Tuned config of matmul {} doesn't fit in {} B of L1",
+                get_matmul_problem_key(problem),
+                problem.l1_size);
+            return std::nullopt;
+        }
+        return result;
+    }
+    auto result = tune_matmul(problem);
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+    {
+        std::unique_lock lock(this->mutex_);
+        this->results_.insert_or_assign(get_matmul_problem_key(problem), result.value());
+        this->dirty_ = true;
+    }
+    log_debug(tt::LogOp, "Tuned matmul {}, estimated {} cycles", get_matmul_problem_key(problem), result->estimated_cycles);
+    return result;
+}
+
+void MatmulTuningDatabase::load(const std::string &file_name) {
+    std::ifstream file(file_name);
+    TT_FATAL(file.is_open(), "Failed to open matmul tuning database {}", file_name);
+    nlohmann::json json;
+    try {
+        json = nlohmann::json::parse(file);
+    } catch (const nlohmann::json::exception &exception) {
+        TT_THROW("Failed to parse matmul tuning database {}: {}", file_name, exception.what());
+    }
+    TT_FATAL(
+        json.value("version", 0u) == DATABASE_VERSION,
+        "Matmul tuning database {} has version {}, expected {}",
+        file_name,
+        json.value("version", 0u),
+        DATABASE_VERSION);
+
+    std::unique_lock lock(this->mutex_);
+    for (const auto &[key, result] : json.at("results").items()) {
+        this->results_.insert_or_assign(key, from_json(result));
+    }
+}
+
+void MatmulTuningDatabase::save(const std::string &file_name) const {
+    nlohmann::json json = {{"version", DATABASE_VERSION}, {"results", nlohmann::json::object()}};
+    {
+        std::unique_lock lock(this->mutex_);
+        for (const auto &[key, result] : this->results_) {
+            json["results"][key] = to_json(result);
+        }
+    }
+    // Written aside and renamed, so other processes never read a partial file
+    const auto temporary_file_name = file_name + ".tmp";
+    {
+        std::ofstream file(temporary_file_name);
+        TT_FATAL(file.is_open(), "Failed to open {}", temporary_file_name);
+        file << json.dump(4) << std::endl;
+    }
+    std::filesystem::rename(temporary_file_name, file_name);
+}
+
+void MatmulTuningDatabase::flush() {
+    {
+        std::unique_lock lock(this->mutex_);
+        if (this->file_name_.empty() or not this->dirty_) {
+            return;
+        }
+        this->dirty_ = false;
+    }
+    this->save(this->file_name_);
+}
+
+std::size_t MatmulTuningDatabase::size() const {
+    std::unique_lock lock(this->mutex_);
+    return this->results_.size();
+}
+
+MatmulTuningDatabase *get_matmul_tuning_database() {
+    // Never destroyed, ops may still run while the process exits
+    static MatmulTuningDatabase *database = []() -> MatmulTuningDatabase * {
+        const char *file_name = std::getenv("TT_METAL_MATMUL_TUNING_DB");
+        if (file_name == nullptr) {
+            return nullptr;
+        }
+        auto database = new MatmulTuningDatabase(file_name);
+        tt::log_info(tt::LogOp, "Matmul tuning database: {} tuned problems in {}", database->size(), file_name);
+        // Problems tuned by the run are written back once, when it exits
+        std::atexit([] {
+            try {
+                get_matmul_tuning_database()->flush();
+            } catch (const std::exception &exception) {
+                tt::log_warning(tt::LogOp, "Failed to save the matmul tuning database: {}", exception.what());
+            }
+        });
+        return database;
+    }();
+    return database;
+}
+
+std::optional<MatmulProgramConfig> get_tuned_matmul_program_config(
+    const Tensor &input_tensor_a,
+    const Tensor &input_tensor_b,
+    const MemoryConfig &output_mem_config,
+    DataType output_dtype,
+    MathFidelity math_fidelity,
+    bool fp32_dest_acc_en,
+    bool packer_l1_acc) {
+    auto database = get_matmul_tuning_database();
+    if (database == nullptr) {
+        return std::nullopt;
+    }
+    auto problem = create_matmul_problem(
+        input_tensor_a, input_tensor_b, output_mem_config, output_dtype, math_fidelity, fp32_dest_acc_en, packer_l1_acc);
+    if (not problem.has_value()) {
+        return std::nullopt;
+    }
+    auto result = database->tune(problem.value());
+    if (not result.has_value()) {
+        return std::nullopt;
+    }
+    return result->program_config;
+}
+
+}  // namespace primary
+
+}  // namespace operations
+
+}  // namespace tt
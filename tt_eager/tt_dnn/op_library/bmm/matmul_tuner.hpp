@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Program config autotuning for operations::primary::Matmul.
+// Every legal MatmulMultiCoreReuseMultiCast1DProgramConfig and MatmulMultiCoreReuseMultiCastProgramConfig of a problem
+// is enumerated and scored with an analytical model of the cycles of one core, the best one is kept in a JSON
+// database keyed by shape, dtypes, grid and output sharding.
+// With TT_METAL_MATMUL_TUNING_DB=<file> a matmul without a program config runs the tuned config of its problem
+// instead of the default heuristics, problems missing from the file are tuned on first use and written back when the
+// process exits.
+//
+
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tt_dnn/op_library/bmm/bmm_op.hpp"
+
+namespace tt {
+
+namespace operations {
+
+namespace primary {
+
+using namespace tt_metal;
+
+struct MatmulProblem {
+    // In tiles, the batch of in0 is fused into M
+    uint32_t M;
+    uint32_t K;
+    uint32_t N;
+    DataType in0_dtype;
+    DataType in1_dtype;
+    DataType output_dtype;
+    MathFidelity math_fidelity;
+    bool fp32_dest_acc_en;
+    bool packer_l1_acc;
+    CoreCoord compute_with_storage_grid_size;
+    TensorMemoryLayout output_memory_layout;
+    BufferType output_buffer_type;
+    // L1 of a core below its lowest L1 buffer, left for the circular buffers and an L1 output
+    uint32_t l1_size;
+};
+
+// Problem of a matmul with interleaved device inputs and an in1 broadcast over the batch, the only ones tuned. The
+// L1 budget is what is free of L1 buffers at the time of the call
+std::optional<MatmulProblem> create_matmul_problem(
+    const Tensor &input_tensor_a,
+    const Tensor &input_tensor_b,
+    const MemoryConfig &output_mem_config,
+    DataType output_dtype,
+    MathFidelity math_fidelity,
+    bool fp32_dest_acc_en,
+    bool packer_l1_acc);
+
+// Database key, every field but l1_size
+std::string get_matmul_problem_key(const MatmulProblem &problem);
+
+// All 1D (mcast in0 and in1) and 2D (plain and transposed) configs the programs accept for problem whose
+// circular buffers and output fit in its L1
+std::vector<MatmulProgramConfig> enumerate_matmul_program_configs(const MatmulProblem &problem);
+
+// Bytes of L1 a core needs to run problem with program_config: its circular buffers, including a bias, and its part
+// of an output in L1
+uint32_t get_matmul_l1_usage(const MatmulProblem &problem, const MatmulProgramConfig &program_config);
+
+// Estimated cycles of a core: compute, reads, multicasts and writes of its block, overlapped when double buffered,
+// bounded by the DRAM bandwidth of the whole chip. Only meant to rank configs of the same problem
+double estimate_matmul_program_cycles(const MatmulProblem &problem, const MatmulProgramConfig &program_config);
+
+struct MatmulTuningResult {
+    MatmulProgramConfig program_config;
+    double estimated_cycles;
+};
+
+// Config of problem with the fewest estimated cycles, nullopt if there is no legal one
+std::optional<MatmulTuningResult> tune_matmul(const MatmulProblem &problem);
+
+class MatmulTuningDatabase {
+   public:
+    // In memory only
+    MatmulTuningDatabase() = default;
+    // Loads file_name if it exists, flush writes the results tuned since back to it
+    explicit MatmulTuningDatabase(const std::string &file_name);
+
+    std::optional<MatmulTuningResult> lookup(const MatmulProblem &problem) const;
+    void insert(const MatmulProblem &problem, const MatmulTuningResult &result);
+    // Looks problem up, on a miss tunes it and inserts the result. nullopt if the result doesn't fit in the L1 the
+    // problem has left, a config tuned with more free L1 is kept for when it has
+    std::optional<MatmulTuningResult> tune(const MatmulProblem &problem);
+
+    void load(const std::string &file_name);
+    void save(const std::string &file_name) const;
+    // Saves to file_name if tune added results since the last flush
+    void flush();
+
+    const std::string &file_name() const { return this->file_name_; }
+    std::size_t size() const;
+
+   private:
+    std::string file_name_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, MatmulTuningResult> results_;
+    bool dirty_ = false;
+};
+
+// Database of TT_METAL_MATMUL_TUNING_DB, nullptr if it isn't set
+MatmulTuningDatabase *get_matmul_tuning_database();
+
+// Tuned config of a matmul without a program config, nullopt without a database or if the problem isn't tuned
+std::optional<MatmulProgramConfig> get_tuned_matmul_program_config(
+    const Tensor &input_tensor_a,
+    const Tensor &input_tensor_b,
+    const MemoryConfig &output_mem_config,
+    DataType output_dtype,
+    MathFidelity math_fidelity,
+    bool fp32_dest_acc_en,
+    bool packer_l1_acc);
+
+}  // namespace primary
+
+}  // namespace operations
+
+}  // namespace tt
@@ -49,31 +49,17 @@ operation::ProgramWithCallbacks create_program_mcast_in0(
     uint32_t output_single_tile_size = tt_metal::detail::TileSize(output_data_format);
     uint32_t interm0_single_tile_size = tt_metal::detail::TileSize(interm0_data_format);
 
-    uint32_t in0_block_tiles = per_core_M * in0_block_w;
-    uint32_t in0_CB_tiles = in0_block_tiles;
-    if (B * num_blocks > 1) {
-        in0_CB_tiles = in0_CB_tiles * 2; // double buffer
-    }
-    uint32_t in0_CB_size = in0_CB_tiles * in0_single_tile_size;
-    uint32_t in1_block_tiles = per_core_N * in0_block_w;
-    uint32_t in1_CB_tiles = in1_block_tiles;
-    if (B * num_blocks > 1) {
-        in1_CB_tiles = in1_CB_tiles * 2; // double buffer
-    }
-    uint32_t in1_CB_size = in1_CB_tiles * in1_single_tile_size;
-
     uint32_t out_block_tiles = per_core_M * per_core_N;
-    uint32_t out_CB_tiles = out_block_tiles; // No double buffer
-    uint32_t out_CB_size = out_CB_tiles * output_single_tile_size;
-    uint32_t interm0_CB_size = out_CB_tiles * interm0_single_tile_size;
-
-    uint32_t in2_block_tiles = per_core_M * in0_block_w;
-    uint32_t in2_CB_tiles = in2_block_tiles;
-    uint32_t in2_CB_size = in2_CB_tiles * in0_single_tile_size;
 
-    uint32_t in3_block_tiles = per_core_N;
-    uint32_t in3_CB_tiles = in3_block_tiles; // No double buffer
-    uint32_t in3_CB_size = in3_CB_tiles * bias_single_tile_size;
+    auto cb_sizes = bmm_op_utils::get_mcast_matmul_cb_sizes(
+        B, num_blocks, in0_block_w, per_core_M, per_core_N,
+        in0_data_format, in1_data_format, bias_data_format, output_data_format, packer_l1_acc, false);
+    uint32_t in0_CB_size = cb_sizes.in0_CB_size;
+    uint32_t in1_CB_size = cb_sizes.in1_CB_size;
+    uint32_t out_CB_size = cb_sizes.out_CB_size;
+    uint32_t interm0_CB_size = cb_sizes.interm0_CB_size;
+    uint32_t in2_CB_size = cb_sizes.in2_CB_size;
+    uint32_t in3_CB_size = cb_sizes.in3_CB_size;
 
     uint32_t start_core_x = 0;
     uint32_t start_core_y = 0;
@@ -610,29 +596,16 @@ operation::ProgramWithCallbacks create_program_mcast_in1(
     uint32_t output_single_tile_size = tt_metal::detail::TileSize(output_data_format);
     uint32_t interm0_single_tile_size = tt_metal::detail::TileSize(interm0_data_format);
 
-    uint32_t in0_block_tiles = per_core_M * in0_block_w;
-    uint32_t in0_CB_tiles = in0_block_tiles;
-    if (in0_is_sharded) {
-        in0_CB_tiles = num_blocks * in0_CB_tiles * B;
-    } else if (B * num_blocks > 1) {
-        in0_CB_tiles = in0_CB_tiles * 2; // double buffer
-    }
-    uint32_t in0_CB_size = in0_CB_tiles * in0_single_tile_size;
-    uint32_t in1_block_tiles = per_core_N * in0_block_w;
-    uint32_t in1_CB_tiles = in1_block_tiles;
-    if (B * num_blocks > 1) {
-        in1_CB_tiles = in1_CB_tiles * 2; // double buffer
-    }
-    uint32_t in1_CB_size = in1_CB_tiles * in1_single_tile_size;
     uint32_t out_block_tiles = per_core_M * per_core_N;
-    uint32_t out_CB_tiles = out_block_tiles; // No double buffer
-    uint32_t out_CB_size = out_CB_tiles * output_single_tile_size;
-    uint32_t interm0_CB_size = out_CB_tiles * interm0_single_tile_size;
-
 
-    uint32_t in3_block_tiles = per_core_N;
-    uint32_t in3_CB_tiles = in3_block_tiles; // No double buffer
-    uint32_t in3_CB_size = in3_CB_tiles * bias_single_tile_size;
+    auto cb_sizes = bmm_op_utils::get_mcast_matmul_cb_sizes(
+        B, num_blocks, in0_block_w, per_core_M, per_core_N,
+        in0_data_format, in1_data_format, bias_data_format, output_data_format, packer_l1_acc, in0_is_sharded);
+    uint32_t in0_CB_size = cb_sizes.in0_CB_size;
+    uint32_t in1_CB_size = cb_sizes.in1_CB_size;
+    uint32_t out_CB_size = cb_sizes.out_CB_size;
+    uint32_t interm0_CB_size = cb_sizes.interm0_CB_size;
+    uint32_t in3_CB_size = cb_sizes.in3_CB_size;
 
     uint32_t start_core_x = 0;
     uint32_t start_core_y = 0;
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+
+#include <tt_eager/tensor/tensor.hpp>
+#include "tt_dnn/op_library/operation.hpp"
+#include "tt_metal/impl/allocator/buffer_planner.hpp"
+#include "tt_metal/impl/device/device.hpp"
+
+namespace tt::tt_metal {
+
+// Buffer plans of composite ops. The first run of a composite op records the interleaved buffers its device ops
+// allocate and when they are freed, later runs with the same arguments place them at planned offsets of one arena
+// per buffer type.
+namespace buffer_plan_cache {
+
+namespace detail {
+
+struct BufferPlanCache {
+    allocator::BufferPlan& get(operation::Hash key) { return this->plans_[key]; }
+
+    void enable() { this->is_enabled_ = true; }
+
+    void disable() { this->is_enabled_ = false; }
+
+    bool is_enabled() const { return this->is_enabled_; }
+
+    void clear() { this->plans_.clear(); }
+
+    std::size_t num_entries() const { return this->plans_.size(); }
+
+   private:
+    bool is_enabled_ = false;
+    std::unordered_map<operation::Hash, allocator::BufferPlan> plans_{};
+};
+
+inline BufferPlanCache BUFFER_PLAN_CACHE{};
+
+// Arguments that determine the buffers a composite op allocates, other arguments only change the computed values
+template <typename T>
+operation::Hash hash_argument(const T& argument) {
+    if constexpr (std::is_same_v<T, Tensor>) {
+        if (argument.storage_type() != StorageType::DEVICE) {
+            return 0;
+        }
+        return stl::hash::hash_objects(
+            0, argument.shape(), argument.dtype(), argument.layout(), argument.memory_config(), argument.device()->id());
+    } else if constexpr (std::is_same_v<T, MemoryConfig> or std::is_integral_v<T> or std::is_enum_v<T>) {
+        return stl::hash::hash_object(argument);
+    } else if constexpr (stl::hash::detail::is_specialization_v<T, std::vector>) {
+        operation::Hash hash = stl::hash::hash_object(argument.size());
+        for (const auto& element : argument) {
+            hash = stl::hash::hash_objects(hash, hash_argument(element));
+        }
+        return hash;
+    } else if constexpr (stl::hash::detail::is_specialization_v<T, std::optional>) {
+        return argument.has_value() ? stl::hash::hash_objects(1, hash_argument(argument.value())) : 0;
+    } else {
+        return 0;
+    }
+}
+
+template <typename T>
+Device* get_device(const T& argument) {
+    if constexpr (std::is_same_v<T, Tensor>) {
+        if (argument.storage_type() == StorageType::DEVICE) {
+            return argument.device();
+        }
+    } else if constexpr (stl::hash::detail::is_specialization_v<T, std::vector>) {
+        for (const auto& element : argument) {
+            if (auto device = get_device(element); device != nullptr) {
+                return device;
+            }
+        }
+    } else if constexpr (stl::hash::detail::is_specialization_v<T, std::optional>) {
+        if (argument.has_value()) {
+            return get_device(argument.value());
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace detail
+
+inline bool is_enabled() { return detail::BUFFER_PLAN_CACHE.is_enabled(); }
+
+inline void enable() {
+    tt::log_info(tt::LogOp, "Buffer Plan Cache: enabled.");
+    detail::BUFFER_PLAN_CACHE.enable();
+}
+
+inline void disable_and_clear() {
+    tt::log_info(tt::LogOp, "Buffer Plan Cache: disabled and cleared.");
+    detail::BUFFER_PLAN_CACHE.disable();
+    detail::BUFFER_PLAN_CACHE.clear();
+}
+
+inline std::size_t num_entries() { return detail::BUFFER_PLAN_CACHE.num_entries(); }
+
+// Records or replays the buffer plan of a composite op on the device of its first device tensor argument while alive
+class Scope {
+   public:
+    template <typename... Args>
+    Scope(const char* name, const Args&... args) {
+        ((this->device_ = this->device_ != nullptr ? this->device_ : detail::get_device(args)), ...);
+        if (this->device_ == nullptr) {
+            return;
+        }
+        auto key = stl::hash::hash_objects(0, std::string_view(name), detail::hash_argument(args)...);
+        this->session_.emplace(detail::BUFFER_PLAN_CACHE.get(key));
+        this->device_->set_buffer_plan_session(&this->session_.value());
+    }
+
+    // Only a completed run updates the plan
+    void finish() {
+        if (this->session_.has_value()) {
+            this->device_->set_buffer_plan_session(nullptr);
+            this->session_->finish();
+            this->session_.reset();
+        }
+    }
+
+    ~Scope() {
+        if (this->session_.has_value()) {
+            this->device_->set_buffer_plan_session(nullptr);
+        }
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    Device* device_ = nullptr;
+    std::optional<allocator::BufferPlanSession> session_;
+};
+
+}  // namespace buffer_plan_cache
+
+}  // namespace tt::tt_metal
@@ -167,6 +167,8 @@ struct HostOperation final {
     const std::function<const std::vector<Tensor>(const std::vector<Tensor>&)> compute_output_tensors;
     const std::function<const ProfilerInfo(const std::vector<Tensor> &input_tensors)> create_profiler_info;
     const std::function<const tt::stl::reflection::Attributes()> attributes;
+    const std::function<const Hash(const std::vector<Tensor>&, const std::vector<std::optional<const Tensor>>&)>
+        attributes_hash;
 
     template <typename T>
     explicit HostOperation(T&& operation) :
@@ -200,6 +202,10 @@ struct HostOperation final {
         attributes{[this] {
             const auto& operation = *reinterpret_cast<const std::decay_t<T>*>(&this->type_erased_storage);
             return tt::stl::reflection::get_attributes(operation);
+        }},
+        attributes_hash{[this](const std::vector<Tensor>&, const std::vector<std::optional<const Tensor>>&) -> const Hash {
+            const auto& operation = *reinterpret_cast<const std::decay_t<T>*>(&this->type_erased_storage);
+            return hash_operation<T>(operation);
         }} {
         static_assert(sizeof(T) <= sizeof(storage_t));
     }
@@ -273,6 +279,15 @@ struct DeviceOperation final {
         return this->attributes_impl_(this->type_erased_storage);
     }
 
+    // Identifies the operation by its type and the values of its attributes, hashed in place when they are known at
+    // compile time instead of building attributes(). Unlike the program hash, operations that only differ in
+    // attributes that share a program are told apart
+    inline const Hash attributes_hash(
+        const std::vector<Tensor>& input_tensors,
+        const std::vector<std::optional<const Tensor>>& optional_input_tensors) const {
+        return this->attributes_hash_impl_(this->type_erased_storage, input_tensors, optional_input_tensors);
+    }
+
     template <typename T>
     explicit DeviceOperation(T&& operation) :
 
@@ -384,6 +399,12 @@ struct DeviceOperation final {
         attributes_impl_{[](const storage_t& storage) -> const tt::stl::reflection::Attributes {
             const auto& operation = *reinterpret_cast<const std::decay_t<T>*>(&storage);
             return tt::stl::reflection::get_attributes(operation);
+        }},
+        attributes_hash_impl_{[](const storage_t& storage,
+                                 const std::vector<Tensor>& input_tensors,
+                                 const std::vector<std::optional<const Tensor>>& optional_input_tensors) -> const Hash {
+            const auto& operation = *reinterpret_cast<const std::decay_t<T>*>(&storage);
+            return hash_operation<T>(operation);
         }} {
         static_assert(sizeof(T) <= sizeof(storage_t));
     }
@@ -426,6 +447,8 @@ struct DeviceOperation final {
         const storage_t& value, const std::vector<Tensor>&, const std::vector<std::optional<const Tensor>>&);
     const ProfilerInfo (*create_profiler_info_impl_)(const storage_t& value, const std::vector<Tensor>& input_tensors);
     const tt::stl::reflection::Attributes (*attributes_impl_)(const storage_t& value);
+    const Hash (*attributes_hash_impl_)(
+        const storage_t& value, const std::vector<Tensor>&, const std::vector<std::optional<const Tensor>>&);
 };
 
 struct ExternalOperation {
@@ -434,6 +457,9 @@ struct ExternalOperation {
 
     const std::string get_type_name() const { return this->function_name_; }
     const tt::stl::reflection::Attributes attributes() const { return this->attributes_; }
+    const Hash attributes_hash(const std::vector<Tensor>&, const std::vector<std::optional<const Tensor>>&) const {
+        return stl::hash::hash_objects(0, this->function_name_, this->attributes_);
+    }
 };
 
 using Operation = std::variant<HostOperation, DeviceOperation, ExternalOperation>;
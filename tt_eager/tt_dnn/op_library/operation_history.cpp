@@ -4,147 +4,331 @@
 
 #include "tt_dnn/op_library/operation_history.hpp"
 
-namespace tt {
+#include <fcntl.h>
+#include <unistd.h>
 
-namespace tt_metal {
+#include <array>
+#include <climits>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string_view>
 
+#include "third_party/magic_enum/magic_enum.hpp"
 
-#ifdef DEBUG
+namespace tt {
+
+namespace tt_metal {
 
 namespace operation_history {
 
 namespace detail {
 
-OperationHistory::~OperationHistory() {
-    this->dump_to_csv();
+namespace {
+
+constexpr uint32_t MAX_RECORDED_THREADS = 64;
+constexpr uint32_t DEFAULT_CAPACITY = 16 * 1024;
+constexpr std::size_t STRING_CHUNK_SIZE = 64 * 1024;
+
+// File layout: a FileHeader followed by sections, each a SectionHeader and its payload.
+// ENUM_NAMES holds entries of {uint8_t enum, uint8_t value, uint16_t length, name}.
+// STRINGS holds interned strings as {uint32_t length, string} in id order, across all STRINGS sections.
+// RING holds a RingHeader and the min(num_records, capacity) records of one thread in slot order.
+constexpr std::array<char, 8> MAGIC = {'T', 'T', 'O', 'P', 'H', 'I', 'S', 'T'};
+
+enum class SectionType : uint32_t { ENUM_NAMES = 0, STRINGS = 1, RING = 2 };
+
+// Enums of TensorRecord in the order of the ENUM_NAMES ids
+enum class EnumId : uint8_t { STORAGE_TYPE = 0, DATA_TYPE = 1, LAYOUT = 2, MEMORY_LAYOUT = 3, BUFFER_TYPE = 4 };
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t max_input_tensors;
+    uint32_t max_num_dimensions;
+};
+
+struct SectionHeader {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t size;
+};
+
+struct RingHeader {
+    uint32_t thread_index;
+    uint32_t capacity;
+    uint64_t num_records;
+};
+
+// Only async-signal-safe calls from here on, the file can be written from a signal handler
+bool write_all(int file_descriptor, const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        auto num_written = ::write(file_descriptor, bytes, size);
+        if (num_written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        bytes += num_written;
+        size -= num_written;
+    }
+    return true;
 }
 
-void OperationHistory::append(OperationRecord&& record) {
-    TT_ASSERT(record.input_tensor_records.size() <= 5);
-    this->records.push_back(std::move(record));
+bool write_section(int file_descriptor, SectionType type, const void* data, std::size_t size) {
+    SectionHeader header{.type = static_cast<uint32_t>(type), .reserved = 0, .size = size};
+    return write_all(file_descriptor, &header, sizeof(header)) and write_all(file_descriptor, data, size);
 }
 
-template <typename RowType>
-void write_row(std::ofstream& output_file_stream, const std::size_t num_columns, const RowType& row) {
-    TT_ASSERT(row.size() == num_columns);
-    for (const auto& element : row) {
-        output_file_stream << '"' << element << '"' << ",";
+// Interned strings in append-only chunks that are never moved, so a dump can read them while other threads intern
+class StringTable {
+   public:
+    StringTable() : first_(new Chunk{}), last_(first_) { this->intern(""); }
+
+    uint32_t intern(std::string_view string) {
+        std::unique_lock lock(this->mutex_);
+        auto id = this->ids_.find(std::string(string));
+        if (id != this->ids_.end()) {
+            return id->second;
+        }
+        const uint32_t length = std::min(string.size(), STRING_CHUNK_SIZE - sizeof(uint32_t));
+        const std::size_t entry_size = sizeof(length) + length;
+        auto size = this->last_->size.load(std::memory_order_relaxed);
+        if (size + entry_size > STRING_CHUNK_SIZE) {
+            auto chunk = new Chunk{};
+            this->last_->next.store(chunk, std::memory_order_release);
+            this->last_ = chunk;
+            size = 0;
+        }
+        std::memcpy(this->last_->data.data() + size, &length, sizeof(length));
+        std::memcpy(this->last_->data.data() + size + sizeof(length), string.data(), length);
+        this->last_->size.store(size + entry_size, std::memory_order_release);
+        return this->ids_.emplace(std::string(string), this->ids_.size()).first->second;
+    }
+
+    bool write(int file_descriptor) const {
+        for (auto chunk = this->first_; chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire)) {
+            if (not write_section(
+                    file_descriptor, SectionType::STRINGS, chunk->data.data(), chunk->size.load(std::memory_order_acquire))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+   private:
+    struct Chunk {
+        std::atomic<std::size_t> size = 0;
+        std::atomic<Chunk*> next = nullptr;
+        std::array<char, STRING_CHUNK_SIZE> data;
+    };
+
+    std::mutex mutex_;
+    Chunk* const first_;
+    Chunk* last_;
+    std::unordered_map<std::string, uint32_t> ids_;
+};
+
+template <typename Enum>
+void append_enum_names(std::vector<char>& enum_names, EnumId enum_id) {
+    for (const auto& [value, name] : magic_enum::enum_entries<Enum>()) {
+        const uint16_t length = name.size();
+        enum_names.push_back(static_cast<char>(enum_id));
+        enum_names.push_back(static_cast<char>(value));
+        enum_names.insert(enum_names.end(), reinterpret_cast<const char*>(&length), reinterpret_cast<const char*>(&length) + sizeof(length));
+        enum_names.insert(enum_names.end(), name.begin(), name.end());
     }
-    output_file_stream << std::endl;
 }
 
-std::size_t write_header(
-    std::ofstream& output_file_stream,
-    const std::size_t num_attributes,
-    const std::size_t num_input_tensors,
-    const std::size_t num_dimensions) {
-    auto column_names = std::vector<std::string>{"Opcode", "Composite Parent Names"};
+void handle_signal(int signal, siginfo_t* info, void* context);
 
-    for (auto attribute_index = 0; attribute_index < num_attributes; attribute_index++) {
-        column_names.push_back(fmt::format("Attribute {} Name", attribute_index));
-        column_names.push_back(fmt::format("Attribute {} Value", attribute_index));
+// Never destroyed, threads still running ops while the process exits keep appending to their rings
+class Recorder {
+   public:
+    Recorder() {
+        const char* file_name = std::getenv("OPERATION_HISTORY");
+        if (file_name == nullptr) {
+            return;
+        }
+        TT_FATAL(std::strlen(file_name) < this->file_name_.size(), "OPERATION_HISTORY path is too long");
+        std::strncpy(this->file_name_.data(), file_name, this->file_name_.size() - 1);
+        if (const char* capacity = std::getenv("OPERATION_HISTORY_CAPACITY"); capacity != nullptr) {
+            this->capacity_ = std::stoul(capacity);
+            TT_FATAL(this->capacity_ > 0, "OPERATION_HISTORY_CAPACITY has to be positive");
+        }
+
+        append_enum_names<StorageType>(this->enum_names_, EnumId::STORAGE_TYPE);
+        append_enum_names<DataType>(this->enum_names_, EnumId::DATA_TYPE);
+        append_enum_names<Layout>(this->enum_names_, EnumId::LAYOUT);
+        append_enum_names<TensorMemoryLayout>(this->enum_names_, EnumId::MEMORY_LAYOUT);
+        append_enum_names<BufferType>(this->enum_names_, EnumId::BUFFER_TYPE);
+
+        this->enabled_ = true;
+        std::atexit([] { get_recorder().dump(get_recorder().file_name_.data()); });
+        // Handlers installed before keep running after the dump
+        struct sigaction action {};
+        action.sa_sigaction = handle_signal;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        TT_FATAL(sigaction(SIGUSR2, &action, &this->previous_signal_action_) == 0, "Failed to install the SIGUSR2 handler");
+        tt::log_info(tt::LogOp, "Operation History: recording the last {} operations of each thread to {}", this->capacity_, file_name);
     }
 
-    for (auto input_tensor_index = 0; input_tensor_index < num_input_tensors; input_tensor_index++) {
-        column_names.push_back(fmt::format("Input Tensor {} Storage Type", input_tensor_index));
-        for (auto dimension_index = 0; dimension_index < num_dimensions; dimension_index++) {
-            column_names.push_back(fmt::format("Input Tensor {} Shape {}", input_tensor_index, dimension_index));
+    static Recorder& get_recorder() {
+        static Recorder* recorder = new Recorder();
+        return *recorder;
+    }
+
+    bool enabled() const { return this->enabled_; }
+
+    const char* file_name() const { return this->file_name_.data(); }
+
+    const struct sigaction& previous_signal_action() const { return this->previous_signal_action_; }
+
+    uint64_t next_index() { return this->next_index_.fetch_add(1, std::memory_order_relaxed); }
+
+    StringTable& strings() { return this->strings_; }
+
+    Ring* create_ring() {
+        std::unique_lock lock(this->rings_mutex_);
+        const auto index = this->num_rings_.load(std::memory_order_relaxed);
+        if (index >= MAX_RECORDED_THREADS) {
+            tt::log_warning(tt::LogOp, "Operation History: only the first {} threads running operations are recorded", MAX_RECORDED_THREADS);
+            return nullptr;
         }
-        column_names.push_back(fmt::format("Input Tensor {} Data Type", input_tensor_index));
-        column_names.push_back(fmt::format("Input Tensor {} Layout", input_tensor_index));
-        column_names.push_back(fmt::format("Input Tensor {} Memory Config", input_tensor_index));
+        this->rings_[index] = new Ring(index, this->capacity_);
+        this->num_rings_.store(index + 1, std::memory_order_release);
+        return this->rings_[index];
     }
 
-    write_row(output_file_stream, column_names.size(), column_names);
-    return column_names.size();
-}
+    // Rings of threads that keep running ops while they are written may end with a partially written record
+    bool dump(const char* file_name) const {
+        int file_descriptor = ::open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (file_descriptor < 0) {
+            return false;
+        }
+        FileHeader header{
+            .magic = MAGIC,
+            .version = VERSION,
+            .record_size = sizeof(OperationRecord),
+            .max_input_tensors = MAX_INPUT_TENSORS,
+            .max_num_dimensions = MAX_NUM_DIMENSIONS};
+        bool success = write_all(file_descriptor, &header, sizeof(header)) and
+                       write_section(file_descriptor, SectionType::ENUM_NAMES, this->enum_names_.data(), this->enum_names_.size()) and
+                       this->strings_.write(file_descriptor);
 
-void write_record(
-    std::ofstream& output_file_stream,
-    const std::size_t num_columns,
-    const OperationRecord& record,
-    const std::size_t num_attributes,
-    const std::size_t num_input_tensors,
-    const std::size_t num_dimensions) {
-    std::vector<std::string> row;
-    row.reserve(num_columns);
-
-    row.push_back(record.opcode);
-    row.push_back(fmt::format("{}", record.composite_parent_names));
-    for (auto attribute_index = 0; attribute_index < num_attributes; attribute_index++) {
-        if (attribute_index < record.attributes.size()) {
-            const auto& [name, value] = record.attributes.at(attribute_index);
-            row.push_back(fmt::format("{}", name));
-            row.push_back(fmt::format("{}", value));
-        } else {
-            row.push_back("");
-            row.push_back("");
+        const auto num_rings = this->num_rings_.load(std::memory_order_acquire);
+        for (uint32_t index = 0; success and index < num_rings; index++) {
+            const auto& ring = *this->rings_[index];
+            RingHeader ring_header{.thread_index = ring.thread_index(), .capacity = ring.capacity(), .num_records = ring.head()};
+            const auto num_records_written = std::min<uint64_t>(ring_header.num_records, ring_header.capacity);
+            SectionHeader section_header{
+                .type = static_cast<uint32_t>(SectionType::RING),
+                .reserved = 0,
+                .size = sizeof(ring_header) + num_records_written * sizeof(OperationRecord)};
+            success = write_all(file_descriptor, &section_header, sizeof(section_header)) and
+                      write_all(file_descriptor, &ring_header, sizeof(ring_header)) and
+                      write_all(file_descriptor, ring.records(), num_records_written * sizeof(OperationRecord));
         }
+        return ::close(file_descriptor) == 0 and success;
     }
-    for (auto input_tensor_index = 0; input_tensor_index < num_input_tensors; input_tensor_index++) {
-        if (input_tensor_index < record.input_tensor_records.size()) {
-            const auto& tensor_record = record.input_tensor_records.at(input_tensor_index);
-            row.push_back(fmt::format("{}", tensor_record.storage_type));
-            for (auto dimension_index = 0; dimension_index < num_dimensions; dimension_index++) {
-                if (dimension_index < tensor_record.shape.rank()) {
-                    row.push_back(fmt::format("{}", tensor_record.shape[dimension_index]));
-                } else {
-                    row.push_back("");
-                }
-            }
-            row.push_back(fmt::format("{}", tensor_record.data_type));
-            row.push_back(fmt::format("{}", tensor_record.layout));
-            row.push_back(fmt::format("{}", tensor_record.memory_config));
-        } else {
-            row.push_back("");
-            for (auto dimension_index = 0; dimension_index < num_dimensions; dimension_index++) {
-                row.push_back("");
-            }
-            row.push_back("");
-            row.push_back("");
-            row.push_back("");
+
+   private:
+    bool enabled_ = false;
+    std::array<char, PATH_MAX> file_name_{};
+    struct sigaction previous_signal_action_ {};
+    uint32_t capacity_ = DEFAULT_CAPACITY;
+    std::vector<char> enum_names_;
+    std::atomic<uint64_t> next_index_ = 0;
+    StringTable strings_;
+
+    std::mutex rings_mutex_;
+    std::array<Ring*, MAX_RECORDED_THREADS> rings_{};
+    std::atomic<uint32_t> num_rings_ = 0;
+};
+
+void handle_signal(int signal, siginfo_t* info, void* context) {
+    auto& recorder = Recorder::get_recorder();
+    recorder.dump(recorder.file_name());
+
+    // The default action of SIGUSR2 terminates the process, it is replaced rather than chained so a dump can be taken
+    // of a running process
+    const auto& previous_action = recorder.previous_signal_action();
+    if (previous_action.sa_flags & SA_SIGINFO) {
+        if (previous_action.sa_sigaction != nullptr) {
+            previous_action.sa_sigaction(signal, info, context);
         }
+    } else if (previous_action.sa_handler != SIG_DFL and previous_action.sa_handler != SIG_IGN) {
+        previous_action.sa_handler(signal);
     }
-    write_row(output_file_stream, num_columns, row);
 }
 
-void OperationHistory::dump_to_csv() {
-    std::ofstream output_file_stream(csv_file_name());
+}  // namespace
 
-    std::size_t num_attributes = 0;
-    for (const auto& record : this->records) {
-        num_attributes = std::max(num_attributes, record.attributes.size());
-    }
+ThreadState& get_thread_state() {
+    thread_local ThreadState thread_state{.ring = Recorder::get_recorder().create_ring()};
+    return thread_state;
+}
+
+uint64_t next_index() { return Recorder::get_recorder().next_index(); }
 
-    std::size_t num_input_tensors = 0;
-    std::size_t num_dimensions = 0;
-    for (const auto& record : this->records) {
-        num_input_tensors = std::max(num_input_tensors, record.input_tensor_records.size());
-        for (const auto& input_tensor_record : record.input_tensor_records) {
-            num_dimensions = std::max(num_dimensions, input_tensor_record.shape.rank());
+std::pair<uint32_t, uint32_t> intern_operation(
+    const std::string& opcode, const tt::stl::reflection::Attributes& attributes) {
+    auto& strings = Recorder::get_recorder().strings();
+    return {strings.intern(opcode), strings.intern(fmt::format("{}", attributes))};
+}
+
+uint32_t intern_composite_parent_names(const std::vector<const char*>& composite_parent_names) {
+    std::string names;
+    for (auto name : composite_parent_names) {
+        if (not names.empty()) {
+            names += '/';
         }
+        names += name;
     }
+    return Recorder::get_recorder().strings().intern(names);
+}
 
-    auto num_columns = write_header(output_file_stream, num_attributes, num_input_tensors, num_dimensions);
-    for (const auto& record : this->records) {
-        write_record(output_file_stream, num_columns, record, num_attributes, num_input_tensors, num_dimensions);
+TensorRecord create_tensor_record(const Tensor& tensor) {
+    TensorRecord record{
+        .storage_type = static_cast<uint8_t>(tensor.storage_type()),
+        .data_type = static_cast<uint8_t>(tensor.dtype()),
+        .layout = static_cast<uint8_t>(tensor.layout()),
+        .memory_layout = NO_MEMORY_CONFIG,
+        .buffer_type = NO_MEMORY_CONFIG};
+    const auto& shape = tensor.shape();
+    record.rank = shape.rank();
+    for (uint32_t dim = 0; dim < record.rank; dim++) {
+        record.shape[dim] = shape[dim];
     }
+    if (tensor.storage_type() == StorageType::DEVICE) {
+        const auto memory_config = tensor.memory_config();
+        record.memory_layout = static_cast<uint8_t>(memory_config.memory_layout);
+        record.buffer_type = static_cast<uint8_t>(memory_config.buffer_type);
+    }
+    return record;
 }
 
 }  // namespace detail
 
-const char* csv_file_name() {
-    return std::getenv("OPERATION_HISTORY_CSV");
+bool enabled() { return detail::Recorder::get_recorder().enabled(); }
+
+void dump() {
+    TT_FATAL(enabled(), "Operation history is only recorded when OPERATION_HISTORY is set");
+    dump(detail::Recorder::get_recorder().file_name());
 }
 
-bool enabled() {
-    return csv_file_name() != nullptr;
+void dump(const std::string& file_name) {
+    TT_FATAL(enabled(), "Operation history is only recorded when OPERATION_HISTORY is set");
+    TT_FATAL(detail::Recorder::get_recorder().dump(file_name.c_str()), "Failed to write the operation history to {}", file_name);
 }
 
 }  // namespace operation_history
 
-#endif
-
 }  // namespace tt_metal
 
 }  // namespace tt
@@ -2,8 +2,26 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+//
+// History of the operations run by each thread, recorded in all builds when OPERATION_HISTORY=<file_path> is set.
+// Each thread appends fixed size binary records to its own ring, which keeps its last OPERATION_HISTORY_CAPACITY
+// operations. Opcodes, attributes and composite parent names are interned once into a shared table of strings, so an
+// append only takes the lock of that table the first time an operation is seen by a thread, operations are told apart
+// by attributes_hash. The rings are written to the file at exit, on SIGUSR2 and by dump().
+// tt_eager/decode_operation_history.py decodes the file into CSV or JSON.
+//
+
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <tt_eager/tensor/tensor.hpp>
 #include "tt_dnn/op_library/operation.hpp"
 
@@ -11,60 +29,173 @@ namespace tt {
 
 namespace tt_metal {
 
-#ifdef DEBUG
-
 namespace operation_history {
 
+// The layout of the records is part of the file format, VERSION has to be bumped when it changes
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t MAX_INPUT_TENSORS = 6;
+constexpr uint8_t NO_MEMORY_CONFIG = 0xFF;
+// Entries of the per-thread maps of interned ids, the maps are cleared when full
+constexpr std::size_t MAX_CACHED_IDS = 4096;
+
+enum class OperationType : uint8_t { HOST = 0, DEVICE = 1, EXTERNAL = 2 };
+
 struct TensorRecord {
-    const StorageType storage_type;
-    const Shape shape;
-    const DataType data_type;
-    const Layout layout;
-    const std::optional<MemoryConfig> memory_config;
-
-    static constexpr auto attribute_names = std::make_tuple("storage_type", "shape", "data_type", "layout", "memory_config");
-    const auto attribute_values() const {
-        return std::make_tuple(
-            std::cref(this->storage_type), std::cref(this->shape), std::cref(this->data_type), std::cref(this->layout), std::cref(this->memory_config));
-    }
+    uint8_t storage_type;
+    uint8_t data_type;
+    uint8_t layout;
+    uint8_t rank;
+    // NO_MEMORY_CONFIG unless the tensor is on device
+    uint8_t memory_layout;
+    uint8_t buffer_type;
+    uint8_t reserved[2];
+    uint32_t shape[MAX_NUM_DIMENSIONS];
 };
+static_assert(sizeof(TensorRecord) == 40);
 
 struct OperationRecord {
-    const std::string opcode;
-    const tt::stl::reflection::Attributes attributes;
-    const std::vector<TensorRecord> input_tensor_records;
-    const std::vector<const char*> composite_parent_names{};
+    // Order of the operation across all threads
+    uint64_t index;
+    uint64_t timestamp_ns;
+    // Ids of interned strings, 0 is the empty string
+    uint32_t opcode;
+    uint32_t attributes;
+    uint32_t composite_parent_names;
+    uint8_t operation_type;
+    // Including the input tensors that didn't fit in the record
+    uint8_t num_input_tensors;
+    uint8_t reserved[2];
+    TensorRecord input_tensors[MAX_INPUT_TENSORS];
 };
+static_assert(sizeof(OperationRecord) == 32 + MAX_INPUT_TENSORS * sizeof(TensorRecord));
 
 namespace detail {
 
-struct OperationHistory {
+// Written by its thread only, read by dumps from any thread or signal handler
+class Ring {
+   public:
+    Ring(uint32_t thread_index, uint32_t capacity) : thread_index_(thread_index), records_(capacity) {}
+
+    OperationRecord& next() { return this->records_[this->head_.load(std::memory_order_relaxed) % this->records_.size()]; }
+
+    void commit() { this->head_.store(this->head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
 
-    ~OperationHistory();
+    uint32_t thread_index() const { return this->thread_index_; }
+    uint32_t capacity() const { return this->records_.size(); }
+    // Number of records appended since the ring was created
+    uint64_t head() const { return this->head_.load(std::memory_order_acquire); }
+    const OperationRecord* records() const { return this->records_.data(); }
 
-    void append(OperationRecord&& record);
-    void dump_to_csv();
+   private:
+    const uint32_t thread_index_;
+    std::atomic<uint64_t> head_ = 0;
+    std::vector<OperationRecord> records_;
+};
 
-  private:
-    std::vector<OperationRecord> records;
+struct ThreadState {
+    // Null if every ring is taken
+    Ring* ring = nullptr;
+    // Ids already interned by this thread
+    std::unordered_map<operation::Hash, std::pair<uint32_t, uint32_t>> operations;
+    std::unordered_map<operation::Hash, uint32_t> composite_parent_names;
 };
 
-inline OperationHistory OPERATION_HISTORY{};
+ThreadState& get_thread_state();
 
-}
+uint64_t next_index();
+
+// Returns the ids of the opcode and of the attributes
+std::pair<uint32_t, uint32_t> intern_operation(
+    const std::string& opcode, const tt::stl::reflection::Attributes& attributes);
 
-template<typename ... Args>
-inline void append(Args&& ... args) {
-    detail::OPERATION_HISTORY.append(std::forward<Args>(args)...);
+uint32_t intern_composite_parent_names(const std::vector<const char*>& composite_parent_names);
+
+TensorRecord create_tensor_record(const Tensor& tensor);
+
+template <typename T>
+constexpr OperationType get_operation_type() {
+    if constexpr (std::is_same_v<T, operation::HostOperation>) {
+        return OperationType::HOST;
+    } else if constexpr (std::is_same_v<T, operation::DeviceOperation>) {
+        return OperationType::DEVICE;
+    } else {
+        return OperationType::EXTERNAL;
+    }
 }
 
-const char* csv_file_name();
+}  // namespace detail
 
 bool enabled();
 
-}  // namespace operation_history
+template <typename T>
+void append(
+    const T& operation,
+    const std::vector<const char*>& composite_parent_names,
+    const std::vector<Tensor>& input_tensors,
+    const std::vector<std::optional<const Tensor>>& optional_input_tensors = {}) {
+    auto& thread_state = detail::get_thread_state();
+    if (thread_state.ring == nullptr) {
+        return;
+    }
+    auto& record = thread_state.ring->next();
+    record.index = detail::next_index();
+    record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    const auto operation_hash = operation.attributes_hash(input_tensors, optional_input_tensors);
+    auto operation_ids = thread_state.operations.find(operation_hash);
+    if (operation_ids == thread_state.operations.end()) {
+        if (thread_state.operations.size() >= MAX_CACHED_IDS) {
+            thread_state.operations.clear();
+        }
+        operation_ids = thread_state.operations.emplace(
+            operation_hash, detail::intern_operation(operation.get_type_name(), operation.attributes())).first;
+    }
+    std::tie(record.opcode, record.attributes) = operation_ids->second;
+
+    // Composite op names are string literals, so their addresses identify them
+    record.composite_parent_names = 0;
+    if (not composite_parent_names.empty()) {
+        operation::Hash names_hash = 0;
+        for (auto name : composite_parent_names) {
+            names_hash = stl::hash::hash_objects(names_hash, reinterpret_cast<std::uintptr_t>(name));
+        }
+        auto names_id = thread_state.composite_parent_names.find(names_hash);
+        if (names_id == thread_state.composite_parent_names.end()) {
+            if (thread_state.composite_parent_names.size() >= MAX_CACHED_IDS) {
+                thread_state.composite_parent_names.clear();
+            }
+            names_id = thread_state.composite_parent_names.emplace(
+                names_hash, detail::intern_composite_parent_names(composite_parent_names)).first;
+        }
+        record.composite_parent_names = names_id->second;
+    }
 
-#endif
+    record.operation_type = static_cast<uint8_t>(detail::get_operation_type<T>());
+    uint32_t num_input_tensors = 0;
+    auto append_tensor = [&record, &num_input_tensors](const Tensor& tensor) {
+        if (num_input_tensors < MAX_INPUT_TENSORS) {
+            record.input_tensors[num_input_tensors] = detail::create_tensor_record(tensor);
+        }
+        num_input_tensors++;
+    };
+    for (const auto& tensor : input_tensors) {
+        append_tensor(tensor);
+    }
+    for (const auto& tensor : optional_input_tensors) {
+        if (tensor.has_value()) {
+            append_tensor(tensor.value());
+        }
+    }
+    record.num_input_tensors = std::min<uint32_t>(num_input_tensors, std::numeric_limits<uint8_t>::max());
+    thread_state.ring->commit();
+}
+
+// Writes the history of every thread, to the file set by OPERATION_HISTORY by default
+void dump();
+void dump(const std::string& file_name);
+
+}  // namespace operation_history
 
 }  // namespace tt_metal
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <list>
+
 #include <tt_eager/tensor/tensor.hpp>
 #include "tt_dnn/op_library/auto_format.hpp"
 #include "tt_dnn/op_library/operation.hpp"
@@ -14,25 +16,84 @@ namespace tt::tt_metal {
 
 namespace program_cache {
 
+enum class EvictionPolicy {
+    LRU = 0,
+    LFU = 1,
+};
+
+// A limit of 0 means unbounded
+struct ProgramCacheConfig {
+    std::size_t max_entries = 0;
+    std::size_t max_bytes = 0;
+    EvictionPolicy eviction_policy = EvictionPolicy::LRU;
+};
+
+struct ProgramCacheStatistics {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+    std::size_t evictions = 0;
+    // Misses on a key that had been evicted before, a high count means the cache is too small for the workload
+    std::size_t reinsertions = 0;
+    std::size_t num_entries = 0;
+    // Size of the compiled kernel binaries held by cached programs. The same binaries are mirrored in device DRAM
+    // under fast dispatch, so this also estimates the device footprint
+    std::size_t estimated_bytes = 0;
+};
+
+struct ProgramCacheKey {
+    chip_id_t device_id;
+    operation::Hash program_hash;
+
+    bool operator==(const ProgramCacheKey& other) const {
+        return this->device_id == other.device_id and this->program_hash == other.program_hash;
+    }
+};
+
+struct ThrashingProgram {
+    ProgramCacheKey key;
+    std::size_t evictions;
+};
+
 namespace detail {
 
+struct ProgramCacheKeyHash {
+    std::size_t operator()(const ProgramCacheKey& key) const {
+        return std::hash<operation::Hash>{}(key.program_hash) ^ (std::hash<chip_id_t>{}(key.device_id) << 1);
+    }
+};
+
 struct ProgramCache {
     inline std::tuple<operation::ProgramWithCallbacks&, bool> get_or_create(
         const operation::DeviceOperation& op,
+        Device* device,
         const std::vector<Tensor>& input_tensors,
         const std::vector<std::optional<const Tensor>>& optional_input_tensors,
         std::vector<Tensor>& output_tensors) {
         auto program_hash = op.compute_program_hash(input_tensors, optional_input_tensors);
-        auto cache_hit = this->cache_.count(program_hash) > 0;
-        if (cache_hit) {
+        auto key = ProgramCacheKey{.device_id = device->id(), .program_hash = program_hash};
+        auto it = this->index_.find(key);
+        if (it != this->index_.end()) {
             tt::log_debug(tt::LogOp, "Program Cache: HIT - Getting program from the cache with hash \"{}\"", program_hash);
-            auto& program = this->cache_.at(program_hash);
-            return {program, cache_hit};
+            this->statistics_.hits++;
+            auto entry = it->second;
+            entry->use_count++;
+            // Most recently used entries live at the front
+            this->entries_.splice(this->entries_.begin(), this->entries_, entry);
+            return {entry->program_with_callbacks, true};
         } else {
             tt::log_debug(tt::LogOp, "Program Cache: MISS - Compiling new program with hash \"{}\"", program_hash);
-            this->cache_[program_hash] = op.create_program(input_tensors, optional_input_tensors, output_tensors);
-            auto& program = this->cache_[program_hash].program;
-            return {this->cache_[program_hash], cache_hit};
+            this->statistics_.misses++;
+            if (this->eviction_counts_.count(key)) {
+                this->statistics_.reinsertions++;
+            }
+            // Evict before inserting so the returned reference always stays valid
+            this->evict(this->config_.max_entries == 0 ? 0 : this->config_.max_entries - 1);
+            this->entries_.push_front(Entry{
+                .key = key,
+                .device = device,
+                .program_with_callbacks = op.create_program(input_tensors, optional_input_tensors, output_tensors)});
+            this->index_[key] = this->entries_.begin();
+            return {this->entries_.front().program_with_callbacks, false};
         }
     }
 
@@ -48,15 +109,118 @@ struct ProgramCache {
         return this->is_enabled_;
     }
 
+    void configure(const ProgramCacheConfig& config) {
+        this->config_ = config;
+        this->evict(this->config_.max_entries);
+    }
+
+    const ProgramCacheConfig& config() const { return this->config_; }
+
     void clear() {
-        this->cache_.clear();
+        this->entries_.clear();
+        this->index_.clear();
+        this->eviction_counts_.clear();
+        this->statistics_ = ProgramCacheStatistics{};
     }
 
-    inline std::size_t num_entries() const { return this->cache_.size(); }
+    inline std::size_t num_entries() const { return this->entries_.size(); }
+
+    ProgramCacheStatistics statistics() {
+        auto statistics = this->statistics_;
+        statistics.num_entries = this->entries_.size();
+        statistics.estimated_bytes = this->estimated_bytes();
+        return statistics;
+    }
+
+    std::vector<ThrashingProgram> thrashing_programs(std::size_t min_evictions) const {
+        std::vector<ThrashingProgram> programs;
+        for (const auto& [key, evictions] : this->eviction_counts_) {
+            if (evictions >= min_evictions) {
+                programs.push_back({key, evictions});
+            }
+        }
+        std::sort(programs.begin(), programs.end(), [](const auto& a, const auto& b) { return a.evictions > b.evictions; });
+        return programs;
+    }
 
    private:
+    struct Entry {
+        ProgramCacheKey key;
+        Device* device;
+        operation::ProgramWithCallbacks program_with_callbacks;
+        std::size_t use_count = 1;
+        // Programs are compiled on first enqueue, after they enter the cache, so the size is filled in lazily
+        std::size_t size_bytes = 0;
+    };
+    using EntryIterator = std::list<Entry>::iterator;
+
+    std::size_t entry_size_bytes(Entry& entry) {
+        if (entry.size_bytes == 0) {
+            entry.size_bytes = entry.program_with_callbacks.program.binaries_size_bytes(entry.device->id());
+        }
+        return entry.size_bytes;
+    }
+
+    std::size_t estimated_bytes() {
+        std::size_t total_bytes = 0;
+        for (auto& entry : this->entries_) {
+            total_bytes += this->entry_size_bytes(entry);
+        }
+        return total_bytes;
+    }
+
+    EntryIterator select_victim() {
+        // entries_ is ordered most to least recently used
+        auto victim = std::prev(this->entries_.end());
+        if (this->config_.eviction_policy == EvictionPolicy::LFU) {
+            for (auto it = victim; it != this->entries_.begin();) {
+                --it;
+                if (it->use_count < victim->use_count) {
+                    victim = it;
+                }
+            }
+        }
+        return victim;
+    }
+
+    // Evicts until at most max_entries remain (0 means no entry limit) and the byte limit is respected
+    void evict(std::size_t max_entries) {
+        if (this->config_.max_entries == 0 and this->config_.max_bytes == 0) {
+            return;
+        }
+        std::size_t total_bytes = this->config_.max_bytes != 0 ? this->estimated_bytes() : 0;
+        auto over_limit = [this, max_entries, &total_bytes] {
+            if (this->entries_.empty()) {
+                return false;
+            }
+            if (this->config_.max_entries != 0 and this->entries_.size() > max_entries) {
+                return true;
+            }
+            return this->config_.max_bytes != 0 and total_bytes > this->config_.max_bytes;
+        };
+        while (over_limit()) {
+            auto victim = this->select_victim();
+            total_bytes -= std::min(total_bytes, victim->size_bytes);
+            tt::log_debug(
+                tt::LogOp,
+                "Program Cache: EVICT - Removing program with hash \"{}\" for device {}",
+                victim->key.program_hash,
+                victim->key.device_id);
+            tt::tt_metal::detail::ReleaseCommandQueueProgram(
+                victim->device, victim->program_with_callbacks.program.get_id());
+            this->eviction_counts_[victim->key]++;
+            this->statistics_.evictions++;
+            this->index_.erase(victim->key);
+            this->entries_.erase(victim);
+        }
+    }
+
     bool is_enabled_ = false;
-    std::unordered_map<operation::Hash, operation::ProgramWithCallbacks> cache_{};
+    ProgramCacheConfig config_{};
+    ProgramCacheStatistics statistics_{};
+    std::list<Entry> entries_{};
+    std::unordered_map<ProgramCacheKey, EntryIterator, ProgramCacheKeyHash> index_{};
+    std::unordered_map<ProgramCacheKey, std::size_t, ProgramCacheKeyHash> eviction_counts_{};
 };
 
 inline ProgramCache PROGRAM_CACHE{};
@@ -83,6 +247,22 @@ inline void disable_and_clear() {
 }
 
 inline std::size_t num_entries() { return detail::PROGRAM_CACHE.num_entries(); }
+
+inline void configure(const ProgramCacheConfig& config) {
+    tt::log_info(
+        tt::LogOp,
+        "Program Cache: max entries {}, max bytes {}, eviction policy {}.",
+        config.max_entries,
+        config.max_bytes,
+        magic_enum::enum_name(config.eviction_policy));
+    detail::PROGRAM_CACHE.configure(config);
+}
+
+inline ProgramCacheStatistics statistics() { return detail::PROGRAM_CACHE.statistics(); }
+
+inline std::vector<ThrashingProgram> thrashing_programs(std::size_t min_evictions = 1) {
+    return detail::PROGRAM_CACHE.thrashing_programs(min_evictions);
+}
 }
 
 }
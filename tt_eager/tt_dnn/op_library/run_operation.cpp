@@ -25,7 +25,7 @@ bool is_logging_enabled() {
         enabled |= std::string{std::getenv("TT_METAL_LOGGER_TYPES")} == "Op" and
                    std::string{std::getenv("TT_METAL_LOGGER_LEVEL")} == "DEBUG";
     }
-    enabled |= std::getenv("OPERATION_HISTORY_CSV") != nullptr;
+    enabled |= operation_history::enabled();
     return enabled;
 }
 
@@ -76,10 +76,14 @@ void setup_profiler(const HostOperation& operation, const std::vector<Tensor>& i
     if (profiler_info.preferred_name.has_value()) {
         op_profiler::set_preferred_name(profiler_info.preferred_name.value());
     }
-    op_profiler::append_meta_data(fmt::format("{}", operation.attributes()));
+    op_profiler::append_attributes(operation, input_tensors, std::vector<std::optional<const Tensor>>{});
 }
 
-void setup_profiler(const DeviceOperation& operation, const std::vector<Tensor>& input_tensors, const Program& program) {
+void setup_profiler(
+    const DeviceOperation& operation,
+    const std::vector<Tensor>& input_tensors,
+    const std::vector<std::optional<const Tensor>>& optional_input_tensors,
+    const Program& program) {
     auto profiler_info = operation.create_profiler_info(input_tensors);
     if (profiler_info.preferred_name.has_value()) {
         op_profiler::set_preferred_name(profiler_info.preferred_name.value());
@@ -89,7 +93,7 @@ void setup_profiler(const DeviceOperation& operation, const std::vector<Tensor>&
     }
 
     op_profiler::append_math_fidelities(program);
-    op_profiler::append_meta_data(fmt::format("{}", operation.attributes()));
+    op_profiler::append_attributes(operation, input_tensors, optional_input_tensors);
 }
 
 template <typename OperationType>
@@ -169,7 +173,7 @@ std::vector<Tensor> run_device_operation(
                                    const std::vector<std::optional<const Tensor>>& optional_input_tensors,
                                    std::vector<Tensor>& output_tensors) -> std::reference_wrapper<Program> {
             auto&& [program_with_callbacks, cache_hit] =
-                program_cache::get_or_create(operation, input_tensors, optional_input_tensors, output_tensors);
+                program_cache::get_or_create(operation, detail::get_device(input_tensors, optional_input_tensors), input_tensors, optional_input_tensors, output_tensors);
             TT_ASSERT(program_with_callbacks.supports_program_cache());
 
             auto& program = program_with_callbacks.program;
@@ -216,7 +220,7 @@ std::vector<Tensor> run_device_operation(
 
             auto do_profile = op_profiler::get_profiler_flag();
             if (do_profile) {
-                detail::setup_profiler(operation, input_tensors, program);
+                detail::setup_profiler(operation, input_tensors, optional_input_tensors, program);
             }
 
             if (USE_FAST_DISPATCH) {
@@ -9,6 +9,7 @@
 
 #include "third_party/magic_enum/magic_enum.hpp"
 #include "tt_dnn/op_library/auto_format.hpp"
+#include "tt_dnn/op_library/buffer_plan_cache.hpp"
 #include "tt_dnn/op_library/operation.hpp"
 #include "tt_dnn/op_library/operation_history.hpp"
 #include "tt_stl/concepts.hpp"
@@ -99,9 +100,17 @@ struct CompositeOperation {
     std::function<ReturnType(Args...)> function;
 
     constexpr ReturnType operator()(Args... args) const {
+        // Nested composite ops are part of the buffer plan of the outermost one
+        std::optional<buffer_plan_cache::Scope> buffer_plan_scope;
+        if (buffer_plan_cache::is_enabled() and not run_operation_state::is_composite_operation()) {
+            buffer_plan_scope.emplace(this->name, args...);
+        }
         run_operation_state::push_composite_parent_name(this->name);
         ReturnType output = this->function(args...);
         run_operation_state::pop_composite_parent_name();
+        if (buffer_plan_scope.has_value()) {
+            buffer_plan_scope->finish();
+        }
         return output;
     }
 };
@@ -134,59 +143,6 @@ constexpr std::string operation_type_to_string() {
     }
 }
 
-static operation_history::TensorRecord create_tensor_record(const Tensor& tensor) {
-    return std::visit(
-        [&] (const auto& storage) -> operation_history::TensorRecord {
-            using T = std::decay_t<decltype(storage)>;
-            if constexpr (std::is_same_v<T, OwnedStorage>) {
-                return operation_history::TensorRecord{
-                    tensor.storage_type(), tensor.shape(), tensor.dtype(), tensor.layout(), std::nullopt
-                };
-            }
-            else if constexpr (std::is_same_v<T, DeviceStorage>) {
-                return operation_history::TensorRecord{
-                    tensor.storage_type(), tensor.shape(), tensor.dtype(), tensor.layout(), tensor.memory_config()};
-            }
-            else if constexpr (std::is_same_v<T, BorrowedStorage>) {
-                return operation_history::TensorRecord{
-                    tensor.storage_type(), tensor.shape(), tensor.dtype(), tensor.layout()
-                };
-            }
-            else {
-                raise_unsupported_storage<T>();
-            }
-        },
-        tensor.storage()
-    );
-}
-
-template<typename OperationType>
-static void append_operation_to_operation_history(
-    const OperationType& operation,
-    const std::vector<Tensor>& input_tensors,
-    const std::vector<std::optional<const Tensor>>& optional_input_tensors) {
-
-    std::vector<operation_history::TensorRecord> input_tensor_records;
-    input_tensor_records.reserve(input_tensors.size() + optional_input_tensors.size());
-
-    for (const auto& tensor : input_tensors) {
-        input_tensor_records.emplace_back(create_tensor_record(tensor));
-    }
-    for (const auto& tensor : optional_input_tensors) {
-        if (tensor.has_value()) {
-            input_tensor_records.emplace_back(create_tensor_record(tensor.value()));
-        }
-    }
-    operation_history::append(
-        operation_history::OperationRecord{
-            operation.get_type_name(),
-            operation.attributes(),
-            input_tensor_records,
-            run_operation_state::get_composite_parent_names()
-        }
-    );
-}
-
 }  // namespace detail
 
 template<typename OperationType>
@@ -228,7 +184,8 @@ inline void log_operation(
     tt::log_debug(tt::LogOp, "");
 
     if (operation_history::enabled()) {
-        detail::append_operation_to_operation_history(operation, input_tensors, optional_input_tensors);
+        operation_history::append(
+            operation, run_operation_state::get_composite_parent_names(), input_tensors, optional_input_tensors);
     }
 }
 #else
@@ -237,7 +194,12 @@ template <typename OperationType>
 inline void log_operation(
     const OperationType& operation,
     const std::vector<Tensor>& input_tensors,
-    const std::vector<std::optional<const Tensor>>& optional_input_tensors = {}) {}
+    const std::vector<std::optional<const Tensor>>& optional_input_tensors = {}) {
+    if (operation_history::enabled()) {
+        operation_history::append(
+            operation, run_operation_state::get_composite_parent_names(), input_tensors, optional_input_tensors);
+    }
+}
 #endif
 
 bool is_logging_enabled();
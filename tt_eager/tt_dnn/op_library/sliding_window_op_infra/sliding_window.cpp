@@ -0,0 +1,263 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_dnn/op_library/sliding_window_op_infra/sliding_window.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "tt_metal/common/assert.hpp"
+#include "tt_metal/tt_stl/concepts.hpp"
+#include "tt_metal/tt_stl/reflection.hpp"
+
+namespace tt {
+namespace tt_metal {
+namespace sliding_window {
+
+namespace {
+
+constexpr uint32_t NUM_NEIGHBORS = 2 * NEIGHBORHOOD_DIST + 1;
+
+// Index of the first padded input stick read by the sliding window producing output stick output_index
+uint32_t input_top_left_index(const SlidingWindowConfig &config, uint32_t output_index) {
+    uint32_t output_hw = config.output_h() * config.output_w();
+    uint32_t n = output_index / output_hw;
+    uint32_t oh = (output_index % output_hw) / config.output_w();
+    uint32_t ow = output_index % config.output_w();
+    return n * config.padded_input_h() * config.padded_input_w() + oh * config.stride_h * config.padded_input_w() +
+           ow * config.stride_w;
+}
+
+std::vector<ShardBoundary> generate_shard_boundaries(const SlidingWindowConfig &config) {
+    uint32_t output_nhw = config.batch_size * config.output_h() * config.output_w();
+    uint32_t halo_nsticks = (config.window_h - 1) * config.padded_input_w() + config.window_w - 1;
+    std::vector<ShardBoundary> shard_boundaries;
+    shard_boundaries.reserve(config.num_cores_nhw);
+    for (uint32_t core = 0; core < config.num_cores_nhw; core++) {
+        uint32_t output_start = core * config.output_shard_height;
+        TT_FATAL(output_start < output_nhw, "Core {} has no output sticks, {} output sticks are split over {} cores", core, output_nhw, config.num_cores_nhw);
+        uint32_t output_end = std::min(output_start + config.output_shard_height, output_nhw) - 1;
+        shard_boundaries.push_back(ShardBoundary{
+            .output = {output_start, output_end},
+            .input = {input_top_left_index(config, output_start), input_top_left_index(config, output_end) + halo_nsticks}});
+    }
+    return shard_boundaries;
+}
+
+// A run of sticks that are all padding or all come from one source core
+struct Segment {
+    bool is_pad;
+    uint32_t src_core;
+    uint32_t neighbor;
+    uint32_t dst_start;
+    uint32_t size;
+};
+
+HaloKernelConfig generate_halo_kernel_config_for_shards(const SlidingWindowConfig &config, const std::vector<ShardBoundary> &shard_boundaries) {
+    uint32_t num_cores = config.num_cores_nhw;
+    uint32_t padded_input_h = config.padded_input_h();
+    uint32_t padded_input_w = config.padded_input_w();
+
+    // Data segments are grouped by the core that sends them, pad segments by the core that fills them
+    std::vector<std::array<std::vector<std::pair<uint32_t, uint32_t>>, NUM_NEIGHBORS>> data_segments(num_cores);
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> pad_segments(num_cores);
+    std::vector<std::array<int32_t, NUM_NEIGHBORS>> src_start_offsets(num_cores);
+    for (auto &offsets : src_start_offsets) {
+        offsets.fill(-1);
+    }
+
+    auto finish_segment = [&](const Segment &segment, uint32_t dst_core) {
+        if (segment.size == 0) {
+            return;
+        }
+        if (segment.is_pad) {
+            pad_segments[dst_core].emplace_back(segment.dst_start, segment.size);
+        } else {
+            data_segments[segment.src_core][segment.neighbor].emplace_back(segment.dst_start, segment.size);
+        }
+    };
+
+    uint32_t max_out_nsticks_per_core = 0;
+    for (uint32_t dst_core = 0; dst_core < num_cores; dst_core++) {
+        auto [input_start, input_end] = shard_boundaries[dst_core].input;
+        max_out_nsticks_per_core = std::max(max_out_nsticks_per_core, input_end - input_start + 1);
+
+        // Position of input_start in the padded input, advanced stick by stick instead of divided out each time
+        uint32_t n = input_start / (padded_input_h * padded_input_w);
+        uint32_t h = (input_start / padded_input_w) % padded_input_h;
+        uint32_t w = input_start % padded_input_w;
+
+        Segment segment{.is_pad = false, .src_core = 0, .neighbor = 0, .dst_start = 0, .size = 0};
+        for (uint32_t dst_local = 0; dst_local <= input_end - input_start; dst_local++) {
+            bool is_pad = h < config.pad_h or h >= config.input_h + config.pad_h or w < config.pad_w or w >= config.input_w + config.pad_w;
+            if (is_pad) {
+                if (segment.size == 0 or not segment.is_pad) {
+                    finish_segment(segment, dst_core);
+                    segment = Segment{.is_pad = true, .src_core = 0, .neighbor = 0, .dst_start = dst_local, .size = 0};
+                }
+            } else {
+                uint32_t input_index = (n * config.input_h + h - config.pad_h) * config.input_w + w - config.pad_w;
+                uint32_t src_core = input_index / config.input_shard_height;
+                uint32_t src_local = input_index % config.input_shard_height;
+                TT_FATAL(src_core < num_cores, "Input stick {} is outside of the {} input shards", input_index, num_cores);
+                TT_FATAL(
+                    src_core + NEIGHBORHOOD_DIST >= dst_core and dst_core + NEIGHBORHOOD_DIST >= src_core,
+                    "Core {} needs input from core {}, halo is limited to {} cores on either side", dst_core, src_core, NEIGHBORHOOD_DIST);
+                if (segment.size == 0 or segment.is_pad or segment.src_core != src_core) {
+                    finish_segment(segment, dst_core);
+                    uint32_t neighbor = NEIGHBORHOOD_DIST + dst_core - src_core;
+                    segment = Segment{.is_pad = false, .src_core = src_core, .neighbor = neighbor, .dst_start = dst_local, .size = 0};
+                    if (src_start_offsets[src_core][neighbor] < 0) {
+                        src_start_offsets[src_core][neighbor] = src_local;
+                    }
+                }
+            }
+            segment.size++;
+
+            if (++w == padded_input_w) {
+                w = 0;
+                if (++h == padded_input_h) {
+                    h = 0;
+                    n++;
+                }
+            }
+        }
+        finish_segment(segment, dst_core);
+    }
+
+    // Every core gets the same number of segments so the configs can be sharded evenly
+    auto flatten_segments = [num_cores](
+                                const auto &segments_of_core,
+                                std::vector<std::vector<uint32_t>> &flattened,
+                                std::vector<int32_t> &nsegments_per_core) {
+        size_t max_nsegments = 0;
+        for (uint32_t core = 0; core < num_cores; core++) {
+            max_nsegments = std::max(max_nsegments, segments_of_core(core).size());
+        }
+        flattened.resize(num_cores);
+        nsegments_per_core.resize(num_cores);
+        for (uint32_t core = 0; core < num_cores; core++) {
+            const std::vector<std::pair<uint32_t, uint32_t>> &segments = segments_of_core(core);
+            nsegments_per_core[core] = segments.size();
+            flattened[core].reserve(2 * max_nsegments);
+            for (const auto &[dst_start, size] : segments) {
+                flattened[core].push_back(dst_start);
+                flattened[core].push_back(size);
+            }
+            flattened[core].resize(2 * max_nsegments, 0);
+        }
+    };
+
+    HaloKernelConfig halo_config;
+    halo_config.max_out_nsticks_per_core = max_out_nsticks_per_core;
+    flatten_segments(
+        [&](uint32_t core) -> const auto & { return pad_segments[core]; },
+        halo_config.local_pad,
+        halo_config.local_pad_nsegments_per_core);
+
+    std::array<std::vector<std::vector<uint32_t>> *, NUM_NEIGHBORS> data = {
+        &halo_config.ll_data, &halo_config.l_data, &halo_config.local_data, &halo_config.r_data, &halo_config.rr_data};
+    std::array<std::vector<int32_t> *, NUM_NEIGHBORS> nsegments = {
+        &halo_config.ll_data_nsegments_per_core,
+        &halo_config.l_data_nsegments_per_core,
+        &halo_config.local_data_nsegments_per_core,
+        &halo_config.r_data_nsegments_per_core,
+        &halo_config.rr_data_nsegments_per_core};
+    std::array<std::vector<int32_t> *, NUM_NEIGHBORS> offsets = {
+        &halo_config.ll_data_src_start_offsets_per_core,
+        &halo_config.l_data_src_start_offsets_per_core,
+        &halo_config.local_data_src_start_offsets_per_core,
+        &halo_config.r_data_src_start_offsets_per_core,
+        &halo_config.rr_data_src_start_offsets_per_core};
+    for (uint32_t neighbor = 0; neighbor < NUM_NEIGHBORS; neighbor++) {
+        flatten_segments(
+            [&](uint32_t core) -> const auto & { return data_segments[core][neighbor]; },
+            *data[neighbor],
+            *nsegments[neighbor]);
+        offsets[neighbor]->resize(num_cores);
+        for (uint32_t core = 0; core < num_cores; core++) {
+            (*offsets[neighbor])[core] = src_start_offsets[core][neighbor];
+        }
+    }
+    return halo_config;
+}
+
+struct SlidingWindowConfigHash {
+    size_t operator()(const SlidingWindowConfig &config) const { return tt::stl::hash::hash_objects(0, config); }
+};
+
+void validate_config(const SlidingWindowConfig &config) {
+    TT_FATAL(config.num_cores_nhw > 0 and config.input_shard_height > 0 and config.output_shard_height > 0);
+    TT_FATAL(config.stride_h > 0 and config.stride_w > 0);
+    TT_FATAL(
+        config.window_h <= config.padded_input_h() and config.window_w <= config.padded_input_w(),
+        "Window {}x{} does not fit in padded input {}x{}", config.window_h, config.window_w, config.padded_input_h(), config.padded_input_w());
+    TT_FATAL(
+        config.batch_size * config.input_h * config.input_w <= config.num_cores_nhw * config.input_shard_height,
+        "Input sticks do not fit in {} shards of {} sticks", config.num_cores_nhw, config.input_shard_height);
+}
+
+std::mutex configs_cache_mutex;
+std::unordered_map<SlidingWindowConfig, std::unique_ptr<const SlidingWindowOpConfigs>, SlidingWindowConfigHash> op_configs_cache;
+std::unordered_map<SlidingWindowConfig, std::unique_ptr<const HaloKernelConfig>, SlidingWindowConfigHash> halo_kernel_configs_cache;
+
+template <typename T, typename Generator>
+const T &get_cached(
+    std::unordered_map<SlidingWindowConfig, std::unique_ptr<const T>, SlidingWindowConfigHash> &cache,
+    const SlidingWindowConfig &config,
+    Generator generate) {
+    std::lock_guard<std::mutex> lock(configs_cache_mutex);
+    auto cached = cache.find(config);
+    if (cached == cache.end()) {
+        cached = cache.emplace(config, std::make_unique<const T>(generate(config))).first;
+    }
+    return *cached->second;
+}
+
+}  // namespace
+
+SlidingWindowOpConfigs generate_sliding_window_op_configs(const SlidingWindowConfig &config) {
+    validate_config(config);
+
+    SlidingWindowOpConfigs configs;
+    configs.shard_boundaries = generate_shard_boundaries(config);
+
+    configs.sharded_input_top_left_indices.resize(config.num_cores_nhw);
+    for (uint32_t core = 0; core < config.num_cores_nhw; core++) {
+        auto [output_start, output_end] = configs.shard_boundaries[core].output;
+        uint32_t shard_input_start = configs.shard_boundaries[core].input.first;
+        std::vector<uint32_t> &top_left_indices = configs.sharded_input_top_left_indices[core];
+        top_left_indices.reserve(output_end - output_start + 1);
+        for (uint32_t output_index = output_start; output_index <= output_end; output_index++) {
+            top_left_indices.push_back(input_top_left_index(config, output_index) - shard_input_start);
+        }
+    }
+    return configs;
+}
+
+HaloKernelConfig generate_halo_kernel_config(const SlidingWindowConfig &config) {
+    validate_config(config);
+    return generate_halo_kernel_config_for_shards(config, generate_shard_boundaries(config));
+}
+
+const SlidingWindowOpConfigs &get_sliding_window_op_configs(const SlidingWindowConfig &config) {
+    return get_cached(op_configs_cache, config, generate_sliding_window_op_configs);
+}
+
+const HaloKernelConfig &get_halo_kernel_config(const SlidingWindowConfig &config) {
+    return get_cached(halo_kernel_configs_cache, config, generate_halo_kernel_config);
+}
+
+void clear_sliding_window_op_configs_cache() {
+    std::lock_guard<std::mutex> lock(configs_cache_mutex);
+    op_configs_cache.clear();
+    halo_kernel_configs_cache.clear();
+}
+
+}  // namespace sliding_window
+}  // namespace tt_metal
+}  // namespace tt
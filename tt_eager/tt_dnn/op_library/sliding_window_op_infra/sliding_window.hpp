@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Generates the data movement configs of sliding window ops (conv, max pool) on height sharded inputs:
+// which input sticks each core needs, where they come from and where padding goes.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace tt {
+namespace tt_metal {
+namespace sliding_window {
+
+// Halo data is only exchanged with cores at most this far away on either side
+constexpr uint32_t NEIGHBORHOOD_DIST = 2;
+
+struct SlidingWindowConfig {
+    uint32_t stride_h;
+    uint32_t stride_w;
+    uint32_t pad_h;
+    uint32_t pad_w;
+    uint32_t window_h;
+    uint32_t window_w;
+    uint32_t batch_size;
+    uint32_t input_h;
+    uint32_t input_w;
+    uint32_t num_cores_nhw;
+    // Unpadded input sticks held by each core
+    uint32_t input_shard_height;
+    // Output sticks computed by each core
+    uint32_t output_shard_height;
+
+    uint32_t padded_input_h() const { return input_h + 2 * pad_h; }
+    uint32_t padded_input_w() const { return input_w + 2 * pad_w; }
+    uint32_t output_h() const { return (padded_input_h() - window_h) / stride_h + 1; }
+    uint32_t output_w() const { return (padded_input_w() - window_w) / stride_w + 1; }
+
+    static constexpr auto attribute_names = std::make_tuple(
+        "stride_h", "stride_w", "pad_h", "pad_w", "window_h", "window_w", "batch_size", "input_h", "input_w",
+        "num_cores_nhw", "input_shard_height", "output_shard_height");
+    const auto attribute_values() const {
+        return std::make_tuple(
+            std::cref(this->stride_h),
+            std::cref(this->stride_w),
+            std::cref(this->pad_h),
+            std::cref(this->pad_w),
+            std::cref(this->window_h),
+            std::cref(this->window_w),
+            std::cref(this->batch_size),
+            std::cref(this->input_h),
+            std::cref(this->input_w),
+            std::cref(this->num_cores_nhw),
+            std::cref(this->input_shard_height),
+            std::cref(this->output_shard_height));
+    }
+
+    bool operator==(const SlidingWindowConfig &other) const { return attribute_values() == other.attribute_values(); }
+};
+
+// Inclusive [start, end] stick indices
+using StickRange = std::pair<uint32_t, uint32_t>;
+
+struct ShardBoundary {
+    StickRange output;
+    // Sticks of the padded input tensor needed to compute the output range, halo included
+    StickRange input;
+};
+
+// Configs consumed by untilize_with_halo_v2. Segments are (dst_start, size) pairs flattened per core and padded with
+// (0, 0) to the largest number of segments on any core. Data segments are indexed by the core sending them.
+struct HaloKernelConfig {
+    std::vector<std::vector<uint32_t>> local_pad;
+    std::vector<std::vector<uint32_t>> ll_data;
+    std::vector<std::vector<uint32_t>> l_data;
+    std::vector<std::vector<uint32_t>> local_data;
+    std::vector<std::vector<uint32_t>> r_data;
+    std::vector<std::vector<uint32_t>> rr_data;
+
+    std::vector<int32_t> local_pad_nsegments_per_core;
+    std::vector<int32_t> ll_data_nsegments_per_core;
+    std::vector<int32_t> l_data_nsegments_per_core;
+    std::vector<int32_t> local_data_nsegments_per_core;
+    std::vector<int32_t> r_data_nsegments_per_core;
+    std::vector<int32_t> rr_data_nsegments_per_core;
+
+    // First stick the sending core reads for each neighbor, -1 if it sends nothing to that neighbor
+    std::vector<int32_t> ll_data_src_start_offsets_per_core;
+    std::vector<int32_t> l_data_src_start_offsets_per_core;
+    std::vector<int32_t> local_data_src_start_offsets_per_core;
+    std::vector<int32_t> r_data_src_start_offsets_per_core;
+    std::vector<int32_t> rr_data_src_start_offsets_per_core;
+
+    uint32_t max_out_nsticks_per_core;
+};
+
+struct SlidingWindowOpConfigs {
+    std::vector<ShardBoundary> shard_boundaries;
+    // Top left input stick of each output stick, relative to the first input stick of the core's shard
+    std::vector<std::vector<uint32_t>> sharded_input_top_left_indices;
+};
+
+SlidingWindowOpConfigs generate_sliding_window_op_configs(const SlidingWindowConfig &config);
+
+// Computed in one pass over the sticks each core needs, without materializing the padded input tensor
+HaloKernelConfig generate_halo_kernel_config(const SlidingWindowConfig &config);
+
+// Memoized versions of the generators above, returned configs live until the cache is cleared
+const SlidingWindowOpConfigs &get_sliding_window_op_configs(const SlidingWindowConfig &config);
+const HaloKernelConfig &get_halo_kernel_config(const SlidingWindowConfig &config);
+
+void clear_sliding_window_op_configs_cache();
+
+}  // namespace sliding_window
+}  // namespace tt_metal
+}  // namespace tt
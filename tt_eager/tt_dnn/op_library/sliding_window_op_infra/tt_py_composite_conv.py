@@ -5,13 +5,6 @@
 from typing import List, Union
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.tt_py_op import TTPyOp
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.tt_py_untilize_with_halo import TTPyUntilizeWithHalo
-from tt_eager.tt_dnn.op_library.sliding_window_op_infra.untilize_with_halo_config_generation_and_validation import (
-    trace_conv_to_generate_data_top_left_indices_and_pad_metadata,
-    decompose_conv_into_shards_and_generate_tensor_metadata,
-)
-from tt_eager.tt_dnn.op_library.sliding_window_op_infra.sliding_window_op_config_generation_and_validation import (
-    generate_sliding_window_op_sharded_input_top_left_indices,
-)
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.sliding_window_op_utils import (
     SlidingWindowOpParams,
     SlidingWindowOpParamsWithParallelConfig,
@@ -502,7 +495,6 @@ class TTPyCompositeConv(TTPyOp):
             num_cores_h = sliding_window_op_params.num_cores_h
             num_cores_nhw = sliding_window_op_params.num_cores_nhw
 
-            input_nchw_shape = [batch_size, 1, input_h, input_w]
             conv_input_volume = batch_size * input_h * input_w
             conv_output_h = ((int)((input_h + (2 * pad_h) - filter_h) / stride_h)) + 1
             conv_output_w = ((int)((input_w + (2 * pad_w) - filter_w) / stride_w)) + 1
@@ -513,30 +505,22 @@ class TTPyCompositeConv(TTPyOp):
             output_size_to_shard_evenly = _nearest_y(conv_output_volume, num_cores_nhw * 32)
             conv_output_shard_height = (int)(output_size_to_shard_evenly / num_cores_nhw)
 
-            input_padded_width = input_w + 2 * pad_w
-
-            # TODO: We should remove C from input_nchw_shape since none of the specs depend on it
-            # TODO: Pass sliding_window_op_params instead of conv_param?
-            pad_metadata, data_top_left_indices = trace_conv_to_generate_data_top_left_indices_and_pad_metadata(
-                conv_params, input_nchw_shape
-            )
-
-            req_conv_input_shard_start_end, tensor_metadata = decompose_conv_into_shards_and_generate_tensor_metadata(
-                data_top_left_indices,
-                pad_metadata,
-                input_padded_width,
-                conv_output_shard_height,
-                untilize_with_halo_input_shard_height,
-                num_cores_nhw,
-                filter_h,
-                filter_w,
-            )
-
-            sliding_window_op_sharded_input_top_left_indices = (
-                generate_sliding_window_op_sharded_input_top_left_indices(
-                    data_top_left_indices, req_conv_input_shard_start_end
+            sliding_window_op_sharded_input_top_left_indices = ttl.tensor.get_sliding_window_op_configs(
+                ttl.tensor.SlidingWindowConfig(
+                    stride_h=stride_h,
+                    stride_w=stride_w,
+                    pad_h=pad_h,
+                    pad_w=pad_w,
+                    window_h=filter_h,
+                    window_w=filter_w,
+                    batch_size=batch_size,
+                    input_h=input_h,
+                    input_w=input_w,
+                    num_cores_nhw=num_cores_nhw,
+                    input_shard_height=untilize_with_halo_input_shard_height,
+                    output_shard_height=conv_output_shard_height,
                 )
-            )
+            ).sharded_input_top_left_indices
 
             # Pad indices for last core if not equal to other cores
             indices_length_per_core = len(sliding_window_op_sharded_input_top_left_indices[0])
@@ -4,13 +4,6 @@
 
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.tt_py_op import TTPyOp
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.tt_py_untilize_with_halo import TTPyUntilizeWithHalo
-from tt_eager.tt_dnn.op_library.sliding_window_op_infra.untilize_with_halo_config_generation_and_validation import (
-    trace_conv_to_generate_data_top_left_indices_and_pad_metadata,
-    decompose_conv_into_shards_and_generate_tensor_metadata,
-)
-from tt_eager.tt_dnn.op_library.sliding_window_op_infra.sliding_window_op_config_generation_and_validation import (
-    generate_sliding_window_op_sharded_input_top_left_indices,
-)
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.sliding_window_op_utils import (
     SlidingWindowOpParamsWithParallelConfig,
     SlidingWindowOpParams,
@@ -167,7 +160,6 @@ class TTPyMaxPool(TTPyOp):
             ncores_w = self.sliding_window_op_params.num_cores_w
             ncores_nhw = self.sliding_window_op_params.num_cores_nhw
 
-            input_nchw_shape = [batch_size, 1, input_h, input_w]
             input_volume = batch_size * input_h * input_w
             output_h = ((int)((input_h + (2 * pad_h) - window_h) / stride_h)) + 1
             output_w = ((int)((input_w + (2 * pad_w) - window_w) / stride_w)) + 1
@@ -181,28 +173,22 @@ class TTPyMaxPool(TTPyOp):
             assert output_volume % ncores_nhw == 0
             output_shard_height = output_volume // ncores_nhw
 
-            input_padded_width = input_w + 2 * pad_w
-
-            pad_metadata, data_top_left_indices = trace_conv_to_generate_data_top_left_indices_and_pad_metadata(
-                (1, 1, window_h, window_w, stride_h, stride_w, pad_h, pad_w, 1, 1), input_nchw_shape
-            )
-
-            req_conv_input_shard_start_end, tensor_metadata = decompose_conv_into_shards_and_generate_tensor_metadata(
-                data_top_left_indices,
-                pad_metadata,
-                input_padded_width,
-                output_shard_height,
-                input_shard_height,
-                ncores_nhw,
-                window_h,
-                window_w,
-            )
-
-            sliding_window_op_sharded_input_top_left_indices = (
-                generate_sliding_window_op_sharded_input_top_left_indices(
-                    data_top_left_indices, req_conv_input_shard_start_end
+            sliding_window_op_sharded_input_top_left_indices = ttl.tensor.get_sliding_window_op_configs(
+                ttl.tensor.SlidingWindowConfig(
+                    stride_h=stride_h,
+                    stride_w=stride_w,
+                    pad_h=pad_h,
+                    pad_w=pad_w,
+                    window_h=window_h,
+                    window_w=window_w,
+                    batch_size=batch_size,
+                    input_h=input_h,
+                    input_w=input_w,
+                    num_cores_nhw=ncores_nhw,
+                    input_shard_height=input_shard_height,
+                    output_shard_height=output_shard_height,
                 )
-            )
+            ).sharded_input_top_left_indices
 
             # Pad indices for last core if not equal to other cores
             indices_length_per_core = len(sliding_window_op_sharded_input_top_left_indices[0])
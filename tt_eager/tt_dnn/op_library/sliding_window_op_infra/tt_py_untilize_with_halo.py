@@ -4,11 +4,6 @@
 
 from typing import List
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.tt_py_op import TTPyOp
-from tt_eager.tt_dnn.op_library.sliding_window_op_infra.untilize_with_halo_config_generation_and_validation import (
-    trace_conv_to_generate_data_top_left_indices_and_pad_metadata,
-    decompose_conv_into_shards_and_generate_tensor_metadata,
-    generate_untilize_with_halo_kernel_configs,
-)
 from tt_lib.utils import _nearest_y
 from tt_eager.tt_dnn.op_library.sliding_window_op_infra.sliding_window_op_utils import (
     SlidingWindowOpParamsWithParallelConfig,
@@ -98,13 +93,6 @@ class TTPyUntilizeWithHalo(TTPyOp):
             num_cores_h = sliding_window_op_params.num_cores_h
             num_cores_nhw = sliding_window_op_params.num_cores_nhw
             assert num_cores_nhw > 0
-            # TODO: send input_nhw_shape to generate functions (no need for C)
-            # output_channels, input_channels, filter_h, filter_w, stride_h, stride_w, pad_h, pad_w, dilation, groups
-            sliding_window_op_all_params = [1, 1, window_h, window_w, stride_h, stride_w, pad_h, pad_w, 1, 1]
-            input_nchw_shape = [input_n, 1, input_h, input_w]
-            pad_metadata, data_top_left_indices = trace_conv_to_generate_data_top_left_indices_and_pad_metadata(
-                sliding_window_op_all_params, input_nchw_shape
-            )
             sliding_window_output_shard_nhw_size = get_sliding_window_op_output_shard_nhw_size(
                 num_cores_nhw, input_n, input_h, input_w, stride_h, stride_w, pad_h, pad_w, window_h, window_w
             )
@@ -112,33 +100,35 @@ class TTPyUntilizeWithHalo(TTPyOp):
             untilize_with_halo_input_shard_nhw_size = (int)(
                 untilize_w_halo_input_nhw_size_to_shard_evenly / num_cores_nhw
             )
-            req_conv_input_shard_start_end, tensor_metadata = decompose_conv_into_shards_and_generate_tensor_metadata(
-                data_top_left_indices,
-                pad_metadata,
-                input_w + (2 * pad_w),
-                sliding_window_output_shard_nhw_size,
-                untilize_with_halo_input_shard_nhw_size,
-                num_cores_nhw,
-                window_h,
-                window_w,
+            halo_kernel_config = ttl.tensor.get_halo_kernel_config(
+                ttl.tensor.SlidingWindowConfig(
+                    stride_h=stride_h,
+                    stride_w=stride_w,
+                    pad_h=pad_h,
+                    pad_w=pad_w,
+                    window_h=window_h,
+                    window_w=window_w,
+                    batch_size=input_n,
+                    input_h=input_h,
+                    input_w=input_w,
+                    num_cores_nhw=num_cores_nhw,
+                    input_shard_height=untilize_with_halo_input_shard_nhw_size,
+                    output_shard_height=sliding_window_output_shard_nhw_size,
+                )
             )
-
-            (
-                local_data,
-                local_pad,
-                ll_data,
-                l_data,
-                r_data,
-                rr_data,
-                src_start_idx,
-                local_data_nsegments_per_core,
-                local_pad_nsegments_per_core,
-                ll_data_nsegments_per_core,
-                l_data_nsegments_per_core,
-                r_data_nsegments_per_core,
-                rr_data_nsegments_per_core,
-                max_out_nsticks_per_core,
-            ) = generate_untilize_with_halo_kernel_configs(tensor_metadata, req_conv_input_shard_start_end)
+            local_data = halo_kernel_config.local_data
+            local_pad = halo_kernel_config.local_pad
+            ll_data = halo_kernel_config.ll_data
+            l_data = halo_kernel_config.l_data
+            r_data = halo_kernel_config.r_data
+            rr_data = halo_kernel_config.rr_data
+            local_data_nsegments_per_core = halo_kernel_config.local_data_nsegments_per_core
+            local_pad_nsegments_per_core = halo_kernel_config.local_pad_nsegments_per_core
+            ll_data_nsegments_per_core = halo_kernel_config.ll_data_nsegments_per_core
+            l_data_nsegments_per_core = halo_kernel_config.l_data_nsegments_per_core
+            r_data_nsegments_per_core = halo_kernel_config.r_data_nsegments_per_core
+            rr_data_nsegments_per_core = halo_kernel_config.rr_data_nsegments_per_core
+            max_out_nsticks_per_core = halo_kernel_config.max_out_nsticks_per_core
 
             assert len(local_data) == num_cores_nhw
             # Flatten the configs per core and construct the sharded tensor
@@ -150,13 +140,11 @@ class TTPyUntilizeWithHalo(TTPyOp):
             r_data = [item for sublist in r_data for item in sublist]
             rr_data = [item for sublist in rr_data for item in sublist]
 
-            # TODO: move this data structure these to generate function to validate the final data structure
-            ll_data_src_start_offsets_per_core = [src_start_idx[core_id][0] for core_id in range(num_cores_nhw)]
-            l_data_src_start_offsets_per_core = [src_start_idx[core_id][1] for core_id in range(num_cores_nhw)]
-            local_data_src_start_offsets_per_core = [src_start_idx[core_id][2] for core_id in range(num_cores_nhw)]
-            r_data_src_start_offsets_per_core = [src_start_idx[core_id][3] for core_id in range(num_cores_nhw)]
-            # print(f'r_data_src_start_offset: {self.r_data_src_start_offsets_per_core}')
-            rr_data_src_start_offsets_per_core = [src_start_idx[core_id][4] for core_id in range(num_cores_nhw)]
+            ll_data_src_start_offsets_per_core = halo_kernel_config.ll_data_src_start_offsets_per_core
+            l_data_src_start_offsets_per_core = halo_kernel_config.l_data_src_start_offsets_per_core
+            local_data_src_start_offsets_per_core = halo_kernel_config.local_data_src_start_offsets_per_core
+            r_data_src_start_offsets_per_core = halo_kernel_config.r_data_src_start_offsets_per_core
+            rr_data_src_start_offsets_per_core = halo_kernel_config.rr_data_src_start_offsets_per_core
 
             block_sharding = num_cores_nhw == num_cores_w
             if not block_sharding:
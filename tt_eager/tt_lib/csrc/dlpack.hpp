@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+// Structs of the DLPack 0.8 ABI (https://github.com/dmlc/dlpack/blob/v0.8/include/dlpack/dlpack.h) exchanged through
+// __dlpack__ capsules. Only the fields and codes host tensors use are named, the layout matches the C header
+namespace tt::tt_metal::dlpack {
+
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+};
+
+struct DLDevice {
+    DLDeviceType device_type;
+    int32_t device_id;
+};
+
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0U,
+    kDLUInt = 1U,
+    kDLFloat = 2U,
+    kDLBfloat = 4U,
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void *data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    // In elements, nullptr for compact row major tensors
+    int64_t *shape;
+    int64_t *strides;
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(DLManagedTensor *self);
+};
+
+// Capsule names, a consumer renames the capsule once it took ownership of the tensor
+constexpr const char *DLTENSOR_CAPSULE_NAME = "dltensor";
+constexpr const char *USED_DLTENSOR_CAPSULE_NAME = "used_dltensor";
+
+}  // namespace tt::tt_metal::dlpack
@@ -8,7 +8,9 @@
 #include "dtx/dtx_passes.hpp"
 #include "operations/module.hpp"
 #include "tt_dnn/op_library/auto_format.hpp"
+#include "tt_dnn/op_library/buffer_plan_cache.hpp"
 #include "tt_dnn/op_library/math.hpp"
+#include "tt_dnn/op_library/operation_history.hpp"
 #include "tt_dnn/op_library/program_cache.hpp"
 #include "tt_lib_bindings_tensor.hpp"
 #include "tt_metal/detail/persistent_kernel_cache.hpp"
@@ -242,6 +244,22 @@ void ProfilerModule(py::module &m_profiler) {
         +------------------+------------------------------------------------+-----------------------+-------------+----------+
     )doc");
 
+    m_profiler.def("flush_events", &op_profiler::event_stream::flush, R"doc(
+        Writes every op profiler event recorded so far to the file set by TT_METAL_OP_PROFILER_EVENTS.
+    )doc");
+
+    m_profiler.def("export_chrome_trace", &op_profiler::event_stream::export_chrome_trace,
+            py::arg("events_file_name"), py::arg("json_file_name"), R"doc(
+        Converts op profiler events written when TT_METAL_OP_PROFILER_EVENTS is set into Chrome trace event JSON,
+        which can be loaded by chrome://tracing and Perfetto.
+        +------------------+------------------------------------------------+-----------------------+-------------+----------+
+        | Argument         | Description                                    | Data type             | Valid range | Required |
+        +==================+================================================+=======================+=============+==========+
+        | events_file_name | File written by the op profiler event stream   | string                |             | Yes      |
+        | json_file_name   | Output JSON file                               | string                |             | Yes      |
+        +------------------+------------------------------------------------+-----------------------+-------------+----------+
+    )doc");
+
 }
 
 void DTXModule(py::module &m_dtx) {
@@ -278,6 +296,62 @@ void ProgramCacheModule(py::module &m_program_cache) {
    m_program_cache.def("enable", &tt::tt_metal::program_cache::enable);
    m_program_cache.def("disable_and_clear", &tt::tt_metal::program_cache::disable_and_clear);
    m_program_cache.def("num_entries", &tt::tt_metal::program_cache::num_entries);
+
+   py::enum_<program_cache::EvictionPolicy>(m_program_cache, "EvictionPolicy")
+       .value("LRU", program_cache::EvictionPolicy::LRU)
+       .value("LFU", program_cache::EvictionPolicy::LFU);
+
+   py::class_<program_cache::ProgramCacheStatistics>(m_program_cache, "ProgramCacheStatistics")
+       .def_readonly("hits", &program_cache::ProgramCacheStatistics::hits)
+       .def_readonly("misses", &program_cache::ProgramCacheStatistics::misses)
+       .def_readonly("evictions", &program_cache::ProgramCacheStatistics::evictions)
+       .def_readonly("reinsertions", &program_cache::ProgramCacheStatistics::reinsertions)
+       .def_readonly("num_entries", &program_cache::ProgramCacheStatistics::num_entries)
+       .def_readonly("estimated_bytes", &program_cache::ProgramCacheStatistics::estimated_bytes);
+
+   m_program_cache.def(
+       "configure",
+       [](std::size_t max_entries, std::size_t max_bytes, program_cache::EvictionPolicy eviction_policy) {
+           program_cache::configure(program_cache::ProgramCacheConfig{
+               .max_entries = max_entries, .max_bytes = max_bytes, .eviction_policy = eviction_policy});
+       },
+       py::arg("max_entries") = 0,
+       py::arg("max_bytes") = 0,
+       py::arg("eviction_policy") = program_cache::EvictionPolicy::LRU,
+       "Bounds the program cache by entry count and/or estimated binary bytes (0 means unbounded).");
+   m_program_cache.def("statistics", &tt::tt_metal::program_cache::statistics);
+   m_program_cache.def(
+       "thrashing_programs",
+       [](std::size_t min_evictions) {
+           std::vector<std::tuple<chip_id_t, operation::Hash, std::size_t>> programs;
+           for (const auto &program : program_cache::thrashing_programs(min_evictions)) {
+               programs.emplace_back(program.key.device_id, program.key.program_hash, program.evictions);
+           }
+           return programs;
+       },
+       py::arg("min_evictions") = 1,
+       "Returns (device_id, program_hash, evictions) for programs evicted at least min_evictions times.");
+}
+
+void OperationHistoryModule(py::module &m_operation_history) {
+   m_operation_history.def("enabled", &tt::tt_metal::operation_history::enabled);
+   m_operation_history.def(
+       "dump",
+       [](std::optional<std::string> file_name) {
+           if (file_name.has_value()) {
+               operation_history::dump(file_name.value());
+           } else {
+               operation_history::dump();
+           }
+       },
+       py::arg("file_name") = std::nullopt,
+       "Writes the operation history of every thread, to the file set by OPERATION_HISTORY by default.");
+}
+
+void BufferPlanCacheModule(py::module &m_buffer_plan_cache) {
+   m_buffer_plan_cache.def("enable", &tt::tt_metal::buffer_plan_cache::enable);
+   m_buffer_plan_cache.def("disable_and_clear", &tt::tt_metal::buffer_plan_cache::disable_and_clear);
+   m_buffer_plan_cache.def("num_entries", &tt::tt_metal::buffer_plan_cache::num_entries);
 }
 
 } // end namespace tt_metal
@@ -305,6 +379,12 @@ PYBIND11_MODULE(_C, m) {
     py::module_ m_program_cache = m.def_submodule("program_cache", "Submodule for caching operations");
     tt::tt_metal::ProgramCacheModule(m_program_cache);
 
+    py::module_ m_operation_history = m.def_submodule("operation_history", "Submodule for the history of operations");
+    tt::tt_metal::OperationHistoryModule(m_operation_history);
+
+    py::module_ m_buffer_plan_cache = m.def_submodule("buffer_plan_cache", "Submodule for planning the buffers of composite operations");
+    tt::tt_metal::BufferPlanCacheModule(m_buffer_plan_cache);
+
     py::module_ m_operations = m.def_submodule("operations", "Submodule for operations");
     tt::operations::py_module(m_operations);
 
@@ -718,6 +718,24 @@ void TensorModule(py::module &m_tensor) {
         )doc"
     );
 
+    m_tensor.def(
+        "dump_tensors",
+        &dump_tensors,
+        R"doc(
+            Dump named host tensors to one file, the file can be memory mapped by load_tensors
+        )doc"
+    );
+
+    m_tensor.def(
+        "load_tensors",
+        &load_tensors,
+        R"doc(
+            Load a dict of named tensors from a file written by dump_tensors
+
+            The file is memory mapped and the tensors borrow the mapping, so loading doesn't copy the data
+        )doc"
+    );
+
     m_tensor.def(
         "num_cores_to_corerange_set",
         py::overload_cast<const uint32_t, const CoreCoord, const bool>(&num_cores_to_corerange_set),
@@ -18,6 +18,7 @@
 #include "tt_dnn/op_library/reduce/reduce_op.hpp"
 #include "tt_dnn/op_library/copy/copy_op.hpp"
 #include "tt_dnn/op_library/sharded/sharded_op.hpp"
+#include "tt_dnn/op_library/sliding_window_op_infra/sliding_window.hpp"
 
 namespace tt::tt_metal::detail{
 
@@ -219,6 +220,76 @@ namespace tt::tt_metal::detail{
                 Untilizes input tiled data to row major format and constructs halo'd output shards.
             )doc");
 
+        py::class_<sliding_window::SlidingWindowConfig>(m_tensor, "SlidingWindowConfig")
+            .def(
+                py::init<uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t>(),
+                py::kw_only(),
+                py::arg("stride_h"),
+                py::arg("stride_w"),
+                py::arg("pad_h"),
+                py::arg("pad_w"),
+                py::arg("window_h"),
+                py::arg("window_w"),
+                py::arg("batch_size"),
+                py::arg("input_h"),
+                py::arg("input_w"),
+                py::arg("num_cores_nhw"),
+                py::arg("input_shard_height"),
+                py::arg("output_shard_height")
+            )
+            .def_property_readonly("output_h", &sliding_window::SlidingWindowConfig::output_h)
+            .def_property_readonly("output_w", &sliding_window::SlidingWindowConfig::output_w);
+
+        py::class_<sliding_window::HaloKernelConfig>(m_tensor, "HaloKernelConfig")
+            .def_readonly("local_pad", &sliding_window::HaloKernelConfig::local_pad)
+            .def_readonly("ll_data", &sliding_window::HaloKernelConfig::ll_data)
+            .def_readonly("l_data", &sliding_window::HaloKernelConfig::l_data)
+            .def_readonly("local_data", &sliding_window::HaloKernelConfig::local_data)
+            .def_readonly("r_data", &sliding_window::HaloKernelConfig::r_data)
+            .def_readonly("rr_data", &sliding_window::HaloKernelConfig::rr_data)
+            .def_readonly("local_pad_nsegments_per_core", &sliding_window::HaloKernelConfig::local_pad_nsegments_per_core)
+            .def_readonly("ll_data_nsegments_per_core", &sliding_window::HaloKernelConfig::ll_data_nsegments_per_core)
+            .def_readonly("l_data_nsegments_per_core", &sliding_window::HaloKernelConfig::l_data_nsegments_per_core)
+            .def_readonly("local_data_nsegments_per_core", &sliding_window::HaloKernelConfig::local_data_nsegments_per_core)
+            .def_readonly("r_data_nsegments_per_core", &sliding_window::HaloKernelConfig::r_data_nsegments_per_core)
+            .def_readonly("rr_data_nsegments_per_core", &sliding_window::HaloKernelConfig::rr_data_nsegments_per_core)
+            .def_readonly("ll_data_src_start_offsets_per_core", &sliding_window::HaloKernelConfig::ll_data_src_start_offsets_per_core)
+            .def_readonly("l_data_src_start_offsets_per_core", &sliding_window::HaloKernelConfig::l_data_src_start_offsets_per_core)
+            .def_readonly("local_data_src_start_offsets_per_core", &sliding_window::HaloKernelConfig::local_data_src_start_offsets_per_core)
+            .def_readonly("r_data_src_start_offsets_per_core", &sliding_window::HaloKernelConfig::r_data_src_start_offsets_per_core)
+            .def_readonly("rr_data_src_start_offsets_per_core", &sliding_window::HaloKernelConfig::rr_data_src_start_offsets_per_core)
+            .def_readonly("max_out_nsticks_per_core", &sliding_window::HaloKernelConfig::max_out_nsticks_per_core);
+
+        py::class_<sliding_window::SlidingWindowOpConfigs>(m_tensor, "SlidingWindowOpConfigs")
+            .def_property_readonly("shard_boundaries", [](const sliding_window::SlidingWindowOpConfigs &c) {
+                // Same ((output_start, output_end), (input_start, input_end)) layout as the python generators
+                std::vector<std::pair<sliding_window::StickRange, sliding_window::StickRange>> shard_boundaries;
+                for (const auto &boundary : c.shard_boundaries) {
+                    shard_boundaries.emplace_back(boundary.output, boundary.input);
+                }
+                return shard_boundaries;
+            })
+            .def_readonly("sharded_input_top_left_indices", &sliding_window::SlidingWindowOpConfigs::sharded_input_top_left_indices);
+
+        m_tensor.def("get_sliding_window_op_configs", &sliding_window::get_sliding_window_op_configs,
+            py::arg("config"),
+            R"doc(
+                Generates the shard boundaries and per core reader indices of a sliding window op.
+                Results are cached by config, repeated calls with the same config do not regenerate them.
+            )doc");
+
+        m_tensor.def("get_halo_kernel_config", &sliding_window::get_halo_kernel_config,
+            py::arg("config"),
+            R"doc(
+                Generates the untilize with halo configs of a sliding window op.
+                Results are cached by config, repeated calls with the same config do not regenerate them.
+            )doc");
+
+        m_tensor.def("clear_sliding_window_op_configs_cache", &sliding_window::clear_sliding_window_op_configs_cache,
+            R"doc(
+                Drops all cached sliding window op configs.
+            )doc");
+
         m_tensor.def("untilize_with_halo", &untilize_with_halo,
             py::arg("input").noconvert(),
             py::arg("pad_val"),
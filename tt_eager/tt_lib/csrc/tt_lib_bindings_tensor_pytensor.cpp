@@ -4,7 +4,9 @@
 
 #include <chrono>
 
+#include "dlpack.hpp"
 #include "tensor/borrowed_buffer.hpp"
+#include "tensor/host_ingestion.hpp"
 #include "tensor/owned_buffer.hpp"
 #include "tensor/tensor_impl.hpp"
 #include "tt_dnn/op_library/run_operation.hpp"
@@ -13,36 +15,203 @@
 
 namespace tt::tt_metal::detail {
 
+// Borrowed storage keeps the python object that owns its memory alive. Host conversions copy and destroy tensors with
+// the GIL released, so the callbacks take it and capture a raw pointer, copying a py::object would change its
+// reference count without the GIL
+std::pair<std::function<void()>, std::function<void()>> create_borrowed_storage_callbacks(const py::object &owner) {
+    PyObject *owner_ptr = owner.ptr();
+    auto on_creation_callback = [owner_ptr] {
+        py::gil_scoped_acquire gil;
+        Py_INCREF(owner_ptr);
+    };
+    auto on_destruction_callback = [owner_ptr] {
+        py::gil_scoped_acquire gil;
+        Py_DECREF(owner_ptr);
+    };
+    return {on_creation_callback, on_destruction_callback};
+}
+
+struct TorchTypes {
+    py::object tensor;
+    py::object from_dlpack;
+    py::object float32;
+    py::object float16;
+    py::object bfloat16;
+    py::object int64;
+    py::object int32;
+    py::object int16;
+};
+
+// Looked up once instead of on every conversion
+const TorchTypes &get_torch_types() {
+    // Never freed, python objects can't be released after the interpreter is finalized
+    static const TorchTypes *torch_types = [] {
+        py::object torch = py::module_::import("torch");
+        return new TorchTypes{
+            .tensor = torch.attr("Tensor"),
+            .from_dlpack = torch.attr("from_dlpack"),
+            .float32 = torch.attr("float32"),
+            .float16 = torch.attr("float16"),
+            .bfloat16 = torch.attr("bfloat16"),
+            .int64 = torch.attr("int64"),
+            .int32 = torch.attr("int32"),
+            .int16 = torch.attr("int16"),
+        };
+    }();
+    return *torch_types;
+}
+
+// Takes over a DLPack capsule, or an object implementing __dlpack__, without copying its memory. The tensor borrows
+// the memory until its last copy is destroyed. Strided sources, conversions, padding and TILE layout are instead
+// ingested into an owned buffer in one pass, see ingest_host_tensor
+Tensor convert_dlpack_to_tt_tensor(
+    const py::object &dlpack_tensor,
+    std::optional<DataType> optional_data_type = std::nullopt,
+    Layout layout = Layout::ROW_MAJOR,
+    const std::optional<Shape> &padded_shape = std::nullopt,
+    float pad_value = 0.0f) {
+    using namespace dlpack;
+
+    py::object capsule = dlpack_tensor;
+    if (py::hasattr(dlpack_tensor, "__dlpack__")) {
+        auto device = py::cast<std::pair<int32_t, int32_t>>(dlpack_tensor.attr("__dlpack_device__")());
+        TT_FATAL(device.first == kDLCPU, "Only host tensors can be imported through DLPack, got device type {}", device.first);
+        capsule = dlpack_tensor.attr("__dlpack__")();
+    }
+    TT_FATAL(
+        PyCapsule_IsValid(capsule.ptr(), DLTENSOR_CAPSULE_NAME),
+        "Expected a DLPack capsule or an object implementing __dlpack__, capsules can only be consumed once");
+    auto managed_tensor = static_cast<DLManagedTensor *>(PyCapsule_GetPointer(capsule.ptr(), DLTENSOR_CAPSULE_NAME));
+    // Renaming the capsule takes ownership of the tensor, the producer doesn't delete it anymore
+    PyCapsule_SetName(capsule.ptr(), USED_DLTENSOR_CAPSULE_NAME);
+    auto owner = py::capsule(managed_tensor, [](void *pointer) {
+        auto managed_tensor = static_cast<DLManagedTensor *>(pointer);
+        if (managed_tensor->deleter != nullptr) {
+            managed_tensor->deleter(managed_tensor);
+        }
+    });
+
+    const auto &dl_tensor = managed_tensor->dl_tensor;
+    TT_FATAL(dl_tensor.device.device_type == kDLCPU, "Only host tensors can be imported through DLPack");
+    TT_FATAL(dl_tensor.dtype.lanes == 1, "Vector data types can't be imported through DLPack");
+
+    auto shape = std::vector<uint32_t>(dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim);
+    std::size_t num_elements = 1;
+    for (auto dim : shape) {
+        num_elements *= dim;
+    }
+    auto strides = compute_row_major_strides(shape);
+    bool is_contiguous = true;
+    if (dl_tensor.strides != nullptr) {
+        for (int32_t dim = 0; dim < dl_tensor.ndim; dim++) {
+            // The stride of a dimension of size 1 is never used
+            is_contiguous &= dl_tensor.shape[dim] == 1 or dl_tensor.strides[dim] == strides[dim];
+            strides[dim] = dl_tensor.strides[dim];
+        }
+    }
+
+    auto code = dl_tensor.dtype.code;
+    auto bits = dl_tensor.dtype.bits;
+    DataType data_type;
+    if (code == kDLFloat and bits == 32) {
+        data_type = DataType::FLOAT32;
+    } else if (code == kDLBfloat and bits == 16) {
+        data_type = DataType::BFLOAT16;
+    } else if ((code == kDLInt or code == kDLUInt) and bits == 32) {
+        data_type = DataType::UINT32;
+    } else if ((code == kDLInt or code == kDLUInt) and bits == 16) {
+        data_type = DataType::UINT16;
+    } else {
+        TT_THROW("Unsupported DLPack data type with code {} and {} bits", static_cast<int>(code), static_cast<int>(bits));
+    }
+    auto source_data_type = data_type;
+    if (optional_data_type.has_value() and optional_data_type.value() != data_type) {
+        auto is_float = [](DataType type) {
+            return type == DataType::FLOAT32 or type == DataType::BFLOAT16 or type == DataType::BFLOAT8_B;
+        };
+        TT_FATAL(
+            is_float(optional_data_type.value()) and is_float(data_type),
+            "DLPack tensor of {} can't be imported as {}",
+            data_type,
+            optional_data_type.value());
+        data_type = optional_data_type.value();
+    }
+
+    auto data_ptr = static_cast<uint8_t *>(dl_tensor.data) + dl_tensor.byte_offset;
+    if (data_type != source_data_type or layout != Layout::ROW_MAJOR or padded_shape.has_value() or not is_contiguous) {
+        auto source = HostTensorSource{.data = data_ptr, .data_type = source_data_type, .shape = shape, .strides = strides};
+        py::gil_scoped_release gil;
+        return ingest_host_tensor(source, data_type, layout, padded_shape, pad_value);
+    }
+
+    auto [on_creation_callback, on_destruction_callback] = create_borrowed_storage_callbacks(owner);
+    switch (data_type) {
+        case DataType::UINT16: {
+            auto storage = BorrowedStorage(
+                borrowed_buffer::Buffer(reinterpret_cast<uint16_t *>(data_ptr), num_elements),
+                on_creation_callback,
+                on_destruction_callback);
+            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
+        }
+        case DataType::UINT32: {
+            auto storage = BorrowedStorage(
+                borrowed_buffer::Buffer(reinterpret_cast<uint32_t *>(data_ptr), num_elements),
+                on_creation_callback,
+                on_destruction_callback);
+            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
+        }
+        case DataType::FLOAT32: {
+            auto storage = BorrowedStorage(
+                borrowed_buffer::Buffer(reinterpret_cast<float *>(data_ptr), num_elements),
+                on_creation_callback,
+                on_destruction_callback);
+            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
+        }
+        case DataType::BFLOAT16: {
+            auto storage = BorrowedStorage(
+                borrowed_buffer::Buffer(reinterpret_cast<bfloat16 *>(data_ptr), num_elements),
+                on_creation_callback,
+                on_destruction_callback);
+            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
+        }
+        default: {
+            TT_THROW(fmt::format("Unsupported DataType: {}", data_type));
+            break;
+        }
+    }
+}
+
 Tensor convert_torch_tensor_to_tt_tensor(
-    const py::handle &torch_tensor, std::optional<DataType> optional_data_type = std::nullopt) {
-    py::object torch = py::module_::import("torch");
-    if (not py::isinstance(torch_tensor, torch.attr("Tensor"))) {
+    const py::handle &torch_tensor,
+    std::optional<DataType> optional_data_type = std::nullopt,
+    Layout layout = Layout::ROW_MAJOR) {
+    const auto &torch = get_torch_types();
+    if (not py::isinstance(torch_tensor, torch.tensor)) {
         TT_THROW("The argument must be of type torch.Tensor!");
     }
 
     auto torch_dtype = torch_tensor.attr("dtype");
-    auto shape = py::cast<std::vector<uint32_t>>(torch_tensor.attr("shape"));
-
-    auto contiguous_torch_tensor = torch_tensor.attr("contiguous")();
+    // Tensors that require grad can't be exported through DLPack. Strided tensors are exported as they are and
+    // gathered while ingesting
+    auto detached_torch_tensor = torch_tensor.attr("detach")();
+    auto is_float = torch_dtype.equal(torch.float32) or torch_dtype.equal(torch.bfloat16);
 
     // Override the data type if there is an user-provided one
     // Otherwise, figure it out from torch dtype
     DataType data_type;
     if (optional_data_type.has_value()) {
         data_type = optional_data_type.value();
-    } else if (torch_dtype.equal(torch.attr("float32"))) {
+    } else if (torch_dtype.equal(torch.float32)) {
         data_type = DataType::FLOAT32;
-    } else if (torch_dtype.equal(torch.attr("float16"))) {
-        contiguous_torch_tensor = contiguous_torch_tensor.attr("to")(torch.attr("bfloat16"));
+    } else if (torch_dtype.equal(torch.float16)) {
         // TODO(arakhmati): add DataType::FLOAT16?
         data_type = DataType::BFLOAT16;
-    } else if (torch_dtype.equal(torch.attr("bfloat16"))) {
+    } else if (torch_dtype.equal(torch.bfloat16)) {
         data_type = DataType::BFLOAT16;
-    } else if (torch_dtype.equal(torch.attr("int64"))) {
-        contiguous_torch_tensor = contiguous_torch_tensor.attr("to")(torch.attr("int32"));
+    } else if (torch_dtype.equal(torch.int64)) {
         // TODO(arakhmati): add DataType::INT64?
         data_type = DataType::UINT32;
-    } else if (torch_dtype.equal(torch.attr("int32"))) {
+    } else if (torch_dtype.equal(torch.int32)) {
         // TODO(arakhmati): add DataType::INT32?
         data_type = DataType::UINT32;
     } else {
@@ -51,27 +220,34 @@ Tensor convert_torch_tensor_to_tt_tensor(
 
     switch (data_type) {
         case DataType::UINT16: {
-            if (not torch_dtype.equal(torch.attr("int32"))) {
-                contiguous_torch_tensor = contiguous_torch_tensor.attr("to")(torch.attr("int16"));
+            if (not torch_dtype.equal(torch.int16)) {
+                detached_torch_tensor = detached_torch_tensor.attr("to")(torch.int16);
             }
             break;
         }
         case DataType::UINT32: {
-            if (not torch_dtype.equal(torch.attr("int32"))) {
-                contiguous_torch_tensor = contiguous_torch_tensor.attr("to")(torch.attr("int32"));
+            if (not torch_dtype.equal(torch.int32)) {
+                detached_torch_tensor = detached_torch_tensor.attr("to")(torch.int32);
+            }
+            break;
+        }
+        case DataType::BFLOAT8_B: {
+            // Converted to float while packing
+            if (not is_float) {
+                detached_torch_tensor = detached_torch_tensor.attr("to")(torch.float32);
             }
             break;
         }
-        case DataType::BFLOAT8_B:
         case DataType::FLOAT32: {
-            if (not torch_dtype.equal(torch.attr("float32"))) {
-                contiguous_torch_tensor = contiguous_torch_tensor.attr("to")(torch.attr("float32"));
+            // Converted while tilizing, a ROW_MAJOR tensor borrows the converted torch tensor instead
+            if (not torch_dtype.equal(torch.float32) and not (is_float and layout == Layout::TILE)) {
+                detached_torch_tensor = detached_torch_tensor.attr("to")(torch.float32);
             }
             break;
         }
         case DataType::BFLOAT16: {
-            if (not torch_dtype.equal(torch.attr("bfloat16"))) {
-                contiguous_torch_tensor = contiguous_torch_tensor.attr("to")(torch.attr("bfloat16"));
+            if (not torch_dtype.equal(torch.bfloat16) and not (is_float and layout == Layout::TILE)) {
+                detached_torch_tensor = detached_torch_tensor.attr("to")(torch.bfloat16);
             }
             break;
         }
@@ -81,50 +257,7 @@ Tensor convert_torch_tensor_to_tt_tensor(
         }
     }
 
-    auto on_creation_callback = [tensor = contiguous_torch_tensor] { tensor.inc_ref(); };
-    auto on_destruction_callback = [tensor = contiguous_torch_tensor] { tensor.dec_ref(); };
-
-    auto num_elements = py::cast<std::size_t>(contiguous_torch_tensor.attr("numel")());
-    auto torch_data_ptr = py::cast<std::size_t>(contiguous_torch_tensor.attr("data_ptr")());
-    switch (data_type) {
-        case DataType::UINT16: {
-            auto data_ptr = reinterpret_cast<uint16_t *>(torch_data_ptr);
-            auto storage = BorrowedStorage(
-                borrowed_buffer::Buffer(data_ptr, num_elements), on_creation_callback, on_destruction_callback);
-            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
-        }
-        case DataType::UINT32: {
-            auto data_ptr = reinterpret_cast<uint32_t *>(torch_data_ptr);
-            auto storage = BorrowedStorage(
-                borrowed_buffer::Buffer(data_ptr, num_elements), on_creation_callback, on_destruction_callback);
-            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
-        }
-        case DataType::FLOAT32: {
-            auto data_ptr = reinterpret_cast<float *>(torch_data_ptr);
-            auto storage = BorrowedStorage(
-                borrowed_buffer::Buffer(data_ptr, num_elements), on_creation_callback, on_destruction_callback);
-            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
-        }
-        case DataType::BFLOAT16: {
-            auto data_ptr = reinterpret_cast<bfloat16 *>(torch_data_ptr);
-            auto storage = BorrowedStorage(
-                borrowed_buffer::Buffer(data_ptr, num_elements), on_creation_callback, on_destruction_callback);
-            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
-        }
-        case DataType::BFLOAT8_B: {
-            auto data_ptr = reinterpret_cast<float *>(torch_data_ptr);
-            auto data = std::vector<float>(data_ptr, data_ptr + num_elements);
-            auto uint32_vector = pack_fp32_vec_as_bfp8_tiles(data, /*row_major_input=*/false, /*is_exp_a=*/false);
-            auto buffer = owned_buffer::create<uint32_t>(std::move(uint32_vector));
-            auto storage = OwnedStorage{std::move(buffer)};
-            // TODO(arakhmati): should it be Layout::TILE?
-            return Tensor(std::move(storage), shape, data_type, Layout::ROW_MAJOR);
-        }
-        default: {
-            TT_THROW(fmt::format("Unsupported DataType: {}", data_type));
-            break;
-        }
-    }
+    return convert_dlpack_to_tt_tensor(detached_torch_tensor.attr("__dlpack__")(), data_type, layout);
 }
 
 Tensor convert_numpy_tensor_to_tt_tensor(
@@ -196,8 +329,7 @@ Tensor convert_numpy_tensor_to_tt_tensor(
         }
     }
 
-    auto on_creation_callback = [tensor = contiguous_np_tensor] { tensor.inc_ref(); };
-    auto on_destruction_callback = [tensor = contiguous_np_tensor] { tensor.dec_ref(); };
+    auto [on_creation_callback, on_destruction_callback] = create_borrowed_storage_callbacks(contiguous_np_tensor);
 
     auto num_elements = py::cast<std::size_t>(contiguous_np_tensor.attr("size"));
     auto np_data_ptr = py::cast<std::size_t>(
@@ -232,8 +364,12 @@ Tensor convert_numpy_tensor_to_tt_tensor(
         */
         case DataType::BFLOAT8_B: {
             auto data_ptr = reinterpret_cast<float *>(np_data_ptr);
-            auto data = std::vector<float>(data_ptr, data_ptr + num_elements);
-            auto uint32_vector = pack_fp32_vec_as_bfp8_tiles(data, /*row_major_input=*/false, /*is_exp_a=*/false);
+            std::vector<uint32_t> uint32_vector;
+            {
+                py::gil_scoped_release gil;
+                auto data = std::vector<float>(data_ptr, data_ptr + num_elements);
+                uint32_vector = pack_fp32_vec_as_bfp8_tiles(data, /*row_major_input=*/false, /*is_exp_a=*/false);
+            }
             auto buffer = owned_buffer::create<uint32_t>(std::move(uint32_vector));
             auto storage = OwnedStorage{std::move(buffer)};
             // TODO(arakhmati): should it be Layout::TILE?
@@ -246,20 +382,26 @@ Tensor convert_numpy_tensor_to_tt_tensor(
     }
 }
 
+// Torch and DLPack tensors are converted straight into layout, numpy tensors are converted to it afterwards
 Tensor convert_python_tensor_to_tt_tensor(
-    const py::handle &tensor, std::optional<DataType> optional_data_type = std::nullopt) {
-    py::object torch = py::module_::import("torch");
+    const py::handle &tensor, std::optional<DataType> optional_data_type = std::nullopt, Layout layout = Layout::ROW_MAJOR) {
+    if (py::isinstance(tensor, get_torch_types().tensor)) {
+        return convert_torch_tensor_to_tt_tensor(tensor, optional_data_type, layout);
+    }
     py::object np = py::module_::import("numpy");
-    if (py::isinstance(tensor, torch.attr("Tensor"))) {
-        return convert_torch_tensor_to_tt_tensor(tensor, optional_data_type);
-    } else if (py::isinstance(tensor, np.attr("ndarray"))) {
-        return convert_numpy_tensor_to_tt_tensor(tensor, optional_data_type);
+    if (py::isinstance(tensor, np.attr("ndarray"))) {
+        auto tt_tensor = convert_numpy_tensor_to_tt_tensor(tensor, optional_data_type);
+        py::gil_scoped_release gil;
+        return tt_tensor.to(layout);
+    } else if (py::hasattr(tensor, "__dlpack__")) {
+        return convert_dlpack_to_tt_tensor(py::reinterpret_borrow<py::object>(tensor), optional_data_type, layout);
     } else {
-        TT_THROW("The argument must be of type torch.Tensor or numpy.ndarray!");
+        TT_THROW("The argument must be of type torch.Tensor or numpy.ndarray, or implement __dlpack__!");
     }
 }
 
     OwnedBuffer create_owned_buffer_from_vector_of_floats(std::vector<float>&& data, DataType data_type) {
+        py::gil_scoped_release gil;
         switch (data_type) {
             case DataType::BFLOAT8_B: {
                 auto uint32_vector = pack_fp32_vec_as_bfp8_tiles(data, /*row_major_input=*/false, /*is_exp_a=*/false);
@@ -283,54 +425,104 @@ Tensor convert_python_tensor_to_tt_tensor(
         }
     }
 
-    py::object convert_tt_tensor_to_torch_tensor(const Tensor& tt_tensor) {
-        TT_ASSERT(tt_tensor.storage_type() == StorageType::OWNED or tt_tensor.storage_type() == StorageType::BORROWED);
+    // Borrowed memory (i.e. a memory mapped tensor file) may only be valid while tt_tensor is, so the returned buffer
+    // keeps a copy of tt_tensor alive
+    py::object borrow_buffer_from_tensor(const std::variant<OwnedBuffer, BorrowedBuffer>& buffer, const Tensor& tt_tensor) {
+        auto py_buffer = py::cast(buffer);
+        if (std::holds_alternative<BorrowedBuffer>(buffer)) {
+            py::detail::keep_alive_impl(py_buffer, py::cast(tt_tensor));
+        }
+        return py_buffer;
+    }
 
-        using namespace pybind11::literals;
-        py::object torch = py::module_::import("torch");
-        auto frombuffer = torch.attr("frombuffer");
+    struct DLPackExportContext {
+        Tensor tensor;
+        std::vector<int64_t> shape;
+        std::vector<int64_t> strides;
+        dlpack::DLManagedTensor managed_tensor;
+    };
+
+    // Exports a host tensor without copying its memory, the capsule holds a copy of the tensor until its consumer
+    // deletes it. The data is described with the tensor's shape whatever its layout, like to_torch
+    py::capsule convert_tt_tensor_to_dlpack(const Tensor& tt_tensor) {
+        using namespace dlpack;
+        TT_FATAL(
+            tt_tensor.storage_type() == StorageType::OWNED or tt_tensor.storage_type() == StorageType::BORROWED,
+            "Only host tensors can be exported through DLPack, move the tensor to host with cpu() first");
+
+        DLDataType dtype;
+        switch (tt_tensor.dtype()) {
+            // TODO(arakhmati): add DataType::INT16 and DataType::INT32, unsigned types are exported as signed like to_torch
+            case DataType::UINT16: dtype = {.code = kDLInt, .bits = 16, .lanes = 1}; break;
+            case DataType::UINT32: dtype = {.code = kDLInt, .bits = 32, .lanes = 1}; break;
+            case DataType::FLOAT32: dtype = {.code = kDLFloat, .bits = 32, .lanes = 1}; break;
+            case DataType::BFLOAT16: dtype = {.code = kDLBfloat, .bits = 16, .lanes = 1}; break;
+            default: TT_THROW("{} tensors can't be exported through DLPack", tt_tensor.dtype());
+        }
 
-        auto buffer = std::visit(
-            [] (auto&& storage) -> std::variant<OwnedBuffer, BorrowedBuffer> {
+        auto context = new DLPackExportContext{.tensor = tt_tensor};
+        auto shape = tt_tensor.shape();
+        context->shape = std::vector<int64_t>(std::begin(shape), std::end(shape));
+        context->strides = std::vector<int64_t>(context->shape.size());
+        int64_t stride = 1;
+        for (int dim = static_cast<int>(context->shape.size()) - 1; dim >= 0; dim--) {
+            context->strides[dim] = stride;
+            stride *= context->shape[dim];
+        }
+
+        void* data = std::visit(
+            [](auto&& storage) -> void* {
                 using T = std::decay_t<decltype(storage)>;
-                if constexpr (std::is_same_v<T, OwnedStorage>) {
-                    return storage.buffer;
-                }
-                else if constexpr (std::is_same_v<T, DeviceStorage>) {
-                    TT_THROW("Device tensor cannot be converted to torch");
-                }
-                else if constexpr (std::is_same_v<T, BorrowedStorage>) {
-                    return storage.buffer;
-                }
-                else {
+                if constexpr (std::is_same_v<T, OwnedStorage> or std::is_same_v<T, BorrowedStorage>) {
+                    return std::visit([](auto&& buffer) { return const_cast<void*>(buffer.data()); }, storage.buffer);
+                } else if constexpr (std::is_same_v<T, DeviceStorage>) {
+                    TT_THROW("Device tensor cannot be exported through DLPack");
+                } else {
                     raise_unsupported_storage<T>();
                 }
             },
-            tt_tensor.storage()
-        );
+            context->tensor.storage());
+
+        context->managed_tensor.dl_tensor = DLTensor{
+            .data = data,
+            .device = {.device_type = kDLCPU, .device_id = 0},
+            .ndim = static_cast<int32_t>(context->shape.size()),
+            .dtype = dtype,
+            .shape = context->shape.data(),
+            .strides = context->strides.data(),
+            .byte_offset = 0};
+        context->managed_tensor.manager_ctx = context;
+        context->managed_tensor.deleter = [](DLManagedTensor* self) {
+            delete static_cast<DLPackExportContext*>(self->manager_ctx);
+        };
 
-        auto tt_dtype = tt_tensor.dtype();
-        if (tt_dtype == DataType::BFLOAT8_B) {
-            auto uint32_data = std::get<owned_buffer::Buffer<std::uint32_t>>(std::get<OwnedBuffer>(buffer)).get();
-            auto float_unpacked_data = unpack_bfp8_tiles_into_float_vec(uint32_data, /*row_major_output=*/false, /*is_exp_a=*/false);
-            buffer = owned_buffer::create<float>(std::move(float_unpacked_data));
-            tt_dtype = DataType::FLOAT32;
-        }
+        return py::capsule(&context->managed_tensor, DLTENSOR_CAPSULE_NAME, [](PyObject* capsule) {
+            // Consumers rename the capsule when they take over the tensor, only delete it if none did
+            if (PyCapsule_IsValid(capsule, DLTENSOR_CAPSULE_NAME)) {
+                auto managed_tensor = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, DLTENSOR_CAPSULE_NAME));
+                managed_tensor->deleter(managed_tensor);
+            }
+        });
+    }
 
-        const auto tt_dtype_to_torch_dtype = std::map<DataType, py::object> {
-            {DataType::UINT16, torch.attr("int16")}, // TODO(arakhmati): add DataType::INT16
-            {DataType::UINT32, torch.attr("int32")}, // TODO(arakhmati): add DataType::INT32
-            {DataType::FLOAT32, torch.attr("float32")},
-            {DataType::BFLOAT16, torch.attr("bfloat16")},
-        };
-        auto torch_dtype = tt_dtype_to_torch_dtype.at(tt_dtype);
+    py::object convert_tt_tensor_to_torch_tensor(const Tensor& tt_tensor) {
+        TT_ASSERT(tt_tensor.storage_type() == StorageType::OWNED or tt_tensor.storage_type() == StorageType::BORROWED);
 
-        auto shape = tt_tensor.shape();
-        auto torch_shape = std::vector<std::uint32_t>(std::begin(shape), std::end(shape));
-        auto tensor = frombuffer(buffer, "dtype"_a=torch_dtype);
-        tensor = tensor.attr("reshape")(torch_shape);
-        tensor = tensor.attr("contiguous")();
-        return tensor;
+        if (tt_tensor.dtype() == DataType::BFLOAT8_B) {
+            std::vector<float> float_unpacked_data;
+            {
+                py::gil_scoped_release gil;
+                auto uint32_data = tensor_impl::get_bfloat8_b_packed_data(tt_tensor);
+                float_unpacked_data = unpack_bfp8_tiles_into_float_vec(uint32_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+            }
+            auto float_tensor = Tensor(
+                OwnedStorage{owned_buffer::create<float>(std::move(float_unpacked_data))},
+                tt_tensor.shape(),
+                DataType::FLOAT32,
+                tt_tensor.layout());
+            return get_torch_types().from_dlpack(convert_tt_tensor_to_dlpack(float_tensor));
+        }
+        return get_torch_types().from_dlpack(convert_tt_tensor_to_dlpack(tt_tensor));
     }
 
     py::object convert_tt_tensor_to_numpy_tensor(const Tensor &tt_tensor) {
@@ -357,9 +549,13 @@ Tensor convert_python_tensor_to_tt_tensor(
 
         auto tt_dtype = tt_tensor.dtype();
         if (tt_dtype == DataType::BFLOAT8_B) {
-            auto uint32_data = std::get<owned_buffer::Buffer<std::uint32_t>>(std::get<OwnedBuffer>(buffer)).get();
-            auto float_unpacked_data =
-                unpack_bfp8_tiles_into_float_vec(uint32_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+            std::vector<float> float_unpacked_data;
+            {
+                py::gil_scoped_release gil;
+                auto uint32_data = tensor_impl::get_bfloat8_b_packed_data(tt_tensor);
+                float_unpacked_data =
+                    unpack_bfp8_tiles_into_float_vec(uint32_data, /*row_major_output=*/false, /*is_exp_a=*/false);
+            }
             buffer = owned_buffer::create<float>(std::move(float_unpacked_data));
             tt_dtype = DataType::FLOAT32;
         }
@@ -373,7 +569,7 @@ Tensor convert_python_tensor_to_tt_tensor(
 
         auto shape = tt_tensor.shape();
         auto np_shape = std::vector<std::uint32_t>(std::begin(shape), std::end(shape));
-        auto tensor = frombuffer(buffer, "dtype"_a = np_dtype);
+        auto tensor = frombuffer(borrow_buffer_from_tensor(buffer, tt_tensor), "dtype"_a = np_dtype);
         tensor = tensor.attr("reshape")(np_shape);
         tensor = np.attr("ascontiguousarray")(tensor);
         return tensor;
@@ -449,6 +645,53 @@ Tensor convert_python_tensor_to_tt_tensor(
                 +----------+----------------------+-----------+-------------+----------+
         )doc");
 
+        m_tensor.def(
+            "from_dlpack",
+            [](const py::object &tensor,
+               std::optional<DataType> data_type,
+               Layout layout,
+               const std::optional<Shape> &padded_shape,
+               float pad_value) {
+                return detail::convert_dlpack_to_tt_tensor(tensor, data_type, layout, padded_shape, pad_value);
+            },
+            py::arg("tensor"),
+            py::arg("data_type") = std::nullopt,
+            py::arg("layout") = Layout::ROW_MAJOR,
+            py::arg("padded_shape") = std::nullopt,
+            py::arg("pad_value") = 0.0f,
+            R"doc(
+            Create a TT Tensor on host that borrows the memory of a DLPack capsule or of an object implementing __dlpack__.
+
+            The source must be a host tensor of float32, bfloat16, int32, uint32, int16 or uint16. A contiguous source
+            kept in its data type and in ROW_MAJOR layout is borrowed. Otherwise the source is read once with its strides
+            and converted, padded, tilized and packed into an owned tensor in the same pass. Float32 and bfloat16 sources
+            can be converted to each other and to BFLOAT8_B.
+
+                +--------------+-----------------------------------------+------------------------+-------------------+----------+
+                | Argument     | Description                             | Data type              | Valid range       | Required |
+                +==============+=========================================+========================+===================+==========+
+                | tensor       | Tensor to import                        | DLPack capsule, object |                   | Yes      |
+                +--------------+-----------------------------------------+------------------------+-------------------+----------+
+                | data_type    | TT Tensor data type                     | DataType               |                   | No       |
+                +--------------+-----------------------------------------+------------------------+-------------------+----------+
+                | layout       | TT Tensor layout                        | Layout                 | ROW_MAJOR, TILE   | No       |
+                +--------------+-----------------------------------------+------------------------+-------------------+----------+
+                | padded_shape | Shape to pad the tensor to at its end   | List[int]              | >= tensor shape   | No       |
+                +--------------+-----------------------------------------+------------------------+-------------------+----------+
+                | pad_value    | Value of the padding                    | float                  |                   | No       |
+                +--------------+-----------------------------------------+------------------------+-------------------+----------+
+
+            .. code-block:: python
+
+                tt_tensor = tt_lib.tensor.from_dlpack(torch.randn((1, 1, 32, 32)))
+                tt_tensor = tt_lib.tensor.from_dlpack(
+                    torch.randn((1, 1, 30, 30)),
+                    tt_lib.tensor.DataType.BFLOAT8_B,
+                    tt_lib.tensor.Layout.TILE,
+                    padded_shape=[1, 1, 32, 32],
+                )
+        )doc");
+
         m_tensor.def(
             "decorate_external_operation",
             [](const py::function &function, std::optional<std::string> function_name) -> py::function {
@@ -699,9 +942,8 @@ Tensor convert_python_tensor_to_tt_tensor(
                               Device *device,
                               Layout layout,
                               const MemoryConfig &mem_config) {
-                    auto tensor = detail::convert_python_tensor_to_tt_tensor(python_tensor, data_type);
-                    auto layout_tensor = tensor.to(layout);
-                    return layout_tensor.to(device, mem_config);
+                    auto tensor = detail::convert_python_tensor_to_tt_tensor(python_tensor, data_type, layout);
+                    return tensor.to(device, mem_config);
                 }),
                 py::arg("tensor"),
                 py::arg("data_type") = std::nullopt,
@@ -826,7 +1068,7 @@ Tensor convert_python_tensor_to_tt_tensor(
 
                     tt_tensor = tt_tensor.cpu_sharded()
             )doc")
-            .def("to", py::overload_cast<Layout>(&Tensor::to, py::const_), R"doc(
+            .def("to", py::overload_cast<Layout>(&Tensor::to, py::const_), py::call_guard<py::gil_scoped_release>(), R"doc(
                 Convert TT Tensor to provided memory layout. Available layouts conversions are:
 
                 * ROW_MAJOR to TILE
@@ -848,6 +1090,7 @@ Tensor convert_python_tensor_to_tt_tensor(
                    const std::array<uint32_t, 4> &output_tensor_shape,
                    const std::array<uint32_t, 4> &input_tensor_start,
                    float pad_value) { return self.pad(output_tensor_shape, input_tensor_start, pad_value); },
+                py::call_guard<py::gil_scoped_release>(),
                 R"doc(
                 Pad TT Tensor with given pad value ``arg2``.
 
@@ -921,6 +1164,7 @@ Tensor convert_python_tensor_to_tt_tensor(
                    const std::array<uint32_t, 4> &output_tensor_end) {
                     return self.unpad(output_tensor_start, output_tensor_end);
                 },
+                py::call_guard<py::gil_scoped_release>(),
                 R"doc(
                 Unpad this TT Tensor.
 
@@ -983,7 +1227,10 @@ Tensor convert_python_tensor_to_tt_tensor(
                         [7, 8, 9]]] dtype=bfloat16 ]
             )doc")
             .def(
-                "pad_to_tile", [](const Tensor &self, float pad_value) { return self.pad_to_tile(pad_value); }, R"doc(
+                "pad_to_tile",
+                [](const Tensor &self, float pad_value) { return self.pad_to_tile(pad_value); },
+                py::call_guard<py::gil_scoped_release>(),
+                R"doc(
                 Pads TT Tensor with given pad value ``arg0``.
 
                 The input tensor must be on host and in ROW_MAJOR layout.
@@ -1043,6 +1290,7 @@ Tensor convert_python_tensor_to_tt_tensor(
                 [](const Tensor &self, const std::array<uint32_t, 4> &output_tensor_shape) {
                     return self.unpad_from_tile(output_tensor_shape);
                 },
+                py::call_guard<py::gil_scoped_release>(),
                 R"doc(
                 Unpads TT Tensor from given input tensor ``arg0``.
 
@@ -1201,6 +1449,28 @@ Tensor convert_python_tensor_to_tt_tensor(
                     data = tt_tensor.cpu().to_numpy() # move TT Tensor to host and convert it to numpy tensor
 
             )doc")
+            .def(
+                "__dlpack__",
+                [](const Tensor &self, const py::object &stream) -> py::capsule {
+                    TT_FATAL(self.layout() == Layout::ROW_MAJOR, "Only ROW_MAJOR tensors can be exported through DLPack");
+                    return detail::convert_tt_tensor_to_dlpack(self);
+                },
+                py::arg("stream") = py::none(),
+                R"doc(
+                Export the tensor through DLPack without copying it. The tensor must be on host and in ROW_MAJOR layout.
+
+                UINT16 and UINT32 tensors are exported as signed integers. The exported tensor shares memory with this tensor.
+
+                .. code-block:: python
+
+                    torch_tensor = torch.from_dlpack(tt_tensor)
+            )doc")
+            .def(
+                "__dlpack_device__",
+                [](const Tensor &self) { return py::make_tuple(static_cast<int32_t>(dlpack::kDLCPU), 0); },
+                R"doc(
+                Get the DLPack device type and id of the tensor, tensors are only exported from host.
+            )doc")
             .def(
                 "buffer",
                 [](const Tensor &self) -> std::variant<OwnedBuffer, BorrowedBuffer> {
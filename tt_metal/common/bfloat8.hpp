@@ -10,6 +10,7 @@
 #include <immintrin.h>
 
 #include "common/assert.hpp"
+#include "common/executor.hpp"
 #include "common/logger.hpp"
 #include "common/tt_backend_api_types.hpp"
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
@@ -146,171 +147,311 @@ inline uint32_t create_packed_bfp8_packed_as_u32(const std::vector<uint32_t> &u3
     return tmp_o;
 }
 
-inline std::vector<uint32_t> pack_fp32_vec_as_bfp8_tiles(const std::vector<float> &fp32_vec, bool row_major_input, bool is_exp_a) {
-    ZoneScoped;
+// A bfp8 tile is 16 words of shared exponents, one byte per face row (4 faces x 16 rows), followed by 256 words of
+// sign + mantissa bytes with the faces in order and each face row major:
+//  16 exponents for sub-tile 0
+//      exp_row0, exp_row1, … exp_row15
+//  16 exponents for sub-tile 1
+//  16 exponents for sub-tile 2
+//  16 exponents for sub-tile 3
+//  entire sub-tile 0 (RM layout)
+//  entire sub-tile 1 (RM layout)
+//  entire sub-tile 2 (RM layout)
+//  entire sub-tile 3 (RM layout)
+constexpr uint32_t BFP8_FACE_ROWS_IN_TILE = 64;
+constexpr uint32_t BFP8_FACE_ROW_WIDTH = 16;
+constexpr uint32_t BFP8_EXPONENT_BYTES_IN_TILE = BFP8_FACE_ROWS_IN_TILE;
+constexpr uint32_t BFP8_WORDS_IN_TILE = (BFP8_EXPONENT_BYTES_IN_TILE + BFP8_FACE_ROWS_IN_TILE * BFP8_FACE_ROW_WIDTH) / 4;
+constexpr uint32_t FLOATS_IN_TILE = 1024;
+
+// Location of the float data of every tile. A tiled vector holds the faces of every tile contiguously, a row major
+// vector holds num_blocks [rows, cols] matrices whose tiles are taken in row major order
+struct Bfp8TileAddressing {
+    bool row_major;
+    uint32_t rows;
+    uint32_t cols;
+
+    size_t tile_offset(uint32_t tile_index) const {
+        if (not row_major) {
+            return size_t(tile_index) * FLOATS_IN_TILE;
+        }
+        uint32_t col_tiles = cols / 32;
+        uint32_t tiles_in_block = (rows / 32) * col_tiles;
+        uint32_t block = tile_index / tiles_in_block;
+        uint32_t tile_in_block = tile_index % tiles_in_block;
+        return size_t(block) * rows * cols + size_t(tile_in_block / col_tiles) * 32 * cols + (tile_in_block % col_tiles) * 32;
+    }
 
-    uint32_t single_bfp8_tile_size = tile_size(tt::DataFormat::Bfp8_b);
-    int num_float_in_tile = 1024;
-    TT_ASSERT(fp32_vec.size() % num_float_in_tile == 0);
-    uint32_t num_tiles = fp32_vec.size() / num_float_in_tile;
-
-    std::vector<uint32_t> packed_result;
-
-    std::vector<uint8_t> exponents;
-    std::vector<uint32_t> data;
-
-    int subtiles_in_tile_row = 2;
-    int subtiles_in_tile_col = 2;
-    int subtile_rows = 16;
-    int subtile_cols = 16;
-    int num_elements_in_dword = 4;
-    int fp32_element_index = 0;
-    for (int tile_index = 0; tile_index < num_tiles; ++tile_index) {
-        std::vector<uint32_t> packed_data;
-        for (int tr = 0; tr < subtiles_in_tile_row; ++tr) {
-            for (int tc = 0; tc < subtiles_in_tile_col; ++tc) {
-                for (int i = 0; i < subtile_rows; ++i) {
-                    std::vector<uint32_t> single_row;
-                    // populate a single row
-                    for (int j = 0; j < subtile_cols; ++j) {
-                        int data_index;
-                        if (row_major_input) {
-                            data_index = (tr*16 + i)*32 + (tc*16 + j) + (num_float_in_tile * tile_index);
-                        } else {
-                            data_index = fp32_element_index++;
-                        }
-                        float float_num = fp32_vec.at(data_index);
-                        uint32_t uint32_num = *reinterpret_cast<uint32_t*>(&float_num);
-                        single_row.push_back(uint32_num);
-                    }
-
-                    uint8_t exp = get_max_exp(single_row, is_exp_a);
-                    exponents.push_back(exp);
-
-                    if (exponents.size() % num_elements_in_dword == 0) {
-                        packed_result.push_back(get_exp_dword(exponents));
-                        exponents.clear();
-                    }
-
-                    for (uint32_t u32_datum : single_row) {
-                        data.push_back(u32_datum);
-                        if (data.size() % num_elements_in_dword == 0) {
-                            uint32_t datum = create_packed_bfp8_packed_as_u32(data, exp, is_exp_a);
-                            packed_data.push_back(datum);
-                            data.clear();
-                        }
-                    }
-                }
-            }
+    size_t face_row_offset(uint32_t face_row) const {
+        if (not row_major) {
+            return face_row * BFP8_FACE_ROW_WIDTH;
         }
-        // prepend exponents to follow data packing order:
-        //  16 exponents for sub-tile 0​
-        //      exp_row0, exp_row1, … exp_row15​
-        //  16 exponents for sub-tile 1​
-        //  16 exponents for sub-tile 2​
-        //  16 exponents for sub-tile 3​
-        //  entire sub-tile 0 (RM layout)​
-        //  entire sub-tile 1 (RM layout)​
-        //  entire sub-tile 2 (RM layout)​
-        //  entire sub-tile 3 (RM layout)
-        packed_result.insert(packed_result.end(), packed_data.begin(), packed_data.end());
+        uint32_t face = face_row / 16;
+        return size_t((face / 2) * 16 + face_row % 16) * cols + (face % 2) * 16;
     }
+};
 
-    return packed_result;
+inline bool bfp8_cpu_supports_avx512() {
+    static const bool supports_avx512 = __builtin_cpu_supports("avx512f");
+    return supports_avx512;
 }
 
-inline std::vector<float> unpack_bfp8_tiles_into_float_vec(const std::vector<uint32_t> &bfp8_tiles, bool row_major_output, bool is_exp_a) {
-    ZoneScoped;
+// The kernels below are vectorized versions of get_max_exp and convert_u32_to_bfp8 (pack), and the inverse conversion
+// (unpack), they produce exactly the same bits. Each call converts one face row, 16 values sharing an exponent.
 
-    int num_elements_in_dword = 4;
-    uint32_t size_bytes = bfp8_tiles.size() * num_elements_in_dword; // each uint32_t contains 4 BFP8 values
-    uint32_t single_bfp8_tile_size = tile_size(tt::DataFormat::Bfp8_b);
-    TT_ASSERT(size_bytes % single_bfp8_tile_size == 0);
-    uint32_t num_tiles = size_bytes / single_bfp8_tile_size;
-
-    int data_index;
-    int subtile_r;
-    int subtile_c;
-    const vector<uint32_t> mask_vec = {0xff, 0xff00, 0xff0000, 0xff000000};
-    const vector<uint32_t> shift_vec = {0, 8, 16, 24};
-    const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask_vec.data()));
-    const __m128i shift = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shift_vec.data()));
-    __m256i rebias_offset = _mm256_setzero_si256();
+inline __m256i bfp8_exponents_avx2(__m256i input, bool is_exp_a) {
+    __m256i exp = _mm256_srli_epi32(_mm256_and_si256(input, _mm256_set1_epi32(0x7f800000)), 23);
     if (is_exp_a) {
-        rebias_offset = _mm256_set1_epi32(-112); // This rebias offset must be added if we are working with BFP8 format.
+        // need to rebias from 127 to 15 and saturate
+        exp = _mm256_sub_epi32(exp, _mm256_set1_epi32(127 - 15));
+        exp = _mm256_min_epi32(_mm256_max_epi32(exp, _mm256_setzero_si256()), _mm256_set1_epi32(31));
     }
-    uint32_t exp_word, sub_word_index;
-
-    int subtiles_in_tile_row = 2;
-    int subtiles_in_tile_col = 2;
-    int subtile_rows = 16;
-    int subtile_cols = 16;
-    uint32_t num_bfp8_in_tile = 256 + 16;
-    uint32_t num_float_in_tile = subtiles_in_tile_row * subtiles_in_tile_col * subtile_rows * subtile_cols;
-    uint32_t fp32_element_index = 0;
-    std::vector<float> float_vec;
-    float_vec.resize(num_tiles * num_float_in_tile);
-    for (int tile_index = 0; tile_index < num_tiles; ++tile_index) {
-        for (int tr = 0; tr < subtiles_in_tile_row; ++tr) {
-            for (int tc = 0; tc < subtiles_in_tile_col; ++tc) {
-                for (int i = 0; i < subtile_rows; ++i) {
-                    subtile_r = tr * 16 + i;
-                    for (int j = 0; j < subtile_cols; j += 8) {
-                        subtile_c = tc * 16 + j;
-                        data_index = (tr*128 + tc*64 + i*4 + j/4); // Each uint32_t contains 4 BFP8 values. Divide data index by 4.
-                        int tile_and_data_index = data_index + (num_bfp8_in_tile * tile_index);
-
-                        int exponent_index = (data_index >> 4) + (num_bfp8_in_tile * tile_index);
-                        exp_word = bfp8_tiles.at(exponent_index); // Extract the uint32_t value that stores the shared exponent for this set of data. Each 32 bit word is shared amongst 64 datums
-
-                        sub_word_index = (tile_and_data_index >> 2) & 0x3; // Extract the byte in which the shared exponent is stored. Each byte is shared amongst 16 datums.
-                        __m256i exp_vector = _mm256_set1_epi32(get_byte(exp_word, sub_word_index)); // Replicate exp scalar in a vector
-                        // Take 2 uint32_t values. These are 8 BFP8 values
-                        __m128i first = _mm_set1_epi32(bfp8_tiles.at(16 + tile_and_data_index)); // Replicate first uint32_t 4 times (one for each BFP8 value)
-                        __m128i second = _mm_set1_epi32(bfp8_tiles.at(16 + tile_and_data_index + 1)); //  Replicate second uint32_t 4 times
-                        first = _mm_srlv_epi32(_mm_and_si128(first, mask), shift); // Extract each BFP8 from the first uint32_t
-                        second = _mm_srlv_epi32(_mm_and_si128(second, mask), shift); // Extract each BFP8 from the second uint32_t
-                        __m256i combined = _mm256_set_m128i(second, first); // Concatenate 2 128 vectors to 1 256
-                        // Extract sign and mantissa (expo extracted above)
-                        __m256i sign = _mm256_srl_epi32(combined,  _mm_set_epi64x(0, 7));
-                        __m256i man = _mm256_and_si256(combined, _mm256_set1_epi32(0x7f));
-                        // Initialize shift amount per datum to 0. This is incremented below.
-                        __m256i shift_cnt = _mm256_setzero_si256();
-                        __m256i select_mask = _mm256_cmpeq_epi32(man, shift_cnt); // This mask is used to set mantissa values to 0, if they start at 0.
-                        __m256i man_shifted = man; // Initialize updated mantissa
-                        for (int shift_val = 0; shift_val < 7; shift_val++) {
-                            // Shift each mantissa and update the corresponding shift_cnt until the 6th bit of the 8 bit data is set.
-                            __m256i shift_mask = _mm256_or_si256(_mm256_cmpgt_epi32(man_shifted, _mm256_set1_epi32(0x40)), _mm256_cmpeq_epi32(man_shifted, _mm256_set1_epi32(0x40))); // If the 6th bit is set, propagate the current mantissa value. Else take the left shifted value
-                            man_shifted = _mm256_blendv_epi8(_mm256_sll_epi32(man_shifted, _mm_set_epi64x(0, 1)), man_shifted, shift_mask);
-                            shift_cnt = _mm256_blendv_epi8(_mm256_set1_epi32(shift_val + 1), shift_cnt, shift_mask);
-                        }
-                        man_shifted = _mm256_and_si256(_mm256_sll_epi32(man_shifted, _mm_set_epi64x(0, 1)), _mm256_set1_epi32(0x7f)); // One more shift to clear 6th bit
-                        man = _mm256_blendv_epi8(man_shifted, man, select_mask); // Choose new mantissa or keep old mantissa based on 0 initial condition.
-                        // Assert if the exponent and corresponding mantissa for a datum are non-zero and the subtraction bias (shift_cnt) for that data is greater than the exponent value
-                        TT_ASSERT(!(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(exp_vector, _mm256_setzero_si256()))) & _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(shift_cnt, exp_vector))) & !_mm256_movemask_ps(_mm256_castsi256_ps(select_mask))) , "Device returned incorrect data for Bfp8 formats: The Shift Count for a non-zero exponent is greater than the exponent value.");
-                        exp_vector = _mm256_blendv_epi8(_mm256_sub_epi32(exp_vector, _mm256_add_epi32(rebias_offset, shift_cnt)),  _mm256_setzero_si256(), select_mask); // Choose new (rebiased exponent) or keep previous exponent based on mantissa intiial condition
-
-                        sign = _mm256_sll_epi32(sign, _mm_set_epi64x(0, 31)); // Shift sign
-                        exp_vector = _mm256_sll_epi32(exp_vector, _mm_set_epi64x(0, 23)); // Shift exp
-                        man = _mm256_sll_epi32(man, _mm_set_epi64x(0, 16)); // Shift mantissa
-                        man = _mm256_or_si256(sign, _mm256_or_si256(exp_vector, man)); // Store final value in mantissa register and save
-
-                        uint32_t float_data_index;
-                        if (row_major_output) {
-                            float_data_index = subtile_c + (32 * subtile_r) + (tile_index * num_float_in_tile);
-                        } else {
-                            float_data_index = fp32_element_index;
-                            fp32_element_index += 8;
-                        }
-                        _mm256_storeu_ps(&float_vec[float_data_index],  _mm256_castsi256_ps(man));
-                    }
-                }
-            }
+    return exp;
+}
+
+template <bool truncate_bfp_mantissa>
+inline __m256i convert_u32_to_bfp8_avx2(__m256i input, __m256i shared_exp, bool is_exp_a) {
+    __m256i mantissa = _mm256_and_si256(input, _mm256_set1_epi32(0x007fffff));
+    __m256i exp = _mm256_srli_epi32(_mm256_and_si256(input, _mm256_set1_epi32(0x7f800000)), 23);
+    if (is_exp_a) {
+        __m256i se = _mm256_sub_epi32(exp, _mm256_set1_epi32(127 - 15));
+        mantissa = _mm256_blendv_epi8(mantissa, _mm256_set1_epi32(0x007fffff), _mm256_cmpgt_epi32(se, _mm256_set1_epi32(31)));
+        mantissa = _mm256_andnot_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), se), mantissa);
+        exp = _mm256_min_epi32(_mm256_max_epi32(se, _mm256_setzero_si256()), _mm256_set1_epi32(31));
+    }
+    // add hidden 1 and align to the shared exponent, shifts of 32 or more give 0
+    mantissa = _mm256_or_si256(mantissa, _mm256_set1_epi32(1 << 23));
+    mantissa = _mm256_srlv_epi32(mantissa, _mm256_sub_epi32(shared_exp, exp));
+    if constexpr (truncate_bfp_mantissa) {
+        mantissa = _mm256_srli_epi32(mantissa, 17);
+    } else {
+        mantissa = _mm256_srli_epi32(_mm256_add_epi32(mantissa, _mm256_set1_epi32(1 << 16)), 17);
+        mantissa = _mm256_min_epu32(mantissa, _mm256_set1_epi32(127));
+    }
+    // add sign bit only if result is not 0
+    __m256i sign = _mm256_slli_epi32(_mm256_srli_epi32(input, 31), 7);
+    sign = _mm256_andnot_si256(_mm256_cmpeq_epi32(mantissa, _mm256_setzero_si256()), sign);
+    __m256i is_zero = _mm256_cmpeq_epi32(_mm256_and_si256(input, _mm256_set1_epi32(0x7fffffff)), _mm256_setzero_si256());
+    return _mm256_andnot_si256(is_zero, _mm256_or_si256(sign, mantissa));
+}
+
+template <bool truncate_bfp_mantissa>
+inline uint8_t pack_bfp8_face_row_avx2(const float *src, bool is_exp_a, uint8_t *dst) {
+    __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+    __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + 8));
+    __m256i exp = _mm256_max_epi32(bfp8_exponents_avx2(lo, is_exp_a), bfp8_exponents_avx2(hi, is_exp_a));
+    __m128i max_exp = _mm_max_epi32(_mm256_castsi256_si128(exp), _mm256_extracti128_si256(exp, 1));
+    max_exp = _mm_max_epi32(max_exp, _mm_shuffle_epi32(max_exp, _MM_SHUFFLE(1, 0, 3, 2)));
+    max_exp = _mm_max_epi32(max_exp, _mm_shuffle_epi32(max_exp, _MM_SHUFFLE(2, 3, 0, 1)));
+    __m256i shared_exp = _mm256_broadcastd_epi32(max_exp);
+
+    // Narrow the 16 results to bytes, packus interleaves the 128 bit lanes so restore the order in between
+    __m256i packed = _mm256_packus_epi32(
+        convert_u32_to_bfp8_avx2<truncate_bfp_mantissa>(lo, shared_exp, is_exp_a),
+        convert_u32_to_bfp8_avx2<truncate_bfp_mantissa>(hi, shared_exp, is_exp_a));
+    packed = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+    packed = _mm256_packus_epi16(packed, packed);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i *>(dst),
+        _mm_unpacklo_epi64(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1)));
+    return _mm_cvtsi128_si32(max_exp);
+}
+
+template <bool truncate_bfp_mantissa>
+__attribute__((target("avx512f"))) inline uint8_t pack_bfp8_face_row_avx512(const float *src, bool is_exp_a, uint8_t *dst) {
+    __m512i input = _mm512_loadu_si512(src);
+    __m512i mantissa = _mm512_and_si512(input, _mm512_set1_epi32(0x007fffff));
+    __m512i exp = _mm512_srli_epi32(_mm512_and_si512(input, _mm512_set1_epi32(0x7f800000)), 23);
+    if (is_exp_a) {
+        __m512i se = _mm512_sub_epi32(exp, _mm512_set1_epi32(127 - 15));
+        mantissa = _mm512_mask_mov_epi32(mantissa, _mm512_cmpgt_epi32_mask(se, _mm512_set1_epi32(31)), _mm512_set1_epi32(0x007fffff));
+        mantissa = _mm512_maskz_mov_epi32(_mm512_cmpge_epi32_mask(se, _mm512_setzero_si512()), mantissa);
+        exp = _mm512_min_epi32(_mm512_max_epi32(se, _mm512_setzero_si512()), _mm512_set1_epi32(31));
+    }
+    uint32_t shared_exp = _mm512_reduce_max_epi32(exp);
+
+    mantissa = _mm512_or_si512(mantissa, _mm512_set1_epi32(1 << 23));
+    mantissa = _mm512_srlv_epi32(mantissa, _mm512_sub_epi32(_mm512_set1_epi32(shared_exp), exp));
+    if constexpr (truncate_bfp_mantissa) {
+        mantissa = _mm512_srli_epi32(mantissa, 17);
+    } else {
+        mantissa = _mm512_srli_epi32(_mm512_add_epi32(mantissa, _mm512_set1_epi32(1 << 16)), 17);
+        mantissa = _mm512_min_epu32(mantissa, _mm512_set1_epi32(127));
+    }
+    __m512i sign = _mm512_slli_epi32(_mm512_srli_epi32(input, 31), 7);
+    sign = _mm512_maskz_mov_epi32(_mm512_test_epi32_mask(mantissa, mantissa), sign);
+    __m512i result = _mm512_maskz_mov_epi32(
+        _mm512_test_epi32_mask(input, _mm512_set1_epi32(0x7fffffff)), _mm512_or_si512(sign, mantissa));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm512_cvtepi32_epi8(result));
+    return shared_exp;
+}
+
+inline __m256i convert_bfp8_to_u32_avx2(__m256i input, __m256i shared_exp, __m256i rebias_offset) {
+    __m256i sign = _mm256_slli_epi32(_mm256_srli_epi32(input, 7), 31);
+    __m256i mantissa = _mm256_and_si256(input, _mm256_set1_epi32(0x7f));
+    __m256i is_zero = _mm256_cmpeq_epi32(mantissa, _mm256_setzero_si256());
+    // Normalize so that the leading one becomes the hidden bit, floor(log2(mantissa)) is the exponent of the mantissa
+    // converted to float
+    __m256i leading_one = _mm256_sub_epi32(
+        _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(mantissa)), 23), _mm256_set1_epi32(127));
+    __m256i shift_cnt = _mm256_sub_epi32(_mm256_set1_epi32(6), leading_one);
+    mantissa = _mm256_and_si256(
+        _mm256_sllv_epi32(mantissa, _mm256_add_epi32(shift_cnt, _mm256_set1_epi32(1))), _mm256_set1_epi32(0x7f));
+    __m256i exp = _mm256_andnot_si256(is_zero, _mm256_sub_epi32(shared_exp, _mm256_add_epi32(rebias_offset, shift_cnt)));
+    return _mm256_or_si256(sign, _mm256_or_si256(_mm256_slli_epi32(exp, 23), _mm256_slli_epi32(mantissa, 16)));
+}
+
+inline void unpack_bfp8_face_row_avx2(const uint8_t *src, uint32_t shared_exp, bool is_exp_a, float *dst) {
+    // This rebias offset must be added if we are working with BFP8 format
+    __m256i rebias_offset = is_exp_a ? _mm256_set1_epi32(-112) : _mm256_setzero_si256();
+    __m256i exp = _mm256_set1_epi32(shared_exp);
+    for (uint32_t i = 0; i < BFP8_FACE_ROW_WIDTH; i += 8) {
+        __m256i input = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i)));
+        _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(convert_bfp8_to_u32_avx2(input, exp, rebias_offset)));
+    }
+}
+
+__attribute__((target("avx512f"))) inline void unpack_bfp8_face_row_avx512(const uint8_t *src, uint32_t shared_exp, bool is_exp_a, float *dst) {
+    __m512i input = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)));
+    __m512i sign = _mm512_slli_epi32(_mm512_srli_epi32(input, 7), 31);
+    __m512i mantissa = _mm512_and_si512(input, _mm512_set1_epi32(0x7f));
+    __mmask16 is_non_zero = _mm512_test_epi32_mask(mantissa, mantissa);
+    __m512i leading_one = _mm512_sub_epi32(
+        _mm512_srli_epi32(_mm512_castps_si512(_mm512_cvtepi32_ps(mantissa)), 23), _mm512_set1_epi32(127));
+    __m512i shift_cnt = _mm512_sub_epi32(_mm512_set1_epi32(6), leading_one);
+    mantissa = _mm512_and_si512(
+        _mm512_sllv_epi32(mantissa, _mm512_add_epi32(shift_cnt, _mm512_set1_epi32(1))), _mm512_set1_epi32(0x7f));
+    __m512i exp = _mm512_maskz_sub_epi32(
+        is_non_zero, _mm512_set1_epi32(shared_exp + (is_exp_a ? 112 : 0)), shift_cnt);
+    __m512i result = _mm512_or_si512(sign, _mm512_or_si512(_mm512_slli_epi32(exp, 23), _mm512_slli_epi32(mantissa, 16)));
+    _mm512_storeu_si512(dst, result);
+}
+
+template <bool truncate_bfp_mantissa>
+inline void pack_bfp8_tiles_avx2(
+    const float *src, const Bfp8TileAddressing &addressing, uint32_t begin, uint32_t end, bool is_exp_a, uint32_t *dst) {
+    for (uint32_t tile_index = begin; tile_index < end; tile_index++) {
+        const float *tile = src + addressing.tile_offset(tile_index);
+        uint8_t *exponents = reinterpret_cast<uint8_t *>(dst + size_t(tile_index) * BFP8_WORDS_IN_TILE);
+        uint8_t *data = exponents + BFP8_EXPONENT_BYTES_IN_TILE;
+        for (uint32_t face_row = 0; face_row < BFP8_FACE_ROWS_IN_TILE; face_row++) {
+            exponents[face_row] = pack_bfp8_face_row_avx2<truncate_bfp_mantissa>(
+                tile + addressing.face_row_offset(face_row), is_exp_a, data + face_row * BFP8_FACE_ROW_WIDTH);
+        }
+    }
+}
+
+template <bool truncate_bfp_mantissa>
+__attribute__((target("avx512f"))) inline void pack_bfp8_tiles_avx512(
+    const float *src, const Bfp8TileAddressing &addressing, uint32_t begin, uint32_t end, bool is_exp_a, uint32_t *dst) {
+    for (uint32_t tile_index = begin; tile_index < end; tile_index++) {
+        const float *tile = src + addressing.tile_offset(tile_index);
+        uint8_t *exponents = reinterpret_cast<uint8_t *>(dst + size_t(tile_index) * BFP8_WORDS_IN_TILE);
+        uint8_t *data = exponents + BFP8_EXPONENT_BYTES_IN_TILE;
+        for (uint32_t face_row = 0; face_row < BFP8_FACE_ROWS_IN_TILE; face_row++) {
+            exponents[face_row] = pack_bfp8_face_row_avx512<truncate_bfp_mantissa>(
+                tile + addressing.face_row_offset(face_row), is_exp_a, data + face_row * BFP8_FACE_ROW_WIDTH);
+        }
+    }
+}
+
+inline void unpack_bfp8_tiles_avx2(
+    const uint32_t *src, const Bfp8TileAddressing &addressing, uint32_t begin, uint32_t end, bool is_exp_a, float *dst) {
+    for (uint32_t tile_index = begin; tile_index < end; tile_index++) {
+        const uint8_t *exponents = reinterpret_cast<const uint8_t *>(src + size_t(tile_index) * BFP8_WORDS_IN_TILE);
+        const uint8_t *data = exponents + BFP8_EXPONENT_BYTES_IN_TILE;
+        float *tile = dst + addressing.tile_offset(tile_index);
+        for (uint32_t face_row = 0; face_row < BFP8_FACE_ROWS_IN_TILE; face_row++) {
+            unpack_bfp8_face_row_avx2(
+                data + face_row * BFP8_FACE_ROW_WIDTH, exponents[face_row], is_exp_a, tile + addressing.face_row_offset(face_row));
+        }
+    }
+}
+
+__attribute__((target("avx512f"))) inline void unpack_bfp8_tiles_avx512(
+    const uint32_t *src, const Bfp8TileAddressing &addressing, uint32_t begin, uint32_t end, bool is_exp_a, float *dst) {
+    for (uint32_t tile_index = begin; tile_index < end; tile_index++) {
+        const uint8_t *exponents = reinterpret_cast<const uint8_t *>(src + size_t(tile_index) * BFP8_WORDS_IN_TILE);
+        const uint8_t *data = exponents + BFP8_EXPONENT_BYTES_IN_TILE;
+        float *tile = dst + addressing.tile_offset(tile_index);
+        for (uint32_t face_row = 0; face_row < BFP8_FACE_ROWS_IN_TILE; face_row++) {
+            unpack_bfp8_face_row_avx512(
+                data + face_row * BFP8_FACE_ROW_WIDTH, exponents[face_row], is_exp_a, tile + addressing.face_row_offset(face_row));
         }
     }
+}
+
+// Packs num_tiles tiles of float data into bfp8 tiles, tiles are converted in parallel on the executor
+template <bool truncate_bfp_mantissa = false>
+inline std::vector<uint32_t> pack_fp32_as_bfp8_tiles(const float *data, uint32_t num_tiles, const Bfp8TileAddressing &addressing, bool is_exp_a) {
+    ZoneScoped;
+    std::vector<uint32_t> packed_result(size_t(num_tiles) * BFP8_WORDS_IN_TILE);
+    bool use_avx512 = bfp8_cpu_supports_avx512();
+    uint32_t *dst = packed_result.data();
+    size_t num_bytes = size_t(num_tiles) * FLOATS_IN_TILE * sizeof(float);
+    tt::tt_metal::detail::parallel_for(
+        num_tiles, num_bytes / tt::tt_metal::detail::PARALLEL_FOR_MIN_BYTES_PER_TASK, [&](uint32_t begin, uint32_t end) {
+            if (use_avx512) {
+                pack_bfp8_tiles_avx512<truncate_bfp_mantissa>(data, addressing, begin, end, is_exp_a, dst);
+            } else {
+                pack_bfp8_tiles_avx2<truncate_bfp_mantissa>(data, addressing, begin, end, is_exp_a, dst);
+            }
+        });
+    return packed_result;
+}
+
+// Unpacks bfp8 tiles into float data, tiles are converted in parallel on the executor
+inline std::vector<float> unpack_bfp8_tiles_into_float_vec(const uint32_t *bfp8_tiles, uint32_t num_tiles, const Bfp8TileAddressing &addressing, bool is_exp_a) {
+    ZoneScoped;
+    std::vector<float> float_vec(size_t(num_tiles) * FLOATS_IN_TILE);
+    bool use_avx512 = bfp8_cpu_supports_avx512();
+    float *dst = float_vec.data();
+    size_t num_bytes = size_t(num_tiles) * FLOATS_IN_TILE * sizeof(float);
+    tt::tt_metal::detail::parallel_for(
+        num_tiles, num_bytes / tt::tt_metal::detail::PARALLEL_FOR_MIN_BYTES_PER_TASK, [&](uint32_t begin, uint32_t end) {
+            if (use_avx512) {
+                unpack_bfp8_tiles_avx512(bfp8_tiles, addressing, begin, end, is_exp_a, dst);
+            } else {
+                unpack_bfp8_tiles_avx2(bfp8_tiles, addressing, begin, end, is_exp_a, dst);
+            }
+        });
     return float_vec;
 }
 
+// row_major_input means each 32x32 tile of fp32_vec is row major, otherwise each tile is 4 row major faces
+template <bool truncate_bfp_mantissa = false>
+inline std::vector<uint32_t> pack_fp32_vec_as_bfp8_tiles(const std::vector<float> &fp32_vec, bool row_major_input, bool is_exp_a) {
+    TT_ASSERT(fp32_vec.size() % FLOATS_IN_TILE == 0);
+    uint32_t num_tiles = fp32_vec.size() / FLOATS_IN_TILE;
+    return pack_fp32_as_bfp8_tiles<truncate_bfp_mantissa>(
+        fp32_vec.data(), num_tiles, Bfp8TileAddressing{.row_major = row_major_input, .rows = 32, .cols = 32}, is_exp_a);
+}
+
+// Packs num_blocks row major [rows, cols] matrices as bfp8 tiles, fusing the conversion to tile layout
+template <bool truncate_bfp_mantissa = false>
+inline std::vector<uint32_t> pack_row_major_fp32_as_bfp8_tiles(const float *data, uint32_t num_blocks, uint32_t rows, uint32_t cols, bool is_exp_a) {
+    TT_ASSERT(rows % 32 == 0 and cols % 32 == 0, "rows and cols must be divisible by 32");
+    uint32_t num_tiles = num_blocks * (rows / 32) * (cols / 32);
+    return pack_fp32_as_bfp8_tiles<truncate_bfp_mantissa>(
+        data, num_tiles, Bfp8TileAddressing{.row_major = true, .rows = rows, .cols = cols}, is_exp_a);
+}
+
+inline std::vector<float> unpack_bfp8_tiles_into_float_vec(const std::vector<uint32_t> &bfp8_tiles, bool row_major_output, bool is_exp_a) {
+    TT_ASSERT(bfp8_tiles.size() % BFP8_WORDS_IN_TILE == 0);
+    uint32_t num_tiles = bfp8_tiles.size() / BFP8_WORDS_IN_TILE;
+    return unpack_bfp8_tiles_into_float_vec(
+        bfp8_tiles.data(), num_tiles, Bfp8TileAddressing{.row_major = row_major_output, .rows = 32, .cols = 32}, is_exp_a);
+}
+
+// Unpacks bfp8 tiles into num_blocks row major [rows, cols] matrices, fusing the conversion from tile layout
+inline std::vector<float> unpack_bfp8_tiles_into_row_major_float_vec(const std::vector<uint32_t> &bfp8_tiles, uint32_t num_blocks, uint32_t rows, uint32_t cols, bool is_exp_a) {
+    TT_ASSERT(rows % 32 == 0 and cols % 32 == 0, "rows and cols must be divisible by 32");
+    uint32_t num_tiles = num_blocks * (rows / 32) * (cols / 32);
+    TT_ASSERT(bfp8_tiles.size() == size_t(num_tiles) * BFP8_WORDS_IN_TILE);
+    return unpack_bfp8_tiles_into_float_vec(
+        bfp8_tiles.data(), num_tiles, Bfp8TileAddressing{.row_major = true, .rows = rows, .cols = cols}, is_exp_a);
+}
+
 inline std::vector<uint32_t> create_random_vector_of_bfp8(uint32_t num_bytes, bool is_exp_a, int rand_max_float, int seed, float offset = 0.0f) {
     uint32_t single_bfp8_tile_size = tile_size(tt::DataFormat::Bfp8_b);
     TT_ASSERT(num_bytes % single_bfp8_tile_size == 0);
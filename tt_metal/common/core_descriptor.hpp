@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "core_coord.h"
 #include "tt_metal/llrt/tt_cluster.hpp"
 #include "yaml-cpp/yaml.h"
@@ -69,6 +71,9 @@ inline const std::string get_product_name(tt::ARCH arch, uint32_t num_harvested_
 inline const core_descriptor_t &get_core_descriptor_config(chip_id_t device_id, const uint8_t num_hw_cqs) {
     // {arch : {product : {num hardware command queues : config}}}
     static std::unordered_map<ARCH, std::unordered_map<std::string, std::unordered_map<uint8_t, core_descriptor_t>>> config_by_arch;
+    // Devices may be initialized concurrently, cached entries are never moved so references to them stay valid
+    static std::mutex config_mutex;
+    std::lock_guard<std::mutex> lock(config_mutex);
 
     ARCH arch = tt::Cluster::instance().arch();
     uint32_t harvesting_mask = tt::Cluster::instance().get_harvested_rows(device_id);
@@ -157,6 +162,8 @@ inline uint32_t get_storage_core_bank_size(chip_id_t device_id, const uint8_t nu
 inline const std::vector<CoreCoord> &get_logical_storage_cores(chip_id_t device_id, const uint8_t num_hw_cqs) {
     const core_descriptor_t &core_desc = get_core_descriptor_config(device_id, num_hw_cqs);
     static std::unordered_map<chip_id_t, std::vector<CoreCoord>> logical_storage_cores_by_device;
+    static std::mutex logical_storage_cores_mutex;
+    std::lock_guard<std::mutex> lock(logical_storage_cores_mutex);
     if (logical_storage_cores_by_device.count(device_id)) {
         return logical_storage_cores_by_device.at(device_id);
     }
@@ -175,6 +182,8 @@ inline CoreCoord get_compute_grid_size(chip_id_t device_id, const uint8_t num_hw
 inline const std::vector<CoreCoord> &get_logical_compute_cores(chip_id_t device_id, const uint8_t num_hw_cqs) {
     const core_descriptor_t &core_desc = get_core_descriptor_config(device_id, num_hw_cqs);
     static std::unordered_map<chip_id_t, std::vector<CoreCoord>> logical_compute_cores_by_device;
+    static std::mutex logical_compute_cores_mutex;
+    std::lock_guard<std::mutex> lock(logical_compute_cores_mutex);
     if (logical_compute_cores_by_device.count(device_id)) {
         return logical_compute_cores_by_device.at(device_id);
     }
@@ -188,6 +197,8 @@ inline const std::vector<CoreCoord> &get_logical_compute_cores(chip_id_t device_
 inline const std::vector<CoreCoord> &get_logical_dispatch_cores(chip_id_t device_id, const uint8_t num_hw_cqs) {
     const core_descriptor_t &core_desc = get_core_descriptor_config(device_id, num_hw_cqs);
     static std::unordered_map<chip_id_t, std::vector<CoreCoord>> logical_dispatch_cores_by_device;
+    static std::mutex logical_dispatch_cores_mutex;
+    std::lock_guard<std::mutex> lock(logical_dispatch_cores_mutex);
     if (logical_dispatch_cores_by_device.count(device_id)) {
         return logical_dispatch_cores_by_device.at(device_id);
     }
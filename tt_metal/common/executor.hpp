@@ -4,15 +4,20 @@
 
 #pragma once
 #include "third_party/taskflow/taskflow/taskflow.hpp"
+#include <algorithm>
+#include <functional>
+#include <future>
 #include <thread>
 #include <stdexcept>
+#include <vector>
 
 namespace tt::tt_metal::detail {
-    static const size_t EXECUTOR_NTHREADS = std::getenv("TT_METAL_THREADCOUNT") ? std::stoi( std::getenv("TT_METAL_THREADCOUNT") ) : std::thread::hardware_concurrency();
+    inline const size_t EXECUTOR_NTHREADS = std::getenv("TT_METAL_THREADCOUNT") ? std::stoi( std::getenv("TT_METAL_THREADCOUNT") ) : std::thread::hardware_concurrency();
 
     using Executor = tf::Executor;
     using ExecTask = tf::Task;
-    static Executor& GetExecutor() {
+    // inline so that every translation unit shares one executor
+    inline Executor& GetExecutor() {
         static Executor exec(EXECUTOR_NTHREADS);
         return exec;
     }
@@ -34,4 +39,27 @@ namespace tt::tt_metal::detail {
 
         return res;
     }
+
+    // Bytes of work below which a parallel_for task is not worth the executor round trip, callers pass
+    // num_bytes / PARALLEL_FOR_MIN_BYTES_PER_TASK as max_tasks
+    constexpr size_t PARALLEL_FOR_MIN_BYTES_PER_TASK = 256 * 1024;
+
+    // Runs fn(begin, end) over [0, num_items) split into at most max_tasks chunks, the calling thread runs the first one
+    // Calls from executor workers run inline, a worker blocking on other workers could starve the executor
+    inline void parallel_for(uint32_t num_items, size_t max_tasks, const std::function<void(uint32_t, uint32_t)>& fn) {
+        size_t num_tasks = std::min<size_t>({EXECUTOR_NTHREADS, num_items, max_tasks});
+        if (num_tasks <= 1 or GetExecutor().this_worker_id() >= 0) {
+            fn(0, num_items);
+            return;
+        }
+        std::vector<std::future<void>> events;
+        uint32_t items_per_task = (num_items + num_tasks - 1) / num_tasks;
+        for (uint32_t begin = items_per_task; begin < num_items; begin += items_per_task) {
+            events.emplace_back(detail::async(fn, begin, std::min(num_items, begin + items_per_task)));
+        }
+        fn(0, std::min(num_items, items_per_task));
+        for (auto& event : events) {
+            event.get();
+        }
+    }
 }
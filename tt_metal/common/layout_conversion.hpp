@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Host conversion between row major and tile layout (32x32 tiles made of four row major 16x16 faces).
+// Every 16 element face row is a contiguous 32 B (16 bit types) or 64 B (32 bit types) run on both sides, so the
+// conversion is a sequence of SIMD row moves. Large tensors are split by rows of tiles across the executor.
+//
+
+#pragma once
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include "common/assert.hpp"
+#include "common/executor.hpp"
+#include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
+
+namespace tt::tt_metal {
+
+namespace layout_conversion {
+
+constexpr uint32_t TILE_HEIGHT = 32;
+constexpr uint32_t TILE_WIDTH = 32;
+constexpr uint32_t FACE_HEIGHT = 16;
+constexpr uint32_t FACE_WIDTH = 16;
+constexpr uint32_t FACE_NUM_ELEMENTS = FACE_HEIGHT * FACE_WIDTH;
+constexpr uint32_t TILE_NUM_ELEMENTS = TILE_HEIGHT * TILE_WIDTH;
+
+// Layout conversion only moves bits, so any 16 or 32 bit element (bfloat16, float, uint32_t, ...) is supported
+template <typename T>
+constexpr bool is_supported_type = sizeof(T) == 2 or sizeof(T) == 4;
+
+namespace detail {
+
+template <size_t NumBytes>
+inline void copy_face_row(const std::uint8_t* src, std::uint8_t* dst) {
+    static_assert(NumBytes % 32 == 0);
+#if defined(__x86_64__) and defined(__AVX512F__)
+    if constexpr (NumBytes % 64 == 0) {
+        for (size_t i = 0; i < NumBytes; i += 64) {
+            _mm512_storeu_si512(reinterpret_cast<void*>(dst + i), _mm512_loadu_si512(reinterpret_cast<const void*>(src + i)));
+        }
+        return;
+    }
+#endif
+#if defined(__x86_64__) and defined(__AVX2__)
+    for (size_t i = 0; i < NumBytes; i += 32) {
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(dst + i), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)));
+    }
+#else
+    std::memcpy(dst, src, NumBytes);
+#endif
+}
+
+// Rows of the source tile are read with a stride of row_bytes, the tile is written sequentially
+template <size_t ElementSize>
+inline void tilize_one_tile(const std::uint8_t* src_tile, size_t row_bytes, std::uint8_t* dst_tile) {
+    constexpr size_t FACE_ROW_BYTES = FACE_WIDTH * ElementSize;
+    for (uint32_t row = 0; row < TILE_HEIGHT; row++) {
+        const std::uint8_t* src_row = src_tile + row * row_bytes;
+        std::uint8_t* dst_face = dst_tile + ((row / FACE_HEIGHT) * 2 * FACE_NUM_ELEMENTS + (row % FACE_HEIGHT) * FACE_WIDTH) * ElementSize;
+        copy_face_row<FACE_ROW_BYTES>(src_row, dst_face);
+        copy_face_row<FACE_ROW_BYTES>(src_row + FACE_ROW_BYTES, dst_face + FACE_NUM_ELEMENTS * ElementSize);
+    }
+}
+
+template <size_t ElementSize>
+void tilize_tile_rows(const std::uint8_t* src, std::uint8_t* dst, uint32_t cols, uint32_t begin, uint32_t end) {
+    const size_t row_bytes = size_t(cols) * ElementSize;
+    const uint32_t col_tiles = cols / TILE_WIDTH;
+    for (uint32_t tile_row = begin; tile_row < end; tile_row++) {
+        const std::uint8_t* src_tile_row = src + size_t(tile_row) * TILE_HEIGHT * row_bytes;
+        std::uint8_t* dst_tile = dst + size_t(tile_row) * col_tiles * TILE_NUM_ELEMENTS * ElementSize;
+        for (uint32_t col_tile = 0; col_tile < col_tiles; col_tile++) {
+            tilize_one_tile<ElementSize>(src_tile_row + size_t(col_tile) * TILE_WIDTH * ElementSize, row_bytes, dst_tile);
+            dst_tile += TILE_NUM_ELEMENTS * ElementSize;
+        }
+    }
+}
+
+template <size_t ElementSize>
+void untilize_tile_rows(const std::uint8_t* src, std::uint8_t* dst, uint32_t cols, uint32_t begin, uint32_t end) {
+    constexpr size_t FACE_ROW_BYTES = FACE_WIDTH * ElementSize;
+    const size_t row_bytes = size_t(cols) * ElementSize;
+    const uint32_t col_tiles = cols / TILE_WIDTH;
+    for (uint32_t tile_row = begin; tile_row < end; tile_row++) {
+        const std::uint8_t* src_tile = src + size_t(tile_row) * col_tiles * TILE_NUM_ELEMENTS * ElementSize;
+        std::uint8_t* dst_tile_row = dst + size_t(tile_row) * TILE_HEIGHT * row_bytes;
+        for (uint32_t col_tile = 0; col_tile < col_tiles; col_tile++) {
+            std::uint8_t* dst_tile = dst_tile_row + size_t(col_tile) * TILE_WIDTH * ElementSize;
+            for (uint32_t row = 0; row < TILE_HEIGHT; row++) {
+                const std::uint8_t* src_face = src_tile + ((row / FACE_HEIGHT) * 2 * FACE_NUM_ELEMENTS + (row % FACE_HEIGHT) * FACE_WIDTH) * ElementSize;
+                std::uint8_t* dst_row = dst_tile + row * row_bytes;
+                copy_face_row<FACE_ROW_BYTES>(src_face, dst_row);
+                copy_face_row<FACE_ROW_BYTES>(src_face + FACE_NUM_ELEMENTS * ElementSize, dst_row + FACE_ROW_BYTES);
+            }
+            src_tile += TILE_NUM_ELEMENTS * ElementSize;
+        }
+    }
+}
+
+inline void validate_shape(uint32_t num_blocks, uint32_t rows, uint32_t cols) {
+    TT_ASSERT(num_blocks > 0 and rows > 0 and cols > 0, "None of the number of blocks, rows, nor cols can be 0");
+    TT_ASSERT((rows % TILE_HEIGHT == 0) and (cols % TILE_WIDTH == 0), "rows and cols must be divisible by 32");
+}
+
+}  // namespace detail
+
+/**
+ * Converts num_blocks row major [rows, cols] matrices into tiles, tiles of a block are stored in row major order
+ * dst must hold num_blocks * rows * cols elements and must not overlap src
+ */
+template <typename T>
+void tilize(const T* src, T* dst, uint32_t num_blocks, uint32_t rows, uint32_t cols) {
+    ZoneScoped;
+    static_assert(is_supported_type<T>, "Layout conversion supports 16 and 32 bit types");
+    detail::validate_shape(num_blocks, rows, cols);
+    uint32_t num_tile_rows = num_blocks * (rows / TILE_HEIGHT);
+    size_t num_bytes = size_t(num_blocks) * rows * cols * sizeof(T);
+    tt_metal::detail::parallel_for(num_tile_rows, num_bytes / tt_metal::detail::PARALLEL_FOR_MIN_BYTES_PER_TASK, [src, dst, cols](uint32_t begin, uint32_t end) {
+        detail::tilize_tile_rows<sizeof(T)>(
+            reinterpret_cast<const std::uint8_t*>(src), reinterpret_cast<std::uint8_t*>(dst), cols, begin, end);
+    });
+}
+
+/**
+ * Converts a single 32x32 tile whose rows start every src_cols elements of src, dst must hold 1024 elements
+ */
+template <typename T>
+inline void tilize_tile(const T* src, uint32_t src_cols, T* dst) {
+    static_assert(is_supported_type<T>, "Layout conversion supports 16 and 32 bit types");
+    detail::tilize_one_tile<sizeof(T)>(
+        reinterpret_cast<const std::uint8_t*>(src), size_t(src_cols) * sizeof(T), reinterpret_cast<std::uint8_t*>(dst));
+}
+
+/**
+ * Inverse of tilize, converts num_blocks matrices of [rows / 32, cols / 32] tiles back to row major
+ * dst must hold num_blocks * rows * cols elements and must not overlap src
+ */
+template <typename T>
+void untilize(const T* src, T* dst, uint32_t num_blocks, uint32_t rows, uint32_t cols) {
+    ZoneScoped;
+    static_assert(is_supported_type<T>, "Layout conversion supports 16 and 32 bit types");
+    detail::validate_shape(num_blocks, rows, cols);
+    uint32_t num_tile_rows = num_blocks * (rows / TILE_HEIGHT);
+    size_t num_bytes = size_t(num_blocks) * rows * cols * sizeof(T);
+    tt_metal::detail::parallel_for(num_tile_rows, num_bytes / tt_metal::detail::PARALLEL_FOR_MIN_BYTES_PER_TASK, [src, dst, cols](uint32_t begin, uint32_t end) {
+        detail::untilize_tile_rows<sizeof(T)>(
+            reinterpret_cast<const std::uint8_t*>(src), reinterpret_cast<std::uint8_t*>(dst), cols, begin, end);
+    });
+}
+
+}  // namespace layout_conversion
+
+}  // namespace tt::tt_metal
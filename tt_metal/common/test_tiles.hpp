@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <vector>
 #include "common/assert.hpp"
+#include "tt_metal/common/layout_conversion.hpp"
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
 #include "math.hpp"
 
@@ -175,9 +176,37 @@ struct TensAddr {
     }
 };
 
+// Row major <-> 4 faces conversion of tile aligned NCHW tensors doesn't need the intermediate swizzled layout
+template<typename T, template<typename> typename BufferType>
+inline bool can_convert_layout_directly(const BufferType<T>& inp, const vector<uint32_t>& shape) {
+    if constexpr (not tt::tt_metal::layout_conversion::is_supported_type<T>) {
+        return false;
+    } else {
+        if (shape.size() != 4 or shape[2] % 32 != 0 or shape[3] % 32 != 0) {
+            return false;
+        }
+        size_t volume = size_t(shape[0]) * shape[1] * shape[2] * shape[3];
+        return volume > 0 and inp.size() == volume;
+    }
+}
+
 template<typename T, template<typename> typename BufferType>
 inline vector<T> convert_layout(const BufferType<T>& inp, const vector<uint32_t>& shape, TensorLayout inL, TensorLayout outL) {
     ZoneScoped;
+    if constexpr (tt::tt_metal::layout_conversion::is_supported_type<T>) {
+        bool row_major_to_tile = inL == LIN_ROW_MAJOR and outL == TILED32_4FACES;
+        bool tile_to_row_major = inL == TILED32_4FACES and outL == LIN_ROW_MAJOR;
+        if ((row_major_to_tile or tile_to_row_major) and can_convert_layout_directly<T>(inp, shape)) {
+            vector<T> result(inp.size());
+            uint32_t num_blocks = shape[0] * shape[1];
+            if (row_major_to_tile) {
+                tt::tt_metal::layout_conversion::tilize(&inp[0], result.data(), num_blocks, shape[2], shape[3]);
+            } else {
+                tt::tt_metal::layout_conversion::untilize(&inp[0], result.data(), num_blocks, shape[2], shape[3]);
+            }
+            return result;
+        }
+    }
     switch (inL) {
         case TILED32_SWIZZLED:
             if (outL == TILED32_4FACES) {
@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <unordered_set>
+
 namespace tt::tt_metal::detail
 {
     struct HashLookup {
@@ -26,15 +30,46 @@ namespace tt::tt_metal::detail
         return ret;
     }
 
-    void clear() {
+    // The thread that wins add() builds the binaries, other threads wanting the same hash wait for it to finish
+    void mark_generated(size_t khash) {
+        {
+            unique_lock<mutex> lock(mutex_);
+            generated_.insert(khash);
+        }
+        generated_cv_.notify_all();
+    }
+    // Build failed, forget the hash so a later compile can retry
+    void erase(size_t khash) {
+        {
+            unique_lock<mutex> lock(mutex_);
+            hashes_.erase(khash);
+        }
+        generated_cv_.notify_all();
+    }
+    // Returns false if the build of the hash failed
+    bool wait_generated(size_t khash) {
         unique_lock<mutex> lock(mutex_);
-        hashes_.clear();
+        generated_cv_.wait(lock, [this, khash] {
+            return generated_.find(khash) != generated_.end() or hashes_.find(khash) == hashes_.end();
+        });
+        return generated_.find(khash) != generated_.end();
+    }
+
+    void clear() {
+        {
+            unique_lock<mutex> lock(mutex_);
+            hashes_.clear();
+            generated_.clear();
+        }
+        generated_cv_.notify_all();
     }
 
 
     private:
         std::mutex mutex_;
+        std::condition_variable generated_cv_;
         std::unordered_set<size_t > hashes_;
+        std::unordered_set<size_t > generated_;
     };
 
 
@@ -9,7 +9,8 @@
 namespace tt::tt_metal::detail{
 
 /**
- * Enable kernel compilation cache to be persistent across runs. When this is called, kernels will not be compiled if the output binary path exists.
+ * Enable kernel compilation cache to be persistent across runs. When this is called, kernels will not be compiled if a complete build
+ * made with the same toolchain, flags and firmware exists in the kernel binary cache.
  *
  * Return value: void
  */
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include <map>
 #include <mutex>
 #include <variant>
 
@@ -69,6 +70,23 @@ namespace tt::tt_metal{
         */
         void ReadShard(const Buffer &buffer, std::vector<uint32_t> &host_buffer, const uint32_t & core_id);
 
+        /**
+        * Opens several devices concurrently, a multi chip host initializes in about the time of one chip. Devices
+        * with the same firmware build it once. Remote devices are initialized after their MMIO devices
+        *
+        * Return value: std::map<chip_id_t, Device *>, the opened devices by id
+        *
+        * | Argument      | Description                                    | Data type                      | Valid range                       | Required |
+        * |---------------|------------------------------------------------|--------------------------------|-----------------------------------|----------|
+        * | device_ids    | IDs of the devices to open                     | const std::vector<chip_id_t> & | 0 to (GetNumAvailableDevices - 1) | Yes      |
+        * | num_hw_cqs    | Number of hardware command queues per device   | const uint8_t                  | 1 or 2                            | No       |
+        * | l1_bank_remap | Remapping of L1 banks, applied to every device | const std::vector<uint32_t> &  |                                   | No       |
+        */
+        std::map<chip_id_t, Device *> CreateDevices(const std::vector<chip_id_t> &device_ids, const uint8_t num_hw_cqs = 1, const std::vector<uint32_t> &l1_bank_remap = {});
+
+        // Closes every device returned by CreateDevices
+        void CloseDevices(const std::map<chip_id_t, Device *> &devices);
+
 
 
         // Launches all kernels on cores specified with kernels in the program.
@@ -308,6 +326,15 @@ namespace tt::tt_metal{
             }
         }
 
+        // Drops the device-side binaries and transfer map cached for program_id, used when a program is evicted. Their
+        // device buffer is only freed by the next Finish of the queue, so eviction never waits on the device
+        inline void ReleaseCommandQueueProgram(Device *device, uint64_t program_id)
+        {
+            if (std::getenv("TT_METAL_SLOW_DISPATCH_MODE") == nullptr) {
+                ReleaseProgram(GetCommandQueue(device), program_id);
+            }
+        }
+
         inline void GenerateDeviceHeaders(Device *device,
                                           const std::string &path)
         {
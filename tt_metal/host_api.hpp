@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <optional>
 #include <variant>
 #include <vector>
@@ -212,7 +213,7 @@ void DeallocateBuffer(Buffer &buffer);
 // ==================================================
 
 /**
- * Set runtime args for a kernel that are sent to the core during runtime. This API needs to be called to update the runtime args for the kernel.
+ * Set runtime args for a kernel that are sent to the core during runtime. This API needs to be called to update the runtime args for the kernel. The number of args of a core is fixed by the first call that sets them, later calls must pass as many and throw otherwise, in every build type.
  *
  * Return value: void
  *
@@ -240,9 +241,36 @@ void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vari
 void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vector< CoreCoord > & core_spec, const std::vector< std::vector<uint32_t> > &runtime_args);
 
 /**
- * Get the runtime args for a kernel.
+ * Set the runtime args of a kernel on one core from args previously returned by GetRuntimeArgs. Args read back with GetRuntimeArgs are views of the kernel's args, so writes through them already update the args and this call only validates them.
  *
- * Return value: std::vector<uint32_t> &
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                                                         | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|---------------------------------------------------------------------|----------|
+ * | program      | The program containing kernels, circular buffers, semaphores           | const Program &               |                                                                     | Yes      |
+ * | kernel_id    | ID of the kernel that will receive the runtime args                    | KernelHandle (uint64_t)       |                                                                     | Yes      |
+ * | logical_core | Location of the Tensix core where the runtime args will be written     | const CoreCoord &             | Any logical Tensix core coordinate on which the kernel is placed    | Yes      |
+ * | runtime_args | The runtime args to be written                                         | const RuntimeArgsData &       |                                                                     | Yes      |
+ */
+void SetRuntimeArgs(const Program &program, KernelHandle kernel, const CoreCoord &logical_core, const RuntimeArgsData &runtime_args);
+
+/**
+ * Set the common runtime args of a kernel. Common runtime args are the same on all cores the kernel is placed on, they are stored once and multicast to the cores. Kernels read them with get_common_arg_val. Not supported on ethernet kernels. Like the args of a core, their number is fixed by the first call, later calls must pass as many and throw otherwise.
+ *
+ * Return value: void
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                                           | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|-------------------------------------------------------|----------|
+ * | program      | The program containing kernels, circular buffers, semaphores           | const Program &               |                                                       | Yes      |
+ * | kernel_id    | ID of the kernel that will receive the common runtime args             | KernelHandle (uint64_t)       |                                                       | Yes      |
+ * | runtime_args | The common runtime args to be written                                  | const std::vector<uint32_t> & | At most L1_COMMON_ARGS_SIZE bytes                     | Yes      |
+ */
+void SetCommonRuntimeArgs(const Program &program, KernelHandle kernel_id, const std::vector<uint32_t> &runtime_args);
+
+/**
+ * Get the runtime args for a kernel. The returned args are a view of the kernel's args, writing through it updates the args sent with the next enqueue of the program. The returned reference stays valid for the life of the program, but pointers into the args and copies of the view would move if a core later got wider args than any set before, so that throws once args were read back. Set the args of every core before reading any back.
+ *
+ * Return value: RuntimeArgsData &
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
  * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
@@ -250,35 +278,51 @@ void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vect
  * | kernel_id    | ID of the kernel that will receive the runtime args                    | KernelHandle (uint64_t)                |                                    | Yes      |
  * | logical_core | The location of the Tensix core where the runtime args will be written | const CoreCoord &             | Any logical Tensix core coordinate | Yes      |
  */
-std::vector<uint32_t>& GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core);
+RuntimeArgsData& GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core);
+
+/**
+ * Get the common runtime args for a kernel, a view of the args like GetRuntimeArgs.
+ *
+ * Return value: RuntimeArgsData &
+ *
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | program      | The program containing kernels, circular buffers, semaphores           | const Program &               |                                    | Yes      |
+ * | kernel_id    | ID of the kernel that will receive the common runtime args             | KernelHandle (uint64_t)       |                                    | Yes      |
+ */
+RuntimeArgsData& GetCommonRuntimeArgs(const Program &program, KernelHandle kernel_id);
 
 /**
  * Reads a buffer from the device
+ * A non-blocking read returns once the read is enqueued, a host thread copies the data into dst as the device produces
+ * it. buffer and dst must not be destroyed or resized until the returned future is ready, Finish also waits for it
  *
- * Return value: void
+ * Return value: std::shared_future<void>, ready once dst holds the buffer, rethrows errors hit while reading
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                            | Required |
  * |--------------|------------------------------------------------------------------------|-------------------------------|----------------------------------------|----------|
  * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                        | Yes      |
  * | buffer       | The device buffer we are reading from                                  | Buffer &                      |                                        | Yes      |
  * | dst          | The vector where the results that are read will be stored              | vector<uint32_t> &            |                                        | Yes      |
- * | blocking     | Whether or not this is a blocking operation                            | bool                          | Only blocking mode supported currently | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                          |                                        | Yes      |
  */
-void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking);
+std::shared_future<void> EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking);
 
 /**
  * Reads a buffer from the device
+ * A non-blocking read returns once the read is enqueued, a host thread copies the data into dst as the device produces
+ * it. buffer and dst must stay alive until the returned future is ready, Finish also waits for it
  *
- * Return value: void
+ * Return value: std::shared_future<void>, ready once dst holds the buffer, rethrows errors hit while reading
  *
  * | Argument     | Description                                                            | Type                          | Valid Range                            | Required |
  * |--------------|------------------------------------------------------------------------|-------------------------------|----------------------------------------|----------|
  * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                        | Yes      |
  * | buffer       | The device buffer we are reading from                                  | Buffer &                      |                                        | Yes      |
  * | dst          | The memory where the result will be stored                             | void*                         |                                        | Yes      |
- * | blocking     | Whether or not this is a blocking operation                            | bool                          | Only blocking mode supported currently | Yes      |
+ * | blocking     | Whether or not this is a blocking operation                            | bool                          |                                        | Yes      |
  */
-void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking);
+std::shared_future<void> EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking);
 
 /**
  * Writes a buffer to the device
@@ -367,6 +411,32 @@ void EndTrace(Trace& trace);
  */
 void EnqueueTrace(Trace& trace, bool blocking);
 
+/**
+ * Writes the commands, host data and declared patch points of a trace to a file. Unused command entries and data
+ * padding are not stored.
+ * Return value: void
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | trace        | The trace object which represents the history of previously issued     | const Trace &                 |                                    | Yes      |
+ * |              | commands                                                               |                               |                                    |          |
+ * | file_name    | Path of the trace file                                                 | const std::string &           |                                    | Yes      |
+ */
+void DumpTrace(const Trace& trace, const std::string& file_name);
+
+/**
+ * Reads a trace written by DumpTrace. Without a command queue the trace is host only, it can be patched, assembled
+ * and dumped but not replayed. With a command queue the trace is completed with EndTrace and then enqueued with
+ * EnqueueTrace. Commands read program binaries from the device, so the programs of the trace must have been enqueued
+ * on the device before.
+ * Return value: trace
+ * | Argument     | Description                                                            | Type                          | Valid Range                        | Required |
+ * |--------------|------------------------------------------------------------------------|-------------------------------|------------------------------------|----------|
+ * | cq           | The command queue object which dispatches the command to the hardware  | CommandQueue &                |                                    | No       |
+ * | file_name    | Path of the trace file                                                 | const std::string &           |                                    | Yes      |
+ */
+Trace LoadTrace(const std::string& file_name);
+Trace LoadTrace(CommandQueue& cq, const std::string& file_name);
+
 /**
  * Read device side profiler data and dump results into device side CSV log
  *
@@ -19,6 +19,8 @@ constexpr static std::uint32_t NCRISC_L1_ARG_BASE = 103 * 1024;
 constexpr static std::uint32_t NCRISC_L1_RESULT_BASE = 104 * 1024;
 constexpr static std::uint32_t TRISC_L1_ARG_BASE = 105 * 1024;
 constexpr static std::uint32_t L1_ALIGNMENT = 16;
+// Common runtime args, identical on all cores of a kernel, sit at the top of each RISC's runtime arg region
+constexpr static std::uint32_t L1_COMMON_ARGS_SIZE = 256;
 
 // config for 32 L1 buffers is at addr BUFFER_CONFIG_BASE
 // 12 bytes for each buffer: (addr, size, size_in_tiles)
@@ -67,6 +67,28 @@ FORCE_INLINE T get_arg_val(int arg_idx) {
     return *((volatile tt_l1_ptr T*)(get_arg_addr(arg_idx)));
 }
 
+#if !defined(COMPILE_FOR_ERISC)
+constexpr static uint32_t get_common_arg_addr(int arg_idx) {
+    // args are 4B in size
+    return L1_COMMON_ARG_BASE + (arg_idx << 2);
+}
+
+/**
+ * Returns the value of an argument set with SetCommonRuntimeArgs, these args are the same on all cores of the kernel.
+ *
+ * | Argument              | Description                        | Type                  | Valid Range | Required |
+ * |-----------------------|------------------------------------|-----------------------|-------------|----------|
+ * | arg_idx               | The index of the argument          | uint32_t              | 0 to 63     | True     |
+ * | T (template argument) | Data type of the returned argument | Any 4-byte sized type | N/A         | True     |
+ */
+template <typename T>
+FORCE_INLINE T get_common_arg_val(int arg_idx) {
+    // only 4B args are supported (eg int32, uint32)
+    static_assert("Error: only 4B args are supported" && sizeof(T) == 4);
+    return *((volatile tt_l1_ptr T*)(get_common_arg_addr(arg_idx)));
+}
+#endif
+
 /**
  * Returns the value of a constexpr argument from kernel_compile_time_args array provided during kernel creation using
  * CreateKernel calls.
@@ -39,6 +39,9 @@ constexpr std::uint32_t L1_RESULT_BASE = TRISC_L1_ARG_BASE +1024;
 constexpr std::uint32_t L1_ARG_BASE = eth_l1_mem::address_map::ERISC_L1_ARG_BASE;
 constexpr std::uint32_t L1_RESULT_BASE = eth_l1_mem::address_map::ERISC_APP_RESERVED_BASE;
 #endif
+#if !defined(COMPILE_FOR_ERISC)
+constexpr std::uint32_t L1_COMMON_ARG_BASE = L1_RESULT_BASE - L1_COMMON_ARGS_SIZE;
+#endif
 
 const uint32_t STREAM_RESTART_CHECK_MASK = (0x1 << 3) - 1;
 
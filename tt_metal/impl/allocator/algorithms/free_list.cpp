@@ -240,6 +240,8 @@ std::optional<uint64_t> FreeList::allocate(uint64_t size_bytes, bool bottom_up,
 
     this->update_lowest_occupied_address(allocated_block->address);
     if (allocated_block->address + this->offset_bytes_ < address_limit) {
+        // Given back so the failed allocation doesn't hold on to the slice
+        this->deallocate(allocated_block->address + this->offset_bytes_);
         TT_THROW("Out of Memory: Cannot allocate at an address below {}", address_limit);
     }
     return allocated_block->address + this->offset_bytes_;
@@ -0,0 +1,221 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+#include "common/assert.hpp"
+
+#include <fstream>
+#include <limits>
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+IndexedFreeList::IndexedFreeList(uint64_t max_size_bytes, uint64_t offset_bytes, uint64_t min_allocation_size, uint64_t alignment)
+    : Algorithm(max_size_bytes, offset_bytes, min_allocation_size, alignment) {
+    this->init();
+}
+
+void IndexedFreeList::init() {
+    auto block = this->blocks_.emplace(0, Block{.size = this->max_size_bytes_, .allocated = false}).first;
+    this->insert_free_block(block);
+}
+
+void IndexedFreeList::insert_free_block(BlockMap::const_iterator block) {
+    this->free_blocks_by_size_.emplace(block->second.size, block->first);
+}
+
+void IndexedFreeList::erase_free_block(BlockMap::const_iterator block) {
+    this->free_blocks_by_size_.erase({block->second.size, block->first});
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> IndexedFreeList::available_addresses(uint64_t size_bytes) const {
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = this->align(alloc_size);
+    std::vector<std::pair<uint64_t, uint64_t>> addresses;
+    for (const auto &[address, block] : this->blocks_) {
+        if (not block.allocated and block.size >= alloc_size) {
+            addresses.push_back({address, (address + block.size) - alloc_size});
+        }
+    }
+    return addresses;
+}
+
+// Offset marks the start of the allocated slice, free space left on either side stays in the free index
+uint64_t IndexedFreeList::allocate_slice_of_free_block(BlockMap::iterator free_block, uint64_t offset, uint64_t size_bytes) {
+    const uint64_t free_block_address = free_block->first;
+    const uint64_t free_block_size = free_block->second.size;
+    TT_ASSERT(not free_block->second.allocated and offset + size_bytes <= free_block_size);
+    this->erase_free_block(free_block);
+
+    const uint64_t allocated_address = free_block_address + offset;
+    auto allocated_block = free_block;
+    if (offset == 0) {
+        free_block->second = Block{.size = size_bytes, .allocated = true};
+    } else {
+        free_block->second.size = offset;
+        this->insert_free_block(free_block);
+        allocated_block = this->blocks_.emplace_hint(
+            std::next(free_block), allocated_address, Block{.size = size_bytes, .allocated = true});
+    }
+
+    uint64_t remaining_size = free_block_size - offset - size_bytes;
+    if (remaining_size > 0) {
+        auto remaining_block = this->blocks_.emplace_hint(
+            std::next(allocated_block), allocated_address + size_bytes, Block{.size = remaining_size, .allocated = false});
+        this->insert_free_block(remaining_block);
+    }
+    return allocated_address;
+}
+
+void IndexedFreeList::update_lowest_occupied_address(uint64_t address) {
+    if (not this->lowest_occupied_address_.has_value()) {
+        this->lowest_occupied_address_ = address;
+    } else {
+        this->lowest_occupied_address_ = std::min(this->lowest_occupied_address_.value(), address);
+    }
+}
+
+std::optional<uint64_t> IndexedFreeList::allocate(uint64_t size_bytes, bool bottom_up, uint64_t address_limit) {
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = this->align(alloc_size);
+
+    // Smallest block that fits, ties go to the block FreeList would reach first: lowest address when searching
+    // bottom up, highest address when searching top down
+    auto best_fit = this->free_blocks_by_size_.lower_bound({alloc_size, 0});
+    if (best_fit == this->free_blocks_by_size_.end()) {
+        return std::nullopt;
+    }
+    if (not bottom_up) {
+        best_fit = std::prev(this->free_blocks_by_size_.upper_bound({best_fit->first, std::numeric_limits<uint64_t>::max()}));
+    }
+    auto free_block = this->blocks_.find(best_fit->second);
+    TT_ASSERT(free_block != this->blocks_.end());
+
+    // offset denotes where allocation starts relative to free_block start
+    uint64_t offset = bottom_up ? 0 : free_block->second.size - alloc_size;
+    uint64_t allocated_address = this->allocate_slice_of_free_block(free_block, offset, alloc_size);
+
+    this->update_lowest_occupied_address(allocated_address);
+    if (allocated_address + this->offset_bytes_ < address_limit) {
+        // Given back so the failed allocation doesn't hold on to the slice
+        this->deallocate(allocated_address + this->offset_bytes_);
+        TT_THROW("Out of Memory: Cannot allocate at an address below {}", address_limit);
+    }
+    return allocated_address + this->offset_bytes_;
+}
+
+std::optional<uint64_t> IndexedFreeList::allocate_at_address(uint64_t absolute_start_address, uint64_t size_bytes) {
+    TT_ASSERT(absolute_start_address % this->alignment_ == 0, "Requested address " + std::to_string(absolute_start_address) + " should be " + std::to_string(this->alignment_) + "B aligned");
+    auto start_address = absolute_start_address - this->offset_bytes_;
+    uint64_t alloc_size = size_bytes < this->min_allocation_size_ ? this->min_allocation_size_ : size_bytes;
+    alloc_size = this->align(alloc_size);
+
+    // Blocks are disjoint so only the block containing start_address can hold the allocation
+    auto block = this->blocks_.upper_bound(start_address);
+    if (block == this->blocks_.begin()) {
+        return std::nullopt;
+    }
+    block--;
+    uint64_t start_offset = start_address - block->first;
+    if (block->second.allocated or start_offset >= block->second.size or block->second.size - start_offset < alloc_size) {
+        return std::nullopt;
+    }
+    this->allocate_slice_of_free_block(block, start_offset, alloc_size);
+    this->update_lowest_occupied_address(start_address);
+    return absolute_start_address;
+}
+
+void IndexedFreeList::update_lowest_occupied_address() {
+    auto block = this->blocks_.begin();
+    while (block != this->blocks_.end() and not block->second.allocated) {
+        block++;
+    }
+    if (block == this->blocks_.end()) {
+        this->lowest_occupied_address_ = std::nullopt;
+    } else {
+        this->lowest_occupied_address_ = block->first;
+    }
+}
+
+void IndexedFreeList::deallocate(uint64_t absolute_address) {
+    uint64_t address = absolute_address - this->offset_bytes_;
+    auto block_to_free = this->blocks_.find(address);
+    if (block_to_free == this->blocks_.end() or not block_to_free->second.allocated) {
+        return;
+    }
+    block_to_free->second.allocated = false;
+
+    auto next = std::next(block_to_free);
+    if (next != this->blocks_.end() and not next->second.allocated) {
+        this->erase_free_block(next);
+        block_to_free->second.size += next->second.size;
+        this->blocks_.erase(next);
+    }
+    if (block_to_free != this->blocks_.begin()) {
+        auto prev = std::prev(block_to_free);
+        if (not prev->second.allocated) {
+            this->erase_free_block(prev);
+            prev->second.size += block_to_free->second.size;
+            this->blocks_.erase(block_to_free);
+            block_to_free = prev;
+        }
+    }
+    this->insert_free_block(block_to_free);
+
+    if (address == this->lowest_occupied_address_) {
+        this->update_lowest_occupied_address();
+    }
+}
+
+void IndexedFreeList::clear() {
+    this->blocks_.clear();
+    this->free_blocks_by_size_.clear();
+    this->init();
+}
+
+Statistics IndexedFreeList::get_statistics() const {
+    Statistics stats{
+        .total_allocatable_size_bytes = this->max_size_bytes_,
+        .total_allocated_bytes = 0,
+        .total_free_bytes = 0,
+        .largest_free_block_bytes = 0
+    };
+
+    for (const auto &[address, block] : this->blocks_) {
+        if (block.allocated) {
+            stats.total_allocated_bytes += block.size;
+        } else {
+            stats.total_free_bytes += block.size;
+            if (block.size >= stats.largest_free_block_bytes) {
+                stats.largest_free_block_bytes = block.size;
+                stats.largest_free_block_addrs.push_back(address + this->offset_bytes_);
+            }
+        }
+    }
+    if (stats.total_allocated_bytes == 0) {
+        stats.total_free_bytes = this->max_size_bytes_;
+        stats.largest_free_block_bytes = this->max_size_bytes_;
+    }
+    return stats;
+}
+
+void IndexedFreeList::dump_blocks(std::ofstream &out) const {
+    out << ",,Blocks:\n";
+    for (const auto &[address, block] : this->blocks_) {
+        auto alloc_status = block.allocated ? "Y" : "N";
+        out << ",,,Address (KB):," << (address + this->offset_bytes_) / 1024 << "\n"
+            << ",,,Size (KB):," << (block.size) / 1024 << "\n"
+            << ",,,Allocated (Y/N):," << alloc_status << "\n";
+    }
+    out << "\n";
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
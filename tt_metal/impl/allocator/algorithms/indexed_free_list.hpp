@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <map>
+#include <set>
+
+#include "hostdevcommon/common_values.hpp"
+#include "tt_metal/impl/allocator/algorithms/allocator_algorithm.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+// Best fit allocator making the same placement decisions as FreeList with SearchPolicy::BEST
+// Blocks are indexed by address for O(log n) deallocate and coalescing, free blocks are additionally indexed by
+// (size, address) so the best fit lookup is O(log n) instead of a walk over the free list
+class IndexedFreeList : public Algorithm {
+   public:
+    IndexedFreeList(uint64_t max_size_bytes, uint64_t offset_bytes, uint64_t min_allocation_size, uint64_t alignment);
+
+    void init();
+
+    std::vector<std::pair<uint64_t, uint64_t>> available_addresses(uint64_t size_bytes) const;
+
+    std::optional<uint64_t> allocate(uint64_t size_bytes, bool bottom_up=true, uint64_t address_limit=0);
+
+    std::optional<uint64_t> allocate_at_address(uint64_t absolute_start_address, uint64_t size_bytes);
+
+    void deallocate(uint64_t absolute_address);
+
+    void clear();
+
+    Statistics get_statistics() const;
+
+    void dump_blocks(std::ofstream &out) const;
+
+   private:
+    struct Block {
+        uint64_t size;
+        bool allocated;
+    };
+    // Covers the whole bank, adjacent free blocks are always coalesced
+    using BlockMap = std::map<uint64_t, Block>;
+
+    void insert_free_block(BlockMap::const_iterator block);
+
+    void erase_free_block(BlockMap::const_iterator block);
+
+    uint64_t allocate_slice_of_free_block(BlockMap::iterator free_block, uint64_t offset, uint64_t size_bytes);
+
+    void update_lowest_occupied_address();
+
+    void update_lowest_occupied_address(uint64_t address);
+
+    BlockMap blocks_;
+    std::set<std::pair<uint64_t, uint64_t>> free_blocks_by_size_;
+};
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
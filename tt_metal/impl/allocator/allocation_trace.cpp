@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/allocation_trace.hpp"
+
+#include <filesystem>
+#include <sstream>
+
+#include "common/assert.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+AllocationTrace read_allocation_trace(const std::string &file_name) {
+    std::ifstream file(file_name);
+    TT_FATAL(file.is_open(), "Failed to open allocation trace {}", file_name);
+    AllocationTrace trace;
+    bool has_bank = false;
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream record(line);
+        std::string type;
+        record >> type;
+        if (type == "bank") {
+            auto &bank = trace.bank;
+            record >> bank.buffer_type >> bank.num_banks >> bank.bank_size >> bank.offset >> bank.interleaved_address_limit >>
+                bank.min_allocation_size >> bank.alignment;
+            has_bank = true;
+        } else {
+            AllocationTraceEvent event;
+            if (type == "alloc") {
+                event.type = AllocationTraceEvent::Type::ALLOC;
+                record >> event.id >> event.size_per_bank >> event.bottom_up >> event.size >> event.page_size >> event.num_shards >>
+                    event.address;
+            } else if (type == "alloc_at") {
+                event.type = AllocationTraceEvent::Type::ALLOC_AT;
+                record >> event.id >> event.address >> event.size_per_bank;
+            } else if (type == "oom") {
+                event.type = AllocationTraceEvent::Type::OUT_OF_MEMORY;
+                record >> event.size_per_bank >> event.bottom_up >> event.size >> event.page_size >> event.num_shards;
+            } else if (type == "free") {
+                event.type = AllocationTraceEvent::Type::FREE;
+                record >> event.id;
+            } else {
+                continue;
+            }
+            trace.events.push_back(event);
+        }
+        TT_FATAL(not record.fail(), "Malformed allocation trace line: {}", line);
+    }
+    TT_FATAL(has_bank, "Allocation trace {} doesn't describe its bank", file_name);
+    return trace;
+}
+
+AllocationTraceWriter::AllocationTraceWriter(const std::string &file_name, const AllocationTraceBank &bank) {
+    auto directory = std::filesystem::path(file_name).parent_path();
+    if (not directory.empty()) {
+        std::filesystem::create_directories(directory);
+    }
+    this->file_.open(file_name, std::ios::trunc);
+    TT_FATAL(this->file_.is_open(), "Failed to open allocation trace {}", file_name);
+    this->file_ << "bank " << bank.buffer_type << " " << bank.num_banks << " " << bank.bank_size << " " << bank.offset << " "
+                << bank.interleaved_address_limit << " " << bank.min_allocation_size << " " << bank.alignment << "\n";
+}
+
+uint32_t AllocationTraceWriter::add_buffer(uint64_t address) {
+    auto id = this->next_id_++;
+    this->buffer_ids_[address] = id;
+    return id;
+}
+
+void AllocationTraceWriter::allocate(
+    uint64_t size_per_bank, bool bottom_up, uint64_t size, uint64_t page_size, std::optional<uint32_t> num_shards, uint64_t address) {
+    this->file_ << "alloc " << this->add_buffer(address) << " " << size_per_bank << " " << bottom_up << " " << size << " "
+                << page_size << " " << num_shards.value_or(0) << " " << address << "\n";
+}
+
+void AllocationTraceWriter::allocate_at_address(uint64_t address, uint64_t size_per_bank) {
+    this->file_ << "alloc_at " << this->add_buffer(address) << " " << address << " " << size_per_bank << "\n";
+}
+
+void AllocationTraceWriter::out_of_memory(
+    uint64_t size_per_bank, bool bottom_up, uint64_t size, uint64_t page_size, std::optional<uint32_t> num_shards) {
+    // Flushed, the process is likely about to fail
+    this->file_ << "oom " << size_per_bank << " " << bottom_up << " " << size << " " << page_size << " "
+                << num_shards.value_or(0) << std::endl;
+}
+
+void AllocationTraceWriter::deallocate(uint64_t address) {
+    auto id = this->buffer_ids_.find(address);
+    if (id == this->buffer_ids_.end()) {
+        return;
+    }
+    this->file_ << "free " << id->second << "\n";
+    this->buffer_ids_.erase(id);
+}
+
+void AllocationTraceWriter::deallocate_all() {
+    for (const auto &[address, id] : this->buffer_ids_) {
+        this->file_ << "free " << id << "\n";
+    }
+    this->buffer_ids_.clear();
+    this->file_.flush();
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tt {
+
+namespace tt_metal {
+
+enum class BufferType;
+
+namespace allocator {
+
+// Allocations of one bank manager, written as text when TT_METAL_ALLOCATOR_TRACE=<dir> is set, one line per event:
+//   bank <buffer_type> <num_banks> <bank_size> <offset> <interleaved_address_limit> <min_allocation_size> <alignment>
+//   alloc <id> <size_per_bank> <bottom_up> <size> <page_size> <num_shards> <address>
+//   alloc_at <id> <address> <size_per_bank>
+//   oom <size_per_bank> <bottom_up> <size> <page_size> <num_shards>
+//   free <id>
+// num_shards is 0 for interleaved buffers. The leading fields of alloc, alloc_at and free are the ones
+// tests/tt_metal/tt_metal/perf_microbenchmark/allocator/test_allocator_trace_replay.cpp reads, so it replays traces too.
+struct AllocationTraceBank {
+    std::string buffer_type;
+    uint32_t num_banks = 0;
+    uint64_t bank_size = 0;
+    uint64_t offset = 0;
+    // 0 if interleaved buffers can be allocated anywhere in the bank
+    uint64_t interleaved_address_limit = 0;
+    uint64_t min_allocation_size = 0;
+    uint64_t alignment = 0;
+};
+
+struct AllocationTraceEvent {
+    enum class Type { ALLOC, ALLOC_AT, OUT_OF_MEMORY, FREE };
+    Type type;
+    uint32_t id = 0;
+    uint64_t size_per_bank = 0;
+    bool bottom_up = true;
+    uint64_t size = 0;
+    uint64_t page_size = 0;
+    uint32_t num_shards = 0;
+    uint64_t address = 0;
+};
+
+struct AllocationTrace {
+    AllocationTraceBank bank;
+    std::vector<AllocationTraceEvent> events;
+};
+
+AllocationTrace read_allocation_trace(const std::string &file_name);
+
+class AllocationTraceWriter {
+   public:
+    AllocationTraceWriter(const std::string &file_name, const AllocationTraceBank &bank);
+
+    void allocate(uint64_t size_per_bank, bool bottom_up, uint64_t size, uint64_t page_size, std::optional<uint32_t> num_shards, uint64_t address);
+    void allocate_at_address(uint64_t address, uint64_t size_per_bank);
+    void out_of_memory(uint64_t size_per_bank, bool bottom_up, uint64_t size, uint64_t page_size, std::optional<uint32_t> num_shards);
+    // Addresses that weren't allocated while tracing are ignored
+    void deallocate(uint64_t address);
+    void deallocate_all();
+
+   private:
+    uint32_t add_buffer(uint64_t address);
+
+    std::ofstream file_;
+    uint32_t next_id_ = 0;
+    std::unordered_map<uint64_t, uint32_t> buffer_ids_;
+};
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
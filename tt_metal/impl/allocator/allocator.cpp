@@ -4,6 +4,7 @@
 
 #include "tt_metal/impl/allocator/allocator.hpp"
 #include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
 #include "tt_metal/impl/buffers/buffer.hpp"
 #include "tt_metal/common/math.hpp"
 #include "tt_metal/detail/util.hpp"
@@ -16,14 +17,29 @@ namespace tt_metal {
 
 namespace allocator {
 
-void BankManager::init_allocator(uint64_t size_bytes, uint64_t offset) {
-    this->allocator_ = std::make_unique<FreeList>(
-        size_bytes,
-        offset,
-        this->min_allocation_size_bytes_,
-        ADDRESS_ALIGNMENT,
-        FreeList::SearchPolicy::FIRST
-    );
+void BankManager::init_allocator(uint64_t size_bytes, uint64_t offset, AllocatorAlgorithm algorithm) {
+    this->alloc_offset_ = offset;
+    switch (algorithm) {
+        case AllocatorAlgorithm::FREE_LIST:
+            this->allocator_ = std::make_unique<FreeList>(
+                size_bytes,
+                offset,
+                this->min_allocation_size_bytes_,
+                ADDRESS_ALIGNMENT,
+                FreeList::SearchPolicy::FIRST
+            );
+            break;
+        case AllocatorAlgorithm::INDEXED_FREE_LIST:
+            this->allocator_ = std::make_unique<IndexedFreeList>(
+                size_bytes,
+                offset,
+                this->min_allocation_size_bytes_,
+                ADDRESS_ALIGNMENT
+            );
+            break;
+        default:
+            TT_THROW("Unsupported allocator algorithm {}", magic_enum::enum_name(algorithm));
+    }
 }
 
 void validate_num_banks(uint32_t num_banks, const BufferType &buffer_type) {
@@ -38,7 +54,7 @@ void validate_num_banks(uint32_t num_banks, const BufferType &buffer_type) {
     }
 }
 
-BankManager::BankManager(const BufferType &buffer_type, const std::vector<int64_t> &bank_offsets, uint64_t size_bytes, uint64_t alloc_offset) : buffer_type_(buffer_type) {
+BankManager::BankManager(const BufferType &buffer_type, const std::vector<int64_t> &bank_offsets, uint64_t size_bytes, uint64_t alloc_offset, AllocatorAlgorithm algorithm) : buffer_type_(buffer_type) {
     unsigned int bank_id = 0;
     for (const auto bank_offset : bank_offsets) {
         this->bank_id_to_bank_offset_.insert({bank_id, bank_offset});
@@ -46,12 +62,12 @@ BankManager::BankManager(const BufferType &buffer_type, const std::vector<int64_
     }
     this->interleaved_address_limit_ = 0;
     validate_num_banks(this->bank_id_to_bank_offset_.size(), this->buffer_type_);
-    this->init_allocator(size_bytes, alloc_offset);
+    this->init_allocator(size_bytes, alloc_offset, algorithm);
 }
 
-BankManager::BankManager(const BufferType &buffer_type, const std::unordered_map<uint32_t, int64_t> &bank_id_to_bank_offset, uint64_t size_bytes, uint64_t interleaved_address_limit, uint64_t alloc_offset) : buffer_type_(buffer_type), bank_id_to_bank_offset_(bank_id_to_bank_offset), interleaved_address_limit_(interleaved_address_limit) {
+BankManager::BankManager(const BufferType &buffer_type, const std::unordered_map<uint32_t, int64_t> &bank_id_to_bank_offset, uint64_t size_bytes, uint64_t interleaved_address_limit, uint64_t alloc_offset, AllocatorAlgorithm algorithm) : buffer_type_(buffer_type), bank_id_to_bank_offset_(bank_id_to_bank_offset), interleaved_address_limit_(interleaved_address_limit) {
     validate_num_banks(this->bank_id_to_bank_offset_.size(), this->buffer_type_);
-    this->init_allocator(size_bytes, alloc_offset);
+    this->init_allocator(size_bytes, alloc_offset, algorithm);
 }
 
 uint32_t BankManager::num_banks() const {
@@ -76,34 +92,89 @@ void BankManager::validate_bank_id(uint32_t bank_id) const {
     TT_FATAL(this->bank_id_to_bank_offset_.find(bank_id) != this->bank_id_to_bank_offset_.end(), "Expected bank {} to be tracked!", bank_id);
 }
 
-uint64_t BankManager::allocate_buffer(uint32_t size, uint32_t page_size, bool bottom_up, std::optional<uint32_t> num_shards) {
+uint64_t BankManager::address_limit(bool is_sharded) const {
+    if (is_sharded or this->buffer_type_ != BufferType::L1) {
+        return 0;
+    }
+    TT_FATAL(this->interleaved_address_limit_ > 0);
+    return this->interleaved_address_limit_;
+}
+
+uint64_t BankManager::size_per_bank(uint32_t size, uint32_t page_size, std::optional<uint32_t> num_shards) const {
     uint32_t num_banks = this->num_banks();
-    bool is_sharded = false;
     if(num_shards.has_value()){
-        is_sharded = true;
         TT_FATAL(num_shards.value() < num_banks, "Expected number of shards to be less than total number of L1 banks");
         num_banks = num_shards.value();
     }
     // Each page needs to be at a 32B aligned address
-    uint32_t size_per_bank = tt::tt_metal::detail::SizeBytesPerBank(size, page_size, num_banks);
-    uint64_t address_limit = 0;
-    if(!is_sharded and this->buffer_type_ == BufferType::L1) {
-        address_limit = this->interleaved_address_limit_;
-        TT_FATAL(address_limit > 0);
-    }
-    auto address = this->allocator_->allocate(size_per_bank, bottom_up, address_limit);
+    return tt::tt_metal::detail::SizeBytesPerBank(size, page_size, num_banks);
+}
+
+uint64_t BankManager::allocate_buffer(uint32_t size, uint32_t page_size, bool bottom_up, std::optional<uint32_t> num_shards) {
+    uint32_t num_banks = num_shards.value_or(this->num_banks());
+    uint64_t size_per_bank = this->size_per_bank(size, page_size, num_shards);
+    auto address = this->allocator_->allocate(size_per_bank, bottom_up, this->address_limit(num_shards.has_value()));
     if (not address.has_value()) {
+        if (this->trace_ != nullptr) {
+            this->trace_->out_of_memory(size_per_bank, bottom_up, size, page_size, num_shards);
+        }
         TT_THROW("Out of Memory: Not enough space to allocate {} B {} buffer across {} banks, where each bank needs to store {} B", size, magic_enum::enum_name(this->buffer_type_), num_banks, size_per_bank);
     }
     allocated_buffers_.insert(address.value());
+    if (this->trace_ != nullptr) {
+        this->trace_->allocate(size_per_bank, bottom_up, size, page_size, num_shards, address.value());
+    }
     return address.value();
 }
 
+std::optional<uint64_t> BankManager::allocate_buffer_at_address(uint64_t address, uint64_t size_per_bank) {
+    if (address < this->address_limit(/*is_sharded=*/false)) {
+        return std::nullopt;
+    }
+    auto allocated_address = this->allocator_->allocate_at_address(address, size_per_bank);
+    if (allocated_address.has_value()) {
+        allocated_buffers_.insert(allocated_address.value());
+        if (this->trace_ != nullptr) {
+            this->trace_->allocate_at_address(allocated_address.value(), size_per_bank);
+        }
+    }
+    return allocated_address;
+}
+
+std::optional<uint64_t> BankManager::reserve_range(uint64_t size_per_bank, bool bottom_up) {
+    // Free ranges are queried rather than probed with allocate, which throws once it sliced a block below the limit
+    const uint64_t address_limit = this->address_limit(/*is_sharded=*/false);
+    std::optional<uint64_t> address;
+    for (const auto &[start_address, end_address] : this->allocator_->available_addresses(size_per_bank)) {
+        // Blocks are aligned, the limit may not be
+        const uint64_t lowest_address = std::max(start_address + this->alloc_offset_, (address_limit + ADDRESS_ALIGNMENT - 1) / ADDRESS_ALIGNMENT * ADDRESS_ALIGNMENT);
+        const uint64_t highest_address = end_address + this->alloc_offset_;
+        if (lowest_address > highest_address) {
+            continue;
+        }
+        if (bottom_up) {
+            address = std::min(address.value_or(lowest_address), lowest_address);
+        } else {
+            address = std::max(address.value_or(highest_address), highest_address);
+        }
+    }
+    if (not address.has_value()) {
+        return std::nullopt;
+    }
+    return this->allocate_buffer_at_address(address.value(), size_per_bank);
+}
+
 void BankManager::deallocate_buffer(uint64_t address) {
+    if (this->trace_ != nullptr) {
+        this->trace_->deallocate(address);
+    }
     this->allocator_->deallocate(address);
 }
 
 void BankManager::deallocate_all(){
+    if (this->trace_ != nullptr) {
+        this->trace_->deallocate_all();
+    }
     for (uint64_t addr : this->allocated_buffers_)
     {
         this->allocator_->deallocate(addr);
@@ -112,6 +183,9 @@ void BankManager::deallocate_all(){
 
 
 void BankManager::clear() {
+    if (this->trace_ != nullptr) {
+        this->trace_->deallocate_all();
+    }
     this->allocator_->clear();
 }
 
@@ -128,6 +202,8 @@ BankManager&& BankManager::operator=(BankManager&& that) {
     bank_id_to_bank_offset_ = that.bank_id_to_bank_offset_;
     allocator_.reset( that.allocator_.release() );
     interleaved_address_limit_ = that.interleaved_address_limit_;
+    alloc_offset_ = that.alloc_offset_;
+    trace_ = std::move(that.trace_);
     return std::move(*this);
 }
 
@@ -148,6 +224,18 @@ void BankManager::dump_blocks(std::ofstream &out) const {
     this->allocator_->dump_blocks(out);
 }
 
+void BankManager::enable_trace(const std::string &file_name) {
+    AllocationTraceBank bank{
+        .buffer_type = std::string(magic_enum::enum_name(this->buffer_type_)),
+        .num_banks = this->num_banks(),
+        .bank_size = this->allocator_->max_size_bytes(),
+        .offset = this->alloc_offset_,
+        .interleaved_address_limit = this->buffer_type_ == BufferType::L1 ? this->interleaved_address_limit_ : 0,
+        .min_allocation_size = this->min_allocation_size_bytes_,
+        .alignment = ADDRESS_ALIGNMENT};
+    this->trace_ = std::make_unique<AllocationTraceWriter>(file_name, bank);
+}
+
 void init_one_bank_per_channel(Allocator &allocator, const AllocatorConfig &alloc_config) {
     // Space up to DRAM_UNRESERVED_BASE is reserved for DRAM write barrier
     uint64_t offset_bytes = static_cast<uint64_t>(DRAM_UNRESERVED_BASE);
@@ -156,7 +244,7 @@ void init_one_bank_per_channel(Allocator &allocator, const AllocatorConfig &allo
     for (uint32_t channel_id = 0; channel_id < alloc_config.num_dram_channels; channel_id++) {
         bank_offsets.at(channel_id) = static_cast<int32_t>(alloc_config.dram_bank_offsets.at(channel_id));
     }
-    allocator.dram_manager = BankManager(BufferType::DRAM, bank_offsets, dram_bank_size, offset_bytes);
+    allocator.dram_manager = BankManager(BufferType::DRAM, bank_offsets, dram_bank_size, offset_bytes, alloc_config.algorithm);
     for (uint32_t bank_id = 0; bank_id < alloc_config.num_dram_channels; bank_id++) {
         allocator.bank_id_to_dram_channel.insert({bank_id, bank_id});
         allocator.dram_channel_to_bank_ids.insert({bank_id, {bank_id}});
@@ -169,7 +257,7 @@ void init_one_bank_per_l1(Allocator &allocator, const AllocatorConfig &alloc_con
     uint64_t offset_bytes = static_cast<uint64_t>(L1_UNRESERVED_BASE);
     uint32_t l1_bank_size = alloc_config.worker_l1_size - L1_UNRESERVED_BASE;
     std::vector<int64_t> bank_offsets (num_l1_banks, 0);
-    allocator.l1_manager = BankManager(BufferType::L1, bank_offsets, l1_bank_size, offset_bytes);
+    allocator.l1_manager = BankManager(BufferType::L1, bank_offsets, l1_bank_size, offset_bytes, alloc_config.algorithm);
 
     uint32_t bank_id = 0;
     for (uint32_t y = 0; y < alloc_config.worker_grid_size.y; y++) {
@@ -260,6 +348,11 @@ void dump_memory_blocks(const Allocator &allocator, const BufferType &buffer_typ
     }
 }
 
+void enable_allocation_trace(Allocator &allocator, const std::string &file_prefix) {
+    allocator.dram_manager.enable_trace(file_prefix + "_DRAM.trace");
+    allocator.l1_manager.enable_trace(file_prefix + "_L1.trace");
+}
+
 std::optional<uint64_t> lowest_occupied_l1_address(const Allocator &allocator, uint32_t bank_id) {
     return allocator.l1_manager.lowest_occupied_address(bank_id);
 }
@@ -268,8 +361,9 @@ uint64_t base_alloc(const AllocatorConfig &config, BankManager &bank_manager, ui
     return bank_manager.allocate_buffer(size, page_size, bottom_up, num_shards);
 }
 
-uint64_t allocate_buffer(Allocator &allocator, uint32_t size, uint32_t page_size, const BufferType &buffer_type, bool bottom_up, std::optional<uint32_t> num_shards) {
-    uint64_t address = 0;
+namespace {
+
+uint64_t allocate_unplanned_buffer(Allocator &allocator, uint32_t size, uint32_t page_size, const BufferType &buffer_type, bool bottom_up, std::optional<uint32_t> num_shards) {
     switch (buffer_type) {
         case BufferType::DRAM: return allocator.descriptor.dram.alloc(allocator.config, allocator.dram_manager, size, page_size, bottom_up, std::nullopt);
         case BufferType::L1: return allocator.descriptor.l1.alloc(allocator.config, allocator.l1_manager, size, page_size, bottom_up, num_shards);
@@ -277,10 +371,34 @@ uint64_t allocate_buffer(Allocator &allocator, uint32_t size, uint32_t page_size
             TT_THROW("Unsupported buffer type!");
         }
     }
-    return address;
+    return 0;
+}
+
+}  // namespace
+
+uint64_t allocate_buffer(Allocator &allocator, uint32_t size, uint32_t page_size, const BufferType &buffer_type, bool bottom_up, std::optional<uint32_t> num_shards) {
+    // Only interleaved buffers are planned, sharded buffers are placed by their shard grid
+    auto session = allocator.buffer_plan_session;
+    if (session == nullptr or num_shards.has_value() or (buffer_type != BufferType::DRAM and buffer_type != BufferType::L1)) {
+        return allocate_unplanned_buffer(allocator, size, page_size, buffer_type, bottom_up, num_shards);
+    }
+    auto &bank_manager = buffer_type == BufferType::DRAM ? allocator.dram_manager : allocator.l1_manager;
+    uint64_t size_per_bank = bank_manager.size_per_bank(size, page_size, std::nullopt);
+    auto address = session->allocate_planned(bank_manager, buffer_type, size_per_bank, bottom_up);
+    if (not address.has_value()) {
+        address = allocate_unplanned_buffer(allocator, size, page_size, buffer_type, bottom_up, num_shards);
+    }
+    session->record_allocation(buffer_type, address.value(), size_per_bank);
+    return address.value();
 }
 
 void deallocate_buffer(Allocator &allocator, uint64_t address, const BufferType &buffer_type) {
+    if (allocator.buffer_plan_session != nullptr) {
+        allocator.buffer_plan_session->record_deallocation(buffer_type, address);
+        if (allocator.buffer_plan_session->deallocate_planned(buffer_type, address)) {
+            return;
+        }
+    }
     switch (buffer_type) {
         case BufferType::DRAM:
             allocator.dram_manager.deallocate_buffer(address);
@@ -13,6 +13,8 @@
 #include "common/assert.hpp"
 #include "common/core_coord.h"
 #include "tt_metal/impl/allocator/algorithms/allocator_algorithm.hpp"
+#include "tt_metal/impl/allocator/allocation_trace.hpp"
+#include "tt_metal/impl/allocator/buffer_planner.hpp"
 
 namespace tt {
 
@@ -28,8 +30,8 @@ class BankManager {
    public:
     BankManager() {}
 
-    BankManager(const BufferType &buffer_type, const std::vector<int64_t> &bank_descriptors, uint64_t size_bytes, uint64_t alloc_offset=0);
-    BankManager(const BufferType &buffer_type, const std::unordered_map<uint32_t, int64_t> &bank_id_to_descriptor, uint64_t size_bytes, uint64_t interleaved_address_limit, uint64_t alloc_offset=0);
+    BankManager(const BufferType &buffer_type, const std::vector<int64_t> &bank_descriptors, uint64_t size_bytes, uint64_t alloc_offset=0, AllocatorAlgorithm algorithm=AllocatorAlgorithm::FREE_LIST);
+    BankManager(const BufferType &buffer_type, const std::unordered_map<uint32_t, int64_t> &bank_id_to_descriptor, uint64_t size_bytes, uint64_t interleaved_address_limit, uint64_t alloc_offset=0, AllocatorAlgorithm algorithm=AllocatorAlgorithm::FREE_LIST);
     BankManager&& operator=(BankManager&& that);
     ~BankManager();
     uint32_t num_banks() const;
@@ -40,6 +42,15 @@ class BankManager {
 
     uint64_t allocate_buffer(uint32_t size, uint32_t page_size, bool bottom_up, std::optional<uint32_t> num_shards);
 
+    uint64_t size_per_bank(uint32_t size, uint32_t page_size, std::optional<uint32_t> num_shards) const;
+
+    // Interleaved allocation at a given address, nullopt if part of the range is already allocated
+    std::optional<uint64_t> allocate_buffer_at_address(uint64_t address, uint64_t size_per_bank);
+
+    // Allocates a range an interleaved buffer of size_per_bank could be allocated in, nullopt if there is none.
+    // Doesn't throw, the caller places buffers inside the range itself and frees it with deallocate_buffer
+    std::optional<uint64_t> reserve_range(uint64_t size_per_bank, bool bottom_up);
+
     void deallocate_buffer(uint64_t address);
     void deallocate_all();
 
@@ -51,6 +62,9 @@ class BankManager {
 
     void dump_blocks(std::ofstream &out) const;
 
+    // Writes every following allocation and deallocation to the file, see allocation_trace.hpp
+    void enable_trace(const std::string &file_name);
+
    private:
     constexpr static uint32_t min_allocation_size_bytes_ = 32;
 
@@ -62,9 +76,12 @@ class BankManager {
     std::unordered_map<uint32_t, int64_t> bank_id_to_bank_offset_;
     std::unique_ptr<Algorithm> allocator_;
     uint64_t interleaved_address_limit_;
+    uint64_t alloc_offset_ = 0;
+    std::unique_ptr<AllocationTraceWriter> trace_;
     void validate_bank_id(uint32_t bank_id) const;
+    uint64_t address_limit(bool is_sharded) const;
 
-    void init_allocator(uint64_t size_bytes, uint64_t offset);
+    void init_allocator(uint64_t size_bytes, uint64_t offset, AllocatorAlgorithm algorithm);
 };
 
 // Functions used to initiate allocator and allocate buffers
@@ -92,6 +109,9 @@ Statistics get_statistics(const Allocator &allocator, const BufferType &buffer_t
 
 void dump_memory_blocks(const Allocator &allocator, const BufferType &buffer_type, std::ofstream &out);
 
+// Traces the DRAM and L1 bank managers to <file_prefix>_DRAM.trace and <file_prefix>_L1.trace
+void enable_allocation_trace(Allocator &allocator, const std::string &file_prefix);
+
 std::optional<uint64_t> lowest_occupied_l1_address(const Allocator &allocator, uint32_t bank_id);
 
 uint64_t base_alloc(const AllocatorConfig & config, BankManager &bank_manager, uint64_t size, uint64_t page_size, bool bottom_up, std::optional<uint32_t> num_shards);
@@ -122,6 +142,9 @@ struct Allocator {
     // Callbacks to invoke during initialization and allocation
     allocator::AllocDescriptor descriptor;
 
+    // Set while a planned region runs, interleaved allocations are recorded and placed at their planned addresses
+    allocator::BufferPlanSession *buffer_plan_session = nullptr;
+
     void reset();
     ~Allocator();
 };
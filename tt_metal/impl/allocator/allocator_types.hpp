@@ -29,6 +29,12 @@ enum class AllocCoreType {
 
 using BankMapping = std::vector<uint32_t>;
 
+// Algorithm each bank manager uses to place buffers within its banks
+enum class AllocatorAlgorithm {
+    FREE_LIST = 0,          // FreeList, first fit over a linked list of free blocks
+    INDEXED_FREE_LIST = 1,  // IndexedFreeList, best fit with O(log n) allocate and deallocate
+};
+
 //! Allocator configuration -- decouples allocation from soc-desc - Up to user to populate from soc_desc
 struct AllocatorConfig {
     //! DRAM specific configuration
@@ -43,6 +49,7 @@ struct AllocatorConfig {
     std::unordered_map<int, int> worker_log_to_physical_routing_x = {};
     std::unordered_map<int, int> worker_log_to_physical_routing_y = {};
     BankMapping l1_bank_remap = {}; // for remapping which l1 bank points to which bank if we assume normal row-major assignment
+    AllocatorAlgorithm algorithm = AllocatorAlgorithm::FREE_LIST;
     void reset();
     ~AllocatorConfig() { reset(); }
 };
@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tt_metal/impl/allocator/buffer_planner.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "tt_metal/common/assert.hpp"
+#include "tt_metal/hostdevcommon/common_values.hpp"
+#include "tt_metal/impl/allocator/allocator.hpp"
+#include "tt_metal/impl/buffers/buffer.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace allocator {
+
+namespace {
+
+uint64_t align(uint64_t size, uint64_t alignment) { return ((size + alignment - 1) / alignment) * alignment; }
+
+}  // namespace
+
+BufferPlacement plan_buffer_placement(const std::vector<BufferLifetime>& lifetimes, uint64_t alignment) {
+    TT_FATAL(alignment > 0);
+    std::vector<size_t> order(lifetimes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&lifetimes](size_t a, size_t b) { return lifetimes[a].size > lifetimes[b].size; });
+
+    BufferPlacement placement{.offsets = std::vector<uint64_t>(lifetimes.size(), 0)};
+    std::vector<size_t> placed;
+    std::vector<size_t> conflicts;
+    for (size_t index : order) {
+        const auto& lifetime = lifetimes[index];
+        conflicts.clear();
+        for (size_t other : placed) {
+            if (lifetime.overlaps(lifetimes[other])) {
+                conflicts.push_back(other);
+            }
+        }
+        std::sort(conflicts.begin(), conflicts.end(), [&placement](size_t a, size_t b) { return placement.offsets[a] < placement.offsets[b]; });
+
+        // Lowest gap between conflicting buffers that fits
+        const uint64_t size = align(lifetime.size, alignment);
+        uint64_t offset = 0;
+        for (size_t other : conflicts) {
+            if (offset + size <= placement.offsets[other]) {
+                break;
+            }
+            offset = std::max(offset, placement.offsets[other] + align(lifetimes[other].size, alignment));
+        }
+        placement.offsets[index] = offset;
+        placement.arena_size = std::max(placement.arena_size, offset + size);
+        placed.push_back(index);
+    }
+    return placement;
+}
+
+void validate_buffer_placement(
+    const std::vector<BufferLifetime>& lifetimes, const BufferPlacement& placement, uint64_t alignment) {
+    TT_FATAL(placement.offsets.size() == lifetimes.size(), "Placement has {} offsets for {} buffers", placement.offsets.size(), lifetimes.size());
+    for (size_t index = 0; index < lifetimes.size(); index++) {
+        const auto& lifetime = lifetimes[index];
+        const uint64_t offset = placement.offsets[index];
+        TT_FATAL(lifetime.alloc_step < lifetime.free_step, "Buffer {} is freed at step {} before it is allocated at step {}", index, lifetime.free_step, lifetime.alloc_step);
+        TT_FATAL(offset % alignment == 0, "Buffer {} at offset {} isn't {} B aligned", index, offset, alignment);
+        TT_FATAL(offset + lifetime.size <= placement.arena_size, "Buffer {} of {} B at offset {} doesn't fit in the {} B arena", index, lifetime.size, offset, placement.arena_size);
+        for (size_t other = 0; other < index; other++) {
+            if (not lifetime.overlaps(lifetimes[other])) {
+                continue;
+            }
+            const uint64_t other_offset = placement.offsets[other];
+            TT_FATAL(
+                offset + lifetime.size <= other_offset or other_offset + lifetimes[other].size <= offset,
+                "Buffers {} and {} are live at the same time and overlap at offsets {} and {}", other, index, other_offset, offset);
+        }
+    }
+}
+
+BufferPlanSession::BufferPlanSession(BufferPlan& plan) : plan_(plan), follows_plan_(plan.is_planned) {}
+
+BufferPlanSession::~BufferPlanSession() { this->release_arenas(); }
+
+std::optional<uint64_t> BufferPlanSession::allocate_planned(
+    BankManager& bank_manager, const BufferType& buffer_type, uint64_t size_per_bank, bool bottom_up) {
+    if (not this->follows_plan_) {
+        return std::nullopt;
+    }
+    const size_t index = this->lifetimes_.size();
+    if (index >= this->plan_.buffers.size() or this->plan_.buffers[index].buffer_type != buffer_type or
+        this->plan_.buffers[index].size_per_bank != size_per_bank) {
+        this->follows_plan_ = false;
+        return std::nullopt;
+    }
+
+    // The arena is reserved when its first buffer is allocated, every buffer of the plan then fits in it
+    auto arena = this->arenas_.find(buffer_type);
+    if (arena == this->arenas_.end()) {
+        auto arena_address = bank_manager.reserve_range(this->plan_.arena_sizes.at(buffer_type), bottom_up);
+        if (not arena_address.has_value()) {
+            this->follows_plan_ = false;
+            return std::nullopt;
+        }
+        arena = this->arenas_.emplace(buffer_type, Arena{.bank_manager = &bank_manager, .address = arena_address.value()}).first;
+    }
+
+    // Buffers freed later than in the recorded run may still hold the planned range
+    const uint64_t address = arena->second.address + this->plan_.buffers[index].offset;
+    for (const auto& [planned_buffer, planned_size_per_bank] : this->planned_buffers_) {
+        const auto& [planned_buffer_type, planned_address] = planned_buffer;
+        if (planned_buffer_type == buffer_type and address < planned_address + planned_size_per_bank and
+            planned_address < address + size_per_bank) {
+            this->follows_plan_ = false;
+            return std::nullopt;
+        }
+    }
+    this->planned_buffers_.emplace(std::make_pair(buffer_type, address), size_per_bank);
+    return address;
+}
+
+void BufferPlanSession::record_allocation(const BufferType& buffer_type, uint64_t address, uint64_t size_per_bank) {
+    this->live_buffers_[{buffer_type, address}] = this->lifetimes_.size();
+    this->buffer_types_.push_back(buffer_type);
+    this->lifetimes_.push_back(BufferLifetime{.size = size_per_bank, .alloc_step = this->step_++});
+}
+
+void BufferPlanSession::record_deallocation(const BufferType& buffer_type, uint64_t address) {
+    // Buffers allocated before the session started aren't part of the plan
+    auto live_buffer = this->live_buffers_.find({buffer_type, address});
+    if (live_buffer == this->live_buffers_.end()) {
+        return;
+    }
+    this->lifetimes_[live_buffer->second].free_step = this->step_++;
+    this->live_buffers_.erase(live_buffer);
+}
+
+bool BufferPlanSession::deallocate_planned(const BufferType& buffer_type, uint64_t address) {
+    return this->planned_buffers_.erase({buffer_type, address}) > 0;
+}
+
+void BufferPlanSession::release_arenas() {
+    for (const auto& [buffer_type, arena] : this->arenas_) {
+        arena.bank_manager->deallocate_buffer(arena.address);
+        for (const auto& [planned_buffer, size_per_bank] : this->planned_buffers_) {
+            if (planned_buffer.first != buffer_type) {
+                continue;
+            }
+            // Planned buffers don't overlap and the arena was just freed
+            auto address = arena.bank_manager->allocate_buffer_at_address(planned_buffer.second, size_per_bank);
+            TT_FATAL(address.has_value(), "Failed to keep planned buffer at {} after freeing its arena", planned_buffer.second);
+        }
+    }
+    this->arenas_.clear();
+    this->planned_buffers_.clear();
+}
+
+void BufferPlanSession::finish() {
+    this->release_arenas();
+    if (this->follows_plan_ and this->lifetimes_.size() == this->plan_.buffers.size()) {
+        return;
+    }
+    this->plan_ = BufferPlan{.buffers = std::vector<BufferPlan::Buffer>(this->lifetimes_.size())};
+    for (auto buffer_type : {BufferType::DRAM, BufferType::L1}) {
+        std::vector<size_t> indices;
+        std::vector<BufferLifetime> lifetimes;
+        for (size_t index = 0; index < this->lifetimes_.size(); index++) {
+            if (this->buffer_types_[index] == buffer_type) {
+                indices.push_back(index);
+                lifetimes.push_back(this->lifetimes_[index]);
+            }
+        }
+        if (indices.empty()) {
+            continue;
+        }
+        auto placement = plan_buffer_placement(lifetimes, ADDRESS_ALIGNMENT);
+        for (size_t i = 0; i < indices.size(); i++) {
+            this->plan_.buffers[indices[i]] = BufferPlan::Buffer{
+                .buffer_type = buffer_type, .size_per_bank = lifetimes[i].size, .offset = placement.offsets[i]};
+        }
+        this->plan_.arena_sizes[buffer_type] = placement.arena_size;
+    }
+    this->plan_.is_planned = true;
+}
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Plans the placement of the buffers allocated by a region of code (e.g. a composite op) that runs repeatedly.
+// The region is recorded once, then each of its buffers gets a fixed offset in one arena per buffer type such that
+// buffers live at the same time never overlap. Later runs place the buffers at these offsets instead of searching
+// the free list, which avoids the fragmentation left by allocation order and bounds the peak of the region.
+//
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace tt {
+
+namespace tt_metal {
+
+enum class BufferType;
+
+namespace allocator {
+
+class BankManager;
+
+// Buffer of a recorded allocation sequence, live from its allocation step until its free step. Buffers still live at
+// the end of the sequence keep the default free step.
+struct BufferLifetime {
+    uint64_t size;
+    uint32_t alloc_step;
+    uint32_t free_step = std::numeric_limits<uint32_t>::max();
+
+    bool overlaps(const BufferLifetime& other) const {
+        return this->alloc_step < other.free_step and other.alloc_step < this->free_step;
+    }
+};
+
+struct BufferPlacement {
+    // Offset of each buffer from the start of the arena
+    std::vector<uint64_t> offsets;
+    uint64_t arena_size = 0;
+};
+
+// Greedy by size: the largest buffers are placed first, each one at the lowest aligned offset that doesn't overlap a
+// placed buffer live at the same time
+BufferPlacement plan_buffer_placement(const std::vector<BufferLifetime>& lifetimes, uint64_t alignment);
+
+// Throws unless every buffer is aligned, fits in the arena and doesn't overlap any buffer live at the same time
+void validate_buffer_placement(
+    const std::vector<BufferLifetime>& lifetimes, const BufferPlacement& placement, uint64_t alignment);
+
+// Interleaved allocations of a recorded region in allocation order, with their planned offsets
+struct BufferPlan {
+    struct Buffer {
+        BufferType buffer_type;
+        uint64_t size_per_bank;
+        uint64_t offset;
+    };
+    std::vector<Buffer> buffers;
+    std::unordered_map<BufferType, uint64_t> arena_sizes;
+    // Set once a recorded run has been planned, cleared when a run diverges from the plan
+    bool is_planned = false;
+};
+
+// Active on an Allocator while the region runs. The sequence is always recorded: a run without a plan, or one that
+// diverged from it (different sizes, buffer types or a buffer still live where the next one is planned), replans the
+// region when it finishes.
+// The arena of a buffer type is reserved in its bank manager until the session ends, so that allocations outside of
+// the plan (e.g. sharded buffers) land elsewhere. Planned buffers are placed inside it without going through the free
+// list, the ones still live when the session ends are allocated in the free list at the same addresses.
+class BufferPlanSession {
+   public:
+    explicit BufferPlanSession(BufferPlan& plan);
+    ~BufferPlanSession();
+
+    BufferPlanSession(const BufferPlanSession&) = delete;
+    BufferPlanSession& operator=(const BufferPlanSession&) = delete;
+
+    // Allocates the next buffer at its planned address, returns nullopt if it has to be allocated normally
+    std::optional<uint64_t> allocate_planned(
+        BankManager& bank_manager, const BufferType& buffer_type, uint64_t size_per_bank, bool bottom_up);
+
+    void record_allocation(const BufferType& buffer_type, uint64_t address, uint64_t size_per_bank);
+    void record_deallocation(const BufferType& buffer_type, uint64_t address);
+
+    // Frees a buffer placed in an arena, false if it was allocated normally and has to be freed by its bank manager
+    bool deallocate_planned(const BufferType& buffer_type, uint64_t address);
+
+    bool follows_plan() const { return this->follows_plan_; }
+
+    // Ends the session and replans the region from the recorded sequence unless the run followed the plan
+    void finish();
+
+   private:
+    struct Arena {
+        BankManager* bank_manager;
+        uint64_t address;
+    };
+
+    // Frees the arenas, live planned buffers are allocated in the free list of their bank manager
+    void release_arenas();
+
+    BufferPlan& plan_;
+    bool follows_plan_;
+    uint32_t step_ = 0;
+    std::vector<BufferType> buffer_types_;
+    std::vector<BufferLifetime> lifetimes_;
+    std::map<std::pair<BufferType, uint64_t>, size_t> live_buffers_;
+    std::unordered_map<BufferType, Arena> arenas_;
+    // Size per bank of the live buffers placed in an arena
+    std::map<std::pair<BufferType, uint64_t>, uint64_t> planned_buffers_;
+};
+
+}  // namespace allocator
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -11,6 +11,8 @@
 
 #include "llrt/llrt.hpp"
 
+#include <algorithm>
+
 namespace tt {
 
 namespace tt_metal {
@@ -181,6 +183,17 @@ Buffer::Buffer(Device *device, uint64_t size, uint64_t page_size, const BufferTy
                 dev_page_index++;
             }
         }
+        for (uint32_t dev_page_id = 0; dev_page_id < total_dev_pages; dev_page_id++) {
+            uint32_t host_page_id = dev_page_to_host_page_mapping_[dev_page_id];
+            if (not dev_page_runs_.empty()) {
+                BufferPageRun &run = dev_page_runs_.back();
+                if (run.host_page_start + run.num_pages == host_page_id) {
+                    run.num_pages++;
+                    continue;
+                }
+            }
+            dev_page_runs_.push_back({.dev_page_start = dev_page_id, .host_page_start = host_page_id, .num_pages = 1});
+        }
     }
 
     #ifdef DEBUG_SHARD_PRINT
@@ -196,6 +209,7 @@ Buffer::Buffer(Device *device, uint64_t size, uint64_t page_size, const BufferTy
 Buffer::Buffer(const Buffer &other)
     : device_(other.device_), size_(other.size_), page_size_(other.page_size_),
         buffer_type_(other.buffer_type_) , buffer_layout_(other.buffer_layout_), shard_parameters_(other.shard_parameters_){
+    this->copy_shard_page_mapping(other);
     this->allocate();
 }
 
@@ -207,6 +221,7 @@ Buffer &Buffer::operator=(const Buffer &other) {
         this->buffer_type_ = other.buffer_type_;
         this->buffer_layout_ = other.buffer_layout_;
         this->shard_parameters_ = other.shard_parameters_;
+        this->copy_shard_page_mapping(other);
         this->allocate();
     }
     return *this;
@@ -214,6 +229,7 @@ Buffer &Buffer::operator=(const Buffer &other) {
 
 Buffer::Buffer(Buffer &&other) : device_(other.device_), size_(other.size_), address_(other.address_), page_size_(other.page_size_), buffer_type_(other.buffer_type_) ,
                                     buffer_layout_(other.buffer_layout_), shard_parameters_(other.shard_parameters_) {
+    this->copy_shard_page_mapping(other);
     // Set `other.device_` to be nullptr so destroying other does not deallocate reserved address space that is transferred to `this`
     other.device_ = nullptr;
 }
@@ -227,12 +243,32 @@ Buffer &Buffer::operator=(Buffer &&other) {
         this->buffer_type_ = other.buffer_type_;
         this->buffer_layout_ = other.buffer_layout_;
         this->shard_parameters_ = other.shard_parameters_;
+        this->copy_shard_page_mapping(other);
         // Set `other.device_` to be nullptr so destroying other does not deallocate reserved address space that is transferred to `this`
         other.device_ = nullptr;
     }
     return *this;
 }
 
+void Buffer::copy_shard_page_mapping(const Buffer &other) {
+    this->all_cores_ = other.all_cores_;
+    this->core_bank_indices_ = other.core_bank_indices_;
+    this->core_host_page_indices_ = other.core_host_page_indices_;
+    this->dev_page_to_core_mapping_ = other.dev_page_to_core_mapping_;
+    this->dev_page_to_host_page_mapping_ = other.dev_page_to_host_page_mapping_;
+    this->dev_page_runs_ = other.dev_page_runs_;
+    this->core_to_core_id_ = other.core_to_core_id_;
+}
+
+uint32_t Buffer::dev_page_run_index(uint32_t dev_page_id) const {
+    TT_ASSERT(is_sharded(this->buffer_layout_) , "Buffer not sharded");
+    auto run = std::upper_bound(
+        this->dev_page_runs_.begin(), this->dev_page_runs_.end(), dev_page_id,
+        [](uint32_t page_id, const BufferPageRun &run) { return page_id < run.dev_page_start; });
+    TT_ASSERT(run != this->dev_page_runs_.begin());
+    return std::distance(this->dev_page_runs_.begin(), run) - 1;
+}
+
 void Buffer::allocate() {
     TT_ASSERT(this->device_ != nullptr);
     // L1 buffers are allocated top down!
@@ -130,6 +130,12 @@ struct ShardedBufferConfig {
 
 bool is_sharded(const TensorMemoryLayout & layout);
 
+// Consecutive device pages of a sharded buffer that hold consecutive host pages
+struct BufferPageRun {
+    uint32_t dev_page_start;
+    uint32_t host_page_start;
+    uint32_t num_pages;
+};
 
 
 class Buffer {
@@ -202,6 +208,15 @@ class Buffer {
         return dev_page_to_host_page_mapping_[input_id];
     }
 
+    // Device to host page mapping compressed into runs, ordered by device page
+    const std::vector<BufferPageRun>& dev_page_runs() const {
+        TT_ASSERT(is_sharded(this->buffer_layout_) , "Buffer not sharded");
+        return dev_page_runs_;
+    }
+
+    // Index into dev_page_runs() of the run holding dev_page_id
+    uint32_t dev_page_run_index(uint32_t dev_page_id) const;
+
     uint32_t get_bank_id_from_page_id (uint32_t page_id) const{
         TT_ASSERT(is_sharded(this->buffer_layout_) , "Buffer not sharded");
         auto core_id = dev_page_to_core_mapping_[page_id];
@@ -272,6 +287,7 @@ class Buffer {
 
    private:
     void allocate();
+    void copy_shard_page_mapping(const Buffer &other);
 
     void deallocate();
     friend void DeallocateBuffer(Buffer &buffer);
@@ -288,6 +304,7 @@ class Buffer {
     std::vector< std::vector<uint32_t> > core_host_page_indices_;
     std::vector<uint32_t> dev_page_to_core_mapping_;
     std::vector<uint32_t> dev_page_to_host_page_mapping_;
+    std::vector<BufferPageRun> dev_page_runs_;
     std::unordered_map<CoreCoord, uint32_t> core_to_core_id_;
 };
 
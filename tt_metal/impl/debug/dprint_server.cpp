@@ -2,6 +2,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <mutex>
 #include <thread>
 #include <future>
 #include <iostream>
@@ -671,6 +672,9 @@ void DebugPrintServerContext::PollPrintData(uint32_t hart_mask) {
 DebugPrintServerContext* DebugPrintServerContext::inst = nullptr;
 bool DebugPrintServerContext::ProfilerIsRunning = false;
 
+// Devices may be opened concurrently, only one of them starts the server
+std::mutex attach_mutex;
+
 } // anon namespace
 
 // Implementation for functions available from dprint_server.hpp.
@@ -692,6 +696,7 @@ void DprintServerAttach(Device* device) {
             return;
 
     // If no server ir running, create one
+    std::lock_guard<std::mutex> lock(attach_mutex);
     if (!DprintServerIsRunning())
         DebugPrintServerContext* ctx = new DebugPrintServerContext();
 
@@ -700,6 +705,7 @@ void DprintServerAttach(Device* device) {
 }
 
 void DprintServerDetach(Device* device) {
+    std::lock_guard<std::mutex> lock(attach_mutex);
     if (DprintServerIsRunning()) {
         DebugPrintServerContext::inst->DetachDevice(device);
 
@@ -2,6 +2,10 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <unistd.h>
+
+#include <filesystem>
+
 #include "tt_metal/impl/device/device.hpp"
 #include "tt_metal/common/core_descriptor.hpp"
 #include "tt_metal/hostdevcommon/common_runtime_address_map.h"
@@ -88,6 +92,7 @@ void Device::initialize_allocator(const std::vector<uint32_t>& l1_bank_remap) {
         .worker_log_to_physical_routing_x=soc_desc.worker_log_to_physical_routing_x,
         .worker_log_to_physical_routing_y=soc_desc.worker_log_to_physical_routing_y,
         .l1_bank_remap = l1_bank_remap,
+        .algorithm = llrt::OptionsG.get_indexed_free_list_allocator() ? AllocatorAlgorithm::INDEXED_FREE_LIST : AllocatorAlgorithm::FREE_LIST,
     });
     // Initialize dram_offsets from soc_descriptor
     for (auto channel = 0; channel < soc_desc.get_num_dram_channels(); channel++) {
@@ -120,12 +125,23 @@ void Device::initialize_allocator(const std::vector<uint32_t>& l1_bank_remap) {
     // This is the only allocator scheme supported because kernel APIs assume num L1 banks are power of 2
     static_assert(this->allocator_scheme_ == MemoryAllocator::L1_BANKING);
     this->allocator_ = std::make_unique<L1BankingAllocator>(config);
+    if (const auto &trace_dir = llrt::OptionsG.get_allocator_trace_dir(); not trace_dir.empty()) {
+        allocator::enable_allocation_trace(*this->allocator_, trace_dir + "/device_" + std::to_string(this->id_));
+    }
 }
 
 void Device::initialize_build() {
     ZoneScoped;
 
     this->build_env_.init(this->id(), this->arch());
+    // The device specific part of the firmware is the generated headers, devices generating the same ones share
+    // a firmware build. They are staged apart for each process, so that opening the device from another process
+    // neither sees them half written nor removes them, and copied into the shared build when it is (re)built
+    const std::string headers_path =
+        this->build_env_.get_out_firmware_root_path() + "headers." + std::to_string(getpid()) + "/";
+    std::filesystem::remove_all(headers_path);
+    detail::GenerateDeviceHeaders(this, headers_path);
+    this->build_env_.init_firmware_root(headers_path);
 
     auto init_helper = [this] (bool is_fw) -> JitBuildStateSet {
         std::vector<std::shared_ptr<JitBuildState>> build_states;
@@ -158,8 +174,7 @@ void Device::initialize_build() {
 void Device::build_firmware() {
     ZoneScoped;
 
-    detail::GenerateDeviceHeaders(this, this->build_env_.get_out_firmware_root_path());
-    jit_build_set(this->firmware_build_states_, nullptr, "");
+    jit_build_firmware(this->build_env_, this->firmware_build_states_);
 }
 
 void Device::initialize_firmware(CoreCoord phys_core, launch_msg_t *launch_msg) {
@@ -167,7 +182,7 @@ void Device::initialize_firmware(CoreCoord phys_core, launch_msg_t *launch_msg)
 
     if (llrt::is_ethernet_core(phys_core, this->id())) {
         int eriscv_id = build_processor_type_to_index(JitBuildProcessorType::ETHERNET).first + 0;
-        ll_api::memory binary_mem = llrt::get_risc_binary(firmware_build_states_[eriscv_id]->get_target_out_path(""));
+        const ll_api::memory &binary_mem = *llrt::get_risc_binary(firmware_build_states_[eriscv_id]->get_target_out_path(""));
         uint32_t kernel_size16 = llrt::get_binary_code_size16(binary_mem, eriscv_id);
         log_debug(LogDevice, "ERISC fw binary size: {} in bytes", kernel_size16 * 16);
         llrt::test_load_write_read_risc_binary(binary_mem, this->id(), phys_core, eriscv_id);
@@ -175,8 +190,8 @@ void Device::initialize_firmware(CoreCoord phys_core, launch_msg_t *launch_msg)
     } else {
         llrt::program_brisc_startup_addr(this->id(), phys_core);
         for (int riscv_id = 0; riscv_id < 5; riscv_id++) {
-            ll_api::memory binary_mem =
-                llrt::get_risc_binary(firmware_build_states_[riscv_id]->get_target_out_path(""));
+            const ll_api::memory &binary_mem =
+                *llrt::get_risc_binary(firmware_build_states_[riscv_id]->get_target_out_path(""));
             uint32_t kernel_size16 = llrt::get_binary_code_size16(binary_mem, riscv_id);
             if (riscv_id == 1) {
                 launch_msg->ncrisc_kernel_size16 = kernel_size16;
@@ -291,12 +306,15 @@ bool Device::initialize(const std::vector<uint32_t>& l1_bank_remap) {
     ZoneScoped;
     log_info(tt::LogMetal, "Initializing device {}", this->id_);
     bool already_initialized = this->active_devices_.activate_device(this->id_);
+    const std::string firmware_root = this->build_env_.get_out_firmware_root_path();
     this->initialize_cluster();
     this->initialize_allocator(l1_bank_remap);
     this->initialize_build();
-    if (!already_initialized) {
+    // A reopened device keeps the firmware it built unless its headers changed, e.g. with another bank remap
+    if (!already_initialized or this->build_env_.get_out_firmware_root_path() != firmware_root) {
         this->build_firmware();
     }
+    std::filesystem::remove_all(this->build_env_.get_firmware_headers_path());
 
     DprintServerAttach(this);
     llrt::watcher_init(this->id(),
@@ -473,6 +491,13 @@ const std::vector<uint32_t> &Device::bank_ids_from_logical_core(const CoreCoord
     return allocator::bank_ids_from_logical_core(*this->allocator_, logical_core);
 }
 
+std::optional<uint64_t> Device::lowest_occupied_compute_l1_address() const {
+    // Banks are in lockstep so we only need to get lowest L1 address of one compute and storage core
+    // Only compute with storage cores can have CBs and all compute with storage cores will have the same bank offset
+    const std::vector<uint32_t> &bank_ids = this->bank_ids_from_logical_core(*this->compute_cores_.begin());
+    return allocator::lowest_occupied_l1_address(*this->allocator_, bank_ids[0]);
+}
+
 allocator::Statistics Device::get_memory_allocation_statistics(const BufferType &buffer_type) const {
     this->check_allocator_is_initialized();
     return allocator::get_statistics(*this->allocator_, buffer_type);
@@ -483,6 +508,11 @@ void Device::dump_memory_blocks(const BufferType &buffer_type, std::ofstream &ou
     return allocator::dump_memory_blocks(*this->allocator_, buffer_type, out);
 }
 
+void Device::set_buffer_plan_session(allocator::BufferPlanSession *session) {
+    this->check_allocator_is_initialized();
+    this->allocator_->buffer_plan_session = session;
+}
+
 void Device::deallocate_buffers(){
     allocator::deallocate_buffers(*allocator_);
 }
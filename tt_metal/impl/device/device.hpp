@@ -142,10 +142,16 @@ class Device {
 
     const std::vector<uint32_t> &bank_ids_from_logical_core(const CoreCoord &logical_core) const;
 
+    // Lowest address of an L1 buffer on the compute and storage cores, where their circular buffers have to end
+    std::optional<uint64_t> lowest_occupied_compute_l1_address() const;
+
     allocator::Statistics get_memory_allocation_statistics(const BufferType &buffer_type) const;
 
     void dump_memory_blocks(const BufferType &buffer_type, std::ofstream &out) const;
 
+    // While set, interleaved buffers allocated on the device are recorded by the session and placed by its plan
+    void set_buffer_plan_session(allocator::BufferPlanSession *session);
+
     // Set of logical storage only core coordinates
     const std::set<CoreCoord> &storage_only_cores() const { return this->storage_only_cores_; }
 
@@ -28,7 +28,7 @@ uint32_t get_noc_multicast_encoding(const CoreCoord& top_left, const CoreCoord&
 
 uint32_t get_noc_unicast_encoding(CoreCoord coord) { return NOC_XY_ENCODING(NOC_X(coord.x), NOC_Y(coord.y)); }
 
-ProgramMap ConstructProgramMap(const Device* device, Program& program) {
+void ConstructProgramMap(const Device* device, Program& program, ProgramMap& program_map, uint8_t sections) {
     /*
         TODO(agrebenisan): Move this logic to compile program
     */
@@ -171,7 +171,7 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
             uint32_t sub_kernel_index = 0;
             const auto& binaries = kernel->binaries(device->id());
             for (size_t j = 0; j < binaries.size(); j++) {
-                const ll_api::memory& kernel_bin = binaries[j];
+                const ll_api::memory& kernel_bin = *binaries[j];
 
                 uint32_t k = 0;
                 uint32_t num_spans = kernel_bin.num_spans();
@@ -225,8 +225,8 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
             for (KernelHandle kernel_id : kernel_ids) {
                 const Kernel* kernel = detail::GetKernel(program, kernel_id);
 
-                for (const ll_api::memory& kernel_bin : kernel->binaries(device->id())) {
-                    kernel_bin.process_spans([&](vector<uint32_t>::const_iterator mem_ptr, uint64_t dst, uint32_t len) {
+                for (const auto& kernel_bin : kernel->binaries(device->id())) {
+                    kernel_bin->process_spans([&](vector<uint32_t>::const_iterator mem_ptr, uint64_t dst, uint32_t len) {
                         std::copy(mem_ptr, mem_ptr + len, program_pages.begin() + program_page_idx);
 
                         program_page_idx =
@@ -236,212 +236,243 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
             }
         };
 
-    // Step 1: Get transfer info for runtime args (soon to just be host data). We
-    // want to send host data first because of the higher latency to pull
-    // in host data.
-    for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
-        Kernel* kernel = detail::GetKernel(program, kernel_id);
-        uint32_t dst = processor_to_l1_arg_base_addr.at(kernel->processor());
-        const auto& kernel_core_type = kernel->get_kernel_core_type();
-        for (const auto& core_coord : kernel->cores_with_runtime_args()) {
-            CoreCoord physical_core =
-                device->physical_core_from_logical_core(core_coord, kernel->get_kernel_core_type());
-            const auto& runtime_args = kernel->runtime_args(core_coord);
-            uint32_t num_bytes = runtime_args.size() * sizeof(uint32_t);
-            uint32_t dst_noc = get_noc_unicast_encoding(physical_core);
-
-            // Only one receiver per set of runtime arguments
-            src = update_program_page_transfers(
-                src,
-                num_bytes,
-                dst,
-                runtime_arg_page_transfers.at(PageTransferType::MULTICAST),
-                num_transfers_in_runtime_arg_pages.at(PageTransferType::MULTICAST),
-                {{dst_noc, 1}});
+    if (sections & PROGRAM_MAP_RUNTIME_ARGS) {
+        // Step 1: Get transfer info for runtime args (soon to just be host data). We
+        // want to send host data first because of the higher latency to pull
+        // in host data.
+        for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
+            const Kernel* kernel = detail::GetKernel(program, kernel_id);
+            uint32_t dst = processor_to_l1_arg_base_addr.at(kernel->processor());
+            const auto& kernel_core_type = kernel->get_kernel_core_type();
+            // Whole arena slots are sent so the host data is the arena as is
+            uint32_t num_bytes = kernel->runtime_args_stride() * sizeof(uint32_t);
+            for (const auto& core_coord : kernel->cores_with_runtime_args()) {
+                CoreCoord physical_core =
+                    device->physical_core_from_logical_core(core_coord, kernel->get_kernel_core_type());
+                uint32_t dst_noc = get_noc_unicast_encoding(physical_core);
+
+                // Only one receiver per set of runtime arguments
+                src = update_program_page_transfers(
+                    src,
+                    num_bytes,
+                    dst,
+                    runtime_arg_page_transfers.at(PageTransferType::MULTICAST),
+                    num_transfers_in_runtime_arg_pages.at(PageTransferType::MULTICAST),
+                    {{dst_noc, 1}});
+            }
+
+            const auto& common_runtime_args = kernel->common_runtime_args();
+            if (not common_runtime_args.empty()) {
+                src = update_program_page_transfers(
+                    src,
+                    common_runtime_args.size() * sizeof(uint32_t),
+                    kernel->common_runtime_args_base(),
+                    runtime_arg_page_transfers.at(PageTransferType::MULTICAST),
+                    num_transfers_in_runtime_arg_pages.at(PageTransferType::MULTICAST),
+                    extract_dst_noc_multicast_info(kernel->core_range_set().ranges(), kernel_core_type));
+            }
+        }
+
+        // Cleanup step of separating runtime arg pages from program pages
+        if (num_transfers_within_page) {
+            num_transfers_in_runtime_arg_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
         }
+        program_map.runtime_arg_page_transfers = std::move(runtime_arg_page_transfers);
+        program_map.num_transfers_in_runtime_arg_pages = std::move(num_transfers_in_runtime_arg_pages);
+        program_map.runtime_args_layout_version = program.runtime_args_layout_version();
     }
 
-    // Cleanup step of separating runtime arg pages from program pages
-    if (num_transfers_within_page) {
-        num_transfers_in_runtime_arg_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
+    if (sections & PROGRAM_MAP_CB_CONFIGS) {
+        src = 0;  // Resetting since in a new page
+        // Step 2: Continue constructing pages for circular buffer configs
+        for (const shared_ptr<CircularBuffer>& cb : program.circular_buffers()) {
+            // No CB support for ethernet cores
+            vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info =
+                extract_dst_noc_multicast_info(cb->core_ranges().ranges(), CoreType::WORKER);
+            constexpr static uint32_t num_bytes = UINT32_WORDS_PER_CIRCULAR_BUFFER_CONFIG * sizeof(uint32_t);
+            for (const auto buffer_index : cb->buffer_indices()) {
+                src = update_program_page_transfers(
+                    src,
+                    num_bytes,
+                    CIRCULAR_BUFFER_CONFIG_BASE + buffer_index * UINT32_WORDS_PER_CIRCULAR_BUFFER_CONFIG * sizeof(uint32_t),
+                    cb_config_page_transfers.at(PageTransferType::MULTICAST),
+                    num_transfers_in_cb_config_pages.at(PageTransferType::MULTICAST),
+                    dst_noc_multicast_info);
+            }
+        }
+
+        // Cleanup step of separating runtime arg pages from program pages
+        if (num_transfers_within_page) {
+            num_transfers_in_cb_config_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
+        }
+        program_map.cb_config_page_transfers = std::move(cb_config_page_transfers);
+        program_map.num_transfers_in_cb_config_pages = std::move(num_transfers_in_cb_config_pages);
+        program_map.circular_buffers_version = program.circular_buffers_version();
     }
 
-    src = 0;  // Resetting since in a new page
-    // Step 2: Continue constructing pages for circular buffer configs
-    for (const shared_ptr<CircularBuffer>& cb : program.circular_buffers()) {
-        // No CB support for ethernet cores
-        vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info =
-            extract_dst_noc_multicast_info(cb->core_ranges().ranges(), CoreType::WORKER);
-        constexpr static uint32_t num_bytes = UINT32_WORDS_PER_CIRCULAR_BUFFER_CONFIG * sizeof(uint32_t);
-        for (const auto buffer_index : cb->buffer_indices()) {
+    if (sections & PROGRAM_MAP_PROGRAM_PAGES) {
+        // Split kernel groups by multicast/unicast, program multicast transfers first then unicast
+        std::vector<KernelGroup> kernel_group_multicast;
+        std::vector<KernelGroup> kernel_group_unicast;
+        for (const KernelGroup& kernel_group : program.get_kernel_groups()) {
+            if (kernel_group.get_core_type() == CoreType::WORKER) {
+                kernel_group_multicast.emplace_back(kernel_group);
+            } else if (kernel_group.get_core_type() == CoreType::ETH) {
+                kernel_group_unicast.emplace_back(kernel_group);
+            } else {
+                TT_ASSERT(false, "Constructing command for unsupported core type");
+            }
+        }
+        // Enqueue program binaries and go siggals in this order:
+        // - Multicast Program Binaries
+        // - Unicast Program Binaries
+        // - Multicast Go Signals
+        // - Unicast Go Signals
+        // This probably has better perf than sending binaries and go signals together:
+        // - Multicast Program Binaries
+        // - Multicast Go Signals
+        // - Unicast Program Binaries
+        // - Unicast Go Signals
+        // Step 3a (Multicast): Determine the transfer information for each program binary
+        src = 0;  // Restart src since multicast program binaries begins in a new page
+        for (const KernelGroup& kernel_group : kernel_group_multicast) {
+            src = update_program_page_for_kernel_group(src, kernel_group, PageTransferType::MULTICAST);
+        }
+        // Step 4 (Multicast): Continue constructing pages for semaphore configs, only multicast/worker cores supported
+        for (const Semaphore& semaphore : program.semaphores()) {
+            vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info =
+                extract_dst_noc_multicast_info(semaphore.core_range_set().ranges(), CoreType::WORKER);
+
             src = update_program_page_transfers(
                 src,
-                num_bytes,
-                CIRCULAR_BUFFER_CONFIG_BASE + buffer_index * UINT32_WORDS_PER_CIRCULAR_BUFFER_CONFIG * sizeof(uint32_t),
-                cb_config_page_transfers.at(PageTransferType::MULTICAST),
-                num_transfers_in_cb_config_pages.at(PageTransferType::MULTICAST),
+                L1_ALIGNMENT,
+                semaphore.address(),
+                program_page_transfers.at(PageTransferType::MULTICAST),
+                num_transfers_in_program_pages.at(PageTransferType::MULTICAST),
                 dst_noc_multicast_info);
         }
-    }
-
-    // Cleanup step of separating runtime arg pages from program pages
-    if (num_transfers_within_page) {
-        num_transfers_in_cb_config_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
-    }
 
-    // Split kernel groups by multicast/unicast, program multicast transfers first then unicast
-    std::vector<KernelGroup> kernel_group_multicast;
-    std::vector<KernelGroup> kernel_group_unicast;
-    for (const KernelGroup& kernel_group : program.get_kernel_groups()) {
-        if (kernel_group.get_core_type() == CoreType::WORKER) {
-            kernel_group_multicast.emplace_back(kernel_group);
-        } else if (kernel_group.get_core_type() == CoreType::ETH) {
-            kernel_group_unicast.emplace_back(kernel_group);
-        } else {
-            TT_ASSERT(false, "Constructing command for unsupported core type");
+        if (num_transfers_within_page) {
+            num_transfers_in_program_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
         }
-    }
-    // Enqueue program binaries and go siggals in this order:
-    // - Multicast Program Binaries
-    // - Unicast Program Binaries
-    // - Multicast Go Signals
-    // - Unicast Go Signals
-    // This probably has better perf than sending binaries and go signals together:
-    // - Multicast Program Binaries
-    // - Multicast Go Signals
-    // - Unicast Program Binaries
-    // - Unicast Go Signals
-    // Step 3a (Multicast): Determine the transfer information for each program binary
-    src = 0;  // Restart src since multicast program binaries begins in a new page
-    for (const KernelGroup& kernel_group : kernel_group_multicast) {
-        src = update_program_page_for_kernel_group(src, kernel_group, PageTransferType::MULTICAST);
-    }
-    // Step 4 (Multicast): Continue constructing pages for semaphore configs, only multicast/worker cores supported
-    for (const Semaphore& semaphore : program.semaphores()) {
-        vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info =
-            extract_dst_noc_multicast_info(semaphore.core_range_set().ranges(), CoreType::WORKER);
-
-        src = update_program_page_transfers(
-            src,
-            L1_ALIGNMENT,
-            semaphore.address(),
-            program_page_transfers.at(PageTransferType::MULTICAST),
-            num_transfers_in_program_pages.at(PageTransferType::MULTICAST),
-            dst_noc_multicast_info);
-    }
-
-    if (num_transfers_within_page) {
-        num_transfers_in_program_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
-    }
 
-    // Step 3b (Unicast)
-    // skipping step 4 since no semaphore support
-    update_program_pages_with_new_page();  // sets src to 0 since unicast program binaries begins in new page
-    for (const KernelGroup& kernel_group : kernel_group_unicast) {
-        src = update_program_page_for_kernel_group(src, kernel_group, PageTransferType::UNICAST);
-    }
-    if (num_transfers_within_page) {
-        num_transfers_in_program_pages.at(PageTransferType::UNICAST).push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
-    }
+        // Step 3b (Unicast)
+        // skipping step 4 since no semaphore support
+        update_program_pages_with_new_page();  // sets src to 0 since unicast program binaries begins in new page
+        for (const KernelGroup& kernel_group : kernel_group_unicast) {
+            src = update_program_page_for_kernel_group(src, kernel_group, PageTransferType::UNICAST);
+        }
+        if (num_transfers_within_page) {
+            num_transfers_in_program_pages.at(PageTransferType::UNICAST).push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
+        }
 
-    // Step 5a (Multicast): Continue constructing pages for GO signals, multicast first then unicast
-    update_program_pages_with_new_page();  // sets src to 0 since multicast signals begins in new page
-    for (KernelGroup& kernel_group : kernel_group_multicast) {
-        kernel_group.launch_msg.mode = DISPATCH_MODE_DEV;
-        vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info =
-            extract_dst_noc_multicast_info(kernel_group.core_ranges.ranges(), kernel_group.get_core_type());
-        src = update_program_page_transfers(
-            src,
-            sizeof(launch_msg_t),
-            GET_MAILBOX_ADDRESS_HOST(launch),
-            go_signal_page_transfers.at(PageTransferType::MULTICAST),
-            num_transfers_in_go_signal_pages.at(PageTransferType::MULTICAST),
-            dst_noc_multicast_info);
-    }
-    if (num_transfers_within_page) {
-        num_transfers_in_go_signal_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
-    }
+        // Step 5a (Multicast): Continue constructing pages for GO signals, multicast first then unicast
+        update_program_pages_with_new_page();  // sets src to 0 since multicast signals begins in new page
+        for (KernelGroup& kernel_group : kernel_group_multicast) {
+            kernel_group.launch_msg.mode = DISPATCH_MODE_DEV;
+            vector<pair<uint32_t, uint32_t>> dst_noc_multicast_info =
+                extract_dst_noc_multicast_info(kernel_group.core_ranges.ranges(), kernel_group.get_core_type());
+            src = update_program_page_transfers(
+                src,
+                sizeof(launch_msg_t),
+                GET_MAILBOX_ADDRESS_HOST(launch),
+                go_signal_page_transfers.at(PageTransferType::MULTICAST),
+                num_transfers_in_go_signal_pages.at(PageTransferType::MULTICAST),
+                dst_noc_multicast_info);
+        }
+        if (num_transfers_within_page) {
+            num_transfers_in_go_signal_pages.at(PageTransferType::MULTICAST).push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
+        }
 
-    // Step 5b (Unicast)
-    update_program_pages_with_new_page();  // sets src to 0 since unicast signals begins in new page
-    for (const KernelGroup& kernel_group : kernel_group_unicast) {
-        if (kernel_group.get_core_type() == CoreType::ETH) {
-            const Kernel* kernel = detail::GetKernel(program, kernel_group.erisc_id.value());
-            for (const auto& logical_eth_core : kernel->logical_cores()) {
-                uint32_t dst_noc =
-                    get_noc_unicast_encoding(device->physical_core_from_logical_core(logical_eth_core, CoreType::ETH));
-                src = update_program_page_transfers(
-                    src,
-                    sizeof(uint32_t),
-                    eth_l1_mem::address_map::ERISC_APP_SYNC_INFO_BASE,
-                    go_signal_page_transfers.at(PageTransferType::UNICAST),
-                    num_transfers_in_go_signal_pages.at(PageTransferType::UNICAST),
-                    {{dst_noc, 1}});
+        // Step 5b (Unicast)
+        update_program_pages_with_new_page();  // sets src to 0 since unicast signals begins in new page
+        for (const KernelGroup& kernel_group : kernel_group_unicast) {
+            if (kernel_group.get_core_type() == CoreType::ETH) {
+                const Kernel* kernel = detail::GetKernel(program, kernel_group.erisc_id.value());
+                for (const auto& logical_eth_core : kernel->logical_cores()) {
+                    uint32_t dst_noc =
+                        get_noc_unicast_encoding(device->physical_core_from_logical_core(logical_eth_core, CoreType::ETH));
+                    src = update_program_page_transfers(
+                        src,
+                        sizeof(uint32_t),
+                        eth_l1_mem::address_map::ERISC_APP_SYNC_INFO_BASE,
+                        go_signal_page_transfers.at(PageTransferType::UNICAST),
+                        num_transfers_in_go_signal_pages.at(PageTransferType::UNICAST),
+                        {{dst_noc, 1}});
+                }
+            } else {
+                TT_ASSERT(false, "All non-ethernet core go signals should be muticasted");
             }
-        } else {
-            TT_ASSERT(false, "All non-ethernet core go signals should be muticasted");
         }
-    }
-    if (num_transfers_within_page) {
-        num_transfers_in_go_signal_pages.at(PageTransferType::UNICAST).push_back(num_transfers_within_page);
-        num_transfers_within_page = 0;
-    }
+        if (num_transfers_within_page) {
+            num_transfers_in_go_signal_pages.at(PageTransferType::UNICAST).push_back(num_transfers_within_page);
+            num_transfers_within_page = 0;
+        }
 
-    // Allocate some more space for GO signal
-    update_program_pages_with_new_page();  // sets src to 0, but not needed
+        // Allocate some more space for GO signal
+        update_program_pages_with_new_page();  // sets src to 0, but not needed
 
-    // Create a vector of all program binaries/cbs/semaphores
-    align_program_page_idx_to_new_page();
-    for (const KernelGroup& kernel_group : kernel_group_multicast) {
-        populate_program_binaries_pages(kernel_group);
-    }
+        // Create a vector of all program binaries/cbs/semaphores
+        align_program_page_idx_to_new_page();
+        for (const KernelGroup& kernel_group : kernel_group_multicast) {
+            populate_program_binaries_pages(kernel_group);
+        }
 
-    for (const Semaphore& semaphore : program.semaphores()) {
-        program_pages[program_page_idx] = semaphore.initial_value();
-        program_page_idx += 4;
-    }
+        for (const Semaphore& semaphore : program.semaphores()) {
+            program_pages[program_page_idx] = semaphore.initial_value();
+            program_page_idx += 4;
+        }
 
-    align_program_page_idx_to_new_page();
-    for (const KernelGroup& kernel_group : kernel_group_unicast) {
-        populate_program_binaries_pages(kernel_group);
-    }
+        align_program_page_idx_to_new_page();
+        for (const KernelGroup& kernel_group : kernel_group_unicast) {
+            populate_program_binaries_pages(kernel_group);
+        }
 
-    // Since GO signal begin in a new page, I need to advance my idx
-    align_program_page_idx_to_new_page();
-    // uint32_t dispatch_core_word = ((uint32_t)dispatch_core.y << 16) | dispatch_core.x;
-    for (KernelGroup& kernel_group : kernel_group_multicast) {
-        // TODO(agrebenisan): Hanging when we extend the launch msg. Needs to be investigated. For now,
-        // only supporting enqueue program for cq 0 on a device.
-        // kernel_group.launch_msg.dispatch_core_x = dispatch_core.x;
-        // kernel_group.launch_msg.dispatch_core_y = dispatch_core.y;
-        static_assert(sizeof(launch_msg_t) % sizeof(uint32_t) == 0);
-        uint32_t* launch_message_data = (uint32_t*)&kernel_group.launch_msg;
-        for (int i = 0; i < sizeof(launch_msg_t) / sizeof(uint32_t); i++) {
-            program_pages[program_page_idx + i] = launch_message_data[i];
+        // Since GO signal begin in a new page, I need to advance my idx
+        align_program_page_idx_to_new_page();
+        // uint32_t dispatch_core_word = ((uint32_t)dispatch_core.y << 16) | dispatch_core.x;
+        for (KernelGroup& kernel_group : kernel_group_multicast) {
+            // TODO(agrebenisan): Hanging when we extend the launch msg. Needs to be investigated. For now,
+            // only supporting enqueue program for cq 0 on a device.
+            // kernel_group.launch_msg.dispatch_core_x = dispatch_core.x;
+            // kernel_group.launch_msg.dispatch_core_y = dispatch_core.y;
+            static_assert(sizeof(launch_msg_t) % sizeof(uint32_t) == 0);
+            uint32_t* launch_message_data = (uint32_t*)&kernel_group.launch_msg;
+            for (int i = 0; i < sizeof(launch_msg_t) / sizeof(uint32_t); i++) {
+                program_pages[program_page_idx + i] = launch_message_data[i];
+            }
+            program_page_idx += sizeof(launch_msg_t) / sizeof(uint32_t);
         }
-        program_page_idx += sizeof(launch_msg_t) / sizeof(uint32_t);
-    }
 
-    align_program_page_idx_to_new_page();
-    for (KernelGroup& kernel_group : kernel_group_unicast) {
-        if (kernel_group.get_core_type() == CoreType::ETH) {
-            const Kernel* kernel = detail::GetKernel(program, kernel_group.erisc_id.value());
-            for (const auto& logical_eth_core : kernel->logical_cores()) {
-                program_pages[program_page_idx] = 1;
-                program_page_idx += 4;  // 16 byte L1 alignment
+        align_program_page_idx_to_new_page();
+        for (KernelGroup& kernel_group : kernel_group_unicast) {
+            if (kernel_group.get_core_type() == CoreType::ETH) {
+                const Kernel* kernel = detail::GetKernel(program, kernel_group.erisc_id.value());
+                for (const auto& logical_eth_core : kernel->logical_cores()) {
+                    program_pages[program_page_idx] = 1;
+                    program_page_idx += 4;  // 16 byte L1 alignment
+                }
+            } else {
+                TT_ASSERT(false, "All non-ethernet core go signals should be muticasted");
             }
-        } else {
-            TT_ASSERT(false, "All non-ethernet core go signals should be muticasted");
         }
-    }
 
-    TT_ASSERT(
-        program_new_page_tracker == 0, "Number of new program pages not aligned between sizing and populating data.");
+        TT_ASSERT(
+            program_new_page_tracker == 0, "Number of new program pages not aligned between sizing and populating data.");
+
+        program_map.program_pages = std::move(program_pages);
+        program_map.program_page_transfers = std::move(program_page_transfers);
+        program_map.go_signal_page_transfers = std::move(go_signal_page_transfers);
+        program_map.num_transfers_in_program_pages = std::move(num_transfers_in_program_pages);
+        program_map.num_transfers_in_go_signal_pages = std::move(num_transfers_in_go_signal_pages);
+        program_map.binaries_version = program.binaries_version();
+        program_map.semaphores_version = program.semaphores_version();
+    }
 
     uint32_t num_workers = 0;
     // Explicitly sum the worker and eth cores, since we don't have support for all core types
@@ -450,18 +481,7 @@ ProgramMap ConstructProgramMap(const Device* device, Program& program) {
     } else if (program.logical_cores().find(CoreType::ETH) != program.logical_cores().end()) {
         num_workers += program.logical_cores().at(CoreType::ETH).size();
     }
-    return {
-        .num_workers = num_workers,
-        .program_pages = std::move(program_pages),
-        .program_page_transfers = std::move(program_page_transfers),
-        .runtime_arg_page_transfers = std::move(runtime_arg_page_transfers),
-        .cb_config_page_transfers = std::move(cb_config_page_transfers),
-        .go_signal_page_transfers = std::move(go_signal_page_transfers),
-        .num_transfers_in_program_pages = std::move(num_transfers_in_program_pages),
-        .num_transfers_in_runtime_arg_pages = std::move(num_transfers_in_runtime_arg_pages),
-        .num_transfers_in_cb_config_pages = std::move(num_transfers_in_cb_config_pages),
-        .num_transfers_in_go_signal_pages = std::move(num_transfers_in_go_signal_pages),
-    };
+    program_map.num_workers = num_workers;
 }
 
 EnqueueRestartCommand::EnqueueRestartCommand(
@@ -473,7 +493,7 @@ EnqueueRestartCommand::EnqueueRestartCommand(
 }
 
 const DeviceCommand EnqueueRestartCommand::assemble_device_command(uint32_t) {
-    DeviceCommand cmd;
+    DeviceCommand cmd(this->manager.issue_queue_reserve_command_slot(this->command_queue_channel));
     cmd.set_restart();
     cmd.set_issue_queue_size(this->manager.get_issue_queue_size(this->command_queue_channel));
     cmd.set_completion_queue_size(this->manager.get_completion_queue_size(this->command_queue_channel));
@@ -482,11 +502,8 @@ const DeviceCommand EnqueueRestartCommand::assemble_device_command(uint32_t) {
 }
 
 void EnqueueRestartCommand::process() {
-    uint32_t write_ptr = this->manager.get_issue_queue_write_ptr(this->command_queue_channel);
     const DeviceCommand cmd = this->assemble_device_command(0);
     uint32_t cmd_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND;
-    this->manager.issue_queue_reserve_back(cmd_size, this->command_queue_channel);
-    this->manager.cq_write(cmd.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
     this->manager.issue_queue_push_back(cmd_size, false, this->command_queue_channel);
 }
 
@@ -504,7 +521,7 @@ EnqueueReadBufferCommand::EnqueueReadBufferCommand(
 }
 
 const DeviceCommand EnqueueReadShardedBufferCommand::create_buffer_transfer_instruction(uint32_t dst_address, uint32_t padded_page_size, uint32_t num_pages) {
-    DeviceCommand command;
+    DeviceCommand command(this->manager.issue_queue_reserve_command_slot(this->command_queue_id));
 
     TT_ASSERT(is_sharded(this->buffer.buffer_layout()));
     uint32_t buffer_address = this->buffer.address();
@@ -544,7 +561,7 @@ const DeviceCommand EnqueueReadShardedBufferCommand::create_buffer_transfer_inst
 }
 
 const DeviceCommand EnqueueReadInterleavedBufferCommand::create_buffer_transfer_instruction(uint32_t dst_address, uint32_t padded_page_size, uint32_t num_pages) {
-    DeviceCommand command;
+    DeviceCommand command(this->manager.issue_queue_reserve_command_slot(this->command_queue_id));
     TT_ASSERT(not is_sharded(this->buffer.buffer_layout()));
 
     uint32_t buffer_address = this->buffer.address();
@@ -599,14 +616,12 @@ const DeviceCommand EnqueueReadBufferCommand::assemble_device_command(uint32_t d
 }
 
 void EnqueueReadBufferCommand::process() {
-    uint32_t write_ptr = this->manager.get_issue_queue_write_ptr(this->command_queue_id);
-    this->read_buffer_addr = this->manager.get_completion_queue_read_ptr(this->command_queue_id);
+    this->read_buffer_addr = this->manager.get_completion_queue_issue_ptr(this->command_queue_id);
 
     const DeviceCommand cmd = this->assemble_device_command(this->read_buffer_addr);
 
-    this->manager.issue_queue_reserve_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, this->command_queue_id);
-    this->manager.cq_write(cmd.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
     this->manager.issue_queue_push_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
+    this->manager.completion_queue_issue_read(this->pages_to_read * align(this->buffer.page_size(), 32), this->command_queue_id);
 }
 
 // EnqueueWriteBufferCommand section
@@ -627,7 +642,7 @@ EnqueueWriteBufferCommand::EnqueueWriteBufferCommand(
 
 
 const DeviceCommand EnqueueWriteInterleavedBufferCommand::create_buffer_transfer_instruction(uint32_t src_address, uint32_t padded_page_size, uint32_t num_pages) {
-    DeviceCommand command;
+    DeviceCommand command(this->manager.issue_queue_reserve_command_slot(this->command_queue_id));
 
     TT_ASSERT(not is_sharded(this->buffer.buffer_layout()));
 
@@ -649,7 +664,7 @@ const DeviceCommand EnqueueWriteInterleavedBufferCommand::create_buffer_transfer
 }
 
 const DeviceCommand EnqueueWriteShardedBufferCommand::create_buffer_transfer_instruction(uint32_t src_address, uint32_t padded_page_size, uint32_t num_pages) {
-    DeviceCommand command;
+    DeviceCommand command(this->manager.issue_queue_reserve_command_slot(this->command_queue_id));
 
     TT_ASSERT(is_sharded(this->buffer.buffer_layout()));
     uint32_t buffer_address = this->buffer.address();
@@ -727,6 +742,18 @@ const DeviceCommand EnqueueWriteBufferCommand::assemble_device_command(uint32_t
     return command;
 }
 
+void EnqueueWriteBufferCommand::write_pages(const char* src, uint32_t num_pages, uint32_t sysmem_address) {
+    if (this->buffer.page_size() % 32 != 0 and this->buffer.page_size() != this->buffer.size()) {
+        // If page size is not 32B-aligned, we cannot do a contiguous write
+        uint32_t padded_page_size = align(this->buffer.page_size(), 32);
+        for (uint32_t page = 0; page < num_pages; page++) {
+            this->manager.cq_write(src + page * this->buffer.page_size(), this->buffer.page_size(), sysmem_address + page * padded_page_size);
+        }
+    } else {
+        this->manager.cq_write(src, num_pages * this->buffer.page_size(), sysmem_address);
+    }
+}
+
 void EnqueueWriteBufferCommand::process() {
     uint32_t write_ptr = this->manager.get_issue_queue_write_ptr(this->command_queue_id);
     uint32_t system_memory_temporary_storage_address = write_ptr + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND;
@@ -737,19 +764,26 @@ void EnqueueWriteBufferCommand::process() {
     uint32_t cmd_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + data_size_in_bytes;
     this->manager.issue_queue_reserve_back(cmd_size, this->command_queue_id);
 
-    this->manager.cq_write(cmd.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
-    uint32_t unpadded_src_offset = this->dst_page_index * this->buffer.page_size();
-
-    if (this->buffer.page_size() % 32 != 0 and this->buffer.page_size() != this->buffer.size()) {
-        // If page size is not 32B-aligned, we cannot do a contiguous write
-        uint32_t src_address_offset = unpadded_src_offset;
-        uint32_t padded_page_size = align(this->buffer.page_size(), 32);
-        for (uint32_t sysmem_address_offset = 0; sysmem_address_offset < data_size_in_bytes; sysmem_address_offset += padded_page_size) {
-            this->manager.cq_write((char*)this->src + src_address_offset, this->buffer.page_size(), system_memory_temporary_storage_address + sysmem_address_offset);
-            src_address_offset += this->buffer.page_size();
+    if (is_sharded(this->buffer.buffer_layout())) {
+        // Gather each run of host pages straight into the device page order the command expects
+        const std::vector<BufferPageRun>& runs = this->buffer.dev_page_runs();
+        uint32_t run_index = this->buffer.dev_page_run_index(this->dst_page_index);
+        uint32_t dev_page_id = this->dst_page_index;
+        uint32_t num_pages_left = this->pages_to_write;
+        uint32_t sysmem_address = system_memory_temporary_storage_address;
+        while (num_pages_left > 0) {
+            const BufferPageRun& run = runs[run_index++];
+            uint32_t run_offset = dev_page_id - run.dev_page_start;
+            uint32_t num_pages = std::min(run.num_pages - run_offset, num_pages_left);
+            uint32_t src_address_offset = (run.host_page_start + run_offset) * this->buffer.page_size();
+            this->write_pages((char*)this->src + src_address_offset, num_pages, sysmem_address);
+            sysmem_address += num_pages * (data_size_in_bytes / this->pages_to_write);
+            dev_page_id += num_pages;
+            num_pages_left -= num_pages;
         }
     } else {
-        this->manager.cq_write((char*)this->src + unpadded_src_offset, data_size_in_bytes, system_memory_temporary_storage_address);
+        uint32_t unpadded_src_offset = this->dst_page_index * this->buffer.page_size();
+        this->write_pages((char*)this->src + unpadded_src_offset, this->pages_to_write, system_memory_temporary_storage_address);
     }
 
     this->manager.issue_queue_push_back(cmd_size, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
@@ -771,7 +805,7 @@ EnqueueProgramCommand::EnqueueProgramCommand(
 }
 
 const DeviceCommand EnqueueProgramCommand::assemble_device_command(uint32_t host_data_src) {
-    DeviceCommand command;
+    DeviceCommand command(this->manager.issue_queue_reserve_command_slot(this->command_queue_id));
     command.set_num_workers(this->program_to_dev_map.num_workers);
 
     auto populate_program_data_transfer_instructions =
@@ -916,23 +950,21 @@ void EnqueueProgramCommand::process() {
     uint32_t data_size_in_bytes = cmd.get_data_size();
     const uint32_t cmd_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + data_size_in_bytes;
     this->manager.issue_queue_reserve_back(cmd_size, this->command_queue_id);
-    this->manager.cq_write(cmd.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
 
-    bool tracing = this->trace.has_value();
-    vector<uint32_t> trace_host_data;
     uint32_t start_addr = system_memory_temporary_storage_address;
     constexpr static uint32_t padding_alignment = 16;
     for (size_t kernel_id = 0; kernel_id < this->program.num_kernels(); kernel_id++) {
-        Kernel* kernel = detail::GetKernel(program, kernel_id);
-        for (const auto& c: kernel->cores_with_runtime_args()) {
-            const auto & core_runtime_args = kernel->runtime_args(c);
-            this->manager.cq_write(core_runtime_args.data(), core_runtime_args.size() * sizeof(uint32_t), system_memory_temporary_storage_address);
-            system_memory_temporary_storage_address = align(system_memory_temporary_storage_address + core_runtime_args.size() * sizeof(uint32_t), padding_alignment);
-
-            if (tracing) {
-                trace_host_data.insert(trace_host_data.end(), core_runtime_args.begin(), core_runtime_args.end());
-                trace_host_data.resize(align(trace_host_data.size(), padding_alignment / sizeof(uint32_t)));
-            }
+        const Kernel* kernel = detail::GetKernel(program, kernel_id);
+        // Arena slots are padded to the transfer alignment, the arena goes out in one copy
+        const vector<uint32_t>& runtime_args_arena = kernel->runtime_args_arena();
+        if (not runtime_args_arena.empty()) {
+            this->manager.cq_write(runtime_args_arena.data(), runtime_args_arena.size() * sizeof(uint32_t), system_memory_temporary_storage_address);
+            system_memory_temporary_storage_address += runtime_args_arena.size() * sizeof(uint32_t);
+        }
+        const auto& common_runtime_args = kernel->common_runtime_args();
+        if (not common_runtime_args.empty()) {
+            this->manager.cq_write(common_runtime_args.data(), common_runtime_args.size() * sizeof(uint32_t), system_memory_temporary_storage_address);
+            system_memory_temporary_storage_address = align(system_memory_temporary_storage_address + common_runtime_args.size() * sizeof(uint32_t), padding_alignment);
         }
     }
 
@@ -944,35 +976,26 @@ void EnqueueProgramCommand::process() {
             cb_data = {cb->address() >> 4, cb->size() >> 4, cb->num_pages(buffer_index), cb->size() / cb->num_pages(buffer_index) >> 4};
             this->manager.cq_write(cb_data.data(), padding_alignment, system_memory_temporary_storage_address);
             system_memory_temporary_storage_address += padding_alignment;
-            if (tracing) {
-                // No need to resize since cb_data size is guaranteed to be 16 bytes
-                trace_host_data.insert(trace_host_data.end(), cb_data.begin(), cb_data.end());
-            }
         }
     }
 
     this->manager.issue_queue_push_back(cmd_size, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
-    if (tracing) {
-        Trace::TraceNode trace_node = {.command = cmd, .data = trace_host_data, .command_type = this->type(), .num_data_bytes = cmd.get_data_size()};
-        Trace& trace_ = trace.value();
-        trace_.record(trace_node);
+    if (this->trace.has_value()) {
+        this->trace.value().get().record_program(this->program, cmd);
     }
 }
 
 FinishCommand::FinishCommand(uint32_t command_queue_id, Device* device, SystemMemoryManager& manager) : command_queue_id(command_queue_id), manager(manager) { this->device = device; }
 
 const DeviceCommand FinishCommand::assemble_device_command(uint32_t) {
-    DeviceCommand command;
+    DeviceCommand command(this->manager.issue_queue_reserve_command_slot(this->command_queue_id));
     command.set_finish();
     return command;
 }
 
 void FinishCommand::process() {
-    uint32_t write_ptr = this->manager.get_issue_queue_write_ptr(this->command_queue_id);
     const DeviceCommand cmd = this->assemble_device_command(0);
     uint32_t cmd_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND;
-    this->manager.issue_queue_reserve_back(cmd_size, this->command_queue_id);
-    this->manager.cq_write(cmd.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, write_ptr);
     this->manager.issue_queue_push_back(cmd_size, false, this->command_queue_id);
 }
 
@@ -999,10 +1022,9 @@ void EnqueueWrapCommand::process() {
     this->manager.issue_queue_reserve_back(wrap_packet_size_bytes, this->command_queue_id);
     this->manager.cq_write(cmd.data(), wrap_packet_size_bytes, write_ptr);
     if (this->wrap_region == DeviceCommand::WrapRegion::COMPLETION) {
-        // Wrap the read pointers for completion queue because device will start writing data at head of completion queue and there are no more reads to be done at current completion queue write pointer
-        // If we don't wrap the read then the subsequent read buffer command may attempt to read past the total command queue size
-        // because the read buffer command will see updated write pointer to compute num pages to read but the local read pointer is pointing to tail of completion queue
-        this->manager.wrap_completion_queue_rd_ptr(this->command_queue_id);
+        // Device will start writing data at head of completion queue and there are no more reads to be done at current completion queue write pointer
+        // The read pointer is wrapped by the completion queue reader once it has drained the reads enqueued before this wrap
+        this->manager.completion_queue_enqueue_wrap(this->command_queue_id);
         this->manager.issue_queue_push_back(wrap_packet_size_bytes, LAZY_COMMAND_QUEUE_MODE, this->command_queue_id);
     } else {
         this->manager.wrap_issue_queue_wr_ptr(this->command_queue_id);
@@ -1027,6 +1049,10 @@ CommandQueue::CommandQueue(Device* device, uint32_t id): manager(*device->manage
 
 CommandQueue::~CommandQueue() {}
 
+void CommandQueue::retire_program_buffer(unique_ptr<Buffer> buffer) {
+    this->retired_program_buffers.push_back(std::move(buffer));
+}
+
 void CommandQueue::enqueue_command(Command& command, bool blocking) {
     // For the time-being, doing the actual work of enqueing in
     // the main thread.
@@ -1039,112 +1065,75 @@ void CommandQueue::enqueue_command(Command& command, bool blocking) {
 }
 
 
-//TODO: Currently converting page ordering from interleaved to sharded and then doing contiguous read/write
-// Look into modifying command to do read/write of a page at a time to avoid doing copy
-void convert_interleaved_to_sharded_on_host(const void * host,
-                                        const Buffer & buffer,
-                                        bool read=false) {
-
-    const uint32_t num_pages = buffer.num_pages();
-    const uint32_t page_size = buffer.page_size();
-
-    const uint32_t size_in_bytes = num_pages * page_size;
-
-    void * temp = malloc(size_in_bytes);
-    memcpy(temp, host, size_in_bytes);
-
-    const void * dst = host;
-    std::set<uint32_t> pages_seen;
-    for (uint32_t host_page_id = 0; host_page_id < num_pages; host_page_id++) {
-        auto dev_page_id = buffer.get_mapped_page_id(host_page_id);
-
-        TT_ASSERT(dev_page_id < num_pages and dev_page_id >= 0);
-        if (read) {
-            memcpy((char* )dst + dev_page_id*page_size,
-                (char *)temp + host_page_id*page_size,
-                page_size
-                );
-        }
-        else {
-            memcpy((char* )dst + host_page_id*page_size,
-                (char *)temp + dev_page_id*page_size,
-                page_size
-                );
-        }
-    }
-    free(temp);
-}
-
 // Read buffer command is enqueued in the issue region and device writes requested buffer data into the completion region
-void CommandQueue::enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking) {
+// The data is copied out to dst by the completion queue reader thread, the returned future is ready once dst holds the buffer
+std::shared_future<void> CommandQueue::enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking) {
     ZoneScopedN("CommandQueue_read_buffer");
-    TT_FATAL(blocking, "EnqueueReadBuffer only has support for blocking mode currently");
 
-    chip_id_t mmio_device_id = tt::Cluster::instance().get_associated_mmio_device(this->device->id());
-    uint16_t channel = tt::Cluster::instance().get_assigned_channel_for_device(this->device->id());
     uint32_t read_buffer_command_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND;
 
     uint32_t padded_page_size = align(buffer.page_size(), 32);
     uint32_t total_pages_to_read = buffer.num_pages();
-    uint32_t unpadded_dst_offset = 0;
     uint32_t src_page_index = 0;
+    auto promise = std::make_shared<std::promise<void>>();
+    std::shared_future<void> read_done = promise->get_future().share();
     while (total_pages_to_read > 0) {
         if ((this->manager.get_issue_queue_write_ptr(this->id)) + read_buffer_command_size >= this->manager.get_issue_queue_limit(this->id)) {
             this->wrap(DeviceCommand::WrapRegion::ISSUE, blocking);
         }
 
+        // Space is counted from where the data of the last enqueued read lands, earlier reads may still be in flight
         const uint32_t command_completion_limit = this->manager.get_completion_queue_limit(this->id);
-        uint32_t num_pages_available = (command_completion_limit - get_cq_completion_wr_ptr<false>(this->device->id(), this->id, this->size_B)) / padded_page_size;
+        uint32_t num_pages_available = (command_completion_limit - this->manager.get_completion_queue_issue_ptr(this->id)) / padded_page_size;
         uint32_t pages_to_read = std::min(total_pages_to_read, num_pages_available);
         if (pages_to_read == 0) {
             // Wrap the completion region because a single page won't fit in available space
-            // Wrap needs to be blocking because host needs updated write pointer to compute how many pages can be read
-            this->wrap(DeviceCommand::WrapRegion::COMPLETION, true);
-            num_pages_available = (command_completion_limit - get_cq_completion_wr_ptr<false>(this->device->id(), this->id, this->size_B)) / padded_page_size;
+            this->wrap(DeviceCommand::WrapRegion::COMPLETION, false);
+            num_pages_available = (command_completion_limit - this->manager.get_completion_queue_issue_ptr(this->id)) / padded_page_size;
             pages_to_read = std::min(total_pages_to_read, num_pages_available);
         }
 
         tt::log_debug(tt::LogDispatch, "EnqueueReadBuffer for channel {}", this->id);
-        uint32_t command_read_buffer_addr;
         if (is_sharded(buffer.buffer_layout())) {
             auto command = EnqueueReadShardedBufferCommand(this->id, this->device, buffer, dst, this->manager, src_page_index, pages_to_read);
-            this->enqueue_command(command, blocking);
-            command_read_buffer_addr = command.read_buffer_addr;
+            this->enqueue_command(command, false);
         }
         else {
             auto command = EnqueueReadInterleavedBufferCommand(this->id, this->device, buffer, dst, this->manager, src_page_index, pages_to_read);
-            this->enqueue_command(command, blocking);
-            command_read_buffer_addr = command.read_buffer_addr;
-        }
-        this->manager.completion_queue_wait_front(this->id); // wait for device to write data
-
-        uint32_t bytes_read = pages_to_read * padded_page_size;
-        if ((buffer.page_size() % 32) != 0) {
-            // If page size is not 32B-aligned, we cannot do a contiguous copy
-            uint32_t dst_address_offset = unpadded_dst_offset;
-            for (uint32_t sysmem_address_offset = 0; sysmem_address_offset < bytes_read; sysmem_address_offset += padded_page_size) {
-                tt::Cluster::instance().read_sysmem((char*)dst + dst_address_offset, buffer.page_size(), command_read_buffer_addr + sysmem_address_offset, mmio_device_id, channel);
-                dst_address_offset += buffer.page_size();
-            }
-        } else {
-            tt::Cluster::instance().read_sysmem((char*)dst + unpadded_dst_offset, bytes_read, command_read_buffer_addr, mmio_device_id, channel);
+            this->enqueue_command(command, false);
         }
 
-        this->manager.completion_queue_pop_front(bytes_read, this->id);
         total_pages_to_read -= pages_to_read;
+        CompletionQueueRead read{
+            .dst = dst,
+            .sharded_buffer = is_sharded(buffer.buffer_layout()) ? &buffer : nullptr,
+            .page_index = src_page_index,
+            .page_size = buffer.page_size(),
+            .padded_page_size = padded_page_size,
+            .num_pages = pages_to_read,
+            .last_chunk = total_pages_to_read == 0,
+            .promise = promise};
+        this->manager.completion_queue_enqueue_read(std::move(read), this->id);
+
         src_page_index += pages_to_read;
-        unpadded_dst_offset += pages_to_read * buffer.page_size();
     }
 
-    if (buffer.buffer_layout() == TensorMemoryLayout::WIDTH_SHARDED or
-        buffer.buffer_layout() == TensorMemoryLayout::BLOCK_SHARDED) {
-        convert_interleaved_to_sharded_on_host(dst,
-                                        buffer,
-                                        true);
+    // In lazy mode the device only sees commands once the write pointer is sent, the returned future would never
+    // become ready otherwise
+    if (LAZY_COMMAND_QUEUE_MODE) {
+        this->manager.send_issue_queue_write_ptr(this->id);
     }
+    if (blocking) {
+        read_done.get();
+    }
+    return read_done;
 }
 
 void CommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, bool blocking) {
+    this->enqueue_write_buffer(buffer, src, 0, buffer.num_pages(), blocking);
+}
+
+void CommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking) {
     ZoneScopedN("CommandQueue_write_buffer");
 
     // TODO(agrebenisan): Fix these asserts after implementing multi-core CQ
@@ -1153,17 +1142,11 @@ void CommandQueue::enqueue_write_buffer(Buffer& buffer, const void* src, bool bl
         buffer.page_size() < MEM_L1_SIZE - get_data_section_l1_address(false),
         "Buffer pages must fit within the command queue data section");
 
-    if (buffer.buffer_layout() == TensorMemoryLayout::WIDTH_SHARDED or
-        buffer.buffer_layout() == TensorMemoryLayout::BLOCK_SHARDED) {
-        convert_interleaved_to_sharded_on_host(src,
-                                    buffer
-                                    );
-    }
+    TT_ASSERT(dst_page_index + num_pages <= buffer.num_pages());
 
     uint32_t padded_page_size = align(buffer.page_size(), 32);
-    uint32_t total_pages_to_write = buffer.num_pages();
+    uint32_t total_pages_to_write = num_pages;
     const uint32_t command_issue_limit = this->manager.get_issue_queue_limit(this->id);
-    uint32_t dst_page_index = 0;
     while (total_pages_to_write > 0) {
         int32_t num_pages_available = (int32_t(command_issue_limit - this->manager.get_issue_queue_write_ptr(this->id)) - int32_t(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND)) / int32_t(padded_page_size);
         // If not even a single device command fits, we hit this edgecase
@@ -1205,15 +1188,24 @@ void CommandQueue::enqueue_program(Program& program, std::optional<std::referenc
     bool stall = false;
     // No shared cache so far, can come at a later time
     map<uint64_t, unique_ptr<Buffer>>& program_to_buffer = this->program_to_buffer(this->device->id());
+    map<uint64_t, ProgramMap>& program_to_dev_map = this->program_to_dev_map(this->device->id());
     if (not program_to_buffer.count(program_id)) {
         stall = true;
-        ProgramMap program_to_device_map = ConstructProgramMap(this->device, program);
+        ProgramMap program_to_device_map;
+        ConstructProgramMap(this->device, program, program_to_device_map, PROGRAM_MAP_ALL);
 
         vector<uint32_t>& program_pages = program_to_device_map.program_pages;
         uint32_t program_data_size_in_bytes = program_pages.size() * sizeof(uint32_t);
 
-        uint32_t write_buffer_command_size = DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + program_data_size_in_bytes;
-
+        // Without room for the binary, wait for the queue to drain so the binaries of released programs can be freed.
+        // Any other failure to create the buffer is left to the constructor to report
+        if (not this->retired_program_buffers.empty()) {
+            const uint32_t size_per_bank = detail::SizeBytesPerBank(
+                program_data_size_in_bytes, DeviceCommand::PROGRAM_PAGE_SIZE, this->device->num_banks(BufferType::DRAM));
+            if (size_per_bank > this->device->get_memory_allocation_statistics(BufferType::DRAM).largest_free_block_bytes) {
+                this->finish();
+            }
+        }
         program_to_buffer.emplace(
             program_id,
             std::make_unique<Buffer>(
@@ -1221,13 +1213,38 @@ void CommandQueue::enqueue_program(Program& program, std::optional<std::referenc
 
         this->enqueue_write_buffer(*program_to_buffer.at(program_id), program_pages.data(), false);
 
-        map<uint64_t, ProgramMap>& program_to_dev_map = this->program_to_dev_map(device->id());
         program_to_dev_map.emplace(program_id, std::move(program_to_device_map));
+    } else {
+        // Runtime arg and CB config values are sent as host data on every enqueue, only their transfer layout is cached
+        ProgramMap& program_to_device_map = program_to_dev_map.at(program_id);
+        uint8_t stale_sections = 0;
+        if (program_to_device_map.runtime_args_layout_version != program.runtime_args_layout_version()) {
+            stale_sections |= PROGRAM_MAP_RUNTIME_ARGS;
+        }
+        if (program_to_device_map.circular_buffers_version != program.circular_buffers_version()) {
+            stale_sections |= PROGRAM_MAP_CB_CONFIGS;
+        }
+        if (program_to_device_map.binaries_version != program.binaries_version() or
+            program_to_device_map.semaphores_version != program.semaphores_version()) {
+            stale_sections |= PROGRAM_MAP_PROGRAM_PAGES;
+        }
+
+        if (stale_sections) {
+            vector<uint32_t> cached_program_pages;
+            if (stale_sections & PROGRAM_MAP_PROGRAM_PAGES) {
+                cached_program_pages = std::move(program_to_device_map.program_pages);
+            }
+            ConstructProgramMap(this->device, program, program_to_device_map, stale_sections);
+
+            if (stale_sections & PROGRAM_MAP_PROGRAM_PAGES) {
+                stall = this->update_program_buffer(program_id, cached_program_pages, program_to_device_map.program_pages);
+            }
+        }
     }
 
     tt::log_debug(tt::LogDispatch, "EnqueueProgram for channel {}", this->id);
 
-    uint32_t host_data_num_pages = this->program_to_dev_map(this->device->id()).at(program_id).runtime_arg_page_transfers.size() + this->program_to_dev_map(this->device->id()).at(program_id).cb_config_page_transfers.size();
+    uint32_t host_data_num_pages = program_to_dev_map.at(program_id).runtime_arg_page_transfers.size() + program_to_dev_map.at(program_id).cb_config_page_transfers.size();
 
     uint32_t host_data_and_device_command_size =
         DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + (host_data_num_pages * DeviceCommand::PROGRAM_PAGE_SIZE);
@@ -1242,8 +1259,8 @@ void CommandQueue::enqueue_program(Program& program, std::optional<std::referenc
     EnqueueProgramCommand command(
         this->id,
         this->device,
-        *this->program_to_buffer(this->device->id()).at(program_id),
-        this->program_to_dev_map(this->device->id()).at(program_id),
+        *program_to_buffer.at(program_id),
+        program_to_dev_map.at(program_id),
         this->manager,
         program,
         stall,
@@ -1252,6 +1269,46 @@ void CommandQueue::enqueue_program(Program& program, std::optional<std::referenc
     this->enqueue_command(command, blocking);
 }
 
+bool CommandQueue::update_program_buffer(
+    uint64_t program_id, const vector<uint32_t>& cached_program_pages, const vector<uint32_t>& program_pages) {
+    map<uint64_t, unique_ptr<Buffer>>& program_to_buffer = this->program_to_buffer(this->device->id());
+    uint32_t program_data_size_in_bytes = program_pages.size() * sizeof(uint32_t);
+    if (program_pages.size() != cached_program_pages.size()) {
+        // Binaries may still be read by in-flight dispatch, the old buffer is freed once the queue has drained
+        this->retire_program_buffer(std::move(program_to_buffer.at(program_id)));
+        program_to_buffer[program_id] = std::make_unique<Buffer>(
+            this->device, program_data_size_in_bytes, DeviceCommand::PROGRAM_PAGE_SIZE, BufferType::DRAM);
+        this->enqueue_write_buffer(*program_to_buffer.at(program_id), program_pages.data(), false);
+        return true;
+    }
+
+    // Pages that did not change are reused from the cached buffer, only runs of differing pages are written
+    Buffer& program_buffer = *program_to_buffer.at(program_id);
+    constexpr uint32_t words_per_page = DeviceCommand::PROGRAM_PAGE_SIZE / sizeof(uint32_t);
+    auto page_changed = [&](uint32_t page) {
+        return not std::equal(
+            program_pages.begin() + page * words_per_page,
+            program_pages.begin() + (page + 1) * words_per_page,
+            cached_program_pages.begin() + page * words_per_page);
+    };
+    bool written = false;
+    uint32_t num_pages = program_buffer.num_pages();
+    uint32_t page = 0;
+    while (page < num_pages) {
+        if (not page_changed(page)) {
+            page++;
+            continue;
+        }
+        uint32_t first_page = page;
+        while (page < num_pages and page_changed(page)) {
+            page++;
+        }
+        this->enqueue_write_buffer(program_buffer, program_pages.data(), first_page, page - first_page, false);
+        written = true;
+    }
+    return written;
+}
+
 void CommandQueue::wait_finish() {
     chip_id_t mmio_device_id = tt::Cluster::instance().get_associated_mmio_device(this->device->id());
     uint16_t channel = tt::Cluster::instance().get_assigned_channel_for_device(this->device->id());
@@ -1290,6 +1347,9 @@ void CommandQueue::finish() {
     FinishCommand command(this->id, this->device, this->manager);
     this->enqueue_command(command, false);
     this->wait_finish();
+    this->manager.completion_queue_wait_idle(this->id);
+    // Every command enqueued before the finish has completed, nothing reads the retired binaries anymore
+    this->retired_program_buffers.clear();
 }
 
 void CommandQueue::wrap(DeviceCommand::WrapRegion wrap_region, bool blocking) {
@@ -1310,46 +1370,155 @@ void CommandQueue::restart() {
     this->manager.reset(this->id);
 }
 
-Trace::Trace(CommandQueue& command_queue): command_queue(command_queue) {
+Trace::Trace(): command_queue(nullptr) {
     this->trace_complete = false;
     this->num_data_bytes = 0;
+    this->replay_address = 0;
+}
+
+Trace::Trace(CommandQueue& command_queue): Trace() {
+    this->command_queue = &command_queue;
 }
 
 void Trace::record(const TraceNode& trace_node) {
     TT_ASSERT(not this->trace_complete, "Cannot record any more for a completed trace");
-    this->num_data_bytes += trace_node.num_data_bytes;
+    TT_ASSERT(trace_node.data.size() * sizeof(uint32_t) == trace_node.num_data_bytes);
     this->history.push_back(trace_node);
+    this->history.back().stream_offset = (this->history.size() - 1) * DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + this->num_data_bytes;
+    this->num_data_bytes += trace_node.num_data_bytes;
+}
+
+// Host data is laid out as EnqueueProgramCommand::process writes it: runtime args of every kernel and core padded to
+// 16 B, then circular buffer configs starting on a new page
+Trace::TraceNode Trace::create_program_node(const Program& program, const DeviceCommand& command) {
+    constexpr static uint32_t padding_alignment = 16;
+    constexpr static uint32_t words_in_page = DeviceCommand::PROGRAM_PAGE_SIZE / sizeof(uint32_t);
+    TraceNode node = {
+        .command = command,
+        .data = vector<uint32_t>(command.get_data_size() / sizeof(uint32_t), 0),
+        .command_type = EnqueueCommandType::ENQUEUE_PROGRAM,
+        .num_data_bytes = command.get_data_size()};
+
+    uint32_t word_offset = 0;
+    auto write_words = [&node, &word_offset](const uint32_t* src, uint32_t num_words) {
+        TT_ASSERT(word_offset + num_words <= node.data.size(), "Program host data exceeds the data size of its command");
+        std::copy(src, src + num_words, node.data.begin() + word_offset);
+        word_offset += num_words;
+    };
+    for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
+        const Kernel* kernel = detail::GetKernel(program, kernel_id);
+        for (uint32_t slot = 0; slot < kernel->cores_with_runtime_args().size(); slot++) {
+            const CoreCoord& c = kernel->cores_with_runtime_args()[slot];
+            node.runtime_args_locations.push_back(
+                {.kernel_id = KernelHandle(kernel_id), .core = c, .word_offset = word_offset + slot * kernel->runtime_args_stride(), .num_args = uint32_t(kernel->runtime_args(c).size())});
+        }
+        write_words(kernel->runtime_args_arena().data(), kernel->runtime_args_arena().size());
+        const auto& common_runtime_args = kernel->common_runtime_args();
+        write_words(common_runtime_args.data(), common_runtime_args.size());
+        word_offset = align(word_offset, padding_alignment / sizeof(uint32_t));
+    }
+
+    word_offset = align(word_offset, words_in_page);
+    array<uint32_t, 4> cb_data;
+    for (const shared_ptr<CircularBuffer>& cb : program.circular_buffers()) {
+        for (const auto buffer_index : cb->buffer_indices()) {
+            cb_data = {cb->address() >> 4, cb->size() >> 4, cb->num_pages(buffer_index), cb->size() / cb->num_pages(buffer_index) >> 4};
+            write_words(cb_data.data(), cb_data.size());
+        }
+    }
+    return node;
+}
+
+void Trace::record_program(const Program& program, const DeviceCommand& command) {
+    this->record(create_program_node(program, command));
+}
+
+TracePatchPoint Trace::runtime_arg_patch_point(uint32_t command_index, KernelHandle kernel_id, const CoreCoord& core, uint32_t arg_index) const {
+    TT_FATAL(command_index < this->history.size(), "Trace has {} commands, cannot patch command {}", this->history.size(), command_index);
+    for (const auto& location : this->history[command_index].runtime_args_locations) {
+        if (location.kernel_id == kernel_id and location.core == core) {
+            TT_FATAL(arg_index < location.num_args, "Kernel {} on core {} has {} runtime args, cannot patch arg {}", kernel_id, core.str(), location.num_args, arg_index);
+            return {.command_index = command_index, .stream = TracePatchPoint::Stream::DATA, .word_offset = location.word_offset + arg_index};
+        }
+    }
+    TT_THROW("Command {} of the trace has no runtime args for kernel {} on core {}", command_index, kernel_id, core.str());
+}
+
+uint32_t Trace::declare_patch_point(const TracePatchPoint& patch_point) {
+    TT_FATAL(patch_point.command_index < this->history.size(), "Trace has {} commands, cannot patch command {}", this->history.size(), patch_point.command_index);
+    const TraceNode& node = this->history[patch_point.command_index];
+    uint32_t num_words = patch_point.stream == TracePatchPoint::Stream::COMMAND ? DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND : node.data.size();
+    TT_FATAL(patch_point.word_offset < num_words, "Patch point at word {} is outside of command {}", patch_point.word_offset, patch_point.command_index);
+    this->patch_points.push_back(patch_point);
+    return this->patch_points.size() - 1;
+}
+
+uint32_t& Trace::patch_word(const TracePatchPoint& patch_point) {
+    TraceNode& node = this->history[patch_point.command_index];
+    if (patch_point.stream == TracePatchPoint::Stream::COMMAND) {
+        return static_cast<uint32_t*>(node.command.data())[patch_point.word_offset];
+    }
+    return node.data[patch_point.word_offset];
+}
+
+void Trace::set_patch_value(uint32_t patch_point_id, uint32_t value) {
+    TT_FATAL(patch_point_id < this->patch_points.size(), "Patch point {} was not declared", patch_point_id);
+    this->patch_word(this->patch_points[patch_point_id]) = value;
+    if (this->trace_complete) {
+        this->dirty_patch_points.insert(patch_point_id);
+    }
+}
+
+vector<uint32_t> Trace::assemble(uint32_t base_address) const {
+    vector<uint32_t> stream;
+    stream.reserve((this->history.size() * DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + this->num_data_bytes) / sizeof(uint32_t));
+    for (const auto& node : this->history) {
+        DeviceCommand command = node.command;
+        // Host data is the first buffer transfer of a command, without host data the first transfer reads program binaries
+        if (node.num_data_bytes) {
+            command.update_buffer_transfer_src(0, base_address + node.stream_offset + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND);
+        }
+        const uint32_t* command_words = static_cast<const uint32_t*>(command.data());
+        stream.insert(stream.end(), command_words, command_words + DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND);
+        stream.insert(stream.end(), node.data.begin(), node.data.end());
+    }
+    return stream;
 }
 
 void Trace::create_replay() {
     // Reconstruct the hugepage from the command cache
-    SystemMemoryManager& manager = this->command_queue.manager;
-    const uint32_t command_queue_id = this->command_queue.id;
+    SystemMemoryManager& manager = this->command_queue->manager;
+    const uint32_t command_queue_id = this->command_queue->id;
     const bool lazy_push = true;
-    for (auto& [device_command, data, command_type, num_data_bytes]: this->history) {
-        uint32_t issue_write_ptr = manager.get_issue_queue_write_ptr(command_queue_id);
-        device_command.update_buffer_transfer_src(0, issue_write_ptr + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND);
-        manager.cq_write(device_command.data(), DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, issue_write_ptr);
-        manager.issue_queue_push_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, lazy_push, command_queue_id);
-
-        uint32_t host_data_size = align(data.size() * sizeof(uint32_t), 16);
-        manager.cq_write(data.data(), host_data_size, manager.get_issue_queue_write_ptr(command_queue_id));
-        vector<uint32_t> read_back(host_data_size / sizeof(uint32_t), 0);
-        tt::Cluster::instance().read_sysmem(read_back.data(), host_data_size, issue_write_ptr + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, 0, 0);
-        manager.issue_queue_push_back(host_data_size, lazy_push, command_queue_id);
+    this->replay_address = manager.get_issue_queue_write_ptr(command_queue_id);
+    vector<uint32_t> stream = this->assemble(this->replay_address);
+    manager.cq_write(stream.data(), stream.size() * sizeof(uint32_t), this->replay_address);
+    manager.issue_queue_push_back(stream.size() * sizeof(uint32_t), lazy_push, command_queue_id);
+    this->dirty_patch_points.clear();
+}
+
+void Trace::apply_patches() {
+    SystemMemoryManager& manager = this->command_queue->manager;
+    for (uint32_t patch_point_id : this->dirty_patch_points) {
+        const TracePatchPoint& patch_point = this->patch_points[patch_point_id];
+        uint32_t address = this->replay_address + this->history[patch_point.command_index].stream_offset + patch_point.word_offset * sizeof(uint32_t);
+        if (patch_point.stream == TracePatchPoint::Stream::DATA) {
+            address += DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND;
+        }
+        manager.cq_write(&this->patch_word(patch_point), sizeof(uint32_t), address);
     }
+    this->dirty_patch_points.clear();
 }
 
-void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking) {
+std::shared_future<void> EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking) {
     // TODO(agrebenisan): Move to deprecated
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    TT_FATAL(blocking, "Non-blocking EnqueueReadBuffer not yet supported");
 
     // Only resizing here to keep with the original implementation. Notice how in the void*
     // version of this API, I assume the user mallocs themselves
     dst.resize(buffer.page_size() * buffer.num_pages() / sizeof(uint32_t));
-    cq.enqueue_read_buffer(buffer, dst.data(), blocking);
+    return cq.enqueue_read_buffer(buffer, dst.data(), blocking);
 }
 
 void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src, bool blocking) {
@@ -1359,10 +1528,10 @@ void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src,
     cq.enqueue_write_buffer(buffer, src.data(), blocking);
 }
 
-void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking) {
+std::shared_future<void> EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking) {
     ZoneScoped;
     tt_metal::detail::DispatchStateCheck(true);
-    cq.enqueue_read_buffer(buffer, dst, blocking);
+    return cq.enqueue_read_buffer(buffer, dst, blocking);
 }
 
 void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, const void* src, bool blocking) {
@@ -1396,6 +1565,19 @@ void ClearProgramCache(CommandQueue& cq) {
     cq.program_to_dev_map(cq.device->id()).clear();
 }
 
+void ReleaseProgram(CommandQueue& cq, uint64_t program_id) {
+    detail::DispatchStateCheck(true);
+    map<uint64_t, unique_ptr<Buffer>>& program_to_buffer = cq.program_to_buffer(cq.device->id());
+    if (not program_to_buffer.count(program_id)) {
+        return;
+    }
+    // Binaries may still be read by in-flight dispatch, the queue frees them at its next finish instead of stalling
+    // the caller here
+    cq.retire_program_buffer(std::move(program_to_buffer.at(program_id)));
+    program_to_buffer.erase(program_id);
+    cq.program_to_dev_map(cq.device->id()).erase(program_id);
+}
+
 Trace BeginTrace(CommandQueue& command_queue) {
     // Resets the command queue state
     command_queue.restart();
@@ -1405,21 +1587,26 @@ Trace BeginTrace(CommandQueue& command_queue) {
 
 void EndTrace(Trace& trace) {
     TT_ASSERT(not trace.trace_complete, "Already completed this trace");
-    SystemMemoryManager& manager = trace.command_queue.manager;
-    const uint32_t command_queue_id = trace.command_queue.id;
+    TT_FATAL(trace.command_queue != nullptr, "Host only traces cannot be replayed");
+    SystemMemoryManager& manager = trace.command_queue->manager;
+    const uint32_t command_queue_id = trace.command_queue->id;
     TT_FATAL(trace.num_data_bytes + trace.history.size() * DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND <= manager.get_issue_queue_limit(command_queue_id), "Trace does not fit in issue queue");
     trace.trace_complete = true;
     manager.set_issue_queue_size(command_queue_id, trace.num_data_bytes + DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND * trace.history.size());
-    trace.command_queue.restart();
+    trace.command_queue->restart();
     trace.create_replay();
-    manager.reset(trace.command_queue.id);
+    manager.reset(command_queue_id);
 }
 
 void EnqueueTrace(Trace& trace, bool blocking) {
+    TT_FATAL(trace.trace_complete, "Trace must be completed with EndTrace before it is enqueued");
     // Run the trace
-    CommandQueue& command_queue = trace.command_queue;
+    CommandQueue& command_queue = *trace.command_queue;
     uint32_t trace_size = trace.history.size() * DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND + trace.num_data_bytes;
     command_queue.manager.issue_queue_reserve_back(trace_size, command_queue.id);
+    // The issue queue holds exactly one trace, so once there is room for it the device has fetched the previous replay
+    // and patches cannot race with it
+    trace.apply_patches();
     command_queue.manager.issue_queue_push_back(trace_size, false, command_queue.id);
 
     // This will block because the wr toggles will be different between the host and the device
@@ -1428,6 +1615,116 @@ void EnqueueTrace(Trace& trace, bool blocking) {
     }
 }
 
+namespace {
+
+constexpr uint32_t TRACE_FILE_VERSION = 1;
+
+template <typename T>
+void write_trace_value(std::ofstream& output_stream, const T& value) {
+    output_stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_trace_value(std::ifstream& input_stream) {
+    T value;
+    input_stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    TT_FATAL(input_stream, "Trace file is truncated");
+    return value;
+}
+
+// Device commands are mostly unused entries and host data is padded to pages, only the words up to the last non zero
+// one are stored
+void write_trace_words(std::ofstream& output_stream, const uint32_t* words, uint32_t num_words) {
+    while (num_words > 0 and words[num_words - 1] == 0) {
+        num_words--;
+    }
+    write_trace_value(output_stream, num_words);
+    output_stream.write(reinterpret_cast<const char*>(words), num_words * sizeof(uint32_t));
+}
+
+void read_trace_words(std::ifstream& input_stream, uint32_t* words, uint32_t max_num_words) {
+    uint32_t num_words = read_trace_value<uint32_t>(input_stream);
+    TT_FATAL(num_words <= max_num_words, "Trace file is corrupted");
+    input_stream.read(reinterpret_cast<char*>(words), num_words * sizeof(uint32_t));
+    TT_FATAL(input_stream, "Trace file is truncated");
+}
+
+}  // namespace
+
+void DumpTrace(const Trace& trace, const std::string& file_name) {
+    std::ofstream output_stream(file_name, std::ios::out | std::ios::binary);
+    TT_FATAL(output_stream, "Cannot open \"{}\"", file_name);
+
+    write_trace_value(output_stream, TRACE_FILE_VERSION);
+    write_trace_value(output_stream, uint32_t(trace.history.size()));
+    for (const auto& node : trace.history) {
+        write_trace_value(output_stream, node.command_type);
+        write_trace_value(output_stream, node.num_data_bytes);
+        write_trace_words(output_stream, static_cast<const uint32_t*>(node.command.data()), DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND);
+        write_trace_words(output_stream, node.data.data(), node.data.size());
+        write_trace_value(output_stream, uint32_t(node.runtime_args_locations.size()));
+        for (const auto& location : node.runtime_args_locations) {
+            write_trace_value(output_stream, location.kernel_id);
+            write_trace_value(output_stream, uint32_t(location.core.x));
+            write_trace_value(output_stream, uint32_t(location.core.y));
+            write_trace_value(output_stream, location.word_offset);
+            write_trace_value(output_stream, location.num_args);
+        }
+    }
+    write_trace_value(output_stream, uint32_t(trace.patch_points.size()));
+    for (const auto& patch_point : trace.patch_points) {
+        write_trace_value(output_stream, patch_point.command_index);
+        write_trace_value(output_stream, patch_point.stream);
+        write_trace_value(output_stream, patch_point.word_offset);
+    }
+    TT_FATAL(output_stream, "Failed to write \"{}\"", file_name);
+}
+
+Trace LoadTrace(const std::string& file_name) {
+    std::ifstream input_stream(file_name, std::ios::in | std::ios::binary);
+    TT_FATAL(input_stream, "Cannot open \"{}\"", file_name);
+
+    uint32_t version = read_trace_value<uint32_t>(input_stream);
+    TT_FATAL(version == TRACE_FILE_VERSION, "Unsupported trace file version {} in \"{}\"", version, file_name);
+    Trace trace;
+    uint32_t num_commands = read_trace_value<uint32_t>(input_stream);
+    for (uint32_t command_index = 0; command_index < num_commands; command_index++) {
+        Trace::TraceNode node;
+        node.command_type = read_trace_value<EnqueueCommandType>(input_stream);
+        node.num_data_bytes = read_trace_value<uint32_t>(input_stream);
+        TT_FATAL(node.num_data_bytes % DeviceCommand::PROGRAM_PAGE_SIZE == 0, "Trace file \"{}\" is corrupted", file_name);
+        read_trace_words(input_stream, static_cast<uint32_t*>(node.command.data()), DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND);
+        node.data.resize(node.num_data_bytes / sizeof(uint32_t), 0);
+        read_trace_words(input_stream, node.data.data(), node.data.size());
+        uint32_t num_runtime_args_locations = read_trace_value<uint32_t>(input_stream);
+        for (uint32_t i = 0; i < num_runtime_args_locations; i++) {
+            Trace::RuntimeArgsLocation location;
+            location.kernel_id = read_trace_value<KernelHandle>(input_stream);
+            location.core.x = read_trace_value<uint32_t>(input_stream);
+            location.core.y = read_trace_value<uint32_t>(input_stream);
+            location.word_offset = read_trace_value<uint32_t>(input_stream);
+            location.num_args = read_trace_value<uint32_t>(input_stream);
+            node.runtime_args_locations.push_back(location);
+        }
+        trace.record(node);
+    }
+    uint32_t num_patch_points = read_trace_value<uint32_t>(input_stream);
+    for (uint32_t i = 0; i < num_patch_points; i++) {
+        TracePatchPoint patch_point;
+        patch_point.command_index = read_trace_value<uint32_t>(input_stream);
+        patch_point.stream = read_trace_value<TracePatchPoint::Stream>(input_stream);
+        patch_point.word_offset = read_trace_value<uint32_t>(input_stream);
+        trace.declare_patch_point(patch_point);
+    }
+    return trace;
+}
+
+Trace LoadTrace(CommandQueue& command_queue, const std::string& file_name) {
+    Trace trace = LoadTrace(file_name);
+    trace.command_queue = &command_queue;
+    return trace;
+}
+
 namespace detail {
 
 void EnqueueRestart(CommandQueue& cq) {
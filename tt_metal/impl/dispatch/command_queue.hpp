@@ -10,6 +10,7 @@
 #include <thread>
 #include <utility>
 #include <fstream>
+#include <unordered_set>
 
 #include "tt_metal/impl/dispatch/command_queue_interface.hpp"
 #include "jit_build/build.hpp"
@@ -38,8 +39,21 @@ struct transfer_info {
 
 enum class PageTransferType { MULTICAST, UNICAST };
 
+// Sections of a ProgramMap that are built independently of each other
+enum ProgramMapSection : uint8_t {
+    PROGRAM_MAP_RUNTIME_ARGS = 1 << 0,
+    PROGRAM_MAP_CB_CONFIGS = 1 << 1,
+    PROGRAM_MAP_PROGRAM_PAGES = 1 << 2,  // Binaries, semaphores and go signals
+    PROGRAM_MAP_ALL = PROGRAM_MAP_RUNTIME_ARGS | PROGRAM_MAP_CB_CONFIGS | PROGRAM_MAP_PROGRAM_PAGES,
+};
+
 struct ProgramMap {
     uint32_t num_workers;
+    // Program section versions each part of the map was built from
+    uint32_t binaries_version;
+    uint32_t semaphores_version;
+    uint32_t circular_buffers_version;
+    uint32_t runtime_args_layout_version;
     vector<uint32_t> program_pages;
     std::unordered_map<PageTransferType, vector<transfer_info>> program_page_transfers;
     std::unordered_map<PageTransferType, vector<transfer_info>> runtime_arg_page_transfers;
@@ -96,14 +110,14 @@ class EnqueueRestartCommand : public Command {
 
 class EnqueueReadBufferCommand : public Command {
    private:
-    SystemMemoryManager& manager;
     void* dst;
     uint32_t pages_to_read;
-    uint32_t command_queue_id;
 
 
     virtual const DeviceCommand create_buffer_transfer_instruction(uint32_t dst_address, uint32_t padded_page_size, uint32_t num_pages) = 0;
    protected:
+    SystemMemoryManager& manager;
+    uint32_t command_queue_id;
     Device* device;
     uint32_t src_page_index;
    public:
@@ -175,13 +189,15 @@ class EnqueueWriteInterleavedBufferCommand;
 class EnqueueWriteBufferCommand : public Command {
    private:
 
-    SystemMemoryManager& manager;
     const void* src;
     uint32_t pages_to_write;
-    uint32_t command_queue_id;
 
     virtual const DeviceCommand create_buffer_transfer_instruction(uint32_t dst_address, uint32_t padded_page_size, uint32_t num_pages) = 0;
+    // Copies num_pages consecutive host pages at src into the issue queue, padding each page to 32B if needed
+    void write_pages(const char* src, uint32_t num_pages, uint32_t sysmem_address);
    protected:
+    SystemMemoryManager& manager;
+    uint32_t command_queue_id;
     Device* device;
     Buffer& buffer;
     uint32_t dst_page_index;
@@ -312,29 +328,70 @@ namespace detail{
 }
 
 
+// A word of a recorded trace that can be rebound before replay without re-tracing, either in a device command or in
+// the host data (runtime args, circular buffer configs) that follows it in the issue queue
+struct TracePatchPoint {
+    enum class Stream : uint8_t { COMMAND, DATA };
+
+    uint32_t command_index;
+    Stream stream;
+    uint32_t word_offset;
+};
+
 class Trace {
 
     private:
+      struct RuntimeArgsLocation {
+          KernelHandle kernel_id;
+          CoreCoord core;
+          uint32_t word_offset;
+          uint32_t num_args;
+      };
       struct TraceNode {
           DeviceCommand command;
-          const vector<uint32_t> data;
+          vector<uint32_t> data;
           EnqueueCommandType command_type;
           uint32_t num_data_bytes;
+          // Byte offset of the command from the start of the trace
+          uint32_t stream_offset;
+          vector<RuntimeArgsLocation> runtime_args_locations;
       };
       bool trace_complete;
-      CommandQueue& command_queue;
+      CommandQueue* command_queue;
       vector<TraceNode> history;
       uint32_t num_data_bytes;
+      vector<TracePatchPoint> patch_points;
+      // Patch points set since the replay was written to the issue queue, EnqueueTrace writes them before launching
+      std::unordered_set<uint32_t> dirty_patch_points;
+      uint32_t replay_address;
       void create_replay();
+      void apply_patches();
+      uint32_t& patch_word(const TracePatchPoint& patch_point);
+      static TraceNode create_program_node(const Program& program, const DeviceCommand& command);
 
     friend class EnqueueProgramCommand;
     friend Trace BeginTrace(CommandQueue& cq);
     friend void EndTrace(Trace& trace);
     friend void EnqueueTrace(Trace& trace, bool blocking);
+    friend void DumpTrace(const Trace& trace, const std::string& file_name);
+    friend Trace LoadTrace(const std::string& file_name);
+    friend Trace LoadTrace(CommandQueue& command_queue, const std::string& file_name);
 
     public:
+      // Host only trace, commands can be recorded, patched and serialized but not replayed
+      Trace();
       Trace(CommandQueue& command_queue);
       void record(const TraceNode& trace_node);
+      void record_program(const Program& program, const DeviceCommand& command);
+
+      uint32_t num_commands() const { return this->history.size(); }
+      // Location of a runtime arg of kernel_id on core in the command_index-th recorded command
+      TracePatchPoint runtime_arg_patch_point(uint32_t command_index, KernelHandle kernel_id, const CoreCoord& core, uint32_t arg_index) const;
+      // Returns the id to pass to set_patch_value
+      uint32_t declare_patch_point(const TracePatchPoint& patch_point);
+      void set_patch_value(uint32_t patch_point_id, uint32_t value);
+      // Trace as it is laid out in the issue queue when replayed from base_address
+      vector<uint32_t> assemble(uint32_t base_address) const;
 };
 
 namespace detail {
@@ -379,14 +436,26 @@ class CommandQueue {
         return chip_to_program_to_dev_map[chip_id];
     };
 
+    // Binaries of released programs that commands already in the queue may still read, freed by the next finish
+    vector<unique_ptr<Buffer>> retired_program_buffers;
+
+    void retire_program_buffer(unique_ptr<Buffer> buffer);
+
     void enqueue_command(Command& command, bool blocking);
 
-    void enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking);
+    std::shared_future<void> enqueue_read_buffer(Buffer& buffer, void* dst, bool blocking);
 
     void enqueue_write_buffer(Buffer& buffer, const void* src, bool blocking);
 
+    // Writes num_pages pages starting at dst_page_index, src points at the data of the whole buffer
+    void enqueue_write_buffer(Buffer& buffer, const void* src, uint32_t dst_page_index, uint32_t num_pages, bool blocking);
+
     void enqueue_program(Program& program, std::optional<std::reference_wrapper<Trace>> trace, bool blocking);
 
+    // Brings the cached binary buffer of a program in line with its rebuilt pages, returns true if any pages were written
+    bool update_program_buffer(
+        uint64_t program_id, const vector<uint32_t>& cached_program_pages, const vector<uint32_t>& program_pages);
+
     void wait_finish();
 
     void finish();
@@ -397,14 +466,15 @@ class CommandQueue {
 
     void launch(launch_msg_t& msg);
 
-    friend void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking);
+    friend std::shared_future<void> EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& dst, bool blocking);
     friend void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, vector<uint32_t>& src, bool blocking);
-    friend void EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking);
+    friend std::shared_future<void> EnqueueReadBuffer(CommandQueue& cq, Buffer& buffer, void* dst, bool blocking);
     friend void EnqueueWriteBuffer(CommandQueue& cq, Buffer& buffer, const void* src, bool blocking);
     friend void EnqueueProgram(CommandQueue& cq, Program& program, bool blocking, std::optional<std::reference_wrapper<Trace>> trace);
     friend void Finish(CommandQueue& cq);
     friend void detail::EnqueueRestart(CommandQueue& cq);
     friend void ClearProgramCache(CommandQueue& cq);
+    friend void ReleaseProgram(CommandQueue& cq, uint64_t program_id);
     friend CommandQueue &detail::GetCommandQueue(Device *device);
 
     // Trace APIs
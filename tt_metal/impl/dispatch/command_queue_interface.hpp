@@ -3,7 +3,15 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+
 #include "tt_metal/common/base.hpp"
+#include "tt_metal/impl/buffers/buffer.hpp"
 #include "tt_metal/impl/dispatch/device_command.hpp"
 #include "tt_metal/impl/dispatch/dispatch_core_manager.hpp"
 #include "tt_metal/llrt/llrt.hpp"
@@ -99,10 +107,14 @@ struct SystemMemoryCQInterface {
         this->issue_fifo_wr_ptr = (CQ_START + this->offset) >> 4;  // In 16B words
         this->issue_fifo_wr_toggle = 0;
 
-        this->completion_fifo_rd_ptr = this->issue_fifo_limit;
+        this->completion_fifo_rd_ptr = this->completion_fifo_start();
         this->completion_fifo_rd_toggle = 0;
+        this->completion_fifo_issue_ptr = this->completion_fifo_start();
     }
 
+    // Head of the completion region, fixed even when the issue queue is resized for a trace
+    uint32_t completion_fifo_start() const { return (CQ_START + this->offset + this->command_issue_region_size) >> 4; }
+
     // Percentage of the command queue that is dedicated for issuing commands. Issue queue size is rounded to be 32B aligned and remaining space is dedicated for completion queue
     // Smaller issue queues can lead to more stalls for applications that send more work to device than readback data.
     static constexpr float default_issue_queue_split = 0.75;
@@ -119,6 +131,37 @@ struct SystemMemoryCQInterface {
     uint32_t completion_fifo_limit;  // Last possible FIFO address
     uint32_t completion_fifo_rd_ptr;
     bool completion_fifo_rd_toggle;
+    // Where the data of the next enqueued read lands. Reads complete asynchronously, so this runs ahead of
+    // completion_fifo_rd_ptr by the reads in flight and mirrors how the device advances its write pointer
+    uint32_t completion_fifo_issue_ptr;
+};
+
+// Pages of one EnqueueReadBuffer chunk the device writes into the completion region
+struct CompletionQueueRead {
+    // Host copy of the whole buffer, page i of the buffer lands at dst + i * page_size
+    void* dst;
+    // Set for sharded buffers, the chunk then holds device pages which are scattered to their host pages
+    const Buffer* sharded_buffer;
+    uint32_t page_index;
+    uint32_t page_size;
+    uint32_t padded_page_size;
+    uint32_t num_pages;
+    bool last_chunk;
+    // Shared by the chunks of a read, set once the last chunk is copied out or when a chunk fails
+    std::shared_ptr<std::promise<void>> promise;
+};
+
+// Host thread draining the completion region of one command queue, reads are copied out in the order they were
+// enqueued while the issuing thread keeps enqueuing commands
+struct CompletionQueueReader {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable event_pushed;
+    std::condition_variable idle;
+    // nullopt marks a wrap of the completion region
+    std::deque<std::optional<CompletionQueueRead>> events;
+    uint32_t num_pending_events = 0;
+    bool stop = false;
 };
 
 class SystemMemoryManager {
@@ -132,6 +175,105 @@ class SystemMemoryManager {
     vector<SystemMemoryCQInterface> cq_interfaces;
     uint32_t cq_size;
     uint32_t channel_offset;
+    vector<std::unique_ptr<CompletionQueueReader>> completion_queue_readers;
+
+    static void copy_completion_pages(char* dst, const char* src, uint32_t num_pages, const CompletionQueueRead& read) {
+        if (read.page_size == read.padded_page_size) {
+            memcpy(dst, src, num_pages * read.page_size);
+        } else {
+            // If page size is not 32B-aligned, we cannot do a contiguous copy
+            for (uint32_t page = 0; page < num_pages; page++) {
+                memcpy(dst + page * read.page_size, src + page * read.padded_page_size, read.page_size);
+            }
+        }
+    }
+
+    void completion_queue_reader_loop(const uint8_t cq_id) {
+        CompletionQueueReader& reader = *this->completion_queue_readers[cq_id];
+        while (true) {
+            std::optional<CompletionQueueRead> event;
+            {
+                std::unique_lock<std::mutex> lock(reader.mutex);
+                reader.event_pushed.wait(lock, [&reader] { return reader.stop or not reader.events.empty(); });
+                if (reader.events.empty()) {
+                    return;
+                }
+                event = std::move(reader.events.front());
+                reader.events.pop_front();
+            }
+
+            if (not event.has_value()) {
+                this->wrap_completion_queue_rd_ptr(cq_id);
+            } else {
+                const CompletionQueueRead& read = event.value();
+                bool data_landed = false;
+                bool copied = false;
+                try {
+                    this->completion_queue_wait_front(cq_id);  // wait for device to write data
+                    data_landed = true;
+                    const char* src = (const char*)this->get_host_ptr(this->get_completion_queue_read_ptr(cq_id));
+                    if (read.sharded_buffer == nullptr) {
+                        copy_completion_pages((char*)read.dst + read.page_index * read.page_size, src, read.num_pages, read);
+                    } else {
+                        // Scatter each run of device pages straight to where its host pages live
+                        const std::vector<BufferPageRun>& runs = read.sharded_buffer->dev_page_runs();
+                        uint32_t run_index = read.sharded_buffer->dev_page_run_index(read.page_index);
+                        uint32_t dev_page_id = read.page_index;
+                        uint32_t num_pages_left = read.num_pages;
+                        while (num_pages_left > 0) {
+                            const BufferPageRun& run = runs[run_index++];
+                            uint32_t run_offset = dev_page_id - run.dev_page_start;
+                            uint32_t num_pages = std::min(run.num_pages - run_offset, num_pages_left);
+                            copy_completion_pages(
+                                (char*)read.dst + (run.host_page_start + run_offset) * read.page_size, src, num_pages, read);
+                            src += num_pages * read.padded_page_size;
+                            dev_page_id += num_pages;
+                            num_pages_left -= num_pages;
+                        }
+                    }
+                    copied = true;
+                } catch (...) {
+                    try {
+                        read.promise->set_exception(std::current_exception());
+                    } catch (const std::future_error&) {
+                        // An earlier chunk of this read already failed
+                    }
+                }
+                // The chunk is in the completion region whether or not copying it out succeeded, popping it keeps
+                // the reads that follow in step with the device
+                if (data_landed) {
+                    this->completion_queue_pop_front(read.num_pages * read.padded_page_size, cq_id);
+                }
+                if (copied and read.last_chunk) {
+                    try {
+                        read.promise->set_value();
+                    } catch (const std::future_error&) {
+                        // An earlier chunk of this read already failed
+                    }
+                }
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(reader.mutex);
+                reader.num_pending_events--;
+            }
+            reader.idle.notify_all();
+        }
+    }
+
+    void push_completion_queue_event(const uint8_t cq_id, std::optional<CompletionQueueRead> event) {
+        std::unique_ptr<CompletionQueueReader>& reader = this->completion_queue_readers[cq_id];
+        if (reader == nullptr) {
+            reader = std::make_unique<CompletionQueueReader>();
+            reader->thread = std::thread(&SystemMemoryManager::completion_queue_reader_loop, this, cq_id);
+        }
+        {
+            std::unique_lock<std::mutex> lock(reader->mutex);
+            reader->events.push_back(std::move(event));
+            reader->num_pending_events++;
+        }
+        reader->event_pushed.notify_one();
+    }
 
    public:
     SystemMemoryManager(chip_id_t device_id, uint8_t num_hw_cqs) :
@@ -142,6 +284,7 @@ class SystemMemoryManager {
 
         this->issue_byte_addrs.resize(num_hw_cqs);
         this->completion_byte_addrs.resize(num_hw_cqs);
+        this->completion_queue_readers.resize(num_hw_cqs);
 
         // Split hugepage into however many pieces as there are CQs
         chip_id_t mmio_device_id = tt::Cluster::instance().get_associated_mmio_device(device_id);
@@ -166,12 +309,28 @@ class SystemMemoryManager {
         }
     }
 
+    ~SystemMemoryManager() {
+        for (auto& reader : this->completion_queue_readers) {
+            if (reader == nullptr) {
+                continue;
+            }
+            {
+                std::unique_lock<std::mutex> lock(reader->mutex);
+                reader->stop = true;
+            }
+            reader->event_pushed.notify_one();
+            reader->thread.join();
+        }
+    }
+
     void reset(const uint8_t cq_id) {
+        this->completion_queue_wait_idle(cq_id);
         SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
         cq_interface.issue_fifo_wr_ptr = (CQ_START + cq_interface.offset) >> 4;  // In 16B words
         cq_interface.issue_fifo_wr_toggle = 0;
-        cq_interface.completion_fifo_rd_ptr = cq_interface.issue_fifo_limit;
+        cq_interface.completion_fifo_rd_ptr = cq_interface.completion_fifo_start();
         cq_interface.completion_fifo_rd_toggle = 0;
+        cq_interface.completion_fifo_issue_ptr = cq_interface.completion_fifo_start();
     }
 
     void set_issue_queue_size(const uint8_t cq_id, const uint32_t issue_queue_size) {
@@ -204,6 +363,42 @@ class SystemMemoryManager {
         return this->cq_interfaces[cq_id].completion_fifo_rd_ptr << 4;
     }
 
+    uint32_t get_completion_queue_issue_ptr(const uint8_t cq_id) const {
+        return this->cq_interfaces[cq_id].completion_fifo_issue_ptr << 4;
+    }
+
+    // Accounts for the data of a read command being enqueued, the device wraps its write pointer the same way
+    void completion_queue_issue_read(uint32_t data_size_B, const uint8_t cq_id) {
+        SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
+        cq_interface.completion_fifo_issue_ptr += align(data_size_B, 32) >> 4;
+        if (cq_interface.completion_fifo_issue_ptr >= cq_interface.completion_fifo_limit) {
+            cq_interface.completion_fifo_issue_ptr = cq_interface.completion_fifo_start();
+        }
+    }
+
+    // Hands a chunk of an enqueued read to the reader thread of the command queue
+    void completion_queue_enqueue_read(CompletionQueueRead read, const uint8_t cq_id) {
+        this->push_completion_queue_event(cq_id, std::move(read));
+    }
+
+    // Called when a completion wrap command is enqueued. The device writes the data of later reads at the head of the
+    // completion region, the reader thread follows once it has drained the reads enqueued before the wrap
+    void completion_queue_enqueue_wrap(const uint8_t cq_id) {
+        SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
+        cq_interface.completion_fifo_issue_ptr = cq_interface.completion_fifo_start();
+        this->push_completion_queue_event(cq_id, std::nullopt);
+    }
+
+    // Blocks until every read enqueued so far has been copied out
+    void completion_queue_wait_idle(const uint8_t cq_id) {
+        std::unique_ptr<CompletionQueueReader>& reader = this->completion_queue_readers[cq_id];
+        if (reader == nullptr) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(reader->mutex);
+        reader->idle.wait(lock, [&reader] { return reader->num_pending_events == 0; });
+    }
+
     void issue_queue_reserve_back(uint32_t cmd_size_B, const uint8_t cq_id) const {
         uint32_t cmd_size_16B = align(cmd_size_B, 32) >> 4;
 
@@ -225,7 +420,7 @@ class SystemMemoryManager {
             (rd_toggle != cq_interface.issue_fifo_wr_toggle and cq_interface.issue_fifo_wr_ptr == rd_ptr));
     }
 
-    void cq_write(const void* data, uint32_t size_in_bytes, uint32_t write_ptr) const {
+    void* get_host_ptr(uint32_t write_ptr) const {
         // Currently read / write pointers on host and device assumes contiguous ranges for each channel
         // Device needs absolute offset of a hugepage to access the region of sysmem that holds a particular command queue
         //  but on host, we access a region of sysmem using addresses relative to a particular channel
@@ -233,9 +428,18 @@ class SystemMemoryManager {
         //  since all rd/wr pointers include channel offset from address 0 to match device side pointers
         //  so channel offset needs to be subtracted to get address relative to channel
         // TODO: Reconsider offset sysmem offset calculations based on https://github.com/tenstorrent-metal/tt-metal/issues/4757
-        void* user_scratchspace = this->cq_sysmem_start + (write_ptr - this->channel_offset);
+        return this->cq_sysmem_start + (write_ptr - this->channel_offset);
+    }
+
+    void cq_write(const void* data, uint32_t size_in_bytes, uint32_t write_ptr) const {
+        memcpy(this->get_host_ptr(write_ptr), data, size_in_bytes);
+    }
 
-        memcpy(user_scratchspace, data, size_in_bytes);
+    // Waits for room for a device command at the issue queue write pointer and returns the host address of its slot,
+    // commands are assembled there in place
+    void* issue_queue_reserve_command_slot(const uint8_t cq_id) const {
+        this->issue_queue_reserve_back(DeviceCommand::NUM_BYTES_IN_DEVICE_COMMAND, cq_id);
+        return this->get_host_ptr(this->get_issue_queue_write_ptr(cq_id));
     }
 
     void send_issue_queue_write_ptr(const uint8_t cq_id) const {
@@ -298,7 +502,7 @@ class SystemMemoryManager {
 
     void wrap_completion_queue_rd_ptr(const uint8_t cq_id) {
         SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
-        cq_interface.completion_fifo_rd_ptr = cq_interface.issue_fifo_limit;
+        cq_interface.completion_fifo_rd_ptr = cq_interface.completion_fifo_start();
         cq_interface.completion_fifo_rd_toggle = not cq_interface.completion_fifo_rd_toggle;
     }
 
@@ -308,7 +512,7 @@ class SystemMemoryManager {
         SystemMemoryCQInterface& cq_interface = this->cq_interfaces[cq_id];
         cq_interface.completion_fifo_rd_ptr += data_read_16B;
         if (cq_interface.completion_fifo_rd_ptr >= cq_interface.completion_fifo_limit) {
-            cq_interface.completion_fifo_rd_ptr = cq_interface.command_issue_region_size >> 4;
+            cq_interface.completion_fifo_rd_ptr = cq_interface.completion_fifo_start();
             cq_interface.completion_fifo_rd_toggle = not cq_interface.completion_fifo_rd_toggle;
         }
 
@@ -6,84 +6,125 @@
 
 #include "tt_metal/common/logger.hpp"
 #include "tt_metal/common/assert.hpp"
+#include <algorithm>
 #include <atomic>
 
-DeviceCommand::DeviceCommand() {
+DeviceCommand::DeviceCommand() : owned_packet(std::make_unique<packet_>()) {
+    this->packet = this->owned_packet.get();
     this->buffer_transfer_idx = 0;
-    this->program_transfer_idx = this->buffer_transfer_idx + DeviceCommand::NUM_POSSIBLE_BUFFER_TRANSFERS *
-                                                                      DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION;
+    this->program_transfer_idx = DeviceCommand::PROGRAM_TRANSFER_START_IDX;
+    this->num_entries_in_buffer_transfer.fill(0);
 }
 
-void DeviceCommand::set_restart() { this->packet.header.restart = 1; }
+DeviceCommand::DeviceCommand(void* command_slot) : packet(static_cast<packet_*>(command_slot)) {
+    this->packet->header = CommandHeader{};
+    this->buffer_transfer_idx = 0;
+    this->program_transfer_idx = DeviceCommand::PROGRAM_TRANSFER_START_IDX;
+    this->num_entries_in_buffer_transfer.fill(0);
+}
+
+DeviceCommand::DeviceCommand(const DeviceCommand& other) :
+    buffer_transfer_idx(other.buffer_transfer_idx),
+    program_transfer_idx(other.program_transfer_idx),
+    num_entries_in_buffer_transfer(other.num_entries_in_buffer_transfer),
+    owned_packet(other.owned_packet ? std::make_unique<packet_>(*other.packet) : std::make_unique<packet_>()) {
+    this->packet = this->owned_packet.get();
+    if (other.owned_packet) {
+        return;
+    }
 
-void DeviceCommand::set_issue_queue_size(uint32_t new_issue_queue_size) { this->packet.header.new_issue_queue_size = new_issue_queue_size; }
+    // An in place command shares its slot with stale data, only the entries that were set are copied
+    this->packet->header = other.packet->header;
+    for (uint32_t i = 0; i < DeviceCommand::NUM_POSSIBLE_BUFFER_TRANSFERS; i++) {
+        auto src = other.packet->data.begin() + i * DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION;
+        std::copy(
+            src,
+            src + this->num_entries_in_buffer_transfer[i],
+            this->packet->data.begin() + i * DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION);
+    }
+    std::copy(
+        other.packet->data.begin() + DeviceCommand::PROGRAM_TRANSFER_START_IDX,
+        other.packet->data.begin() + this->program_transfer_idx,
+        this->packet->data.begin() + DeviceCommand::PROGRAM_TRANSFER_START_IDX);
+}
 
-void DeviceCommand::set_completion_queue_size(uint32_t new_completion_queue_size) { this->packet.header.new_completion_queue_size = new_completion_queue_size; }
+DeviceCommand& DeviceCommand::operator=(const DeviceCommand& other) {
+    if (this != &other) {
+        *this = DeviceCommand(other);
+    }
+    return *this;
+}
 
-void DeviceCommand::set_wrap(WrapRegion wrap_region) { this->packet.header.wrap = (uint32_t)wrap_region; }
+void DeviceCommand::set_restart() { this->packet->header.restart = 1; }
 
-void DeviceCommand::set_finish() { this->packet.header.finish = 1; }
+void DeviceCommand::set_issue_queue_size(uint32_t new_issue_queue_size) { this->packet->header.new_issue_queue_size = new_issue_queue_size; }
 
-void DeviceCommand::set_num_workers(const uint32_t num_workers) { this->packet.header.num_workers = num_workers; }
+void DeviceCommand::set_completion_queue_size(uint32_t new_completion_queue_size) { this->packet->header.new_completion_queue_size = new_completion_queue_size; }
 
-void DeviceCommand::set_is_program() { this->packet.header.is_program_buffer = 1; }
+void DeviceCommand::set_wrap(WrapRegion wrap_region) { this->packet->header.wrap = (uint32_t)wrap_region; }
 
-void DeviceCommand::set_stall() { this->packet.header.stall = 1; }
+void DeviceCommand::set_finish() { this->packet->header.finish = 1; }
 
-void DeviceCommand::set_page_size(const uint32_t page_size) { this->packet.header.page_size = page_size; }
+void DeviceCommand::set_num_workers(const uint32_t num_workers) { this->packet->header.num_workers = num_workers; }
 
-void DeviceCommand::set_producer_cb_size(const uint32_t cb_size) { this->packet.header.producer_cb_size = cb_size; }
+void DeviceCommand::set_is_program() { this->packet->header.is_program_buffer = 1; }
 
-void DeviceCommand::set_consumer_cb_size(const uint32_t cb_size) { this->packet.header.consumer_cb_size = cb_size; }
+void DeviceCommand::set_stall() { this->packet->header.stall = 1; }
 
-void DeviceCommand::set_producer_cb_num_pages(const uint32_t cb_num_pages) { this->packet.header.producer_cb_num_pages = cb_num_pages; }
+void DeviceCommand::set_page_size(const uint32_t page_size) { this->packet->header.page_size = page_size; }
 
-void DeviceCommand::set_consumer_cb_num_pages(const uint32_t cb_num_pages) { this->packet.header.consumer_cb_num_pages = cb_num_pages; }
+void DeviceCommand::set_producer_cb_size(const uint32_t cb_size) { this->packet->header.producer_cb_size = cb_size; }
 
-void DeviceCommand::set_num_pages(uint32_t num_pages) { this->packet.header.num_pages = num_pages; }
+void DeviceCommand::set_consumer_cb_size(const uint32_t cb_size) { this->packet->header.consumer_cb_size = cb_size; }
 
-void DeviceCommand::set_sharded_buffer_num_cores(uint32_t num_cores) { this->packet.header.sharded_buffer_num_cores = num_cores; }
+void DeviceCommand::set_producer_cb_num_pages(const uint32_t cb_num_pages) { this->packet->header.producer_cb_num_pages = cb_num_pages; }
+
+void DeviceCommand::set_consumer_cb_num_pages(const uint32_t cb_num_pages) { this->packet->header.consumer_cb_num_pages = cb_num_pages; }
+
+void DeviceCommand::set_num_pages(uint32_t num_pages) { this->packet->header.num_pages = num_pages; }
+
+void DeviceCommand::set_sharded_buffer_num_cores(uint32_t num_cores) { this->packet->header.sharded_buffer_num_cores = num_cores; }
 
 void DeviceCommand::set_buffer_type(const DeviceCommand::BufferType buffer_type) {
-    this->packet.header.buffer_type = (uint32_t)buffer_type;
+    this->packet->header.buffer_type = (uint32_t)buffer_type;
 }
 
 
 void DeviceCommand::set_num_pages(const DeviceCommand::TransferType transfer_type, const uint32_t num_pages) {
     switch (transfer_type) {
         case DeviceCommand::TransferType::RUNTIME_ARGS:
-            this->packet.header.num_runtime_arg_pages = num_pages;
+            this->packet->header.num_runtime_arg_pages = num_pages;
             break;
         case DeviceCommand::TransferType::CB_CONFIGS:
-            this->packet.header.num_cb_config_pages = num_pages;
+            this->packet->header.num_cb_config_pages = num_pages;
             break;
         case DeviceCommand::TransferType::PROGRAM_MULTICAST_PAGES:
-            this->packet.header.num_program_multicast_pages = num_pages;
+            this->packet->header.num_program_multicast_pages = num_pages;
             break;
         case DeviceCommand::TransferType::PROGRAM_UNICAST_PAGES:
-            this->packet.header.num_program_unicast_pages = num_pages;
+            this->packet->header.num_program_unicast_pages = num_pages;
             break;
         case DeviceCommand::TransferType::GO_SIGNALS_MULTICAST:
-            this->packet.header.num_go_signal_multicast_pages = num_pages;
+            this->packet->header.num_go_signal_multicast_pages = num_pages;
             break;
         case DeviceCommand::TransferType::GO_SIGNALS_UNICAST:
-            this->packet.header.num_go_signal_unicast_pages = num_pages;
+            this->packet->header.num_go_signal_unicast_pages = num_pages;
             break;
         default:
             TT_ASSERT(false, "Invalid transfer type.");
     }
 }
 
-void DeviceCommand::set_data_size(const uint32_t data_size) { this->packet.header.data_size = data_size; }
+void DeviceCommand::set_data_size(const uint32_t data_size) { this->packet->header.data_size = data_size; }
 
-uint32_t DeviceCommand::get_data_size() const { return this->packet.header.data_size; }
+uint32_t DeviceCommand::get_data_size() const { return this->packet->header.data_size; }
 
 void DeviceCommand::set_producer_consumer_transfer_num_pages(const uint32_t producer_consumer_transfer_num_pages) {
-    this->packet.header.producer_consumer_transfer_num_pages = producer_consumer_transfer_num_pages;
+    this->packet->header.producer_consumer_transfer_num_pages = producer_consumer_transfer_num_pages;
 }
 
 void DeviceCommand::update_buffer_transfer_src(const uint8_t buffer_transfer_idx, const uint32_t new_src) {
-    this->packet.data[DeviceCommand::NUM_ENTRIES_IN_COMMAND_HEADER + buffer_transfer_idx * DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION] = new_src;
+    this->packet->data[buffer_transfer_idx * DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION] = new_src;
 }
 
 
@@ -98,23 +139,23 @@ void DeviceCommand::add_buffer_transfer_instruction_preamble(
     const uint32_t dst_page_index
 )
 {
-    this->packet.data[this->buffer_transfer_idx] = src;
-    this->packet.data[this->buffer_transfer_idx + 1] = dst;
-    this->packet.data[this->buffer_transfer_idx + 2] = num_pages;
-    this->packet.data[this->buffer_transfer_idx + 3] = padded_page_size;
-    this->packet.data[this->buffer_transfer_idx + 4] = src_buf_type;
-    this->packet.data[this->buffer_transfer_idx + 5] = dst_buf_type;
-    this->packet.data[this->buffer_transfer_idx + 6] = src_page_index;
-    this->packet.data[this->buffer_transfer_idx + 7] = dst_page_index;
-
+    this->packet->data[this->buffer_transfer_idx] = src;
+    this->packet->data[this->buffer_transfer_idx + 1] = dst;
+    this->packet->data[this->buffer_transfer_idx + 2] = num_pages;
+    this->packet->data[this->buffer_transfer_idx + 3] = padded_page_size;
+    this->packet->data[this->buffer_transfer_idx + 4] = src_buf_type;
+    this->packet->data[this->buffer_transfer_idx + 5] = dst_buf_type;
+    this->packet->data[this->buffer_transfer_idx + 6] = src_page_index;
+    this->packet->data[this->buffer_transfer_idx + 7] = dst_page_index;
+    this->num_entries_in_buffer_transfer.at(this->buffer_transfer_idx / DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION) = COMMAND_PTR_SHARD_IDX;
 }
 
 void DeviceCommand::add_buffer_transfer_instruction_postamble(){
     this->buffer_transfer_idx += DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION;
 
-    this->packet.header.num_buffer_transfers++;
+    this->packet->header.num_buffer_transfers++;
     TT_ASSERT(
-        this->packet.header.num_buffer_transfers <= DeviceCommand::NUM_POSSIBLE_BUFFER_TRANSFERS,
+        this->packet->header.num_buffer_transfers <= DeviceCommand::NUM_POSSIBLE_BUFFER_TRANSFERS,
         "Surpassing the limit of {} on possible buffer transfers in a single command",
         DeviceCommand::NUM_POSSIBLE_BUFFER_TRANSFERS);
 }
@@ -164,16 +205,17 @@ void DeviceCommand::add_buffer_transfer_sharded_instruction(
     uint32_t num_shards = core_id_x.size();
     uint32_t idx_offset = COMMAND_PTR_SHARD_IDX;
     for (auto shard_id = 0; shard_id < num_shards; shard_id++) {
-        this->packet.data[this->buffer_transfer_idx + idx_offset++] = num_pages_in_shard[shard_id];
-        this->packet.data[this->buffer_transfer_idx + idx_offset++] = core_id_x[shard_id];
-        this->packet.data[this->buffer_transfer_idx + idx_offset++] = core_id_y[shard_id];
+        this->packet->data[this->buffer_transfer_idx + idx_offset++] = num_pages_in_shard[shard_id];
+        this->packet->data[this->buffer_transfer_idx + idx_offset++] = core_id_x[shard_id];
+        this->packet->data[this->buffer_transfer_idx + idx_offset++] = core_id_y[shard_id];
     }
+    this->num_entries_in_buffer_transfer[this->buffer_transfer_idx / DeviceCommand::NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION] = idx_offset;
 
     this->add_buffer_transfer_instruction_postamble();
 }
 
 void DeviceCommand::write_program_entry(const uint32_t value) {
-    this->packet.data.at(this->program_transfer_idx) = value;
+    this->packet->data.at(this->program_transfer_idx) = value;
     this->program_transfer_idx++;
 }
 
@@ -181,17 +223,25 @@ void DeviceCommand::add_write_page_partial_instruction(
     const uint32_t num_bytes, const uint32_t dst, const uint32_t dst_noc, const uint32_t num_receivers, const bool advance, const bool linked) {
 
     // This 'at' does size checking
-    this->packet.data.at(this->program_transfer_idx + 5) = linked;
+    this->packet->data.at(this->program_transfer_idx + 5) = linked;
 
-    this->packet.data[this->program_transfer_idx] = num_bytes;
-    this->packet.data[this->program_transfer_idx + 1] = dst;
-    this->packet.data[this->program_transfer_idx + 2] = dst_noc;
-    this->packet.data[this->program_transfer_idx + 3] = num_receivers;
-    this->packet.data[this->program_transfer_idx + 4] = advance;
+    this->packet->data[this->program_transfer_idx] = num_bytes;
+    this->packet->data[this->program_transfer_idx + 1] = dst;
+    this->packet->data[this->program_transfer_idx + 2] = dst_noc;
+    this->packet->data[this->program_transfer_idx + 3] = num_receivers;
+    this->packet->data[this->program_transfer_idx + 4] = advance;
 
     this->program_transfer_idx += 6;
 }
 
 void* DeviceCommand::data() const {
-    return (void*)&this->packet;
+    return (void*)this->packet;
+}
+
+uint32_t DeviceCommand::num_written_bytes() const {
+    uint32_t num_entries = DeviceCommand::NUM_ENTRIES_IN_COMMAND_HEADER + this->program_transfer_idx - DeviceCommand::PROGRAM_TRANSFER_START_IDX;
+    for (uint32_t num_entries_in_transfer : this->num_entries_in_buffer_transfer) {
+        num_entries += num_entries_in_transfer;
+    }
+    return num_entries * sizeof(uint32_t);
 }
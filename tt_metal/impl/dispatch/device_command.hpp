@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "dev_mem_map.h"
@@ -40,7 +41,17 @@ struct CommandHeader {
 
 class DeviceCommand {
    public:
+    // Owns zero initialized storage, for commands that outlive their slot in the issue queue (i.e. traces)
     DeviceCommand();
+    // Assembles the command in place in command_slot, a reserved slot of the issue queue or any host memory standing in
+    // for it. Only the header and the entries that are set are written, the device parses entries as directed by the
+    // header so the rest of the slot may hold stale data
+    explicit DeviceCommand(void* command_slot);
+    // Copies own their storage, copies of an in place command carry only the entries that were set
+    DeviceCommand(const DeviceCommand& other);
+    DeviceCommand& operator=(const DeviceCommand& other);
+    DeviceCommand(DeviceCommand&& other) = default;
+    DeviceCommand& operator=(DeviceCommand&& other) = default;
 
     enum class TransferType : uint8_t {
         RUNTIME_ARGS,
@@ -158,9 +169,15 @@ class DeviceCommand {
 
     void* data() const;
 
+    // Bytes of the command that were written, header and entries that were set
+    uint32_t num_written_bytes() const;
+
    private:
+    static constexpr uint32_t PROGRAM_TRANSFER_START_IDX = NUM_POSSIBLE_BUFFER_TRANSFERS * NUM_ENTRIES_PER_BUFFER_TRANSFER_INSTRUCTION;
+
     uint32_t buffer_transfer_idx;
     uint32_t program_transfer_idx;
+    std::array<uint32_t, NUM_POSSIBLE_BUFFER_TRANSFERS> num_entries_in_buffer_transfer;
     void add_buffer_transfer_instruction_preamble(
         const uint32_t src,
         const uint32_t dst,
@@ -178,5 +195,6 @@ class DeviceCommand {
         std::array<uint32_t, DeviceCommand::NUM_ENTRIES_IN_DEVICE_COMMAND - DeviceCommand::NUM_ENTRIES_IN_COMMAND_HEADER> data;
     };
 
-    packet_ packet;
+    std::unique_ptr<packet_> owned_packet;
+    packet_* packet;
 };
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "common/core_descriptor.hpp"
 
 namespace tt::tt_metal {
@@ -51,6 +53,7 @@ class dispatch_core_manager {
     /// @param cq_id ID of the command queue within the channel
     /// @return tt_cxy_pair logical location (chip + core coordinate) of the issue queue interface
     const tt_cxy_pair &issue_queue_reader_core(chip_id_t device_id, uint16_t channel, uint8_t cq_id) {
+        std::lock_guard<std::mutex> lock(this->assignment_mutex);
         dispatch_core_types_t &assignment = this->dispatch_core_assignments[device_id][channel][cq_id];
         if (assignment.issue_queue_reader.has_value()) {
             return assignment.issue_queue_reader.value();
@@ -71,6 +74,7 @@ class dispatch_core_manager {
     /// @param cq_id ID of the command queue within the channel
     /// @return tt_cxy_pair logical location (chip + core coordinate) of the completion queue interface
     const tt_cxy_pair &completion_queue_writer_core(chip_id_t device_id, uint16_t channel, uint8_t cq_id) {
+        std::lock_guard<std::mutex> lock(this->assignment_mutex);
         dispatch_core_types_t &assignment = this->dispatch_core_assignments[device_id][channel][cq_id];
         if (assignment.completion_queue_writer.has_value()) {
             return assignment.completion_queue_writer.value();
@@ -93,6 +97,7 @@ class dispatch_core_manager {
     /// @param cq_id ID of the command queue within the channel
     /// @return tt_cxy_pair logical location (chip + core coordinate) of the dispatcher core
     const tt_cxy_pair &command_dispatcher_core(chip_id_t device_id, uint16_t channel, uint8_t cq_id) {
+        std::lock_guard<std::mutex> lock(this->assignment_mutex);
         dispatch_core_types_t &assignment = this->dispatch_core_assignments[device_id][channel][cq_id];
         if (assignment.command_dispatcher.has_value()) {
             return assignment.command_dispatcher.value();
@@ -150,6 +155,8 @@ class dispatch_core_manager {
     // Each device has an assigned hugepage at a specific channel that holds (up to 2) hardware command queues (represented by cq_id)
     std::unordered_map<chip_id_t, std::unordered_map<uint16_t, std::unordered_map<uint8_t, dispatch_core_types_t>>> dispatch_core_assignments;
     std::unordered_map<chip_id_t, std::list<CoreCoord>> available_dispatch_cores_by_device;
+    // Devices are initialized concurrently, references to assigned cores stay valid as unordered_map never moves its elements
+    std::mutex assignment_mutex;
 };
 
 
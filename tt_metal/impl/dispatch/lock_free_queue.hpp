@@ -0,0 +1,319 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tt_metal/common/assert.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace tt::tt_metal {
+
+inline constexpr std::size_t QUEUE_CACHE_LINE_SIZE = 64;
+
+// Tuning for the spin-then-park wait used by the blocking calls
+inline constexpr uint32_t QUEUE_SPIN_ITERATIONS = 1024;
+inline constexpr uint32_t QUEUE_YIELD_ITERATIONS = 64;
+
+enum class QueueProducerMode : uint8_t {
+    SINGLE = 0,
+    MULTI = 1,
+};
+
+// Bounded lock-free ring buffer with the same push/peek/pop/size interface as TSQueue.
+// A single consumer is always assumed. With QueueProducerMode::SINGLE the producer side is wait-free,
+// with QueueProducerMode::MULTI producers claim slots with a CAS on the tail (Vyukov-style per-slot sequence).
+// Blocking calls spin, then yield, then park on a condition variable; the opposite side only touches the mutex
+// when it observes a parked waiter, so the uncontended fast path never takes a lock.
+template <class T, QueueProducerMode producer_mode = QueueProducerMode::SINGLE>
+class LockFreeQueue {
+   public:
+    LockFreeQueue() : LockFreeQueue(100) {}
+    explicit LockFreeQueue(uint32_t capacity);
+    ~LockFreeQueue();
+
+    LockFreeQueue(const LockFreeQueue &) = delete;
+    LockFreeQueue &operator=(const LockFreeQueue &) = delete;
+
+    // Blocking API, drop-in for TSQueue
+    void push(T e);
+    T peek();
+    void pop();
+
+    // Non-blocking API
+    bool try_push(T e);
+    bool try_pop(T &e);
+
+    // Batched API: push blocks until all elements are enqueued, pop returns up to max_count available elements
+    // (blocking until at least one is available)
+    template <class InputIt>
+    void push_batch(InputIt first, InputIt last);
+    std::size_t pop_batch(std::vector<T> &out, std::size_t max_count);
+
+    // Snapshot; exact only when called from the consumer with producers quiescent
+    std::size_t size() const;
+    bool empty() const { return this->size() == 0; }
+    uint32_t capacity() const { return this->capacity_; }
+
+   private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        T *ptr() { return std::launder(reinterpret_cast<T *>(&this->storage)); }
+    };
+
+    bool try_claim_tail(std::size_t &position);
+    bool wait_for_front();
+    void notify(std::atomic<uint32_t> &waiters, std::condition_variable &condition);
+    template <class Pred>
+    void wait(std::atomic<uint32_t> &waiters, std::condition_variable &condition, Pred pred);
+
+    static void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    const uint32_t capacity_;
+    const std::size_t mask_;
+    Slot *slots_;
+
+    // Producer and consumer indices live on their own cache lines to avoid false sharing
+    alignas(QUEUE_CACHE_LINE_SIZE) std::atomic<std::size_t> tail_{0};
+    alignas(QUEUE_CACHE_LINE_SIZE) std::atomic<std::size_t> head_{0};
+
+    alignas(QUEUE_CACHE_LINE_SIZE) std::atomic<uint32_t> consumer_waiters_{0};
+    std::atomic<uint32_t> producer_waiters_{0};
+    std::mutex park_mutex_;
+    std::condition_variable empty_condition_;
+    std::condition_variable full_condition_;
+};
+
+template <class T, QueueProducerMode producer_mode>
+LockFreeQueue<T, producer_mode>::LockFreeQueue(uint32_t capacity) :
+    capacity_(capacity), mask_([capacity] {
+        std::size_t ring_size = 1;
+        while (ring_size < capacity) {
+            ring_size <<= 1;
+        }
+        return ring_size - 1;
+    }()) {
+    TT_FATAL(capacity > 0, "LockFreeQueue capacity must be non-zero");
+    // Ring is sized to the next power of 2 for cheap wrap-around, capacity_ still bounds the occupancy
+    this->slots_ = static_cast<Slot *>(::operator new[]((this->mask_ + 1) * sizeof(Slot), std::align_val_t(QUEUE_CACHE_LINE_SIZE)));
+    for (std::size_t i = 0; i <= this->mask_; i++) {
+        new (&this->slots_[i].sequence) std::atomic<std::size_t>(i);
+    }
+}
+
+template <class T, QueueProducerMode producer_mode>
+LockFreeQueue<T, producer_mode>::~LockFreeQueue() {
+    T discard;
+    while (this->try_pop(discard)) {
+    }
+    for (std::size_t i = 0; i <= this->mask_; i++) {
+        this->slots_[i].sequence.~atomic();
+    }
+    ::operator delete[](this->slots_, std::align_val_t(QUEUE_CACHE_LINE_SIZE));
+}
+
+template <class T, QueueProducerMode producer_mode>
+bool LockFreeQueue<T, producer_mode>::try_claim_tail(std::size_t &position) {
+    position = this->tail_.load(std::memory_order_relaxed);
+    while (true) {
+        std::size_t head = this->head_.load(std::memory_order_acquire);
+        // With several producers the position may be stale and already behind the head, which would wrap the
+        // unsigned occupancy below and look like a full queue
+        if (position < head) {
+            position = this->tail_.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (position - head >= this->capacity_) {
+            return false;
+        }
+        Slot &slot = this->slots_[position & this->mask_];
+        std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (diff == 0) {
+            if constexpr (producer_mode == QueueProducerMode::SINGLE) {
+                this->tail_.store(position + 1, std::memory_order_relaxed);
+                return true;
+            } else {
+                if (this->tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return true;
+                }
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            position = this->tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <class T, QueueProducerMode producer_mode>
+bool LockFreeQueue<T, producer_mode>::try_push(T e) {
+    std::size_t position;
+    if (not this->try_claim_tail(position)) {
+        return false;
+    }
+    Slot &slot = this->slots_[position & this->mask_];
+    new (&slot.storage) T(std::move(e));
+    slot.sequence.store(position + 1, std::memory_order_release);
+    this->notify(this->consumer_waiters_, this->empty_condition_);
+    return true;
+}
+
+template <class T, QueueProducerMode producer_mode>
+bool LockFreeQueue<T, producer_mode>::try_pop(T &e) {
+    std::size_t position = this->head_.load(std::memory_order_relaxed);
+    Slot &slot = this->slots_[position & this->mask_];
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+        return false;
+    }
+    T *element = slot.ptr();
+    e = std::move(*element);
+    element->~T();
+    slot.sequence.store(position + this->mask_ + 1, std::memory_order_release);
+    this->head_.store(position + 1, std::memory_order_release);
+    this->notify(this->producer_waiters_, this->full_condition_);
+    return true;
+}
+
+template <class T, QueueProducerMode producer_mode>
+void LockFreeQueue<T, producer_mode>::push(T e) {
+    std::size_t position;
+    this->wait(this->producer_waiters_, this->full_condition_, [this, &position] { return this->try_claim_tail(position); });
+    Slot &slot = this->slots_[position & this->mask_];
+    new (&slot.storage) T(std::move(e));
+    slot.sequence.store(position + 1, std::memory_order_release);
+    this->notify(this->consumer_waiters_, this->empty_condition_);
+}
+
+template <class T, QueueProducerMode producer_mode>
+template <class InputIt>
+void LockFreeQueue<T, producer_mode>::push_batch(InputIt first, InputIt last) {
+    if constexpr (producer_mode == QueueProducerMode::SINGLE) {
+        // Single producer owns the tail, so publish as many slots as are free before waking the consumer once
+        while (first != last) {
+            this->wait(this->producer_waiters_, this->full_condition_, [this] {
+                return this->tail_.load(std::memory_order_relaxed) - this->head_.load(std::memory_order_acquire) < this->capacity_;
+            });
+            std::size_t position = this->tail_.load(std::memory_order_relaxed);
+            std::size_t free_slots = this->capacity_ - (position - this->head_.load(std::memory_order_acquire));
+            for (; free_slots > 0 and first != last; free_slots--, ++first, position++) {
+                Slot &slot = this->slots_[position & this->mask_];
+                new (&slot.storage) T(*first);
+                slot.sequence.store(position + 1, std::memory_order_release);
+            }
+            this->tail_.store(position, std::memory_order_relaxed);
+            this->notify(this->consumer_waiters_, this->empty_condition_);
+        }
+    } else {
+        for (; first != last; ++first) {
+            this->push(*first);
+        }
+    }
+}
+
+template <class T, QueueProducerMode producer_mode>
+T LockFreeQueue<T, producer_mode>::peek() {
+    this->wait(this->consumer_waiters_, this->empty_condition_, [this] { return this->wait_for_front(); });
+    return *this->slots_[this->head_.load(std::memory_order_relaxed) & this->mask_].ptr();
+}
+
+template <class T, QueueProducerMode producer_mode>
+void LockFreeQueue<T, producer_mode>::pop() {
+    // Only the consumer pops, so once the front slot is published try_pop cannot fail
+    this->wait(this->consumer_waiters_, this->empty_condition_, [this] { return this->wait_for_front(); });
+    T discard;
+    this->try_pop(discard);
+}
+
+template <class T, QueueProducerMode producer_mode>
+std::size_t LockFreeQueue<T, producer_mode>::pop_batch(std::vector<T> &out, std::size_t max_count) {
+    if (max_count == 0) {
+        return 0;
+    }
+    this->wait(this->consumer_waiters_, this->empty_condition_, [this] { return this->wait_for_front(); });
+    std::size_t position = this->head_.load(std::memory_order_relaxed);
+    std::size_t num_popped = 0;
+    for (; num_popped < max_count; num_popped++, position++) {
+        Slot &slot = this->slots_[position & this->mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+        T *element = slot.ptr();
+        out.push_back(std::move(*element));
+        element->~T();
+        slot.sequence.store(position + this->mask_ + 1, std::memory_order_release);
+    }
+    // Release all consumed slots to producers with a single head update
+    this->head_.store(position, std::memory_order_release);
+    this->notify(this->producer_waiters_, this->full_condition_);
+    return num_popped;
+}
+
+template <class T, QueueProducerMode producer_mode>
+std::size_t LockFreeQueue<T, producer_mode>::size() const {
+    std::size_t head = this->head_.load(std::memory_order_acquire);
+    std::size_t tail = this->tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+template <class T, QueueProducerMode producer_mode>
+bool LockFreeQueue<T, producer_mode>::wait_for_front() {
+    std::size_t position = this->head_.load(std::memory_order_relaxed);
+    return this->slots_[position & this->mask_].sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+template <class T, QueueProducerMode producer_mode>
+void LockFreeQueue<T, producer_mode>::notify(std::atomic<uint32_t> &waiters, std::condition_variable &condition) {
+    // Pairs with the seq_cst increment in wait() so a waiter either sees the published slot or is seen here
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters.load(std::memory_order_relaxed) != 0) {
+        std::lock_guard<std::mutex> lock(this->park_mutex_);
+        condition.notify_all();
+    }
+}
+
+template <class T, QueueProducerMode producer_mode>
+template <class Pred>
+void LockFreeQueue<T, producer_mode>::wait(std::atomic<uint32_t> &waiters, std::condition_variable &condition, Pred pred) {
+    // Busy spinning only helps when the other side can run concurrently
+    static const uint32_t spin_iterations = std::thread::hardware_concurrency() > 1 ? QUEUE_SPIN_ITERATIONS : 0;
+    for (uint32_t i = 0; i < spin_iterations; i++) {
+        if (pred()) {
+            return;
+        }
+        cpu_relax();
+    }
+    for (uint32_t i = 0; i < QUEUE_YIELD_ITERATIONS; i++) {
+        if (pred()) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+    std::unique_lock<std::mutex> lock(this->park_mutex_);
+    waiters.fetch_add(1, std::memory_order_seq_cst);
+    condition.wait(lock, pred);
+    waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+}  // namespace tt::tt_metal
@@ -2,6 +2,9 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#pragma once
+
+#include <condition_variable>
 #include <mutex>
 #include <thread>
 #include <queue>
@@ -75,4 +78,7 @@ void TSQueue<T>::pop() {
 }
 
 template <class T>
-size_t TSQueue<T>::size() { return this->q.size(); }
+size_t TSQueue<T>::size() {
+    std::unique_lock<std::mutex> lock(this->m);
+    return this->q.size();
+}
@@ -24,7 +24,11 @@ Kernel::Kernel(const std::string &kernel_path_file_name, const CoreRangeSet &cor
     kernel_path_file_name_(kernel_path_file_name),
     core_range_set_(core_range_set),
     binary_size16_(0),
-    compile_time_args_(compile_args), defines_(defines) {
+    compile_time_args_(compile_args),
+    runtime_args_stride_(0),
+    runtime_args_layout_version_(0),
+    runtime_args_viewed_(false),
+    defines_(defines) {
     size_t max_x = 0, max_y = 0;
     for (auto core_range : this->core_range_set_.ranges()) {
         auto start = core_range.start;
@@ -38,7 +42,7 @@ Kernel::Kernel(const std::string &kernel_path_file_name, const CoreRangeSet &cor
             }
         }
     }
-    this->core_to_runtime_args_ = { max_x+1, std::vector< std::vector<uint32_t > > (max_y+1, std::vector<uint32_t>() ) };
+    this->core_to_runtime_args_ = { max_x+1, std::vector<RuntimeArgsData> (max_y+1, RuntimeArgsData()) };
 }
 
 std::string Kernel::name() const {
@@ -111,7 +115,7 @@ uint8_t ComputeKernel::expected_num_binaries() const {
     return 3;
 }
 
-std::vector<ll_api::memory> const &Kernel::binaries(chip_id_t device_id) const {
+std::vector<std::shared_ptr<const ll_api::memory>> const &Kernel::binaries(chip_id_t device_id) const {
     int expected_num_binaries = this->expected_num_binaries();
     if (this->binaries_.find(device_id) != this->binaries_.end() and this->binaries_.at(device_id).size() != expected_num_binaries) {
         TT_THROW("Expected " + std::to_string(expected_num_binaries) + " binaries but have "
@@ -120,6 +124,16 @@ std::vector<ll_api::memory> const &Kernel::binaries(chip_id_t device_id) const {
     return this->binaries_.at(device_id);
 }
 
+size_t Kernel::binaries_size_bytes(chip_id_t device_id) const {
+    size_t size_bytes = 0;
+    if (this->binaries_.find(device_id) != this->binaries_.end()) {
+        for (const auto &binary : this->binaries_.at(device_id)) {
+            size_bytes += binary->size() * sizeof(ll_api::memory::word_t);
+        }
+    }
+    return size_bytes;
+}
+
 std::string DataMovementKernel::config_hash() const {
     return fmt::format("{}", magic_enum::enum_name(this->config_.noc));
 }
@@ -149,12 +163,31 @@ void Kernel::update_runtime_arg( const CoreCoord &logical_core, size_t idx, uint
     v[idx] = value;
 }
 
-std::vector<uint32_t>& Kernel::runtime_args(const CoreCoord &logical_core) {
+RuntimeArgsData& Kernel::runtime_args(const CoreCoord &logical_core) {
+    this->runtime_args_viewed_ = true;
+    return this->core_runtime_args(logical_core);
+}
+
+const RuntimeArgsData& Kernel::runtime_args(const CoreCoord &logical_core) const {
+    return const_cast<Kernel *>(this)->core_runtime_args(logical_core);
+}
+
+RuntimeArgsData& Kernel::common_runtime_args() {
+    this->runtime_args_viewed_ = true;
+    return this->common_runtime_args_data_;
+}
+
+RuntimeArgsData& Kernel::core_runtime_args(const CoreCoord &logical_core) {
     // TODO (abhullar): Should this check only be enabled in debug mode?
     TT_FATAL( logical_core.x < this->core_to_runtime_args_.size() && logical_core.y < this->core_to_runtime_args_[logical_core.x].size(), "Cannot get runtime args for kernel {} that is not placed on core {}", this->name(), logical_core.str());
     return this->core_to_runtime_args_[logical_core.x][logical_core.y];
 }
 
+uint32_t Kernel::common_runtime_args_base() const {
+    TT_FATAL(this->processor() != RISCV::ERISC, "Common runtime args are not supported on ethernet kernel {}", this->name());
+    return this->get_runtime_args_range().second - L1_COMMON_ARGS_SIZE;
+}
+
 std::pair<uint64_t, uint64_t> DataMovementKernel::get_runtime_args_range() const {
     std::pair<uint64_t, uint64_t> arg_base_to_result_base;
     switch (this->config_.processor) {
@@ -184,24 +217,99 @@ std::pair<uint64_t, uint64_t> ComputeKernel::get_runtime_args_range() const {
     return arg_base_to_result_base;
 }
 
-void Kernel::set_runtime_args(const CoreCoord &logical_core, const std::vector<uint32_t> &runtime_args) {
-    auto validate_runtime_args_size = [&]() {
-        uint32_t runtime_args_size = runtime_args.size() * sizeof(uint32_t);
-        auto[l1_arg_base, result_base] = this->get_runtime_args_range();
-        if (l1_arg_base + runtime_args_size >= result_base) {
-            TT_THROW(std::to_string(runtime_args_size / 1024) + "KB runtime args targeting kernel " + this->name() + " on " + logical_core.str() + " are too large.\
-                Cannot be written as they will run into memory region reserved for result. Max allowable size is " + std::to_string((result_base - l1_arg_base)/1024) + " KB.");
+void Kernel::validate_runtime_args_size(const CoreCoord &logical_core, size_t num_runtime_args, size_t num_common_runtime_args) const {
+    uint32_t runtime_args_size = num_runtime_args * sizeof(uint32_t);
+    auto[l1_arg_base, result_base] = this->get_runtime_args_range();
+    if (num_common_runtime_args > 0) {
+        // Unique args must stay clear of the common args at the top of the region
+        result_base = this->common_runtime_args_base();
+        TT_FATAL(num_common_runtime_args * sizeof(uint32_t) <= L1_COMMON_ARGS_SIZE,
+            "{}B of common runtime args targeting kernel {} are too large. Max allowable size is {}B.",
+            num_common_runtime_args * sizeof(uint32_t), this->name(), L1_COMMON_ARGS_SIZE);
+    }
+    if (l1_arg_base + runtime_args_size >= result_base) {
+        TT_THROW(std::to_string(runtime_args_size / 1024) + "KB runtime args targeting kernel " + this->name() + " on " + logical_core.str() + " are too large.\
+            Cannot be written as they will run into memory region reserved for result. Max allowable size is " + std::to_string((result_base - l1_arg_base)/1024) + " KB.");
+    }
+}
+
+void Kernel::add_runtime_args_slot(const CoreCoord &logical_core, size_t num_runtime_args) {
+    // Slots are padded to the 16B alignment of runtime arg transfers so the arena is laid out as it is sent
+    uint32_t stride = std::max<uint32_t>(this->runtime_args_stride_, align(num_runtime_args, L1_ALIGNMENT / sizeof(uint32_t)));
+    uint32_t num_slots = this->cores_with_runtime_args_.size() + 1;
+    // Capacity for every core of the kernel is reserved, so only wider slots move the arena
+    bool arena_moves = stride != this->runtime_args_stride_ or this->runtime_args_arena_.capacity() < num_slots * stride;
+    TT_FATAL(
+        not arena_moves or not this->runtime_args_viewed_,
+        "Runtime args of kernel {} on core {} are set after args were read back with GetRuntimeArgs and move the views "
+        "returned, set the args of every core before reading any back",
+        this->name(),
+        logical_core.str());
+    if (stride != this->runtime_args_stride_) {
+        // Widen the slots of the cores already in the arena
+        std::vector<uint32_t> arena;
+        arena.reserve(std::max<size_t>(this->logical_cores_.size(), num_slots) * stride);
+        arena.resize(num_slots * stride, 0);
+        for (uint32_t slot = 0; slot < this->cores_with_runtime_args_.size(); slot++) {
+            const CoreCoord &core = this->cores_with_runtime_args_[slot];
+            const RuntimeArgsData &rt_args = this->core_to_runtime_args_[core.x][core.y];
+            std::copy(rt_args.begin(), rt_args.end(), arena.begin() + slot * stride);
         }
-    };
+        this->runtime_args_arena_ = std::move(arena);
+        this->runtime_args_stride_ = stride;
+    } else {
+        this->runtime_args_arena_.resize(num_slots * stride, 0);
+    }
+    this->cores_with_runtime_args_.push_back(logical_core);
+    this->core_to_runtime_args_[logical_core.x][logical_core.y].rt_args_count = num_runtime_args;
+    this->runtime_args_layout_version_++;
+
+    // The arena may have moved
+    for (uint32_t slot = 0; slot < num_slots; slot++) {
+        const CoreCoord &core = this->cores_with_runtime_args_[slot];
+        this->core_to_runtime_args_[core.x][core.y].rt_args_data = this->runtime_args_arena_.data() + slot * stride;
+    }
+}
 
+void Kernel::set_runtime_args(const CoreCoord &logical_core, const uint32_t *runtime_args, size_t num_runtime_args) {
     // TODO (abhullar): If we don't include this check then user can write runtime args to a core that the kernel is not placed on.
     //                  Should this check only be enabled in debug mode?
     // TT_FATAL(this->is_on_logical_core(logical_core), "Cannot set runtime args for core {} since kernel {} is not placed on it!", logical_core.str(), this->name());
-    validate_runtime_args_size();
-    auto &set_rt_args = this->core_to_runtime_args_[logical_core.x][logical_core.y];
-    TT_ASSERT(set_rt_args.empty() or set_rt_args.size() == runtime_args.size(), "Illegal Runtime Args: Number of runtime args cannot be modified!");
-    set_rt_args = runtime_args;
-    this->core_with_runtime_args_.insert( logical_core );
+    this->validate_runtime_args_size(logical_core, num_runtime_args, this->common_runtime_args_.size());
+    RuntimeArgsData &set_rt_args = this->core_runtime_args(logical_core);
+    // Part of the API, not a debug check: the args live in fixed slots of the program's arena and of the dispatch
+    // commands, a different count would write past them
+    TT_FATAL(set_rt_args.empty() or set_rt_args.size() == num_runtime_args, "Illegal Runtime Args: Number of runtime args cannot be modified!");
+    if (num_runtime_args == 0) {
+        return;
+    }
+    if (set_rt_args.empty()) {
+        this->add_runtime_args_slot(logical_core, num_runtime_args);
+    }
+    // Args read back with GetRuntimeArgs already live in the slot
+    if (runtime_args != set_rt_args.data()) {
+        std::copy(runtime_args, runtime_args + num_runtime_args, set_rt_args.data());
+    }
+}
+
+void Kernel::set_runtime_args(const CoreCoord &logical_core, const std::vector<uint32_t> &runtime_args) {
+    this->set_runtime_args(logical_core, runtime_args.data(), runtime_args.size());
+}
+
+void Kernel::set_runtime_args(const CoreCoord &logical_core, const RuntimeArgsData &runtime_args) {
+    this->set_runtime_args(logical_core, runtime_args.data(), runtime_args.size());
+}
+
+void Kernel::set_common_runtime_args(const std::vector<uint32_t> &common_runtime_args) {
+    TT_FATAL(not this->logical_cores_.empty(), "Cannot set common runtime args for kernel {} that is not placed on any core", this->name());
+    TT_FATAL(this->common_runtime_args_.empty() or this->common_runtime_args_.size() == common_runtime_args.size(), "Illegal Common Runtime Args: Number of common runtime args cannot be modified!");
+    // Only the widest slot needs checking against the common args
+    this->validate_runtime_args_size(*this->logical_cores_.begin(), this->runtime_args_stride_, common_runtime_args.size());
+    if (this->common_runtime_args_.empty() and not common_runtime_args.empty()) {
+        this->runtime_args_layout_version_++;
+    }
+    this->common_runtime_args_ = common_runtime_args;
+    this->common_runtime_args_data_ = RuntimeArgsData{.rt_args_data = this->common_runtime_args_.data(), .rt_args_count = this->common_runtime_args_.size()};
 }
 
 void DataMovementKernel::set_build_options(JitBuildOptions& build_options) const {
@@ -253,9 +361,14 @@ void ComputeKernel::generate_binaries(Device *device, JitBuildOptions& build_opt
     jit_build_subset(build_states, this, this->kernel_path_file_name_);
 }
 
-void Kernel::set_binaries(chip_id_t device_id, std::vector<ll_api::memory> &&binaries) {
+void Kernel::set_binaries(chip_id_t device_id, std::vector<std::shared_ptr<const ll_api::memory>> &&binaries) {
     if (this->binaries_.find(device_id) != this->binaries_.end()) {
-        TT_ASSERT(this->binaries_.at(device_id) == binaries);
+        TT_ASSERT(std::equal(
+            this->binaries_.at(device_id).begin(),
+            this->binaries_.at(device_id).end(),
+            binaries.begin(),
+            binaries.end(),
+            [](const auto &a, const auto &b) { return *a == *b; }));
     } else {
         this->binaries_[device_id] = std::move(binaries);
     }
@@ -263,14 +376,14 @@ void Kernel::set_binaries(chip_id_t device_id, std::vector<ll_api::memory> &&bin
 
 void DataMovementKernel::read_binaries(Device *device) {
     TT_ASSERT ( !binary_path_.empty(), "Path to Kernel binaries not set!" );
-    std::vector<ll_api::memory> binaries;
+    std::vector<std::shared_ptr<const ll_api::memory>> binaries;
 
     // TODO(pgk): move the procssor types into the build system.  or just use integer indicies
     // TODO(pgk): consolidate read_binaries where possible
     int riscv_id = static_cast<std::underlying_type<DataMovementProcessor>::type>(this->config_.processor);
     const JitBuildState& build_state = device->build_kernel_state(JitBuildProcessorType::DATA_MOVEMENT, riscv_id);
-    ll_api::memory binary_mem = llrt::get_risc_binary(build_state.get_target_out_path(this->kernel_full_name_));
-    this->binary_size16_ = llrt::get_binary_code_size16(binary_mem, riscv_id);
+    auto binary_mem = llrt::get_risc_binary(build_state.get_target_out_path(this->binary_name_));
+    this->binary_size16_ = llrt::get_binary_code_size16(*binary_mem, riscv_id);
     log_debug(LogLoader, "RISC {} kernel binary size: {} in bytes", riscv_id, this->binary_size16_ * 16);
 
     binaries.push_back(binary_mem);
@@ -280,21 +393,21 @@ void DataMovementKernel::read_binaries(Device *device) {
 void EthernetKernel::read_binaries(Device *device) {
    // untested
     TT_ASSERT ( !binary_path_.empty(), "Path to Kernel binaries not set!" );
-    std::vector<ll_api::memory> binaries;
+    std::vector<std::shared_ptr<const ll_api::memory>> binaries;
 
     const JitBuildState& build_state = device->build_kernel_state(JitBuildProcessorType::ETHERNET, 0);
-    ll_api::memory binary_mem = llrt::get_risc_binary(build_state.get_target_out_path(this->kernel_full_name_));
+    auto binary_mem = llrt::get_risc_binary(build_state.get_target_out_path(this->binary_name_));
     binaries.push_back(binary_mem);
     this->set_binaries(device->id(), std::move(binaries));
 }
 
 void ComputeKernel::read_binaries(Device *device) {
     TT_ASSERT ( !binary_path_.empty(), "Path to Kernel binaries not set!" );
-    std::vector<ll_api::memory> binaries;
+    std::vector<std::shared_ptr<const ll_api::memory>> binaries;
     for (int trisc_id = 0; trisc_id <= 2; trisc_id++) {
         const JitBuildState& build_state = device->build_kernel_state(JitBuildProcessorType::COMPUTE, trisc_id);
-        ll_api::memory binary_mem = llrt::get_risc_binary(build_state.get_target_out_path(this->kernel_full_name_));
-        this->binary_size16_ = llrt::get_binary_code_size16(binary_mem, trisc_id + 2);
+        auto binary_mem = llrt::get_risc_binary(build_state.get_target_out_path(this->binary_name_));
+        this->binary_size16_ = llrt::get_binary_code_size16(*binary_mem, trisc_id + 2);
         log_debug("RISC {} kernel binary size: {} in bytes", trisc_id + 2, this->binary_size16_ * 16);
         binaries.push_back(binary_mem);
     }
@@ -322,7 +435,7 @@ bool DataMovementKernel::configure(Device *device, const CoreCoord &logical_core
     }
     auto device_id = device->id();
     auto worker_core = device->worker_core_from_logical_core(logical_core);
-    ll_api::memory binary_mem = this->binaries(device_id).at(0);
+    const ll_api::memory &binary_mem = *this->binaries(device_id).at(0);
 
     int riscv_id;
     switch (this->config_.processor) {
@@ -346,7 +459,7 @@ bool EthernetKernel::configure(Device *device, const CoreCoord &logical_core) co
     bool pass = true;
     auto device_id = device->id();
     auto ethernet_core = device->ethernet_core_from_logical_core(logical_core);
-    ll_api::memory binary_mem = this->binaries(device_id).at(0);
+    const ll_api::memory &binary_mem = *this->binaries(device_id).at(0);
     int riscv_id = 5;
     pass &= tt::llrt::test_load_write_read_risc_binary(binary_mem, device_id, ethernet_core, riscv_id);
     return pass;
@@ -359,11 +472,11 @@ bool ComputeKernel::configure(Device *device, const CoreCoord &logical_core) con
     }
     auto device_id = device->id();
     auto worker_core = device->worker_core_from_logical_core(logical_core);
-    std::vector<ll_api::memory> binaries = this->binaries(device_id);
+    const auto &binaries = this->binaries(device_id);
 
     for (int trisc_id = 0; trisc_id <= 2; trisc_id++) {
         pass &= tt::llrt::test_load_write_read_trisc_binary(
-            binaries.at(trisc_id),
+            *binaries.at(trisc_id),
             device_id,
             worker_core,
             trisc_id);
@@ -23,6 +23,29 @@ namespace tt_metal {
 
 using Config = std::variant<DataMovementConfig, experimental::EthernetConfig, ComputeConfig>;
 
+// Runtime args of a kernel on one core, a view into the kernel's runtime arg arena
+struct RuntimeArgsData {
+    uint32_t *rt_args_data = nullptr;
+    size_t rt_args_count = 0;
+
+    uint32_t &operator[](size_t index) {
+        TT_ASSERT(index < this->rt_args_count, "Index {} is out of bounds of {} runtime args", index, this->rt_args_count);
+        return this->rt_args_data[index];
+    }
+    const uint32_t &operator[](size_t index) const {
+        TT_ASSERT(index < this->rt_args_count, "Index {} is out of bounds of {} runtime args", index, this->rt_args_count);
+        return this->rt_args_data[index];
+    }
+    uint32_t *data() { return this->rt_args_data; }
+    const uint32_t *data() const { return this->rt_args_data; }
+    size_t size() const { return this->rt_args_count; }
+    bool empty() const { return this->rt_args_count == 0; }
+    uint32_t *begin() { return this->rt_args_data; }
+    uint32_t *end() { return this->rt_args_data + this->rt_args_count; }
+    const uint32_t *begin() const { return this->rt_args_data; }
+    const uint32_t *end() const { return this->rt_args_data + this->rt_args_count; }
+};
+
 class Kernel : public JitBuildSettings {
    public:
     Kernel(const std::string &kernel_path_file_name, const CoreRangeSet &core_range_set, const std::vector<uint32_t> &compile_args, const std::map<std::string, std::string>&defines);
@@ -41,15 +64,33 @@ class Kernel : public JitBuildSettings {
 
     bool is_on_logical_core(const CoreCoord &logical_core) const;
 
-    std::vector<ll_api::memory> const &binaries(chip_id_t device_id) const;
+    std::vector<std::shared_ptr<const ll_api::memory>> const &binaries(chip_id_t device_id) const;
+
+    // Size of the binaries held for device_id, 0 if the kernel has not been compiled for it
+    size_t binaries_size_bytes(chip_id_t device_id) const;
 
     std::vector<uint32_t> compile_time_args() const { return compile_time_args_; }
 
-    const std::unordered_set<CoreCoord>& cores_with_runtime_args() const { return core_with_runtime_args_; }
+    // Cores with runtime args in the order of their slots in runtime_args_arena()
+    const std::vector<CoreCoord>& cores_with_runtime_args() const { return cores_with_runtime_args_; }
 
     void update_runtime_arg( const CoreCoord &logical_core, size_t idx, uint32_t value);
 
-    std::vector<uint32_t> & runtime_args(const CoreCoord &logical_core);
+    // Views of the args of a core, the references stay valid for the life of the kernel. Pointers into the args and
+    // copies of the view move with the arena, so once a view was taken setting args that move it is an error
+    RuntimeArgsData & runtime_args(const CoreCoord &logical_core);
+    const RuntimeArgsData & runtime_args(const CoreCoord &logical_core) const;
+
+    // Runtime args of every core in cores_with_runtime_args(), each in a slot of runtime_args_stride() words
+    const std::vector<uint32_t>& runtime_args_arena() const { return runtime_args_arena_; }
+    uint32_t runtime_args_stride() const { return runtime_args_stride_; }
+    // Bumped when the arena gains a slot, its stride changes or common args are first set, values alone do not bump it
+    uint32_t runtime_args_layout_version() const { return runtime_args_layout_version_; }
+
+    // Runtime args identical on all cores of the kernel, stored once and multicast to common_runtime_args_base()
+    RuntimeArgsData & common_runtime_args();
+    const RuntimeArgsData & common_runtime_args() const { return common_runtime_args_data_; }
+    uint32_t common_runtime_args_base() const;
 
     std::map<std::string, std::string> defines() const { return defines_; }
 
@@ -64,10 +105,13 @@ class Kernel : public JitBuildSettings {
     virtual void generate_binaries(Device *device, JitBuildOptions& build_options) const = 0;
     inline uint16_t get_binary_size16() const { return binary_size16_; }
     void set_binary_path ( const std::string & binary_path) { binary_path_ = binary_path; }
-    void set_binaries(chip_id_t device_id, std::vector<ll_api::memory> &&binaries);
+    void set_binary_name(const string& s) { binary_name_ = s; }
+    void set_binaries(chip_id_t device_id, std::vector<std::shared_ptr<const ll_api::memory>> &&binaries);
     virtual void read_binaries(Device *device) = 0;
 
     void set_runtime_args(const CoreCoord &logical_core, const std::vector<uint32_t> &runtime_args);
+    void set_runtime_args(const CoreCoord &logical_core, const RuntimeArgsData &runtime_args);
+    void set_common_runtime_args(const std::vector<uint32_t> &common_runtime_args);
 
     int get_watcher_kernel_id() { return watcher_kernel_id_; }
 
@@ -83,14 +127,23 @@ class Kernel : public JitBuildSettings {
     std::string kernel_full_name_;                      // Name + hash
     CoreRangeSet core_range_set_;
     std::string binary_path_;
+    std::string binary_name_;                           // Directory of the binaries in the kernel root
     // DataMovement kernels have one binary each and Compute kernels have three binaries
     // Different set of binaries per device because kernel compilation is device dependent
     // TODO: break this dependency by https://github.com/tenstorrent-metal/tt-metal/issues/3381
-    std::unordered_map<chip_id_t, std::vector<ll_api::memory>> binaries_;
+    // Images are shared with the llrt binary cache, not copied per kernel
+    std::unordered_map<chip_id_t, std::vector<std::shared_ptr<const ll_api::memory>>> binaries_;
     uint16_t binary_size16_;
     std::vector<uint32_t> compile_time_args_;
-    std::vector< std::vector< std::vector<uint32_t>> > core_to_runtime_args_;
-    std::unordered_set<CoreCoord> core_with_runtime_args_;
+    std::vector<uint32_t> runtime_args_arena_;
+    uint32_t runtime_args_stride_;
+    uint32_t runtime_args_layout_version_;
+    std::vector<CoreCoord> cores_with_runtime_args_;
+    std::vector< std::vector<RuntimeArgsData> > core_to_runtime_args_;
+    std::vector<uint32_t> common_runtime_args_;
+    RuntimeArgsData common_runtime_args_data_;
+    // Set once runtime_args() or common_runtime_args() hand out a view
+    bool runtime_args_viewed_;
     std::map<std::string, std::string> defines_;        // preprocessor defines. this is to be able to generate generic instances.
     std::set<CoreCoord> logical_cores_;
 
@@ -99,6 +152,12 @@ class Kernel : public JitBuildSettings {
     virtual std::string config_hash() const = 0;
 
     virtual std::pair<uint64_t, uint64_t> get_runtime_args_range() const = 0;
+
+   private:
+    RuntimeArgsData & core_runtime_args(const CoreCoord &logical_core);
+    void set_runtime_args(const CoreCoord &logical_core, const uint32_t *runtime_args, size_t num_runtime_args);
+    void validate_runtime_args_size(const CoreCoord &logical_core, size_t num_runtime_args, size_t num_common_runtime_args) const;
+    void add_runtime_args_slot(const CoreCoord &logical_core, size_t num_runtime_args);
 };
 
 class DataMovementKernel : public Kernel {
@@ -14,6 +14,7 @@
 #include "tt_metal/detail/persistent_kernel_cache.hpp"
 #include "tt_metal/detail/kernel_cache.hpp"
 #include "tt_metal/jit_build/genfiles.hpp"
+#include "tt_metal/jit_build/kernel_binary_cache.hpp"
 
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
 #include "tools/profiler/profiler.hpp"
@@ -95,10 +96,12 @@ auto Program::semaphores_on_core(const CoreCoord &core) const {
 
 std::atomic<uint64_t> Program::program_counter = 0;
 
-Program::Program(): id(program_counter++),worker_crs_({}), local_circular_buffer_allocation_needed_(false) {}
+Program::Program(): id(program_counter++), binaries_version_(0), circular_buffers_version_(0), semaphores_version_(0), worker_crs_({}), local_circular_buffer_allocation_needed_(false) {}
 
 KernelHandle Program::add_kernel(Kernel *kernel) {
     this->invalidate_compile();
+    // Kernel groups are rebuilt so go signals and binary destinations can change
+    this->binaries_version_++;
     KernelHandle id = kernels_.size();
     kernels_.push_back(kernel);
     kernel_groups_.resize(0);
@@ -349,6 +352,7 @@ void Program::CircularBufferAllocator::mark_address(uint64_t address, uint64_t s
 
 CBHandle Program::add_circular_buffer(const CoreRangeSet &core_range_set, const CircularBufferConfig &config) {
     this->invalidate_compile();
+    this->circular_buffers_version_++;
     std::shared_ptr<CircularBuffer> circular_buffer = std::make_shared<CircularBuffer>(core_range_set, config);
     // Globally allocated circular buffer do not invalidate allocation because their addresses are tracked by memory allocator
     if (not circular_buffer->globally_allocated()) {
@@ -469,10 +473,7 @@ void Program::allocate_circular_buffers() {
 void Program::validate_circular_buffer_region(const Device *device) const {
     ZoneScoped;
 
-    // Banks are in lockstep so we only need to get lowest L1 address of one compute and storage core
-    // Only compute with storage cores can have CBs and all compute with storage cores will have the same bank offset
-    const std::vector<uint32_t> &bank_ids = device->bank_ids_from_logical_core(*device->compute_cores_.begin());
-    std::optional<uint64_t> lowest_address = allocator::lowest_occupied_l1_address(*device->allocator_, bank_ids[0]);
+    std::optional<uint64_t> lowest_address = device->lowest_occupied_compute_l1_address();
     uint32_t max_l1_size = device->l1_size_per_core();
 
     for (const CircularBufferAllocator &cb_allocator : this->cb_allocators_) {
@@ -507,9 +508,19 @@ void Program::init_semaphores( const Device & device, const CoreCoord &logical_c
 
 void Program::add_semaphore(const CoreRangeSet & crs, uint32_t address, uint32_t init_value) {
     this->invalidate_compile();
+    this->semaphores_version_++;
     semaphores_.emplace_back(Semaphore( crs, address, init_value));
 }
 
+uint32_t Program::runtime_args_layout_version() const {
+    // Kernel versions only grow so their sum changes whenever any of them does
+    uint32_t version = 0;
+    for (const Kernel *kernel : kernels_) {
+        version += kernel->runtime_args_layout_version();
+    }
+    return version;
+}
+
 std::unordered_map<CoreType, std::vector<CoreCoord>> Program::logical_cores() const {
     std::unordered_map<CoreType, std::vector<CoreCoord>> cores_in_program;
     std::unordered_map<CoreType, std::set<CoreCoord>> unique_cores;
@@ -589,18 +600,45 @@ void Program::compile( Device * device )
             this->set_cb_data_fmt(device, kernel, build_options);
 
             auto kernel_hash = KernelCompileHash(kernel, build_options, device->id());
-            std::string kernel_path_suffix = kernel->name() + "/" + std::to_string(kernel_hash) + "/";
-            kernel->set_full_name(kernel_path_suffix);
-            build_options.set_name(kernel_path_suffix);
+            KernelBinaryCache &binary_cache = KernelBinaryCache::get(device->build_env());
+            std::string kernel_path_suffix = binary_cache.entry_suffix(kernel->name(), kernel_hash);
 
             bool cache_hit = true;
-            bool path_exists = std::filesystem::exists(build_options.path);
-            if ( enable_persistent_kernel_cache && path_exists ) {
-                if ( not detail::HashLookup::inst().exists(kernel_hash) ) detail::HashLookup::inst().add(kernel_hash);
-            } else if ( detail::HashLookup::inst().add(kernel_hash) ) {
-                cache_hit = false;
-                GenerateBinaries(device, build_options, kernel);
+            // Binaries are read from the version of the entry current when it was resolved, later publishes do not
+            // touch it
+            std::optional<std::string> version_suffix;
+            detail::HashLookup &hash_lookup = detail::HashLookup::inst();
+            if ( hash_lookup.add(kernel_hash) ) {
+                if (enable_persistent_kernel_cache) {
+                    version_suffix = binary_cache.lookup(kernel_path_suffix, kernel_hash);
+                }
+                if ( not version_suffix.has_value() ) {
+                    cache_hit = false;
+                    // Build somewhere private and publish with a rename, readers never see a partial build
+                    std::string staging_suffix = binary_cache.staging_suffix(kernel->name(), kernel_hash);
+                    kernel->set_full_name(staging_suffix);
+                    build_options.set_name(staging_suffix);
+                    try {
+                        GenerateBinaries(device, build_options, kernel);
+                        // Without the persistent cache a fresh build replaces whatever is on disk
+                        version_suffix = binary_cache.publish(staging_suffix, kernel_path_suffix, kernel_hash, not enable_persistent_kernel_cache);
+                    } catch (...) {
+                        binary_cache.discard(staging_suffix);
+                        hash_lookup.erase(kernel_hash);
+                        throw;
+                    }
+                }
+                hash_lookup.mark_generated(kernel_hash);
+            } else if ( not hash_lookup.wait_generated(kernel_hash) ) {
+                TT_THROW("Failed to generate binaries for {}", kernel->name());
+            } else {
+                version_suffix = binary_cache.lookup(kernel_path_suffix, kernel_hash);
+                TT_FATAL(version_suffix.has_value(), "Binaries generated for {} are missing from {}", kernel->name(), kernel_path_suffix);
             }
+            // The version directory stays internal, logs, the profiler and the watcher see the stable name of the entry
+            kernel->set_full_name(kernel_path_suffix);
+            kernel->set_binary_name(version_suffix.value());
+            build_options.set_name(version_suffix.value());
             if (detail::CompilationReporter::enabled()) {
                 detail::CompilationReporter::inst().add_kernel_compile_stats(*this, kernel, cache_hit, kernel_hash);
             }
@@ -627,9 +665,18 @@ void Program::compile( Device * device )
     if (detail::MemoryReporter::enabled()) {
         detail::MemoryReporter::inst().flush_program_memory_usage(*this, device);
     }
+    this->binaries_version_++;
     compile_needed_[device->id()] = false;
 }
 
+size_t Program::binaries_size_bytes(chip_id_t device_id) const {
+    size_t size_bytes = 0;
+    for (const Kernel *kernel : kernels_) {
+        size_bytes += kernel->binaries_size_bytes(device_id);
+    }
+    return size_bytes;
+}
+
 Program::~Program() {
     for (Kernel * kernel : kernels_) {
         delete kernel;
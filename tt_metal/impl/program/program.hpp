@@ -70,10 +70,19 @@ class Program {
 
     size_t num_kernels() const { return kernels_.size(); }
 
+    // Total size of compiled kernel binaries for device_id, 0 if the program has not been compiled for it
+    size_t binaries_size_bytes(chip_id_t device_id) const;
+
     const std::vector<std::shared_ptr<CircularBuffer>> &circular_buffers() const { return circular_buffers_; }
 
     const std::vector< Semaphore > & semaphores() const { return semaphores_; }
 
+    // Versions of the sections sent to device on dispatch, a cached dispatch map only rebuilds the sections whose version moved
+    uint32_t binaries_version() const { return binaries_version_; }
+    uint32_t circular_buffers_version() const { return circular_buffers_version_; }
+    uint32_t semaphores_version() const { return semaphores_version_; }
+    uint32_t runtime_args_layout_version() const;
+
     KernelGroup * kernels_on_core(const CoreCoord &core);
 
     std::vector<KernelGroup>& get_kernel_groups();
@@ -143,6 +152,10 @@ class Program {
 
     std::vector<Semaphore> semaphores_;
 
+    uint32_t binaries_version_;
+    uint32_t circular_buffers_version_;
+    uint32_t semaphores_version_;
+
     CoreRangeSet worker_crs_;
     std::unordered_map<chip_id_t, bool> compile_needed_;
     bool local_circular_buffer_allocation_needed_;
@@ -9,6 +9,7 @@
 #include "compute_kernel_api/pack.h"
 #include "compute_kernel_api/unpack.h"
 #include "compute_kernel_api/cb_api.h"
+#include "risc_common.h"
 
 #define FORCE_INLINE inline __attribute__((always_inline))
 
@@ -42,3 +43,33 @@ FORCE_INLINE T get_arg_val(int arg_idx) {
     static_assert("Error: only 4B args are supported" && sizeof(T) == 4);
     return *((volatile tt_l1_ptr T*)(get_arg_addr(arg_idx)));
 }
+
+/**
+ * Returns the address in L1 for a given common runtime argument index
+ *
+ * Return value: Associated L1 address of given common runtime argument index
+ *
+ * | Argument       | Description                                                             | Type     | Valid Range                                    | Required |
+ * |----------------|-------------------------------------------------------------------------|----------|------------------------------------------------|----------|
+ * | arg_idx        | Common runtime argument index                                           | uint32_t | 0 to 63                                        | True     |
+ */
+constexpr static uint32_t get_common_arg_addr(int arg_idx) {
+    // args are 4B in size
+    return L1_COMMON_ARG_BASE + (arg_idx << 2);
+}
+
+/**
+ * Returns the value at a given common runtime argument index, common runtime args are the same on all cores of the kernel
+ *
+ * Return value: The value associated with the common runtime argument index
+ *
+ * | Argument       | Description                                                             | Type     | Valid Range                                    | Required |
+ * |----------------|-------------------------------------------------------------------------|----------|------------------------------------------------|----------|
+ * | arg_idx        | Common runtime argument index                                           | uint32_t | 0 to 63                                        | True     |
+ */
+template <typename T>
+FORCE_INLINE T get_common_arg_val(int arg_idx) {
+    // only 4B args are supported (eg int32, uint32)
+    static_assert("Error: only 4B args are supported" && sizeof(T) == 4);
+    return *((volatile tt_l1_ptr T*)(get_common_arg_addr(arg_idx)));
+}
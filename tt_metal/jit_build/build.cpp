@@ -2,13 +2,29 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
 #include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <regex>
+#include <set>
+#include <sstream>
 #include <thread>
 #include <string>
+#include <unordered_map>
 
 #include "jit_build/build.hpp"
+#include "jit_build/digest.hpp"
 #include "jit_build/genfiles.hpp"
+#include "jit_build/job_server.hpp"
+#include "jit_build/kernel_binary_cache.hpp"
 #include "dev_mem_map.h"
 #include "hostdevcommon/common_runtime_address_map.h"
 #include "tools/profiler/profiler_state.hpp"
@@ -18,6 +34,48 @@ using namespace tt;
 
 namespace tt::tt_metal {
 
+// Size and mtime are enough to notice a rebuilt file without reading it
+static size_t file_stat_hash(const string& path) {
+    std::error_code ec;
+    auto size = fs::file_size(path, ec);
+    auto mtime = fs::last_write_time(path, ec);
+    size_t seed = std::hash<string>{}(path);
+    tt::utils::hash_combine(seed, ec ? size_t(0) : size_t(size));
+    tt::utils::hash_combine(seed, ec ? size_t(0) : size_t(mtime.time_since_epoch().count()));
+    return seed;
+}
+
+static size_t file_content_hash(const string& path)
+{
+    std::ifstream f(path, std::ios::binary);
+    std::stringstream contents;
+    contents << f.rdbuf();
+    return std::hash<string>{}(contents.str());
+}
+
+// Reading the toolchain takes a while, every device of a process shares it
+static string toolchain_digest(const vector<string>& tools)
+{
+    static std::mutex mutex;
+    static std::unordered_map<string, string> digests;
+
+    string key;
+    for (const string& tool : tools) {
+        key += tool + "\n";
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = digests.find(key);
+    if (it == digests.end()) {
+        Digest digest;
+        for (const string& tool : tools) {
+            digest.update_field(tool);
+            digest.update_file(tool);
+        }
+        it = digests.emplace(key, digest.hex()).first;
+    }
+    return it->second;
+}
+
 static std::string get_string_aliased_arch_lowercase(tt::ARCH arch) {
     switch (arch) {
         case tt::ARCH::GRAYSKULL: return "grayskull"; break;
@@ -42,11 +100,14 @@ void JitBuildEnv::init(uint32_t device_id, tt::ARCH arch)
 
     this->out_firmware_root_ = this->out_root_ + to_string(device_id) + "/firmware/";
     this->out_kernel_root_ = this->out_root_ + to_string(device_id) + "/kernels/";
+    this->out_object_cache_root_ = this->out_root_ + "objects/";
 
     // Tools
     this->gpp_ = this->root_ + "tt_metal/third_party/sfpi/compiler/bin/riscv32-unknown-elf-g++ ";
     this->objcopy_ = this->root_ + "tt_metal/third_party/sfpi/compiler/bin/riscv32-unknown-elf-objcopy ";
-    this->hex8tohex32_ = string("python3 ") + this->root_ + "tt_metal/hw/toolchain/hex8tohex32.py ";
+    this->toolchain_digest_ = toolchain_digest({
+        this->root_ + "tt_metal/third_party/sfpi/compiler/bin/riscv32-unknown-elf-g++",
+        this->root_ + "tt_metal/third_party/sfpi/compiler/bin/riscv32-unknown-elf-objcopy"});
 
     // Flags
     string common_flags;
@@ -121,6 +182,34 @@ void JitBuildEnv::init(uint32_t device_id, tt::ARCH arch)
     this->lflags_ += "-fno-exceptions -Wl,-z,max-page-size=16 -Wl,-z,common-page-size=16 -nostartfiles ";
 }
 
+void JitBuildEnv::init_firmware_root(const string& headers_path)
+{
+    // The sources are left out of the key, jit_build_firmware checks them against the build it finds
+    this->firmware_headers_root_ = headers_path;
+    size_t key = std::hash<string>{}(this->arch_name_);
+    tt::utils::hash_combine(key, std::hash<string>{}(this->toolchain_digest_));
+    tt::utils::hash_combine(key, std::hash<string>{}(this->cflags_ + this->defines_ + this->includes_ + this->lflags_));
+
+    // The headers hold the bank to noc mapping, harvested rows and dispatch cores of the device
+    vector<fs::path> headers;
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(this->firmware_headers_root_, ec);
+         !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (it->is_regular_file()) {
+            headers.push_back(it->path());
+        }
+    }
+    TT_FATAL(!ec && !headers.empty(), "No firmware headers generated in {}", this->firmware_headers_root_);
+    std::sort(headers.begin(), headers.end());
+    for (const fs::path& header : headers) {
+        tt::utils::hash_combine(key, std::hash<string>{}(fs::relative(header, this->firmware_headers_root_).string()));
+        tt::utils::hash_combine(key, file_content_hash(header.string()));
+    }
+
+    this->out_firmware_root_ = this->out_root_ + "firmware/" + to_string(key) + "/";
+}
+
 JitBuildState::JitBuildState(const JitBuildEnv& env, int which, bool is_fw) : env_(env), core_id_(which), is_fw_(is_fw)
 {
 }
@@ -155,7 +244,7 @@ void JitBuildState::finish_init()
 
     // Note the preceding slash which defies convention as this gets appended to
     // the kernel name used as a path which doesn't have a slash
-    this->target_full_path_ = "/" + this->target_name_ + "/" + this->target_name_ + ".hex";
+    this->target_full_path_ = "/" + this->target_name_ + "/" + this->target_name_ + ".elf";
 }
 
 JitBuildDataMovement::JitBuildDataMovement(const JitBuildEnv& env, int which, bool is_fw) : JitBuildState(env, which, is_fw)
@@ -355,16 +444,88 @@ static void build_failure(const string& target_name,
                           const string& log_file)
 {
     log_info(tt::LogBuildKernels, "{} {} failure -- cmd: {}", target_name, op, cmd);
-    string cat = "cat " + log_file;
-    if (fs::exists(log_file)) {
-        // XXXX PGK(TODO) not portable
-        if (system(cat.c_str())) {
-            TT_THROW("Failed system comand {}", cat);
-        }
+    std::ifstream log(log_file);
+    if (log.is_open()) {
+        cout << log.rdbuf() << std::flush;
     }
     TT_THROW("{} build failed", target_name);
 }
 
+static void run_build_step(const string& target_name,
+                           const string& op,
+                           const string& cmd,
+                           const string& out_dir,
+                           const string& log_file)
+{
+    log_debug(tt::LogBuildKernels, "    {} cmd: {}", op, cmd);
+    if (!JitBuildJobServer::get().run(split_command_line(cmd), out_dir, log_file)) {
+        build_failure(target_name, op, cmd, log_file);
+    }
+}
+
+// Extension gcc compiles as the preprocessed form of src, without running the preprocessor again
+static string preprocessed_extension(const string& src)
+{
+    string extension = fs::path(src).extension().string();
+    if (extension == ".S") {
+        return ".s";
+    }
+    return extension == ".c" ? ".i" : ".ii";
+}
+
+vector<string> jit_build_get_linker_scripts(const string& lflags)
+{
+    vector<string> search_dirs;
+    vector<string> pending;
+    std::istringstream flags(lflags);
+    string flag;
+    while (flags >> flag) {
+        if (flag.rfind("-L", 0) == 0) {
+            search_dirs.push_back(flag.substr(2));
+        } else if (flag.rfind("-T", 0) == 0) {
+            pending.push_back(flag.substr(2));
+        }
+    }
+
+    static const std::regex include_regex("(^|[\\s;{}])INCLUDE\\s+\"?([^\"\\s;]+)\"?");
+    vector<string> scripts;
+    std::set<string> seen;
+    while (!pending.empty()) {
+        std::error_code ec;
+        string script = fs::weakly_canonical(pending.back(), ec).string();
+        pending.pop_back();
+        if (ec || !seen.insert(script).second) {
+            continue;
+        }
+        std::ifstream f(script);
+        if (!f.is_open()) {
+            continue;
+        }
+        scripts.push_back(script);
+
+        std::stringstream contents;
+        contents << f.rdbuf();
+        string text = contents.str();
+        for (auto it = std::sregex_iterator(text.begin(), text.end(), include_regex); it != std::sregex_iterator(); ++it) {
+            string name = (*it)[2].str();
+            vector<string> candidates = {fs::path(script).parent_path() / name};
+            for (const string& dir : search_dirs) {
+                candidates.push_back(fs::path(dir) / name);
+            }
+            if (fs::path(name).is_absolute()) {
+                candidates = {name};
+            }
+            for (const string& candidate : candidates) {
+                if (fs::is_regular_file(candidate, ec)) {
+                    pending.push_back(candidate);
+                    break;
+                }
+            }
+        }
+    }
+    return scripts;
+}
+
 void JitBuildState::pre_compile(const string& kernel_in_path, const string& op_out_path) const
 {
 }
@@ -389,11 +550,11 @@ void JitBuildEthernet::pre_compile(const string& kernel_in_path, const string& o
 }
 
 
-void JitBuildState::compile_one(const string& log_file,
-                                const string& out_dir,
-                                const JitBuildSettings *settings,
-                                const string& src,
-                                const string& obj) const
+string JitBuildState::compile_one(const string& log_file,
+                                  const string& out_dir,
+                                  const JitBuildSettings *settings,
+                                  const string& src,
+                                  const string& obj) const
 {
     fs::create_directories(out_dir);
 
@@ -411,33 +572,70 @@ void JitBuildState::compile_one(const string& log_file,
         });
     }
 
+    // Preprocessing is a small part of a compile. Kernels whose hash differs (other defines, compile time args,
+    // kernel name) often still preprocess to the same source, the object built from that source is reused
+    string preprocessed = obj + preprocessed_extension(src);
     string cmd;
-    cmd = "cd " + out_dir + " && ";
-    cmd += env_.gpp_;
+    cmd = env_.gpp_;
     cmd += this->cflags_;
     cmd += defines;
     cmd += this->includes_;
-    cmd += "-c -o " + obj + " " + src;
-
-    log_debug(tt::LogBuildKernels, "    g++ compile cmd: {}", cmd);
-    if (!tt::utils::run_command(cmd, log_file, false)) {
-        build_failure(this->target_name_, "compiile", cmd, log_file);
+    if (this->is_fw_) {
+        // Lets jit_build_firmware tell whether a later run can reuse this build
+        cmd += "-MD -MF " + obj + ".d ";
+    }
+    cmd += "-E -o " + preprocessed + " " + src;
+    run_build_step(this->target_name_, "preprocess", cmd, out_dir, log_file);
+
+    Digest digest;
+    digest.update_field("object");
+    digest.update_field(env_.toolchain_digest_);
+    digest.update_field(this->cflags_);
+    TT_FATAL(digest.update_file(out_dir + preprocessed), "Failed to read preprocessed {}", out_dir + preprocessed);
+    string key = digest.hex();
+
+    JitObjectCache& cache = JitObjectCache::get(env_.out_object_cache_root_);
+    if (!cache.fetch(key + ".o", out_dir + obj)) {
+        // Compile the preprocessed source rather than preprocessing again. Diagnostics of a failed compile are
+        // reported against the original source, which also covers warnings that only fire on preprocessed input
+        cmd = env_.gpp_;
+        cmd += this->cflags_;
+        if (preprocessed_extension(src) != ".s") {
+            cmd += "-fpreprocessed ";
+        }
+        cmd += "-c -o " + obj + " " + preprocessed;
+        log_debug(tt::LogBuildKernels, "    compile cmd: {}", cmd);
+        if (!JitBuildJobServer::get().run(split_command_line(cmd), out_dir, log_file)) {
+            cmd = env_.gpp_;
+            cmd += this->cflags_;
+            cmd += defines;
+            cmd += this->includes_;
+            cmd += "-c -o " + obj + " " + src;
+            run_build_step(this->target_name_, "compile", cmd, out_dir, log_file);
+        }
+        cache.publish(out_dir + obj, key + ".o");
     }
+    std::remove((out_dir + preprocessed).c_str());
+
+    return key;
 }
 
-void JitBuildState::compile(const string& log_file, const string& out_dir, const JitBuildSettings *settings) const
+vector<string> JitBuildState::compile(const string& log_file, const string& out_dir, const JitBuildSettings *settings) const
 {
     // Compile each of the srcs to an obj in parallel
     std::vector<std::thread> threads;
-    threads.resize(this->srcs_.size());;
+    vector<string> keys(this->srcs_.size());
+    threads.resize(this->srcs_.size());
     for (int i = 0; i < this->srcs_.size(); i++) {
-        threads[i] = thread(&JitBuildState::compile_one, &*this,
-                            ref(log_file), ref(out_dir), settings, ref(this->srcs_[i]), ref(this->objs_[i]));
+        threads[i] = thread([&, i] {
+            keys[i] = this->compile_one(log_file, out_dir, settings, this->srcs_[i], this->objs_[i]);
+        });
     }
 
     for (auto& th: threads) {
         th.join();
     }
+    return keys;
 }
 
 void JitBuildState::link(const string& log_file, const string& out_dir) const
@@ -448,8 +646,7 @@ void JitBuildState::link(const string& log_file, const string& out_dir) const
     }
 
     string cmd;
-    cmd = "cd " + out_dir + " && ";
-    cmd += env_.gpp_;
+    cmd = env_.gpp_;
     cmd += this->lflags_;
     cmd += this->link_objs_;
 
@@ -459,35 +656,7 @@ void JitBuildState::link(const string& log_file, const string& out_dir) const
     }
 
     cmd += "-o " + out_dir + this->target_name_ + ".elf";
-    log_debug(tt::LogBuildKernels, "    g++ link cmd: {}", cmd);
-    if (!tt::utils::run_command(cmd, log_file, false)) {
-        build_failure(this->target_name_, "link", cmd, log_file);
-    }
-}
-
-void JitBuildState::elf_to_hex8(const string& log_file, const string& out_dir) const
-{
-    string cmd;
-    cmd = "cd " + out_dir + " && ";
-    cmd += env_.objcopy_;
-    cmd += " -O verilog " + this->target_name_ + ".elf" + " " + this->target_name_ + ".hex.tmp";
-
-    log_debug(tt::LogBuildKernels, "    objcopy cmd: {}", cmd);
-    if (!tt::utils::run_command(cmd, log_file, false)) {
-        build_failure(this->target_name_, "objcopy", cmd, log_file);
-    }
-}
-
-void JitBuildState::hex8_to_hex32(const string& log_file, const string& out_dir) const
-{
-    string cmd;
-    cmd = "cd " + out_dir + " && ";
-    cmd += env_.hex8tohex32_ + this->target_name_ + ".hex.tmp " + this->target_name_ + ".hex";
-
-    log_debug(tt::LogBuildKernels, "    hex8tohex32 cmd: {}", cmd);
-    if (!tt::utils::run_command(cmd, log_file, false)) {
-        build_failure(this->target_name_, "hex8tohex32.py", cmd, log_file);
-    }
+    run_build_step(this->target_name_, "link", cmd, out_dir, log_file);
 }
 
 // Given this elf (A) and a later elf (B):
@@ -497,15 +666,10 @@ void JitBuildState::hex8_to_hex32(const string& log_file, const string& out_dir)
 void JitBuildState::weaken(const string& log_file, const string& out_dir) const
 {
     string cmd;
-    cmd = "cd " + out_dir + " && ";
-    cmd += env_.objcopy_;
+    cmd = env_.objcopy_;
     cmd += " --wildcard --weaken-symbol \"*\" --weaken-symbol \"!__fw_export_*\" " +
         this->target_name_ + ".elf " + this->target_name_ + "_weakened.elf";
-
-    log_debug(tt::LogBuildKernels, "    objcopy cmd: {}", cmd);
-    if (!tt::utils::run_command(cmd, log_file, false)) {
-        build_failure(this->target_name_, "objcopy weaken", cmd, log_file);
-    }
+    run_build_step(this->target_name_, "objcopy weaken", cmd, out_dir, log_file);
 }
 
 void JitBuildState::build(const JitBuildSettings *settings) const
@@ -519,15 +683,135 @@ void JitBuildState::build(const JitBuildSettings *settings) const
         std::remove(log_file.c_str());
     }
 
-    compile(log_file, out_dir, settings);
-    link(log_file, out_dir);
-    elf_to_hex8(log_file, out_dir);
-    hex8_to_hex32(log_file, out_dir);
+    vector<string> object_keys = compile(log_file, out_dir, settings);
+
+    // Linking runs the LTO code generation, it is skipped when the same objects were already linked with the same
+    // flags and linker scripts against the same firmware
+    Digest digest;
+    digest.update_field("link");
+    for (const string& object_key : object_keys) {
+        digest.update_field(object_key);
+    }
+    digest.update_field(this->lflags_ + this->link_objs_);
+    for (const string& script : jit_build_get_linker_scripts(this->lflags_)) {
+        digest.update_field(script);
+        digest.update_file(script);
+    }
+    if (!this->is_fw_) {
+        digest.update_file(env_.out_firmware_root_ + this->target_name_ + "/" + this->target_name_ + "_weakened.elf");
+    }
+    string cached_elf = digest.hex() + ".elf";
+    string elf_name = out_dir + this->target_name_ + ".elf";
+    JitObjectCache& cache = JitObjectCache::get(env_.out_object_cache_root_);
+    bool cached = !tt::llrt::OptionsG.get_build_map_enabled() && cache.fetch(cached_elf, elf_name);
+    if (!cached) {
+        link(log_file, out_dir);
+        cache.publish(elf_name, cached_elf);
+    }
     if (this->is_fw_) {
         weaken(log_file, out_dir);
     }
 }
 
+vector<string> JitBuildState::get_firmware_build_files() const
+{
+    TT_ASSERT(this->is_fw_, "Dependency files are only written for firmware builds");
+    string out_dir = this->out_path_ + this->target_name_ + "/";
+    vector<string> files = {
+        out_dir + this->target_name_ + ".elf",
+        out_dir + this->target_name_ + "_weakened.elf",
+    };
+
+    for (const string& obj : this->objs_) {
+        std::ifstream deps(out_dir + obj + ".d");
+        if (!deps.is_open()) {
+            return {};
+        }
+        // "<obj>: <src> <header> \", relative paths are relative to the build directory
+        string token;
+        while (deps >> token) {
+            if (token == "\\" || token.back() == ':') {
+                continue;
+            }
+            files.push_back(fs::path(token).is_absolute() ? token : out_dir + token);
+        }
+    }
+
+    for (const string& script : jit_build_get_linker_scripts(this->lflags_)) {
+        files.push_back(script);
+    }
+    return files;
+}
+
+// Serializes firmware builds into one root across threads and processes, flock locks taken through separate opens
+// exclude each other within a process too
+class FirmwareRootLock {
+  public:
+    explicit FirmwareRootLock(const string& path) {
+        this->fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        TT_FATAL(this->fd_ >= 0, "Failed to open firmware lock {}", path);
+        while (flock(this->fd_, LOCK_EX) != 0) {
+            TT_FATAL(errno == EINTR, "Failed to lock {}", path);
+        }
+    }
+    ~FirmwareRootLock() { close(this->fd_); }
+
+  private:
+    int fd_;
+};
+
+// One line per file a firmware build read or wrote with its size and mtime, empty if any build lacks dependencies
+static string firmware_stamp(const JitBuildStateSet& builds)
+{
+    std::stringstream stamp;
+    for (const auto& build : builds) {
+        vector<string> files = build->get_firmware_build_files();
+        if (files.empty()) {
+            return "";
+        }
+        for (const string& file : files) {
+            stamp << file << " " << file_stat_hash(file) << "\n";
+        }
+    }
+    return stamp.str();
+}
+
+void jit_build_firmware(const JitBuildEnv& env, const JitBuildStateSet& builds)
+{
+    ZoneScoped;
+
+    const string& root = env.out_firmware_root_;
+    fs::create_directories(root);
+    FirmwareRootLock lock(root + ".lock");
+
+    // Another device or an earlier run built this firmware, reuse it unless a source changed since
+    string stamp_name = root + "firmware.stamp";
+    if (!tt::llrt::OptionsG.get_build_map_enabled()) {
+        std::ifstream f(stamp_name);
+        if (f.is_open()) {
+            std::stringstream recorded;
+            recorded << f.rdbuf();
+            string current = firmware_stamp(builds);
+            if (!current.empty() && recorded.str() == current) {
+                log_debug(tt::LogBuildKernels, "Reusing firmware built in {}", root);
+                return;
+            }
+        }
+    }
+
+    std::remove(stamp_name.c_str());
+    fs::copy(env.firmware_headers_root_, root, fs::copy_options::recursive | fs::copy_options::overwrite_existing);
+    jit_build_set(builds, nullptr, "");
+
+    // Write then rename so a reader never sees a truncated stamp
+    string tmp_stamp_name = stamp_name + ".tmp";
+    {
+        std::ofstream f(tmp_stamp_name, std::ios::trunc);
+        f << firmware_stamp(builds);
+    }
+    fs::rename(tmp_stamp_name, stamp_name);
+}
+
 void jit_build(const JitBuildState& build,
                const JitBuildSettings *settings,
                const string& kernel_in_path)
@@ -19,6 +19,11 @@
 namespace tt::tt_metal {
 
 class JitBuildSettings;
+class JitBuildState;
+
+// Set of build states
+// Used for parallel builds, builds all members in one call
+typedef vector<std::shared_ptr<JitBuildState>> JitBuildStateSet;
 
 enum class JitBuildProcessorType {
     DATA_MOVEMENT,
@@ -34,16 +39,23 @@ class JitBuildEnv {
     friend class JitBuildDataMovement;
     friend class JitBuildCompute;
     friend class JitBuildEthernet;
+    friend class KernelBinaryCache;
+    friend void jit_build_firmware(const JitBuildEnv& env, const JitBuildStateSet& builds);
 
   public:
     JitBuildEnv();
     void init(uint32_t device_id, tt::ARCH arch);
+    // Moves the firmware output from the device directory to a root shared by every device and process generating
+    // the same headers, found in headers_path, with the same options and toolchain. Call before creating the build
+    // states
+    void init_firmware_root(const string& headers_path);
 
     tt::ARCH get_arch() const { return arch_; }
     const string& get_root_path() const { return root_; }
     const string& get_out_root_path() const { return out_root_; }
     const string& get_out_firmware_root_path() const { return out_firmware_root_; }
     const string& get_out_kernel_root_path() const { return out_kernel_root_; }
+    const string& get_firmware_headers_path() const { return firmware_headers_root_; }
 
   private:
     tt::ARCH arch_;
@@ -54,12 +66,17 @@ class JitBuildEnv {
     string root_;
     string out_root_;
     string out_firmware_root_;
+    // Generated firmware headers of this device, copied into out_firmware_root_ when the firmware is built there
+    string firmware_headers_root_;
     string out_kernel_root_;
+    // Objects and linked binaries keyed by the digest of their inputs, shared by all devices, see JitObjectCache
+    string out_object_cache_root_;
 
     // Tools
     string gpp_;
     string objcopy_;
-    string hex8tohex32_;
+    // Digest of the compiler and objcopy binaries, a toolchain upgrade invalidates the object cache
+    string toolchain_digest_;
 
     // Compilation options
     string cflags_;
@@ -92,11 +109,11 @@ class JitBuildState {
 
     string link_objs_;
 
-    void compile(const string& log_file, const string& out_path, const JitBuildSettings *settings) const;
-    void compile_one(const string& log_file, const string& out_path, const JitBuildSettings *settings, const string& src, const string &obj) const;
+    // Compile steps return the object cache keys of the objects, digests of the toolchain, flags and preprocessed
+    // sources they were built from
+    vector<string> compile(const string& log_file, const string& out_path, const JitBuildSettings *settings) const;
+    string compile_one(const string& log_file, const string& out_path, const JitBuildSettings *settings, const string& src, const string &obj) const;
     void link(const string& log_file, const string& out_path) const;
-    void elf_to_hex8(const string& log_file, const string& out_path) const;
-    void hex8_to_hex32(const string& log_file, const string& out_path) const;
     void weaken(const string& log_file, const string& out_path) const;
     void copy_kernel( const string& kernel_in_path, const string& op_out_path) const;
 
@@ -107,15 +124,15 @@ class JitBuildState {
     virtual void pre_compile(const string& kernel_in_path, const string& op_out_path) const;
     void build(const JitBuildSettings *settings) const;
 
+    // Files the last firmware build read and wrote: sources and headers from the dependency files written while
+    // preprocessing, linker scripts and the linked elfs. Empty if a dependency file is missing
+    vector<string> get_firmware_build_files() const;
+
     const string& get_out_path() const { return this->out_path_; };
     const string& get_target_name() const { return this->target_name_; };
     const string get_target_out_path(const string& kernel_name) const { return this->out_path_ + kernel_name + target_full_path_; }
 };
 
-// Set of build states
-// Used for parallel builds, builds all members in one call
-typedef vector<std::shared_ptr<JitBuildState>> JitBuildStateSet;
-
 // Exracts a slice of builds from a JitBuildState
 // Used for parallel building a subset of the builds in a JitBuildStateSet
 struct JitBuildStateSubset {
@@ -159,6 +176,13 @@ class JitBuildSettings {
 void jit_build(const JitBuildState& build, const JitBuildSettings *settings, const string& kernel_in_path);
 void jit_build_set(const JitBuildStateSet& builds, const JitBuildSettings *settings, const string& kernel_in_path);
 void jit_build_subset(const JitBuildStateSubset& builds, const JitBuildSettings *settings, const string& kernel_in_path);
+// Builds firmware into env's firmware root unless the build already there is up to date with its sources, one
+// builder per root at a time across threads and processes. Devices sharing the root reuse the build
+void jit_build_firmware(const JitBuildEnv& env, const JitBuildStateSet& builds);
+
+// The -T linker scripts of lflags and the scripts they INCLUDE, resolved against the including script's directory
+// and the -L directories like ld does. Scripts that can't be found are left out, the link reports them
+vector<string> jit_build_get_linker_scripts(const string& lflags);
 
 inline const string jit_build_get_kernel_compile_outpath(int device_id) {
     // TODO(pgk), get rid of this
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "jit_build/digest.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace tt::tt_metal {
+
+namespace {
+
+constexpr uint32_t ROUND_CONSTANTS[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+inline uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+}  // namespace
+
+Digest::Digest() :
+    state_{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19} {}
+
+void Digest::compress(const uint8_t* block) {
+    uint32_t w[64];
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t(block[4 * i]) << 24) | (uint32_t(block[4 * i + 1]) << 16) |
+               (uint32_t(block[4 * i + 2]) << 8) | uint32_t(block[4 * i + 3]);
+    }
+    for (int i = 16; i < 64; i++) {
+        uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = this->state_[0], b = this->state_[1], c = this->state_[2], d = this->state_[3];
+    uint32_t e = this->state_[4], f = this->state_[5], g = this->state_[6], h = this->state_[7];
+    for (int i = 0; i < 64; i++) {
+        uint32_t t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + ROUND_CONSTANTS[i] + w[i];
+        uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+    this->state_[0] += a;
+    this->state_[1] += b;
+    this->state_[2] += c;
+    this->state_[3] += d;
+    this->state_[4] += e;
+    this->state_[5] += f;
+    this->state_[6] += g;
+    this->state_[7] += h;
+}
+
+Digest& Digest::update(const void* data, size_t size) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    this->total_size_ += size;
+    if (this->block_size_ != 0) {
+        size_t n = std::min(size, sizeof(this->block_) - this->block_size_);
+        std::memcpy(this->block_ + this->block_size_, bytes, n);
+        this->block_size_ += n;
+        bytes += n;
+        size -= n;
+        if (this->block_size_ < sizeof(this->block_)) {
+            return *this;
+        }
+        this->compress(this->block_);
+        this->block_size_ = 0;
+    }
+    for (; size >= sizeof(this->block_); bytes += sizeof(this->block_), size -= sizeof(this->block_)) {
+        this->compress(bytes);
+    }
+    std::memcpy(this->block_, bytes, size);
+    this->block_size_ = size;
+    return *this;
+}
+
+Digest& Digest::update_field(std::string_view data) {
+    uint64_t size = data.size();
+    return this->update(&size, sizeof(size)).update(data);
+}
+
+bool Digest::update_file(const std::string& path) {
+    std::ifstream f(path, std::ios::binary);
+    if (not f.is_open()) {
+        return false;
+    }
+    f.seekg(0, std::ios::end);
+    uint64_t size = f.tellg();
+    f.seekg(0, std::ios::beg);
+    this->update(&size, sizeof(size));
+
+    char buffer[64 * 1024];
+    while (f.read(buffer, sizeof(buffer)) or f.gcount() > 0) {
+        this->update(buffer, f.gcount());
+    }
+    return not f.bad();
+}
+
+std::string Digest::hex() {
+    uint64_t bit_size = this->total_size_ * 8;
+    uint8_t padding[72] = {0x80};
+    size_t padding_size = (this->block_size_ < 56 ? 56 : 120) - this->block_size_;
+    for (int i = 0; i < 8; i++) {
+        padding[padding_size + i] = uint8_t(bit_size >> (56 - 8 * i));
+    }
+    this->update(padding, padding_size + 8);
+
+    static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(64);
+    for (uint32_t word : this->state_) {
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            hex += HEX_DIGITS[(word >> shift) & 0xf];
+        }
+    }
+    return hex;
+}
+
+std::string file_digest(const std::string& path) {
+    Digest digest;
+    return digest.update_file(path) ? digest.hex() : "";
+}
+
+}  // namespace tt::tt_metal
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace tt::tt_metal {
+
+// SHA-256 of the inputs of a build step. Unlike std::hash it is the same in every process, library version and
+// platform and does not collide in practice, so it can name cache entries shared on disk
+class Digest {
+  public:
+    Digest();
+
+    Digest& update(const void* data, size_t size);
+    Digest& update(std::string_view data) { return this->update(data.data(), data.size()); }
+    // Prefixes the size, so consecutive fields can't be shifted into each other
+    Digest& update_field(std::string_view data);
+    // Hashes the size and contents of a file, false if it can't be read
+    bool update_file(const std::string& path);
+
+    // Lowercase hex, the digest can't be updated afterwards
+    std::string hex();
+
+  private:
+    void compress(const uint8_t* block);
+
+    uint32_t state_[8];
+    uint8_t block_[64];
+    size_t block_size_ = 0;
+    uint64_t total_size_ = 0;
+};
+
+// Digest of the contents of a file, empty if it can't be read
+std::string file_digest(const std::string& path);
+
+}  // namespace tt::tt_metal
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "jit_build/job_server.hpp"
+
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#include "common/assert.hpp"
+#include "llrt/rtoptions.hpp"
+#include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
+
+extern char **environ;
+
+namespace tt::tt_metal {
+
+namespace {
+
+// Destroys the file actions on every exit path
+struct SpawnFileActions {
+    posix_spawn_file_actions_t actions;
+    SpawnFileActions() { posix_spawn_file_actions_init(&this->actions); }
+    ~SpawnFileActions() { posix_spawn_file_actions_destroy(&this->actions); }
+};
+
+}  // namespace
+
+JitBuildJobServer& JitBuildJobServer::get() {
+    static JitBuildJobServer server(
+        llrt::OptionsG.get_build_jobs() != 0 ? llrt::OptionsG.get_build_jobs()
+                                             : std::max(1u, std::thread::hardware_concurrency()));
+    return server;
+}
+
+JitBuildJobServer::JitBuildJobServer(uint32_t num_slots) : num_slots_(num_slots), free_slots_(num_slots) {}
+
+void JitBuildJobServer::acquire_slot() {
+    std::unique_lock<std::mutex> lock(this->mutex_);
+    this->slot_freed_.wait(lock, [this] { return this->free_slots_ > 0; });
+    this->free_slots_--;
+}
+
+void JitBuildJobServer::release_slot() {
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->free_slots_++;
+    }
+    this->slot_freed_.notify_one();
+}
+
+bool JitBuildJobServer::run(const std::vector<std::string>& args, const std::string& cwd, const std::string& log_file) {
+    ZoneScoped;
+    TT_ASSERT(not args.empty());
+    ZoneText(args[0].c_str(), args[0].length());
+
+    std::vector<char*> argv;
+    argv.reserve(args.size() + 1);
+    for (const auto& arg : args) {
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    SpawnFileActions file_actions;
+    if (not cwd.empty()) {
+        posix_spawn_file_actions_addchdir_np(&file_actions.actions, cwd.c_str());
+    }
+    if (getenv("TT_METAL_BACKEND_DUMP_RUN_CMD")) {
+        static std::mutex io_mutex;
+        std::lock_guard<std::mutex> lk(io_mutex);
+        std::cout << "===== RUNNING SYSTEM COMMAND:" << std::endl;
+        for (const auto& arg : args) {
+            std::cout << arg << " ";
+        }
+        std::cout << std::endl << std::endl;
+    } else {
+        posix_spawn_file_actions_addopen(
+            &file_actions.actions, STDOUT_FILENO, log_file.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0666);
+        posix_spawn_file_actions_adddup2(&file_actions.actions, STDOUT_FILENO, STDERR_FILENO);
+    }
+
+    this->acquire_slot();
+    pid_t pid;
+    int spawn_error = posix_spawnp(&pid, argv[0], &file_actions.actions, nullptr, argv.data(), environ);
+    int status = 0;
+    if (spawn_error == 0) {
+        while (waitpid(pid, &status, 0) < 0 and errno == EINTR) {
+        }
+    }
+    this->release_slot();
+
+    if (spawn_error != 0) {
+        log_error(tt::LogBuildKernels, "Failed to launch {}: {}", args[0], std::strerror(spawn_error));
+        return false;
+    }
+    return WIFEXITED(status) and WEXITSTATUS(status) == 0;
+}
+
+std::vector<std::string> split_command_line(const std::string& cmd) {
+    std::vector<std::string> args;
+    std::string arg;
+    bool in_arg = false;
+    for (size_t i = 0; i < cmd.size(); i++) {
+        char c = cmd[i];
+        if (c == ' ' or c == '\t' or c == '\n') {
+            if (in_arg) {
+                args.push_back(std::move(arg));
+                arg.clear();
+                in_arg = false;
+            }
+            continue;
+        }
+        in_arg = true;
+        if (c == '\'') {
+            size_t end = cmd.find('\'', i + 1);
+            TT_FATAL(end != std::string::npos, "Unterminated quote in build command: {}", cmd);
+            arg.append(cmd, i + 1, end - i - 1);
+            i = end;
+        } else if (c == '"') {
+            for (i++; i < cmd.size() and cmd[i] != '"'; i++) {
+                // Within double quotes a backslash only escapes characters the shell treats specially
+                if (cmd[i] == '\\' and i + 1 < cmd.size() and std::strchr("\"\\$`", cmd[i + 1]) != nullptr) {
+                    i++;
+                }
+                arg.push_back(cmd[i]);
+            }
+            TT_FATAL(i < cmd.size(), "Unterminated quote in build command: {}", cmd);
+        } else if (c == '\\' and i + 1 < cmd.size()) {
+            arg.push_back(cmd[++i]);
+        } else {
+            arg.push_back(c);
+        }
+    }
+    if (in_arg) {
+        args.push_back(std::move(arg));
+    }
+    return args;
+}
+
+}  // namespace tt::tt_metal
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tt::tt_metal {
+
+// Runs the toolchain processes of every JIT build in the process
+//
+// Processes are launched directly with posix_spawn rather than through system(), which costs a /bin/sh per step.
+// Builds of different kernels and RISCs run on their own threads, the server bounds how many toolchain processes
+// run at once across all of them with a pool of job slots, sized by TT_METAL_BUILD_JOBS (default one per hardware
+// thread).
+class JitBuildJobServer {
+  public:
+    static JitBuildJobServer& get();
+
+    // Runs args[0], looked up in PATH, from working directory cwd and appends its stdout and stderr to log_file.
+    // Blocks until a job slot is free, returns true if the process exited with status 0
+    bool run(const std::vector<std::string>& args, const std::string& cwd, const std::string& log_file);
+
+    uint32_t num_slots() const { return this->num_slots_; }
+
+  private:
+    explicit JitBuildJobServer(uint32_t num_slots);
+
+    void acquire_slot();
+    void release_slot();
+
+    const uint32_t num_slots_;
+    std::mutex mutex_;
+    std::condition_variable slot_freed_;
+    uint32_t free_slots_;
+};
+
+// Splits a command line into arguments the way /bin/sh would for the commands the build generates: whitespace
+// separates arguments, single quotes are literal, double quotes and backslashes escape
+std::vector<std::string> split_command_line(const std::string& cmd);
+
+}  // namespace tt::tt_metal
@@ -0,0 +1,527 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "jit_build/kernel_binary_cache.hpp"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "jit_build/digest.hpp"
+
+namespace fs = std::filesystem;
+
+namespace tt::tt_metal {
+
+namespace {
+
+// Bump when the entry layout or manifest format changes
+constexpr size_t CACHE_VERSION = 3;
+constexpr const char* MANIFEST_NAME = "manifest";
+// Symlink in an entry to its current version directory
+constexpr const char* CURRENT_NAME = "current";
+constexpr const char* VERSION_TAG = "v-";
+constexpr const char* LOCK_NAME = ".cache.lock";
+constexpr const char* STAGING_TAG = ".staging-";
+constexpr const char* TRASH_TAG = ".trash-";
+// Entries used this recently may be about to be loaded by another process, eviction leaves them alone
+constexpr auto EVICTION_GRACE_PERIOD = std::chrono::seconds(60);
+
+std::atomic<uint64_t> unique_counter = 0;
+
+std::string unique_tag() {
+    return std::to_string(getpid()) + "-" + std::to_string(unique_counter.fetch_add(1));
+}
+
+// Entry suffixes end in '/', rename wants the directory itself
+fs::path dir_path(const std::string& path) { return fs::path(path).parent_path(); }
+
+uint64_t directory_bytes(const fs::path& dir) {
+    uint64_t bytes = 0;
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(dir, ec); !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (it->is_regular_file(ec)) {
+            bytes += it->file_size(ec);
+        }
+    }
+    return bytes;
+}
+
+// Renaming first takes the directory out of view atomically, the slow recursive delete happens afterwards
+void remove_directory(const fs::path& dir) {
+    std::error_code ec;
+    fs::path trash = dir.string() + TRASH_TAG + unique_tag();
+    fs::rename(dir, trash, ec);
+    fs::remove_all(ec ? dir : trash, ec);
+}
+
+// Name of the version the entry's current symlink points to, empty if there is none
+std::string read_current_version(const fs::path& entry_dir) {
+    std::error_code ec;
+    auto version = fs::read_symlink(entry_dir / CURRENT_NAME, ec);
+    return ec ? "" : version.filename().string();
+}
+
+// Cross process lock on the cache root, released when the object goes out of scope
+class FileLock {
+  public:
+    explicit FileLock(const std::string& path) {
+        this->fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        this->locked_ = this->fd_ >= 0 and flock(this->fd_, LOCK_EX | LOCK_NB) == 0;
+    }
+    ~FileLock() {
+        if (this->fd_ >= 0) {
+            close(this->fd_);
+        }
+    }
+    bool locked() const { return this->locked_; }
+
+  private:
+    int fd_ = -1;
+    bool locked_ = false;
+};
+
+struct CacheEntry {
+    fs::path path;
+    fs::file_time_type last_used;
+    uint64_t bytes;
+};
+
+// Evicts least recently used entries outside the grace period down to a low watermark under max_bytes, so the next
+// few publishes do not rescan the whole cache. Returns the bytes left
+uint64_t evict_least_recently_used(
+    std::vector<CacheEntry>& entries,
+    uint64_t total_bytes,
+    uint64_t max_bytes,
+    fs::file_time_type grace_cutoff,
+    const std::function<void(const fs::path&)>& remove) {
+    if (total_bytes <= max_bytes) {
+        return total_bytes;
+    }
+    uint64_t target_bytes = max_bytes - max_bytes / 10;
+    std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) {
+        return a.last_used < b.last_used;
+    });
+    for (const auto& entry : entries) {
+        if (total_bytes <= target_bytes or entry.last_used >= grace_cutoff) {
+            break;
+        }
+        log_debug(tt::LogBuildKernels, "Evicting {} from the build cache", entry.path.string());
+        remove(entry.path);
+        total_bytes -= entry.bytes;
+    }
+    return total_bytes;
+}
+
+}  // namespace
+
+KernelBinaryCache& KernelBinaryCache::get(const JitBuildEnv& env) {
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::unique_ptr<KernelBinaryCache>> registry;
+
+    // Devices can be reopened with different options or firmware within a process, so both are part of the key
+    std::string key = env.out_kernel_root_ + "\n" + env.out_firmware_root_ + "\n" + env.cflags_ + env.defines_ +
+                      env.includes_ + env.lflags_;
+    std::unique_lock<std::mutex> lock(registry_mutex);
+    auto& cache = registry[key];
+    if (cache == nullptr) {
+        cache.reset(new KernelBinaryCache(env));
+    }
+    return *cache;
+}
+
+KernelBinaryCache::KernelBinaryCache(const JitBuildEnv& env) :
+    root_(env.out_kernel_root_),
+    firmware_root_(env.out_firmware_root_),
+    toolchain_(env.gpp_ + "\n" + env.objcopy_),
+    toolchain_digest_(env.toolchain_digest_),
+    flags_(env.cflags_ + "\n" + env.defines_ + "\n" + env.includes_ + "\n" + env.lflags_),
+    max_bytes_(llrt::OptionsG.get_kernel_cache_max_bytes()) {}
+
+const std::string& KernelBinaryCache::fingerprint() {
+    std::call_once(this->fingerprint_once_, [this] { this->fingerprint_ = this->compute_fingerprint(); });
+    return this->fingerprint_;
+}
+
+std::string KernelBinaryCache::compute_fingerprint() const {
+    Digest digest;
+    digest.update_field(std::to_string(CACHE_VERSION));
+    // Contents of the compiler and objcopy, a rebuilt toolchain with the same size and mtime still invalidates
+    digest.update_field(this->toolchain_);
+    digest.update_field(this->toolchain_digest_);
+    digest.update_field(this->flags_);
+
+    // Kernels link against the weakened firmware symbols, so a firmware change invalidates every kernel
+    std::vector<fs::path> firmware_elfs;
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(this->firmware_root_, ec);
+         !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        const std::string name = it->path().filename().string();
+        if (name.size() > 13 and name.compare(name.size() - 13, 13, "_weakened.elf") == 0) {
+            firmware_elfs.push_back(it->path());
+        }
+    }
+    std::sort(firmware_elfs.begin(), firmware_elfs.end());
+    for (const auto& elf : firmware_elfs) {
+        digest.update_field(elf.filename().string());
+        digest.update_file(elf.string());
+    }
+    return digest.hex();
+}
+
+std::string KernelBinaryCache::entry_suffix(const std::string& kernel_name, size_t kernel_hash) {
+    Digest key;
+    key.update_field(this->fingerprint());
+    key.update_field(std::to_string(kernel_hash));
+    return kernel_name + "/" + key.hex() + "/";
+}
+
+std::string KernelBinaryCache::staging_suffix(const std::string& kernel_name, size_t kernel_hash) {
+    std::string entry = this->entry_suffix(kernel_name, kernel_hash);
+    return entry.substr(0, entry.size() - 1) + STAGING_TAG + unique_tag() + "/";
+}
+
+// Manifest format, one record per line:
+//   version <cache version>
+//   fingerprint <toolchain fingerprint>
+//   kernel_hash <kernel compile hash>
+//   binary <path relative to the entry> <size in bytes>
+//   bytes <total size of the entry>
+bool KernelBinaryCache::is_valid_entry(const std::string& version_path, size_t kernel_hash) const {
+    std::ifstream f(version_path + MANIFEST_NAME);
+    if (not f.is_open()) {
+        return false;
+    }
+    bool version_ok = false, fingerprint_ok = false, hash_ok = false;
+    size_t num_binaries = 0;
+    std::string line;
+    while (std::getline(f, line)) {
+        std::istringstream record(line);
+        std::string tag;
+        record >> tag;
+        if (tag == "version") {
+            size_t version;
+            version_ok = (record >> version) and version == CACHE_VERSION;
+        } else if (tag == "fingerprint") {
+            std::string fingerprint;
+            fingerprint_ok = (record >> fingerprint) and fingerprint == this->fingerprint_;
+        } else if (tag == "kernel_hash") {
+            size_t hash;
+            hash_ok = (record >> hash) and hash == kernel_hash;
+        } else if (tag == "binary") {
+            std::string relative_path;
+            uint64_t size;
+            if (not(record >> relative_path >> size)) {
+                return false;
+            }
+            std::error_code ec;
+            auto actual_size = fs::file_size(version_path + relative_path, ec);
+            if (ec or actual_size != size) {
+                return false;
+            }
+            num_binaries++;
+        }
+    }
+    return version_ok and fingerprint_ok and hash_ok and num_binaries > 0;
+}
+
+uint64_t KernelBinaryCache::write_manifest(const std::string& version_path, size_t kernel_hash) const {
+    std::vector<std::pair<std::string, uint64_t>> binaries;
+    uint64_t total_bytes = 0;
+    std::error_code ec;
+    for (auto it = fs::recursive_directory_iterator(version_path, ec); !ec && it != fs::recursive_directory_iterator();
+         it.increment(ec)) {
+        if (not it->is_regular_file()) {
+            continue;
+        }
+        uint64_t size = it->file_size();
+        total_bytes += size;
+        if (it->path().extension() == ".elf") {
+            binaries.emplace_back(fs::relative(it->path(), version_path).string(), size);
+        }
+    }
+    TT_FATAL(not ec, "Failed to scan kernel build output {}: {}", version_path, ec.message());
+    TT_FATAL(not binaries.empty(), "Kernel build output {} contains no binaries", version_path);
+    std::sort(binaries.begin(), binaries.end());
+
+    // Write then rename so a reader never sees a truncated manifest
+    std::string manifest = version_path + MANIFEST_NAME;
+    std::string tmp_manifest = manifest + ".tmp";
+    {
+        std::ofstream f(tmp_manifest, std::ios::trunc);
+        f << "version " << CACHE_VERSION << "\n";
+        f << "fingerprint " << this->fingerprint_ << "\n";
+        f << "kernel_hash " << kernel_hash << "\n";
+        for (const auto& [relative_path, size] : binaries) {
+            f << "binary " << relative_path << " " << size << "\n";
+        }
+        f << "bytes " << total_bytes << "\n";
+        f.close();
+        TT_FATAL(not f.fail(), "Failed to write kernel cache manifest {}", tmp_manifest);
+    }
+    fs::rename(tmp_manifest, manifest);
+    return total_bytes;
+}
+
+std::optional<std::string> KernelBinaryCache::lookup(const std::string& entry_suffix, size_t kernel_hash) {
+    this->fingerprint();
+    std::string version = read_current_version(dir_path(this->root_ + entry_suffix));
+    if (version.empty()) {
+        return std::nullopt;
+    }
+    std::string version_suffix = entry_suffix + version + "/";
+    std::string version_path = this->root_ + version_suffix;
+    if (not this->is_valid_entry(version_path, kernel_hash)) {
+        return std::nullopt;
+    }
+    std::error_code ec;
+    fs::last_write_time(version_path + MANIFEST_NAME, fs::file_time_type::clock::now(), ec);
+    return version_suffix;
+}
+
+std::string KernelBinaryCache::publish(
+    const std::string& staging_suffix, const std::string& entry_suffix, size_t kernel_hash, bool replace) {
+    this->fingerprint();
+    std::string staging_path = this->root_ + staging_suffix;
+    fs::path entry_dir = dir_path(this->root_ + entry_suffix);
+
+    // Another thread or process published the same entry first, keep theirs
+    if (not replace) {
+        if (auto version_suffix = this->lookup(entry_suffix, kernel_hash); version_suffix.has_value()) {
+            remove_directory(dir_path(staging_path));
+            return version_suffix.value();
+        }
+    }
+
+    uint64_t entry_bytes = this->write_manifest(staging_path, kernel_hash);
+    std::error_code ec;
+    fs::create_directories(entry_dir, ec);
+    // Version names are unique, so nothing is ever renamed over a version someone may be reading
+    std::string version = VERSION_TAG + unique_tag();
+    fs::rename(dir_path(staging_path), entry_dir / version, ec);
+    TT_FATAL(not ec, "Failed to publish kernel binaries to {}: {}", (entry_dir / version).string(), ec.message());
+    // Stamped with the publish time, superseded versions are only removed after the grace period
+    fs::last_write_time(entry_dir / version, fs::file_time_type::clock::now(), ec);
+
+    // Renaming a symlink over the current one switches readers to the new version atomically
+    std::string previous_version = read_current_version(entry_dir);
+    fs::path link = entry_dir / (std::string(CURRENT_NAME) + STAGING_TAG + unique_tag());
+    fs::create_directory_symlink(version, link, ec);
+    if (not ec) {
+        fs::rename(link, entry_dir / CURRENT_NAME, ec);
+    }
+    if (ec) {
+        fs::remove(link, ec);
+        remove_directory(entry_dir / version);
+        TT_THROW("Failed to make {} the current version of {}", version, entry_dir.string());
+    }
+
+    // Readers that resolved the superseded version before the switch get the grace period to load it
+    if (not previous_version.empty()) {
+        fs::last_write_time(entry_dir / previous_version, fs::file_time_type::clock::now(), ec);
+    }
+    // Re-read, a concurrent publish may have switched current again
+    std::string current_version = read_current_version(entry_dir);
+    auto grace_cutoff = fs::file_time_type::clock::now() - EVICTION_GRACE_PERIOD;
+    for (auto it = fs::directory_iterator(entry_dir, ec); !ec && it != fs::directory_iterator(); it.increment(ec)) {
+        std::error_code stat_ec;
+        const std::string name = it->path().filename().string();
+        if (name.rfind(VERSION_TAG, 0) == 0 and name != current_version and
+            it->is_directory(stat_ec) and fs::last_write_time(it->path(), stat_ec) < grace_cutoff and not stat_ec) {
+            remove_directory(it->path());
+        }
+    }
+
+    if (this->max_bytes_ != 0) {
+        int64_t estimated_bytes = this->estimated_bytes_.fetch_add(entry_bytes) + entry_bytes;
+        // The estimate starts at -1, so the first publish always scans
+        if (estimated_bytes < int64_t(entry_bytes) or uint64_t(estimated_bytes) > this->max_bytes_) {
+            this->evict();
+        }
+    }
+    return entry_suffix + version + "/";
+}
+
+void KernelBinaryCache::discard(const std::string& staging_suffix) {
+    remove_directory(dir_path(this->root_ + staging_suffix));
+}
+
+void KernelBinaryCache::evict() {
+    // One evicting thread per process and one process per cache root is enough, everyone else keeps compiling
+    std::unique_lock<std::mutex> lock(this->eviction_mutex_, std::try_to_lock);
+    if (not lock.owns_lock()) {
+        return;
+    }
+    FileLock file_lock(this->root_ + LOCK_NAME);
+    if (not file_lock.locked()) {
+        return;
+    }
+
+    std::vector<CacheEntry> entries;
+    uint64_t total_bytes = 0;
+    auto grace_cutoff = fs::file_time_type::clock::now() - EVICTION_GRACE_PERIOD;
+
+    std::error_code ec;
+    for (auto kernel_it = fs::directory_iterator(this->root_, ec); !ec && kernel_it != fs::directory_iterator();
+         kernel_it.increment(ec)) {
+        if (not kernel_it->is_directory()) {
+            continue;
+        }
+        std::error_code entry_ec;
+        for (auto it = fs::directory_iterator(kernel_it->path(), entry_ec);
+             !entry_ec && it != fs::directory_iterator();
+             it.increment(entry_ec)) {
+            if (not it->is_directory()) {
+                continue;
+            }
+            const std::string name = it->path().filename().string();
+            std::error_code stat_ec;
+            bool leftover =
+                name.find(STAGING_TAG) != std::string::npos or name.find(TRASH_TAG) != std::string::npos;
+            if (leftover) {
+                // Builds abandoned by crashed processes
+                if (fs::last_write_time(it->path(), stat_ec) < grace_cutoff and not stat_ec) {
+                    fs::remove_all(it->path(), stat_ec);
+                }
+                continue;
+            }
+            // Entries without a current manifest are incomplete or predate the cache, they age out by directory mtime
+            fs::path manifest = it->path() / CURRENT_NAME / MANIFEST_NAME;
+            bool has_manifest = fs::exists(manifest, stat_ec);
+            auto last_used = fs::last_write_time(has_manifest ? manifest : it->path(), stat_ec);
+            if (stat_ec) {
+                continue;
+            }
+            uint64_t bytes = 0;
+            if (has_manifest) {
+                std::ifstream f(manifest);
+                std::string line;
+                while (std::getline(f, line)) {
+                    if (line.rfind("bytes ", 0) == 0) {
+                        bytes = std::stoull(line.substr(6));
+                    }
+                }
+            }
+            if (bytes == 0) {
+                bytes = directory_bytes(it->path());
+            }
+            total_bytes += bytes;
+            entries.push_back({it->path(), last_used, bytes});
+        }
+    }
+
+    this->estimated_bytes_ =
+        evict_least_recently_used(entries, total_bytes, this->max_bytes_, grace_cutoff, [](const fs::path& path) {
+            remove_directory(path);
+            // Drop the kernel name directory once its last entry is gone, remove fails harmlessly otherwise
+            std::error_code ec;
+            fs::remove(path.parent_path(), ec);
+        });
+}
+
+JitObjectCache& JitObjectCache::get(const std::string& root) {
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::unique_ptr<JitObjectCache>> registry;
+
+    std::unique_lock<std::mutex> lock(registry_mutex);
+    auto& cache = registry[root];
+    if (cache == nullptr) {
+        cache = std::make_unique<JitObjectCache>(root, llrt::OptionsG.get_kernel_cache_max_bytes());
+    }
+    return *cache;
+}
+
+JitObjectCache::JitObjectCache(const std::string& root, uint64_t max_bytes) : root_(root), max_bytes_(max_bytes) {}
+
+bool JitObjectCache::fetch(const std::string& name, const std::string& dst) {
+    std::error_code ec;
+    if (not fs::copy_file(this->root_ + name, dst, fs::copy_options::overwrite_existing, ec) or ec) {
+        return false;
+    }
+    fs::last_write_time(this->root_ + name, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void JitObjectCache::publish(const std::string& src, const std::string& name) {
+    std::error_code ec;
+    fs::create_directories(this->root_, ec);
+    std::string entry = this->root_ + name;
+    std::string tmp = entry + STAGING_TAG + unique_tag();
+    if (fs::copy_file(src, tmp, fs::copy_options::overwrite_existing, ec)) {
+        fs::rename(tmp, entry, ec);
+    }
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+
+    if (this->max_bytes_ != 0) {
+        int64_t entry_bytes = fs::file_size(entry, ec);
+        if (ec) {
+            return;
+        }
+        int64_t estimated_bytes = this->estimated_bytes_.fetch_add(entry_bytes) + entry_bytes;
+        // The estimate starts at -1, so the first publish always scans
+        if (estimated_bytes < entry_bytes or uint64_t(estimated_bytes) > this->max_bytes_) {
+            this->evict();
+        }
+    }
+}
+
+void JitObjectCache::evict() {
+    std::unique_lock<std::mutex> lock(this->eviction_mutex_, std::try_to_lock);
+    if (not lock.owns_lock()) {
+        return;
+    }
+    FileLock file_lock(this->root_ + LOCK_NAME);
+    if (not file_lock.locked()) {
+        return;
+    }
+
+    std::vector<CacheEntry> entries;
+    uint64_t total_bytes = 0;
+    auto grace_cutoff = fs::file_time_type::clock::now() - EVICTION_GRACE_PERIOD;
+    std::error_code ec;
+    for (auto it = fs::directory_iterator(this->root_, ec); !ec && it != fs::directory_iterator(); it.increment(ec)) {
+        std::error_code stat_ec;
+        if (not it->is_regular_file(stat_ec) or it->path().filename() == LOCK_NAME) {
+            continue;
+        }
+        auto last_used = fs::last_write_time(it->path(), stat_ec);
+        uint64_t bytes = it->file_size(stat_ec);
+        if (stat_ec) {
+            continue;
+        }
+        if (it->path().filename().string().find(STAGING_TAG) != std::string::npos) {
+            // Copies abandoned by crashed processes
+            if (last_used < grace_cutoff) {
+                fs::remove(it->path(), stat_ec);
+            }
+            continue;
+        }
+        total_bytes += bytes;
+        entries.push_back({it->path(), last_used, bytes});
+    }
+
+    this->estimated_bytes_ =
+        evict_least_recently_used(entries, total_bytes, this->max_bytes_, grace_cutoff, [](const fs::path& path) {
+            std::error_code ec;
+            fs::remove(path, ec);
+        });
+}
+
+}  // namespace tt::tt_metal
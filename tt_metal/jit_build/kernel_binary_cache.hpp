@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "jit_build/build.hpp"
+
+namespace tt::tt_metal {
+
+// On-disk cache of compiled kernel binaries, one per JitBuildEnv::out_kernel_root_
+//
+// Layout is <out_kernel_root>/<kernel name>/<key>/ where key is the digest of the kernel compile hash and a
+// fingerprint of the toolchain contents, build flags and firmware the kernel links against. Each publish of an entry
+// builds in a private staging directory and renames it to a new version directory of the entry, which is never
+// modified afterwards. The entry's "current" symlink is then switched to it with a rename, so other threads and
+// processes sharing the root always resolve a whole version, and a version they resolved stays readable while it is
+// replaced. A version is only valid once it has a manifest listing the binaries it holds. Superseded versions are
+// removed by later publishes once nobody can still be about to read them.
+//
+// The total size is capped by TT_METAL_KERNEL_CACHE_MAX_MB (0 or unset means unbounded), least recently used
+// entries are evicted first. A hit refreshes the manifest mtime, which is what eviction orders on.
+class KernelBinaryCache {
+  public:
+    static KernelBinaryCache& get(const JitBuildEnv& env);
+
+    // Directory suffix (relative to out_kernel_root) of the entry for a kernel, "<name>/<key>/"
+    std::string entry_suffix(const std::string& kernel_name, size_t kernel_hash);
+    // Private directory suffix to build an entry into before publishing it
+    std::string staging_suffix(const std::string& kernel_name, size_t kernel_hash);
+
+    // Directory suffix of the current version of the entry, "<name>/<key>/<version>/", if it is complete. Refreshes
+    // its LRU stamp
+    std::optional<std::string> lookup(const std::string& entry_suffix, size_t kernel_hash);
+
+    // Moves a finished build from staging to a new version of its entry and makes it current, returns the directory
+    // suffix of the version. When replace is false an already valid version published by someone else is kept and
+    // the staging build is discarded
+    std::string publish(const std::string& staging_suffix, const std::string& entry_suffix, size_t kernel_hash, bool replace);
+
+    // Drops a staging build that failed
+    void discard(const std::string& staging_suffix);
+
+    const std::string& fingerprint();
+
+  private:
+    explicit KernelBinaryCache(const JitBuildEnv& env);
+
+    std::string compute_fingerprint() const;
+    bool is_valid_entry(const std::string& version_path, size_t kernel_hash) const;
+    // Returns the total size of the entry
+    uint64_t write_manifest(const std::string& version_path, size_t kernel_hash) const;
+    void evict();
+
+    // Copied out of the JitBuildEnv, which may not outlive this cache
+    const std::string root_;
+    const std::string firmware_root_;
+    const std::string toolchain_;
+    const std::string toolchain_digest_;
+    const std::string flags_;
+    const uint64_t max_bytes_;
+
+    std::once_flag fingerprint_once_;
+    std::string fingerprint_;
+
+    std::mutex eviction_mutex_;
+    // Estimate of the bytes on disk, refreshed by every eviction scan. Negative until the first scan
+    std::atomic<int64_t> estimated_bytes_ = -1;
+};
+
+// On-disk cache of the objects and linked elfs of JitBuildState, one per JitBuildEnv::out_object_cache_root_ shared by
+// every device and process
+//
+// Entries are flat files named by the digest of everything they are built from (see Digest), copied in aside and
+// renamed into place, so a reader sees a whole entry or none. Eviction unlinks entries, which leaves copies already
+// being read intact. The total size is capped by TT_METAL_KERNEL_CACHE_MAX_MB on its own and evicted like
+// KernelBinaryCache, a hit refreshes the entry mtime.
+class JitObjectCache {
+  public:
+    static JitObjectCache& get(const std::string& root);
+
+    // max_bytes of 0 means unbounded
+    JitObjectCache(const std::string& root, uint64_t max_bytes);
+
+    // Copies the entry to dst and refreshes its LRU stamp, false on a miss
+    bool fetch(const std::string& name, const std::string& dst);
+    // Copies src in as the entry name, evicts if that takes the cache over its cap
+    void publish(const std::string& src, const std::string& name);
+    void evict();
+
+  private:
+    const std::string root_;
+    const uint64_t max_bytes_;
+
+    std::mutex eviction_mutex_;
+    // Estimate of the bytes on disk, refreshed by every eviction scan. Negative until the first scan
+    std::atomic<int64_t> estimated_bytes_ = -1;
+};
+
+}  // namespace tt::tt_metal
@@ -5,7 +5,10 @@ JIT_BUILD_CFLAGS = $(CFLAGS) -Werror
 
 JIT_BUILD_SRCS_RELATIVE = \
 	jit_build/build.cpp \
+	jit_build/digest.cpp \
+	jit_build/job_server.cpp \
 	jit_build/genfiles.cpp \
+	jit_build/kernel_binary_cache.cpp \
 	jit_build/data_format.cpp \
 	jit_build/settings.cpp
 
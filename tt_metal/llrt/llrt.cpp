@@ -30,46 +30,41 @@ using std::uint32_t;
 using std::unordered_map;
 using std::vector;
 
-struct HexNameToMemVectorCache {
+struct ElfNameToMemCache {
     using lock = std::unique_lock<std::mutex>;
-    // maps from RisckCacheMapKey to hex file path
-    static HexNameToMemVectorCache &inst() {
-        static HexNameToMemVectorCache inst_;
+    // maps from elf file path to the image loaded from it, shared by every kernel and device using it
+    static ElfNameToMemCache &inst() {
+        static ElfNameToMemCache inst_;
         return inst_;
     }
 
-    bool exists(const string &path) {
+    std::shared_ptr<const ll_api::memory> get(const string &path) {
         lock l(mutex_);
-        return cache_.find(path) != cache_.end();
+        auto mem = cache_.find(path);
+        return mem == cache_.end() ? nullptr : mem->second;
     }
-    ll_api::memory &get(const string &path) {
+    // Keeps the image already cached if another thread loaded the same path first
+    std::shared_ptr<const ll_api::memory> add(const string &path, std::shared_ptr<const ll_api::memory> mem) {
         lock l(mutex_);
-        return cache_[path];
-    }
-    void add(const string &path, ll_api::memory &mem) {
-        lock l(mutex_);
-        cache_[path] = mem;
+        return cache_.emplace(path, std::move(mem)).first->second;
     }
 
-    unordered_map<string, ll_api::memory> cache_;
+    unordered_map<string, std::shared_ptr<const ll_api::memory>> cache_;
     std::mutex mutex_;
 };
 
-ll_api::memory get_risc_binary(string path) {
+std::shared_ptr<const ll_api::memory> get_risc_binary(string path) {
 
-    if (HexNameToMemVectorCache::inst().exists(path)) {
-        return HexNameToMemVectorCache::inst().get(path);
+    if (auto mem = ElfNameToMemCache::inst().get(path)) {
+        return mem;
     }
 
-    fs::path bin_file(path);
-
-    std::ifstream hex_istream(path);
-    ll_api::memory mem(hex_istream);
+    // Loaded without holding the lock, kernels are read in parallel
+    auto mem = std::make_shared<ll_api::memory>();
+    mem->fill_from_elf(path);
 
     // add this path to binary cache
-    HexNameToMemVectorCache::inst().add(path, mem);
-
-    return mem;
+    return ElfNameToMemCache::inst().add(path, std::move(mem));
 }
 
 // Return the code size in 16 byte units
@@ -225,7 +220,7 @@ void program_brisc_startup_addr(chip_id_t chip_id, const CoreCoord &core) {
     write_hex_vec_to_core(chip_id, core, jump_to_fw, 0);
 }
 
-bool test_load_write_read_risc_binary(ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int riscv_id) {
+bool test_load_write_read_risc_binary(const ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int riscv_id) {
     assert(is_worker_core(core, chip_id) or is_ethernet_core(core, chip_id));
 
     uint64_t local_init_addr;
@@ -257,7 +252,7 @@ bool test_load_write_read_risc_binary(ll_api::memory &mem, chip_id_t chip_id, co
     return true;
 }
 
-bool test_load_write_read_trisc_binary(ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int triscv_id) {
+bool test_load_write_read_trisc_binary(const ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int triscv_id) {
 
     assert(triscv_id >= 0 and triscv_id <= 2);
     return test_load_write_read_risc_binary(mem, chip_id, core, triscv_id + 2);
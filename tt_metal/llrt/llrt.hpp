@@ -9,6 +9,7 @@
 #include <tuple>
 #include <iostream>
 #include <filesystem>
+#include <memory>
 
 #include "llrt/tt_cluster.hpp"
 #include "tensix.h"
@@ -52,7 +53,8 @@ using WorkerCore = tt_cxy_pair;
 using WorkerCores = std::vector<WorkerCore>;
 using CircularBufferConfigVec = std::vector<uint32_t>;
 
-ll_api::memory get_risc_binary(string path);
+// Loaded once per path, the returned image is shared and must not be modified
+std::shared_ptr<const ll_api::memory> get_risc_binary(string path);
 uint16_t get_binary_code_size16(const ll_api::memory& mem, int riscv_id);
 
 // TODO: try using "stop" method from device instead, it's the proper way of asserting reset
@@ -97,10 +99,10 @@ void write_circular_buffer_config_vector_to_core(
 void program_brisc_startup_addr(chip_id_t chip_id, const CoreCoord &core);
 
 bool test_load_write_read_risc_binary(
-    ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int riscv_id);
+    const ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int riscv_id);
 
 bool test_load_write_read_trisc_binary(
-    ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int triscv_id);
+    const ll_api::memory &mem, chip_id_t chip_id, const CoreCoord &core, int triscv_id);
 
 // subchannel hard-coded to 0 for now
 CoreCoord get_core_for_dram_channel(int dram_channel_id, chip_id_t chip_id = 0);
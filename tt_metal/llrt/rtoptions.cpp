@@ -44,6 +44,22 @@ RunTimeOptions::RunTimeOptions() {
     TT_FATAL(!(get_dprint_enabled() && get_profiler_enabled()), "Cannot enable both debug printing and profiling");
 
     null_kernels = (std::getenv("TT_METAL_NULL_KERNELS") != nullptr);
+
+    kernel_cache_max_bytes = 0;
+    if (const char *kernel_cache_max_mb_str = std::getenv("TT_METAL_KERNEL_CACHE_MAX_MB")) {
+        kernel_cache_max_bytes = std::strtoull(kernel_cache_max_mb_str, nullptr, 10) << 20;
+    }
+
+    indexed_free_list_allocator = (std::getenv("TT_METAL_INDEXED_FREE_LIST_ALLOCATOR") != nullptr);
+
+    if (const char *allocator_trace_dir_str = std::getenv("TT_METAL_ALLOCATOR_TRACE")) {
+        allocator_trace_dir = allocator_trace_dir_str;
+    }
+
+    build_jobs = 0;
+    if (const char *build_jobs_str = std::getenv("TT_METAL_BUILD_JOBS")) {
+        build_jobs = std::strtoul(build_jobs_str, nullptr, 10);
+    }
 }
 
 const std::string& RunTimeOptions::get_root_dir() {
@@ -41,6 +41,14 @@ class RunTimeOptions {
 
     bool null_kernels;
 
+    uint64_t kernel_cache_max_bytes;
+
+    bool indexed_free_list_allocator;
+
+    std::string allocator_trace_dir;
+
+    uint32_t build_jobs;
+
 public:
     RunTimeOptions();
 
@@ -116,6 +124,21 @@ public:
     inline void set_kernels_nullified(bool v) { null_kernels = v; }
     inline bool get_kernels_nullified() { return null_kernels; }
 
+    // Size cap of the on-disk kernel binary cache, 0 means unbounded
+    inline uint64_t get_kernel_cache_max_bytes() { return kernel_cache_max_bytes; }
+    inline void set_kernel_cache_max_bytes(uint64_t max_bytes) { kernel_cache_max_bytes = max_bytes; }
+
+    // Bank managers of devices opened afterwards use IndexedFreeList instead of FreeList
+    inline bool get_indexed_free_list_allocator() { return indexed_free_list_allocator; }
+    inline void set_indexed_free_list_allocator(bool enable) { indexed_free_list_allocator = enable; }
+
+    // Directory the allocations of devices opened afterwards are traced to, empty if they aren't traced
+    inline const std::string& get_allocator_trace_dir() { return allocator_trace_dir; }
+    inline void set_allocator_trace_dir(const std::string& dir) { allocator_trace_dir = dir; }
+
+    // Toolchain processes run concurrently by the JIT build, 0 means one per hardware thread
+    inline uint32_t get_build_jobs() { return build_jobs; }
+
 private:
     // Helper functions to parse DPrint-specific environment vaiables.
     void ParseDPrintEnv();
@@ -3,8 +3,12 @@
 // SPDX-License-Identifier: Apache-2.0
 
 
+#include <elf.h>
+
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <limits>
 #include <stdexcept>
@@ -66,6 +70,91 @@ void memory::fill_from_discontiguous_hex(std::istream& is) {
     });
 }
 
+void memory::fill_from_elf(const std::string& path) {
+    // Intended to start empty
+    assert(data_.size() == 0);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw runtime_error("Failed to open ELF file " + path);
+    }
+    vector<char> bytes(file.tellg());
+    file.seekg(0);
+    file.read(bytes.data(), bytes.size());
+    if (!file) {
+        throw runtime_error("Failed to read ELF file " + path);
+    }
+
+    auto read = [&bytes, &path](size_t offset, auto& value) {
+        if (offset + sizeof(value) > bytes.size()) {
+            throw runtime_error("Truncated ELF file " + path);
+        }
+        std::memcpy(&value, bytes.data() + offset, sizeof(value));
+    };
+
+    Elf32_Ehdr header;
+    read(0, header);
+    if (std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 || header.e_ident[EI_CLASS] != ELFCLASS32 ||
+        header.e_ident[EI_DATA] != ELFDATA2LSB) {
+        throw runtime_error(path + " isn't a 32 bit little endian ELF file");
+    }
+
+    vector<Elf32_Shdr> sections(header.e_shnum);
+    for (size_t i = 0; i < sections.size(); i++) {
+        read(header.e_shoff + i * header.e_shentsize, sections[i]);
+    }
+
+    // Allocated sections with contents by load address. Segments also cover alignment padding between sections and
+    // may cover the ELF headers, neither of which is loaded
+    struct chunk {
+        address_t addr;
+        size_t offset;
+        size_t len;
+    };
+    vector<chunk> chunks;
+    for (size_t i = 0; i < header.e_phnum; i++) {
+        Elf32_Phdr segment;
+        read(header.e_phoff + i * header.e_phentsize, segment);
+        if (segment.p_type != PT_LOAD || segment.p_filesz == 0) {
+            continue;
+        }
+        for (const auto& section : sections) {
+            if (!(section.sh_flags & SHF_ALLOC) || section.sh_type == SHT_NOBITS || section.sh_size == 0 ||
+                section.sh_offset < segment.p_offset ||
+                section.sh_offset + section.sh_size > segment.p_offset + segment.p_filesz) {
+                continue;
+            }
+            if (section.sh_offset + section.sh_size > bytes.size()) {
+                throw runtime_error("Truncated ELF file " + path);
+            }
+            chunks.push_back({segment.p_paddr + (section.sh_offset - segment.p_offset), section.sh_offset, section.sh_size});
+        }
+    }
+    std::sort(chunks.begin(), chunks.end(), [](const chunk& a, const chunk& b) { return a.addr < b.addr; });
+
+    // Chunks that share or abut a word are in the same span, as consecutive words of a hex file are
+    size_t span_offset = 0;
+    for (const auto& chunk : chunks) {
+        address_t first_word = chunk.addr >> 2;
+        address_t last_word = (chunk.addr + chunk.len - 1) >> 2;
+        if (link_spans_.empty() || first_word > (link_spans_.back().addr >> 2) + link_spans_.back().len) {
+            span_offset = data_.size();
+            link_spans_.push_back({first_word << 2, 0});
+        }
+        auto& span = link_spans_.back();
+        address_t end_word = (span.addr >> 2) + span.len;
+        if (last_word >= end_word) {
+            data_.resize(data_.size() + (last_word + 1 - end_word), 0);
+            span.len += last_word + 1 - end_word;
+        }
+        for (size_t i = 0; i < chunk.len; i++) {
+            address_t addr = chunk.addr + i;
+            word_t& word = data_[span_offset + (addr >> 2) - (span.addr >> 2)];
+            uint32_t shift = (addr & 3) * 8;
+            word = (word & ~(word_t(0xff) << shift)) | (word_t(uint8_t(bytes[chunk.offset + i])) << shift);
+        }
+    }
+}
+
 void memory::fill_from_mem_template(const memory& mem_template, const std::function<void (std::vector<uint32_t>::iterator, uint64_t addr, uint32_t len)>& callback) {
     link_spans_ = mem_template.link_spans_;
     data_.resize(mem_template.data_.size());
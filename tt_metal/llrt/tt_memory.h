@@ -52,6 +52,10 @@ class memory {
   // Read from file
   void fill_from_discontiguous_hex(std::istream& is);
 
+  // Read the contents of the allocated sections of the PT_LOAD segments of a linked 32 bit little endian ELF at their
+  // load addresses, the same image objcopy -O verilog and hex8tohex32 produce
+  void fill_from_elf(const std::string& path);
+
   // Process spans in arg mem to fill data in *this (eg, from device)
   void fill_from_mem_template(const memory& mem_template, const std::function<void (std::vector<uint32_t>::iterator, uint64_t addr, uint32_t len)>& callback);
 
@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tt_metal/common/logger.hpp"
+#include "tt_metal/common/test_common.hpp"
+#include "tt_metal/impl/allocator/algorithms/free_list.hpp"
+#include "tt_metal/impl/allocator/algorithms/indexed_free_list.hpp"
+#include "tt_metal/impl/allocator/allocation_trace.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Replays an allocation trace written with TT_METAL_ALLOCATOR_TRACE=<dir> against allocator
+// algorithms, without a device. For each algorithm it reports the allocations that failed,
+// the peak allocated bytes, the peak footprint (span from the lowest to the highest occupied
+// address) and the fragmentation of the free space, 1 - largest free block / free bytes, all
+// measured after every event. With -o they are written as CSV every -i events to plot them
+// over time.
+//////////////////////////////////////////////////////////////////////////////////////////
+using namespace tt;
+using namespace tt::tt_metal::allocator;
+
+constexpr uint32_t DEFAULT_INTERVAL = 100;
+
+struct Sample {
+    uint64_t event_index;
+    uint64_t allocated_bytes;
+    uint64_t free_bytes;
+    uint64_t largest_free_block_bytes;
+    uint64_t footprint_bytes;
+
+    double fragmentation() const {
+        return this->free_bytes == 0 ? 0.0 : 1.0 - double(this->largest_free_block_bytes) / this->free_bytes;
+    }
+};
+
+struct ReplayResult {
+    uint32_t num_allocations = 0;
+    uint32_t failed_allocations = 0;
+    // Allocations that ran out of memory when the trace was recorded
+    uint32_t traced_out_of_memory = 0;
+    // Of those, the ones that fit in the replay. They are freed right away, the traced run never held them
+    uint32_t fit_traced_out_of_memory = 0;
+    // Placements that differ from the traced addresses, only meaningful for the traced algorithm
+    uint32_t moved_allocations = 0;
+    uint64_t peak_allocated_bytes = 0;
+    uint64_t peak_footprint_bytes = 0;
+    double peak_fragmentation = 0;
+    uint64_t smallest_largest_free_block_bytes = std::numeric_limits<uint64_t>::max();
+    std::vector<Sample> samples;
+};
+
+Sample sample(const Algorithm &algorithm, const std::map<uint64_t, uint64_t> &live_buffers, uint64_t event_index) {
+    auto statistics = algorithm.get_statistics();
+    uint64_t footprint_bytes = 0;
+    if (not live_buffers.empty()) {
+        // Buffers don't overlap, the highest one ends last
+        const auto &[last_address, last_size] = *live_buffers.rbegin();
+        footprint_bytes = last_address + last_size - live_buffers.begin()->first;
+    }
+    return Sample{
+        .event_index = event_index,
+        .allocated_bytes = statistics.total_allocated_bytes,
+        .free_bytes = statistics.total_free_bytes,
+        .largest_free_block_bytes = statistics.largest_free_block_bytes,
+        .footprint_bytes = footprint_bytes};
+}
+
+ReplayResult replay(Algorithm &algorithm, const AllocationTrace &trace, uint32_t interval) {
+    const auto &bank = trace.bank;
+    ReplayResult result;
+    std::unordered_map<uint32_t, uint64_t> id_to_address;
+    // Live buffers by address, to measure the footprint
+    std::map<uint64_t, uint64_t> live_buffers;
+    for (uint64_t event_index = 0; event_index < trace.events.size(); event_index++) {
+        const auto &event = trace.events[event_index];
+        std::optional<uint64_t> address;
+        bool allocates = true;
+        switch (event.type) {
+            case AllocationTraceEvent::Type::ALLOC:
+            case AllocationTraceEvent::Type::OUT_OF_MEMORY: {
+                // Interleaved L1 buffers stay above the limit, as in BankManager
+                uint64_t address_limit = event.num_shards == 0 ? bank.interleaved_address_limit : 0;
+                try {
+                    address = algorithm.allocate(event.size_per_bank, event.bottom_up, address_limit);
+                } catch (const std::exception &) {
+                    // Allocations that would land below the limit throw and give their block back, as on device
+                }
+                if (event.type == AllocationTraceEvent::Type::OUT_OF_MEMORY) {
+                    result.traced_out_of_memory++;
+                } else if (address.has_value() and address.value() != event.address) {
+                    result.moved_allocations++;
+                }
+            } break;
+            case AllocationTraceEvent::Type::ALLOC_AT:
+                address = algorithm.allocate_at_address(event.address, event.size_per_bank);
+                break;
+            case AllocationTraceEvent::Type::FREE: {
+                allocates = false;
+                auto buffer = id_to_address.find(event.id);
+                if (buffer != id_to_address.end()) {
+                    algorithm.deallocate(buffer->second);
+                    live_buffers.erase(buffer->second);
+                    id_to_address.erase(buffer);
+                }
+            } break;
+        }
+        if (allocates) {
+            result.num_allocations++;
+            if (address.has_value() and event.type == AllocationTraceEvent::Type::OUT_OF_MEMORY) {
+                // Out of memory events have no id and the traced run never held the buffer
+                result.fit_traced_out_of_memory++;
+                algorithm.deallocate(address.value());
+            } else if (address.has_value()) {
+                id_to_address[event.id] = address.value();
+                live_buffers[address.value()] = event.size_per_bank;
+            } else {
+                result.failed_allocations++;
+            }
+        }
+
+        // Peaks are taken over every event, the interval only thins out the samples
+        auto current = sample(algorithm, live_buffers, event_index);
+        result.peak_allocated_bytes = std::max(result.peak_allocated_bytes, current.allocated_bytes);
+        result.peak_footprint_bytes = std::max(result.peak_footprint_bytes, current.footprint_bytes);
+        result.peak_fragmentation = std::max(result.peak_fragmentation, current.fragmentation());
+        result.smallest_largest_free_block_bytes =
+            std::min(result.smallest_largest_free_block_bytes, current.largest_free_block_bytes);
+        if (interval > 0 and (event_index % interval == 0 or event_index + 1 == trace.events.size())) {
+            result.samples.push_back(current);
+        }
+    }
+    return result;
+}
+
+std::unique_ptr<Algorithm> create_algorithm(const std::string &name, const AllocationTraceBank &bank) {
+    if (name == "first_fit") {
+        return std::make_unique<FreeList>(bank.bank_size, bank.offset, bank.min_allocation_size, bank.alignment, FreeList::SearchPolicy::FIRST);
+    } else if (name == "best_fit") {
+        return std::make_unique<FreeList>(bank.bank_size, bank.offset, bank.min_allocation_size, bank.alignment, FreeList::SearchPolicy::BEST);
+    } else if (name == "indexed") {
+        return std::make_unique<IndexedFreeList>(bank.bank_size, bank.offset, bank.min_allocation_size, bank.alignment);
+    }
+    TT_THROW("Unknown allocator algorithm {}, expected first_fit, best_fit or indexed", name);
+}
+
+int main(int argc, char **argv) {
+    std::vector<std::string> input_args(argv, argv + argc);
+    if (input_args.size() < 2 or test_args::has_command_option(input_args, "-h") or
+        test_args::has_command_option(input_args, "--help")) {
+        log_info(LogTest, "Usage: allocator_trace_analyzer <trace file> [options]");
+        log_info(LogTest, "  -a: algorithms to replay, comma separated first_fit,best_fit,indexed (default all)");
+        log_info(LogTest, "  -s: bank size in bytes to replay with (default the traced bank size)");
+        log_info(LogTest, "  -i: events between samples (default {})", DEFAULT_INTERVAL);
+        log_info(LogTest, "  -o: CSV file for the samples of every algorithm");
+        return input_args.size() < 2 ? 1 : 0;
+    }
+
+    auto trace = read_allocation_trace(input_args[1]);
+    auto algorithms = test_args::get_command_option(input_args, "-a", "first_fit,best_fit,indexed");
+    uint32_t interval = std::max<uint32_t>(1, test_args::get_command_option_uint32(input_args, "-i", DEFAULT_INTERVAL));
+    trace.bank.bank_size = std::stoull(test_args::get_command_option(input_args, "-s", std::to_string(trace.bank.bank_size)));
+    auto csv_file_name = test_args::get_command_option(input_args, "-o", "");
+
+    log_info(
+        LogTest,
+        "Trace: {} events, {} bank of {} B across {} banks",
+        trace.events.size(),
+        trace.bank.buffer_type,
+        trace.bank.bank_size,
+        trace.bank.num_banks);
+
+    std::ofstream csv_file;
+    if (not csv_file_name.empty()) {
+        csv_file.open(csv_file_name);
+        TT_FATAL(csv_file.is_open(), "Failed to open {}", csv_file_name);
+        csv_file << "algorithm,event,allocated_bytes,free_bytes,largest_free_block_bytes,footprint_bytes,fragmentation\n";
+    }
+
+    std::stringstream algorithm_names(algorithms);
+    std::string name;
+    while (std::getline(algorithm_names, name, ',')) {
+        auto algorithm = create_algorithm(name, trace.bank);
+        auto result = replay(*algorithm, trace, interval);
+        log_info(
+            LogTest,
+            "{:<10} allocations {} (failed {}, traced out of memory {} of which {} fit, placed elsewhere than traced {})",
+            name,
+            result.num_allocations,
+            result.failed_allocations,
+            result.traced_out_of_memory,
+            result.fit_traced_out_of_memory,
+            result.moved_allocations);
+        log_info(
+            LogTest,
+            "{:<10} peak allocated {} B, peak footprint {} B, smallest largest free block {} B, peak fragmentation {:.3f}",
+            name,
+            result.peak_allocated_bytes,
+            result.peak_footprint_bytes,
+            result.smallest_largest_free_block_bytes,
+            result.peak_fragmentation);
+        if (csv_file.is_open()) {
+            for (const auto &sample : result.samples) {
+                csv_file << name << "," << sample.event_index << "," << sample.allocated_bytes << "," << sample.free_bytes
+                         << "," << sample.largest_free_block_bytes << "," << sample.footprint_bytes << ","
+                         << sample.fragmentation() << "\n";
+            }
+        }
+    }
+    return 0;
+}
@@ -4,7 +4,8 @@
 include $(TT_METAL_HOME)/tt_metal/tools/profiler/module.mk
 
 TOOLS = \
-	tools/memset
+	tools/memset \
+	tools/allocator_trace_analyzer
 
 TOOLS_SRCS = $(addprefix tt_metal/, $(addsuffix .cpp, $(TOOLS)))
 
@@ -16,7 +17,7 @@ TOOLS_DEPS = $(addprefix $(OBJDIR)/, $(TOOLS_SRCS:.cpp=.d))
 -include $(TOOLS_DEPS)
 
 # Each module has a top level target as the entrypoint which must match the subdir name
-tools: $(OBJDIR)/tt_metal/tools/memset tools/profiler #tools/tt_gdb
+tools: $(OBJDIR)/tt_metal/tools/memset $(OBJDIR)/tt_metal/tools/allocator_trace_analyzer tools/profiler #tools/tt_gdb
 
 .PRECIOUS: $(OBJDIR)/tools/%
 $(OBJDIR)/tt_metal/tools/memset: $(OBJDIR)/tt_metal/tools/memset.o $(COMMON_OBJS) $(LLRT_OBJS) $(DEVICE_OBJS)
@@ -26,3 +27,12 @@ $(OBJDIR)/tt_metal/tools/memset: $(OBJDIR)/tt_metal/tools/memset.o $(COMMON_OBJS
 $(OBJDIR)/tt_metal/tools/memset.o: tt_metal/tools/memset.cpp
 	@mkdir -p $(@D)
 	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -c -o $@ $<
+
+# Host only, replays allocation traces against the allocator algorithms of libtt_metal
+$(OBJDIR)/tt_metal/tools/allocator_trace_analyzer: $(OBJDIR)/tt_metal/tools/allocator_trace_analyzer.o $(TT_METAL_LIB)
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -o $@ $< $(LDFLAGS) -ltt_metal -lstdc++fs -pthread
+
+$(OBJDIR)/tt_metal/tools/allocator_trace_analyzer.o: tt_metal/tools/allocator_trace_analyzer.cpp
+	@mkdir -p $(@D)
+	$(CXX) $(CFLAGS) $(CXXFLAGS) $(TOOLS_INCLUDES) -c -o $@ $<
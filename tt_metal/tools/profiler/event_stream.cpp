@@ -0,0 +1,458 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "tools/profiler/event_stream.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/assert.hpp"
+#include "common/logger.hpp"
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace op_profiler {
+
+namespace event_stream {
+
+namespace {
+
+// The file is appended to while ops run: a FileHeader, then a SectionHeader and payload for every write.
+// Before any events are written, a STRINGS section carries the strings interned since the last one, each a uint32_t
+// length and its characters; ids count up from 0, the empty string, across the sections. Its thread_index is 0.
+// An EVENTS section carries size / event_size Events from the buffer of the thread in thread_index, numbered in the
+// order threads first profiled an op. Sections of different threads interleave as their buffers fill, a reader
+// concatenates the sections of each thread and orders the events by timestamp.
+constexpr std::array<char, 8> MAGIC = {'T', 'T', 'O', 'P', 'E', 'V', 'T', 'S'};
+
+enum class SectionType : uint32_t { STRINGS = 0, EVENTS = 1 };
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t event_size;
+};
+
+struct SectionHeader {
+    uint32_t type;
+    uint32_t thread_index;
+    uint64_t size;
+};
+
+class Stream {
+   public:
+    Stream() {
+        const char* file_name = std::getenv("TT_METAL_OP_PROFILER_EVENTS");
+        if (file_name == nullptr) {
+            return;
+        }
+        this->file_.open(file_name, std::ios::binary | std::ios::trunc);
+        TT_FATAL(this->file_.is_open(), "Failed to open {} for the op profiler events", file_name);
+        FileHeader header{.magic = MAGIC, .version = VERSION, .event_size = sizeof(Event)};
+        this->file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        this->strings_.emplace_back();
+        this->string_ids_.emplace("", 0);
+
+        this->enabled_ = true;
+        this->writer_ = std::thread([this] { this->write_full_buffers(); });
+        std::atexit([] { get_stream().close(); });
+        tt::log_info(tt::LogOp, "Op Profiler: writing events to {}", file_name);
+    }
+
+    static Stream& get_stream() {
+        // Never destroyed, threads running ops while the process exits keep appending to their buffers
+        static Stream* stream = new Stream();
+        return *stream;
+    }
+
+    bool enabled() const { return this->enabled_; }
+
+    uint32_t intern(std::string_view string) {
+        std::unique_lock lock(this->mutex_);
+        auto id = this->string_ids_.find(std::string(string));
+        if (id != this->string_ids_.end()) {
+            return id->second;
+        }
+        this->strings_.emplace_back(string);
+        return this->string_ids_.emplace(std::string(string), this->strings_.size() - 1).first->second;
+    }
+
+    detail::Buffer* create_buffer() {
+        std::unique_lock lock(this->mutex_);
+        if (this->closed_) {
+            return nullptr;
+        }
+        auto buffer = this->allocate_buffer(this->num_threads_++);
+        this->thread_buffers_.push_back(buffer);
+        return buffer;
+    }
+
+    detail::Buffer* swap_buffer(detail::Buffer* full_buffer) {
+        {
+            std::unique_lock lock(this->mutex_);
+            if (not this->closed_) {
+                this->queue_.push_back(full_buffer);
+                this->queue_condition_.notify_one();
+                auto thread_buffer = std::find(this->thread_buffers_.begin(), this->thread_buffers_.end(), full_buffer);
+                *thread_buffer = this->allocate_buffer(full_buffer->thread_index);
+                return *thread_buffer;
+            }
+        }
+        this->write_closed_buffer(full_buffer);
+        return nullptr;
+    }
+
+    // The thread's remaining events are written with the next full buffer or at flush
+    void retire_buffer(detail::Buffer* buffer) {
+        {
+            std::unique_lock lock(this->mutex_);
+            if (not this->closed_) {
+                this->thread_buffers_.erase(std::find(this->thread_buffers_.begin(), this->thread_buffers_.end(), buffer));
+                this->queue_.push_back(buffer);
+                this->queue_condition_.notify_one();
+                return;
+            }
+        }
+        this->write_closed_buffer(buffer);
+    }
+
+    void flush() {
+        std::unique_lock file_lock(this->file_mutex_);
+        std::unique_lock lock(this->mutex_);
+        this->write_strings();
+        // Full buffers and buffers of exited threads that the writer thread hasn't taken yet
+        for (auto buffer : this->queue_) {
+            this->write_events(*buffer, buffer->num_written, buffer->num_events.load(std::memory_order_acquire));
+            this->free_buffers_.push_back(buffer);
+        }
+        this->queue_.clear();
+        for (auto buffer : this->thread_buffers_) {
+            const auto num_events = buffer->num_events.load(std::memory_order_acquire);
+            this->write_events(*buffer, buffer->num_written, num_events);
+            buffer->num_written = num_events;
+        }
+        this->file_.flush();
+    }
+
+    void close() {
+        {
+            std::unique_lock lock(this->mutex_);
+            this->closed_ = true;
+            this->queue_condition_.notify_one();
+        }
+        this->writer_.join();
+        this->flush();
+    }
+
+   private:
+    detail::Buffer* allocate_buffer(uint32_t thread_index) {
+        detail::Buffer* buffer;
+        if (this->free_buffers_.empty()) {
+            buffer = new detail::Buffer();
+        } else {
+            buffer = this->free_buffers_.back();
+            this->free_buffers_.pop_back();
+        }
+        buffer->thread_index = thread_index;
+        buffer->num_events.store(0, std::memory_order_relaxed);
+        buffer->num_written = 0;
+        return buffer;
+    }
+
+    // The writer thread is gone once the stream is closed, so buffers handed over afterwards are written right away
+    void write_closed_buffer(detail::Buffer* buffer) {
+        std::unique_lock file_lock(this->file_mutex_);
+        std::unique_lock lock(this->mutex_);
+        this->thread_buffers_.erase(std::find(this->thread_buffers_.begin(), this->thread_buffers_.end(), buffer));
+        this->write_strings();
+        this->write_events(*buffer, buffer->num_written, buffer->num_events.load(std::memory_order_acquire));
+        this->file_.flush();
+        this->free_buffers_.push_back(buffer);
+    }
+
+    // Runs on the writer thread until the stream is closed and every queued buffer is written
+    void write_full_buffers() {
+        while (true) {
+            detail::Buffer* buffer;
+            {
+                std::unique_lock lock(this->mutex_);
+                this->queue_condition_.wait(lock, [this] { return this->closed_ or not this->queue_.empty(); });
+                if (this->queue_.empty()) {
+                    return;
+                }
+                buffer = this->queue_.front();
+                this->queue_.pop_front();
+            }
+            {
+                std::unique_lock file_lock(this->file_mutex_);
+                {
+                    std::unique_lock lock(this->mutex_);
+                    this->write_strings();
+                }
+                this->write_events(*buffer, buffer->num_written, buffer->num_events.load(std::memory_order_acquire));
+            }
+            std::unique_lock lock(this->mutex_);
+            this->free_buffers_.push_back(buffer);
+        }
+    }
+
+    // Both require file_mutex_, write_strings also requires mutex_
+    void write_strings() {
+        if (this->num_strings_written_ == this->strings_.size()) {
+            return;
+        }
+        std::vector<char> payload;
+        for (auto index = this->num_strings_written_; index < this->strings_.size(); index++) {
+            const auto& string = this->strings_[index];
+            const uint32_t length = string.size();
+            payload.insert(payload.end(), reinterpret_cast<const char*>(&length), reinterpret_cast<const char*>(&length) + sizeof(length));
+            payload.insert(payload.end(), string.begin(), string.end());
+        }
+        this->num_strings_written_ = this->strings_.size();
+        this->write_section(SectionType::STRINGS, 0, payload.data(), payload.size());
+    }
+
+    void write_events(const detail::Buffer& buffer, uint32_t begin, uint32_t end) {
+        if (begin < end) {
+            this->write_section(SectionType::EVENTS, buffer.thread_index, &buffer.events[begin], (end - begin) * sizeof(Event));
+        }
+    }
+
+    void write_section(SectionType type, uint32_t thread_index, const void* data, std::size_t size) {
+        SectionHeader header{.type = static_cast<uint32_t>(type), .thread_index = thread_index, .size = size};
+        this->file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        this->file_.write(static_cast<const char*>(data), size);
+    }
+
+    bool enabled_ = false;
+    bool closed_ = false;
+
+    // Guards everything but the file
+    std::mutex mutex_;
+    std::condition_variable queue_condition_;
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> string_ids_;
+    uint32_t num_threads_ = 0;
+    std::vector<detail::Buffer*> thread_buffers_;
+    std::deque<detail::Buffer*> queue_;
+    std::vector<detail::Buffer*> free_buffers_;
+
+    std::mutex file_mutex_;
+    std::ofstream file_;
+    std::size_t num_strings_written_ = 0;
+    std::thread writer_;
+};
+
+struct ThreadState {
+    detail::Buffer* buffer = Stream::get_stream().enabled() ? Stream::get_stream().create_buffer() : nullptr;
+    std::unordered_map<std::string, uint32_t> string_ids;
+
+    ~ThreadState() {
+        if (this->buffer != nullptr) {
+            Stream::get_stream().retire_buffer(this->buffer);
+        }
+    }
+};
+
+ThreadState& get_thread_state() {
+    thread_local ThreadState thread_state;
+    return thread_state;
+}
+
+// Exporting
+
+std::string escape_json(std::string_view string) {
+    std::string escaped;
+    escaped.reserve(string.size());
+    for (char character : string) {
+        switch (character) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    escaped += fmt::format("\\u{:04x}", static_cast<int>(character));
+                } else {
+                    escaped += character;
+                }
+        }
+    }
+    return escaped;
+}
+
+struct OpenOp {
+    const Event* begin;
+    // Arguments in the order they were first recorded, repeated keys are joined
+    std::vector<std::pair<uint32_t, std::string>> arguments;
+
+    void append_argument(uint32_t key, std::string_view value) {
+        auto argument = std::find_if(
+            this->arguments.begin(), this->arguments.end(), [key](const auto& argument) { return argument.first == key; });
+        if (argument == this->arguments.end()) {
+            this->arguments.emplace_back(key, value);
+        } else {
+            argument->second += fmt::format(", {}", value);
+        }
+    }
+};
+
+void write_trace_event(
+    std::ofstream& json_file,
+    bool& first_trace_event,
+    const std::vector<std::string>& strings,
+    uint32_t thread_index,
+    uint64_t start_ns,
+    const OpenOp& op,
+    uint64_t end_ns) {
+    const auto& begin = *op.begin;
+    json_file << (first_trace_event ? "\n" : ",\n");
+    first_trace_event = false;
+    json_file << fmt::format(
+        R"({{"name": "{}", "cat": "{}", "ph": "X", "pid": 0, "tid": {}, "ts": {:.3f}, "dur": {:.3f}, "args": {{"Global Call Count": {}, "Call Count": {})",
+        escape_json(strings.at(begin.name)),
+        escape_json(strings.at(begin.begin.category)),
+        thread_index,
+        (begin.timestamp_ns - start_ns) / 1000.0,
+        (end_ns - begin.timestamp_ns) / 1000.0,
+        begin.begin.global_call_count,
+        begin.begin.call_count);
+    for (const auto& [key, value] : op.arguments) {
+        json_file << fmt::format(R"(, "{}": "{}")", escape_json(strings.at(key)), escape_json(value));
+    }
+    json_file << "}}";
+}
+
+}  // namespace
+
+namespace detail {
+
+Buffer*& get_thread_buffer() { return get_thread_state().buffer; }
+
+Buffer* swap_thread_buffer() { return Stream::get_stream().swap_buffer(get_thread_state().buffer); }
+
+}  // namespace detail
+
+bool enabled() { return Stream::get_stream().enabled(); }
+
+uint32_t intern(std::string_view string) {
+    auto& string_ids = get_thread_state().string_ids;
+    // Heterogeneous lookup isn't available for unordered_map yet, so the key is built once per call
+    std::string key(string);
+    auto id = string_ids.find(key);
+    if (id == string_ids.end()) {
+        id = string_ids.emplace(key, Stream::get_stream().intern(string)).first;
+    }
+    return id->second;
+}
+
+void flush() {
+    if (enabled()) {
+        Stream::get_stream().flush();
+    }
+}
+
+void export_chrome_trace(const std::string& events_file_name, const std::string& json_file_name) {
+    std::ifstream events_file(events_file_name, std::ios::binary);
+    TT_FATAL(events_file.is_open(), "Failed to open {}", events_file_name);
+    FileHeader header;
+    events_file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    TT_FATAL(events_file and header.magic == MAGIC, "{} isn't an op profiler event stream", events_file_name);
+    TT_FATAL(header.version == VERSION and header.event_size == sizeof(Event),
+        "{} has version {} with {} B events, expected version {} with {} B events",
+        events_file_name, header.version, header.event_size, VERSION, sizeof(Event));
+
+    std::vector<std::string> strings;
+    std::map<uint32_t, std::vector<Event>> thread_events;
+    SectionHeader section;
+    while (events_file.read(reinterpret_cast<char*>(&section), sizeof(section))) {
+        std::vector<char> payload(section.size);
+        events_file.read(payload.data(), payload.size());
+        TT_FATAL(events_file, "{} is truncated", events_file_name);
+        if (section.type == static_cast<uint32_t>(SectionType::STRINGS)) {
+            for (std::size_t offset = 0; offset < payload.size();) {
+                uint32_t length;
+                std::memcpy(&length, payload.data() + offset, sizeof(length));
+                offset += sizeof(length);
+                strings.emplace_back(payload.data() + offset, length);
+                offset += length;
+            }
+        } else if (section.type == static_cast<uint32_t>(SectionType::EVENTS)) {
+            auto& events = thread_events[section.thread_index];
+            const auto num_events = payload.size() / sizeof(Event);
+            const auto offset = events.size();
+            events.resize(offset + num_events);
+            std::memcpy(events.data() + offset, payload.data(), num_events * sizeof(Event));
+        }
+    }
+
+    uint64_t start_ns = std::numeric_limits<uint64_t>::max();
+    for (auto& [thread_index, events] : thread_events) {
+        std::stable_sort(events.begin(), events.end(), [](const Event& a, const Event& b) { return a.timestamp_ns < b.timestamp_ns; });
+        if (not events.empty()) {
+            start_ns = std::min(start_ns, events.front().timestamp_ns);
+        }
+    }
+
+    std::ofstream json_file(json_file_name);
+    TT_FATAL(json_file.is_open(), "Failed to open {}", json_file_name);
+    json_file << R"({"displayTimeUnit": "ns", "traceEvents": [)";
+    bool first_trace_event = true;
+    for (const auto& [thread_index, events] : thread_events) {
+        std::vector<OpenOp> open_ops;
+        for (const auto& event : events) {
+            switch (static_cast<EventType>(event.type)) {
+                case EventType::BEGIN: open_ops.push_back(OpenOp{.begin = &event}); break;
+                case EventType::END:
+                    if (not open_ops.empty()) {
+                        write_trace_event(json_file, first_trace_event, strings, thread_index, start_ns, open_ops.back(), event.timestamp_ns);
+                        open_ops.pop_back();
+                    }
+                    break;
+                case EventType::ARGUMENT:
+                    if (not open_ops.empty()) {
+                        open_ops.back().append_argument(event.name, strings.at(event.argument.value));
+                    }
+                    break;
+                case EventType::TENSOR:
+                    if (not open_ops.empty()) {
+                        std::string shape;
+                        for (uint32_t dim = 0; dim < event.rank; dim++) {
+                            shape += fmt::format("{}{}", dim == 0 ? "" : "_", event.tensor.shape[dim]);
+                        }
+                        open_ops.back().append_argument(
+                            event.name, fmt::format("{}|{}", shape, strings.at(event.tensor.descriptor)));
+                    }
+                    break;
+                default: break;
+            }
+        }
+        // Ops still running when the stream was flushed end at the last event of their thread
+        while (not open_ops.empty()) {
+            write_trace_event(json_file, first_trace_event, strings, thread_index, start_ns, open_ops.back(), events.back().timestamp_ns);
+            open_ops.pop_back();
+        }
+    }
+    json_file << "\n]}\n";
+}
+
+}  // namespace event_stream
+
+}  // namespace op_profiler
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: © 2023 Tenstorrent Inc.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+//
+// Binary stream of op profiler events, recorded in all builds when TT_METAL_OP_PROFILER_EVENTS=<file_path> is set.
+// Events are fixed size and refer to names and values through ids of interned strings. Each thread appends to its own
+// buffer, full buffers are written to the file by a background thread and the rest is written by flush() and at exit.
+// Ops run through run_operation are recorded in all builds, OpProfileScope scopes only in PROFILER builds.
+// export_chrome_trace() converts the file into the Chrome trace event JSON format, which Perfetto also loads.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace tt {
+
+namespace tt_metal {
+
+namespace op_profiler {
+
+namespace event_stream {
+
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t MAX_TENSOR_RANK = 8;
+
+enum class EventType : uint8_t {
+    // Starts an op, nested ops start and end before their parent ends
+    BEGIN = 0,
+    END = 1,
+    // Key and value of the innermost op running on the thread
+    ARGUMENT = 2,
+    // Input or output tensor of the innermost op, described by an interned string and its shape
+    TENSOR = 3,
+};
+
+struct Event {
+    uint64_t timestamp_ns;
+    uint8_t type;
+    uint8_t rank;
+    uint8_t reserved[2];
+    // BEGIN and END: op name, ARGUMENT and TENSOR: key
+    uint32_t name;
+    union {
+        struct {
+            uint64_t global_call_count;
+            uint32_t call_count;
+            uint32_t category;
+        } begin;
+        struct {
+            uint32_t value;
+        } argument;
+        struct {
+            uint32_t descriptor;
+            uint32_t shape[MAX_TENSOR_RANK];
+        } tensor;
+    };
+};
+static_assert(sizeof(Event) == 56);
+
+namespace detail {
+
+constexpr uint32_t EVENTS_PER_BUFFER = 4096;
+
+struct Buffer {
+    uint32_t thread_index = 0;
+    // Published with release so that flush() can write the events of a thread that's still running
+    std::atomic<uint32_t> num_events = 0;
+    // Events already written by flush()
+    uint32_t num_written = 0;
+    Event events[EVENTS_PER_BUFFER];
+};
+
+// Current buffer of the calling thread, null if the stream is disabled
+Buffer*& get_thread_buffer();
+
+// Hands the full buffer of the calling thread to the writer thread and returns a new one, null once the stream is closed
+Buffer* swap_thread_buffer();
+
+inline void append(const Event& event) {
+    auto& buffer = get_thread_buffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    auto num_events = buffer->num_events.load(std::memory_order_relaxed);
+    if (num_events == EVENTS_PER_BUFFER) {
+        buffer = swap_thread_buffer();
+        num_events = 0;
+        // The stream is closed once the process exits
+        if (buffer == nullptr) {
+            return;
+        }
+    }
+    buffer->events[num_events] = event;
+    buffer->num_events.store(num_events + 1, std::memory_order_release);
+}
+
+inline uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace detail
+
+bool enabled();
+
+// Id of the string, 0 is the empty string. Strings already interned by the calling thread don't take a lock.
+uint32_t intern(std::string_view string);
+
+inline void begin(uint32_t name, uint32_t category, uint64_t global_call_count, uint32_t call_count) {
+    Event event{.timestamp_ns = detail::now_ns(), .type = static_cast<uint8_t>(EventType::BEGIN), .name = name};
+    event.begin = {.global_call_count = global_call_count, .call_count = call_count, .category = category};
+    detail::append(event);
+}
+
+inline void end(uint32_t name) {
+    detail::append(Event{.timestamp_ns = detail::now_ns(), .type = static_cast<uint8_t>(EventType::END), .name = name});
+}
+
+inline void argument(uint32_t key, uint32_t value) {
+    Event event{.timestamp_ns = detail::now_ns(), .type = static_cast<uint8_t>(EventType::ARGUMENT), .name = key};
+    event.argument = {.value = value};
+    detail::append(event);
+}
+
+template <typename Shape>
+void tensor(uint32_t key, uint32_t descriptor, const Shape& shape) {
+    Event event{.timestamp_ns = detail::now_ns(), .type = static_cast<uint8_t>(EventType::TENSOR), .name = key};
+    event.rank = std::min<std::size_t>(shape.rank(), MAX_TENSOR_RANK);
+    event.tensor.descriptor = descriptor;
+    for (uint32_t dim = 0; dim < event.rank; dim++) {
+        event.tensor.shape[dim] = shape[dim];
+    }
+    detail::append(event);
+}
+
+// Writes every event recorded so far
+void flush();
+
+// Converts a file written by the stream into Chrome trace event JSON, with one complete event per op
+void export_chrome_trace(const std::string& events_file_name, const std::string& json_file_name);
+
+}  // namespace event_stream
+
+}  // namespace op_profiler
+
+}  // namespace tt_metal
+
+}  // namespace tt
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <filesystem>
 #include <type_traits>
 
@@ -12,6 +14,7 @@
 #include "tt_metal/detail/tt_metal.hpp"
 #include "tensor/tensor.hpp"
 #include "tools/profiler/profiler.hpp"
+#include "tools/profiler/event_stream.hpp"
 #include "tt_metal/detail/tt_metal.hpp"
 
 #include "tt_metal/third_party/tracy/public/tracy/Tracy.hpp"
@@ -98,6 +101,71 @@ namespace op_profiler {
 
         }
 
+        // Entries of the per-thread map of attribute ids, the map is cleared when full
+        constexpr size_t MAX_CACHED_ATTRIBUTES = 4096;
+
+        // Ids of the event stream cached by each thread, ops and tensors seen before don't build or intern any string
+        struct EventStreamState {
+            unordered_map<uint32_t, uint32_t> callCounts;
+            unordered_map<uint64_t, uint32_t> tensorDescriptors;
+            unordered_map<uint64_t, uint32_t> attributes;
+        };
+
+        inline EventStreamState& get_event_stream_state()
+        {
+            thread_local EventStreamState state;
+            return state;
+        }
+
+        inline std::atomic<uint64_t> eventStreamGlobalCallCount = 0;
+
+        static void stream_start(const string& opName, OpType opType)
+        {
+            static const auto categories = [] {
+                std::array<uint32_t, magic_enum::enum_count<OpType>()> ids;
+                for (size_t index = 0; index < ids.size(); index++)
+                {
+                    ids[index] = event_stream::intern(magic_enum::enum_name(magic_enum::enum_value<OpType>(index)));
+                }
+                return ids;
+            }();
+            auto name = event_stream::intern(opName);
+            auto callCount = ++get_event_stream_state().callCounts[name];
+            auto globalCallCount = eventStreamGlobalCallCount.fetch_add(1, std::memory_order_relaxed) + 1;
+            event_stream::begin(name, categories[magic_enum::enum_index(opType).value()], globalCallCount, callCount);
+        }
+
+        static void stream_argument(const string& key, const string& value)
+        {
+            event_stream::argument(event_stream::intern(key), event_stream::intern(value));
+        }
+
+        // Everything but the shape of tensor_to_str, the exporter joins the two
+        static uint32_t tensor_descriptor(const Tensor& tensor)
+        {
+            uint64_t key = static_cast<uint64_t>(tensor.storage_type()) | static_cast<uint64_t>(tensor.layout()) << 8 |
+                           static_cast<uint64_t>(tensor.dtype()) << 16;
+            if (tensor.storage_type() == StorageType::DEVICE)
+            {
+                key |= static_cast<uint64_t>(tensor.memory_config().buffer_type) << 24 |
+                       static_cast<uint64_t>(tensor.memory_config().memory_layout) << 32 |
+                       static_cast<uint64_t>(tensor.device()->id()) << 40;
+            }
+            auto& descriptors = get_event_stream_state().tensorDescriptors;
+            auto descriptor = descriptors.find(key);
+            if (descriptor == descriptors.end())
+            {
+                auto tensorStr = tensor_to_str(tensor);
+                descriptor = descriptors.emplace(key, event_stream::intern(tensorStr.substr(tensorStr.find('|') + 1))).first;
+            }
+            return descriptor->second;
+        }
+
+        static void stream_tensor(const string& key, const Tensor& tensor)
+        {
+            event_stream::tensor(event_stream::intern(key), tensor_descriptor(tensor), tensor.shape());
+        }
+
         struct OpData {
             string name;
             Profiler profiler = Profiler();
@@ -359,6 +427,11 @@ namespace op_profiler {
 
     static void start_profiling (const string& opName, OpType opType)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_start(opName, opType);
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.start_profiling(opName, opType);
 #endif
@@ -366,6 +439,11 @@ namespace op_profiler {
 
     static void stop_profiling (const string& opName)
     {
+        if (event_stream::enabled())
+        {
+            event_stream::end(event_stream::intern(opName));
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.stop_profiling(opName);
 #endif
@@ -415,11 +493,16 @@ namespace op_profiler {
 
     static bool get_profiler_flag ()
     {
-        return getHostProfilerState();
+        return getHostProfilerState() or event_stream::enabled();
     }
 
     static void append_input_data (const Tensor& input)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_tensor("Inputs", input);
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.append_input_data(detail::tensor_to_str(input));
 #endif
@@ -427,6 +510,17 @@ namespace op_profiler {
 
     static void append_input_optional_data (std::optional<const Tensor> input)
     {
+        if (event_stream::enabled())
+        {
+            if (input.has_value()) {
+                detail::stream_tensor("Inputs", input.value());
+            }
+            else
+            {
+                detail::stream_argument("Inputs", "");
+            }
+            return;
+        }
 #if defined(PROFILER)
         if (input.has_value()) {
             detail::operationProfiler.append_input_data(detail::tensor_to_str(input.value()));
@@ -440,6 +534,11 @@ namespace op_profiler {
 
     static void append_output_data (const Tensor& output)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_tensor("Outputs", output);
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.append_output_data(detail::tensor_to_str(output));
 #endif
@@ -450,7 +549,12 @@ namespace op_profiler {
         const std::vector<std::optional<const Tensor>> &optional_input_tensors,
         const std::vector<Tensor> &output_tensors)
     {
-#if defined(PROFILER)
+#if !defined(PROFILER)
+        if (not event_stream::enabled())
+        {
+            return;
+        }
+#endif
             for (auto& input : input_tensors)
             {
                 append_input_data(input);
@@ -465,19 +569,55 @@ namespace op_profiler {
             {
                 append_output_data(output);
             }
-#endif
     }
 
     static void append_meta_data (const string& metaData)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_argument("Meta Data", metaData);
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.append_meta_data(metaData);
 #endif
     }
 
+    // Meta data of the attributes of an operation, in the event stream they are only formatted the first time their
+    // hash is seen by the thread
+    template <typename Operation, typename InputTensors, typename OptionalInputTensors>
+    static void append_attributes (const Operation& operation, const InputTensors& input_tensors, const OptionalInputTensors& optional_input_tensors)
+    {
+        if (event_stream::enabled())
+        {
+            static const auto key = event_stream::intern("Meta Data");
+            auto& attributes = detail::get_event_stream_state().attributes;
+            auto hash = operation.attributes_hash(input_tensors, optional_input_tensors);
+            auto value = attributes.find(hash);
+            if (value == attributes.end())
+            {
+                if (attributes.size() >= detail::MAX_CACHED_ATTRIBUTES)
+                {
+                    attributes.clear();
+                }
+                value = attributes.emplace(hash, event_stream::intern(fmt::format("{}", operation.attributes()))).first;
+            }
+            event_stream::argument(key, value->second);
+            return;
+        }
+#if defined(PROFILER)
+        detail::operationProfiler.append_meta_data(fmt::format("{}", operation.attributes()));
+#endif
+    }
+
     template < typename T, typename std::enable_if< std::is_enum<T>::value,bool>::type = true>
     static void set_preferred_name (const T& name)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_argument("Preferred Name", fmt::format("{}",magic_enum::enum_name(name)));
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.set_preferred_name(fmt::format("{}",magic_enum::enum_name(name)));
 #endif
@@ -486,6 +626,11 @@ namespace op_profiler {
     template < typename T, typename std::enable_if< !std::is_enum<T>::value,bool>::type = true>
     static void set_preferred_name (const T& name)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_argument("Preferred Name", fmt::format("{}",name));
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.set_preferred_name(fmt::format("{}",name));
 #endif
@@ -494,6 +639,11 @@ namespace op_profiler {
     template < typename T, typename std::enable_if< std::is_enum<T>::value,bool>::type = true>
     static void set_parallelization_strategy (const T& strategy)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_argument("Parallelization Strategy", fmt::format("{}",magic_enum::enum_name(strategy)));
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.set_parallelization_strategy(fmt::format("{}",magic_enum::enum_name(strategy)));
 #endif
@@ -502,6 +652,11 @@ namespace op_profiler {
     template < typename T, typename std::enable_if< !std::is_enum<T>::value,bool>::type = true>
     static void set_parallelization_strategy (const T& strategy)
     {
+        if (event_stream::enabled())
+        {
+            detail::stream_argument("Parallelization Strategy", fmt::format("{}",strategy));
+            return;
+        }
 #if defined(PROFILER)
         detail::operationProfiler.set_parallelization_strategy(fmt::format("{}",strategy));
 #endif
@@ -509,16 +664,30 @@ namespace op_profiler {
 
     static void append_math_fidelities (const Program& program)
     {
-#if defined(PROFILER)
+        bool streamEnabled = event_stream::enabled();
+#if !defined(PROFILER)
+        if (not streamEnabled)
+        {
+            return;
+        }
+#endif
         for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
             Kernel * kernel = tt::tt_metal::detail::GetKernel(program, kernel_id);
             if (kernel->processor() == RISCV::COMPUTE) {
                 ComputeKernel * compute_kernel = static_cast<ComputeKernel*>(kernel);
                 MathFidelity math_fidelity = std::get<ComputeConfig>(compute_kernel->config()).math_fidelity;
-                detail::operationProfiler.append_math_fidelity(fmt::format("{}", magic_enum::enum_name(math_fidelity)));
+                if (streamEnabled)
+                {
+                    detail::stream_argument("Math Fidelity", string(magic_enum::enum_name(math_fidelity)));
+                }
+#if defined(PROFILER)
+                else
+                {
+                    detail::operationProfiler.append_math_fidelity(fmt::format("{}", magic_enum::enum_name(math_fidelity)));
+                }
+#endif
             }
         }
-#endif
     }
 
     static void set_profiler_location (const string& profilerLocation)
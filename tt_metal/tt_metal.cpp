@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <mutex>
+#include <thread>
 #include <unordered_set>
 #include <string>
 
@@ -512,12 +513,21 @@ namespace detail {
         };
 
         for (size_t kernel_id = 0; kernel_id < program.num_kernels(); kernel_id++) {
-            const auto kernel = detail::GetKernel(program, kernel_id);
+            const Kernel *kernel = detail::GetKernel(program, kernel_id);
             auto processor = kernel->processor();
             for (const auto &logical_core : kernel->cores_with_runtime_args()) {
                 auto physical_core = device->physical_core_from_logical_core(logical_core, kernel->get_kernel_core_type());
                 const auto & rt_args = kernel->runtime_args(logical_core);
-                tt::llrt::write_hex_vec_to_core(device_id, physical_core, rt_args, get_l1_arg_base_addr(processor));
+                tt::Cluster::instance().write_core(
+                    rt_args.data(), rt_args.size() * sizeof(uint32_t), tt_cxy_pair(device_id, physical_core), get_l1_arg_base_addr(processor));
+            }
+            const auto & common_rt_args = kernel->common_runtime_args();
+            if (not common_rt_args.empty()) {
+                for (const auto &logical_core : kernel->logical_cores()) {
+                    auto physical_core = device->physical_core_from_logical_core(logical_core, kernel->get_kernel_core_type());
+                    tt::Cluster::instance().write_core(
+                        common_rt_args.data(), common_rt_args.size() * sizeof(uint32_t), tt_cxy_pair(device_id, physical_core), kernel->common_runtime_args_base());
+                }
             }
         }
     }
@@ -526,6 +536,63 @@ namespace detail {
         ZoneScoped;
         program.compile(device);
     }
+
+    std::map<chip_id_t, Device *> CreateDevices(
+        const std::vector<chip_id_t> &device_ids, const uint8_t num_hw_cqs, const std::vector<uint32_t> &l1_bank_remap) {
+        ZoneScoped;
+        // Remote devices take their issue and completion queue cores from their MMIO device, which picks them while
+        // it initializes. Opening them afterwards keeps the assignment the same as opening devices one at a time
+        std::vector<chip_id_t> mmio_device_ids;
+        std::vector<chip_id_t> remote_device_ids;
+        for (chip_id_t device_id : device_ids) {
+            if (tt::Cluster::instance().get_associated_mmio_device(device_id) == device_id) {
+                mmio_device_ids.push_back(device_id);
+            } else {
+                remote_device_ids.push_back(device_id);
+            }
+        }
+
+        std::map<chip_id_t, Device *> devices;
+        std::mutex devices_mutex;
+        std::exception_ptr error;
+        // Initialization blocks on compiles run by the executor, so it gets its own threads like jit_build_set
+        auto create_devices = [&](const std::vector<chip_id_t> &ids) {
+            std::vector<std::thread> threads;
+            for (chip_id_t device_id : ids) {
+                threads.emplace_back([&, device_id] {
+                    try {
+                        Device *device = new Device(device_id, num_hw_cqs, l1_bank_remap);
+                        std::lock_guard<std::mutex> lock(devices_mutex);
+                        devices[device_id] = device;
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(devices_mutex);
+                        if (error == nullptr) {
+                            error = std::current_exception();
+                        }
+                    }
+                });
+            }
+            for (auto &thread : threads) {
+                thread.join();
+            }
+        };
+        create_devices(mmio_device_ids);
+        if (error == nullptr) {
+            create_devices(remote_device_ids);
+        }
+
+        if (error != nullptr) {
+            CloseDevices(devices);
+            std::rethrow_exception(error);
+        }
+        return devices;
+    }
+
+    void CloseDevices(const std::map<chip_id_t, Device *> &devices) {
+        for (const auto &[device_id, device] : devices) {
+            CloseDevice(device);
+        }
+    }
 }   // namespace detail
 
 size_t GetNumAvailableDevices() {
@@ -689,10 +756,23 @@ void SetRuntimeArgs(const Program &program, KernelHandle kernel, const std::vect
         k->set_runtime_args(core_spec[i], runtime_args[i]);
 }
 
-std::vector<uint32_t> & GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core) {
+void SetRuntimeArgs(const Program &program, KernelHandle kernel, const CoreCoord &logical_core, const RuntimeArgsData &runtime_args) {
+    detail::GetKernel(program, kernel)->set_runtime_args(logical_core, runtime_args);
+}
+
+void SetCommonRuntimeArgs(const Program &program, KernelHandle kernel_id, const std::vector<uint32_t> &runtime_args) {
+    ZoneScoped;
+    detail::GetKernel(program, kernel_id)->set_common_runtime_args(runtime_args);
+}
+
+RuntimeArgsData & GetRuntimeArgs(const Program &program, KernelHandle kernel_id, const CoreCoord &logical_core) {
     return detail::GetKernel(program, kernel_id)->runtime_args(logical_core);
 }
 
+RuntimeArgsData & GetCommonRuntimeArgs(const Program &program, KernelHandle kernel_id) {
+    return detail::GetKernel(program, kernel_id)->common_runtime_args();
+}
+
 }  // namespace tt_metal
 
 }  // namespace tt